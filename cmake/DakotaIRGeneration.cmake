@@ -25,6 +25,7 @@ list(APPEND DAKOTA_INCDIRS "${Dakota_SOURCE_DIR}/src/generated_ir_tables")
 set(dakota_ir_generated_files
   "${DAKOTA_IR_GENERATED_DIR}/generated_ir_environment.cpp"
   "${DAKOTA_IR_GENERATED_DIR}/generated_ir_interface.cpp"
+  "${DAKOTA_IR_GENERATED_DIR}/generated_ir_keys.hpp"
   "${DAKOTA_IR_GENERATED_DIR}/generated_ir_method.cpp"
   "${DAKOTA_IR_GENERATED_DIR}/generated_ir_model.cpp"
   "${DAKOTA_IR_GENERATED_DIR}/generated_ir_registry.cpp"
@@ -9,6 +9,7 @@
 #include <map>
 #include <set>
 #include <memory>
+#include <utility>
 #include <fstream>
 #include <iostream>
 #include <cmath>
@@ -166,7 +167,10 @@ inline json values_to_json(const std::vector<Value>& values, bool force_float =
     if (values.empty()) return nullptr;
     if (values.size() == 1) return value_to_json(values[0], force_float);
     
+    // Bulk lists (bounds, labels, histogram pairs) can hold 10^5 entries;
+    // size the array once instead of growing it per element
     json array = json::array();
+    array.get_ref<json::array_t&>().reserve(values.size());
     for (const auto& val : values) {
         array.push_back(value_to_json(val, force_float));
     }
@@ -308,8 +312,8 @@ inline json convert_keyword(const KeywordNode& kw, const std::string& parent_def
         // If this field should be an array but values_to_json unwrapped a single value, re-wrap it
         if (is_array && !vals.is_array()) {
             json arr = json::array();
-            arr.push_back(vals);
-            vals = arr;
+            arr.push_back(std::move(vals));
+            vals = std::move(arr);
         }
         
         // If there's an argument field, wrap the value
@@ -318,13 +322,13 @@ inline json convert_keyword(const KeywordNode& kw, const std::string& parent_def
             // Check whether THIS keyword's argument target is an array type.
             // This is unambiguous per-keyword (no field-name-level ambiguity).
             if (!ast_metadata::has_array_argument(kw_name) && !vals.is_array()) {
-                result[arg_field] = vals;
+                result[arg_field] = std::move(vals);
             } else if (vals.is_array()) {
-                result[arg_field] = vals;
+                result[arg_field] = std::move(vals);
             } else {
                 json arr = json::array();
-                arr.push_back(vals);
-                result[arg_field] = arr;
+                arr.push_back(std::move(vals));
+                result[arg_field] = std::move(arr);
             }
             return result;
         }
@@ -340,10 +344,11 @@ inline json convert_keyword(const KeywordNode& kw, const std::string& parent_def
             result[arg_field] = value_to_json(kw.param_values[0], is_number);
         } else {
             json arr = json::array();
+            arr.get_ref<json::array_t&>().reserve(kw.param_values.size());
             for (const auto& val : kw.param_values) {
                 arr.push_back(value_to_json(val, is_number));
             }
-            result[arg_field] = arr;
+            result[arg_field] = std::move(arr);
         }
     } else if (!kw.param_values.empty()) {
         // Don't output _value for boolean discriminator flags (e.g., "annotated")
@@ -398,8 +403,8 @@ inline json convert_keyword(const KeywordNode& kw, const std::string& parent_def
                 if (!anchor_contents.count(anchor)) {
                     anchor_contents[anchor] = json::object();
                 }
-                json child_json = convert_keyword(*child, child_config.source_def, kw_name);
-                anchor_contents[anchor][child_effective] = child_json;
+                anchor_contents[anchor][child_effective] =
+                    convert_keyword(*child, child_config.source_def, kw_name);
             } else {
                 // Boolean check: only suppress via direct context_def, not fallback
                 bool child_is_boolean = ast_metadata::is_boolean_field(child_effective);
@@ -413,15 +418,15 @@ inline json convert_keyword(const KeywordNode& kw, const std::string& parent_def
                     continue;
                 }
                 
-                json child_json = convert_keyword(*child, child_config.source_def, kw_name);
-                result[child_effective] = child_json;
+                result[child_effective] =
+                    convert_keyword(*child, child_config.source_def, kw_name);
             }
         }
     }
     
-    // Add anchor contents to result
-    for (const auto& [anchor_name, anchor_content] : anchor_contents) {
-        result[anchor_name] = anchor_content;
+    // Add anchor contents to result (moved: subtrees may hold bulk arrays)
+    for (auto& [anchor_name, anchor_content] : anchor_contents) {
+        result[anchor_name] = std::move(anchor_content);
     }
     
     return result;
@@ -454,16 +459,16 @@ inline json block_to_json(const Block& block) {
                 if (!anchor_contents.count(anchor)) {
                     anchor_contents[anchor] = json::object();
                 }
-                anchor_contents[anchor][effective_name] = kw_json;
+                anchor_contents[anchor][effective_name] = std::move(kw_json);
             } else {
-                result[effective_name] = kw_json;
+                result[effective_name] = std::move(kw_json);
             }
         }
     }
     
-    // Add anchor contents to result
-    for (const auto& [anchor_name, anchor_content] : anchor_contents) {
-        result[anchor_name] = anchor_content;
+    // Add anchor contents to result (moved: subtrees may hold bulk arrays)
+    for (auto& [anchor_name, anchor_content] : anchor_contents) {
+        result[anchor_name] = std::move(anchor_content);
     }
     
     return result;
@@ -488,17 +493,17 @@ inline json ast_to_json(const Document& doc) {
             for (const auto* block : block_list) {
                 json block_obj = block_to_json(*block);
                 if (!block_obj.empty()) {
-                    array.push_back(block_obj);
+                    array.push_back(std::move(block_obj));
                 }
             }
             if (!array.empty()) {
-                result[block_name] = array;
+                result[block_name] = std::move(array);
             }
         } else {
             if (!block_list.empty()) {
                 json block_obj = block_to_json(*block_list[0]);
                 if (!block_obj.empty()) {
-                    result[block_name] = block_obj;
+                    result[block_name] = std::move(block_obj);
                 }
             }
         }
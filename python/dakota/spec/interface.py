@@ -190,6 +190,19 @@ class SystemWorkDirectory(DakotaBaseModel):
             ]
         },
     )
+    recycle: Literal[True] | None = DakotaField(
+        default=None,
+        description="Reuse work directories across evaluations",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "interface.dirRecycle",
+                    "storage_type": "PRESENCE_TRUE",
+                    "ir_value_type": "bool",
+                }
+            ]
+        },
+    )
 
 
 class ForkParametersFormatStandard(DakotaBaseModel):
@@ -369,6 +382,19 @@ class ForkWorkDirectory(DakotaBaseModel):
             ]
         },
     )
+    recycle: Literal[True] | None = DakotaField(
+        default=None,
+        description="Reuse work directories across evaluations",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "interface.dirRecycle",
+                    "storage_type": "PRESENCE_TRUE",
+                    "ir_value_type": "bool",
+                }
+            ]
+        },
+    )
 
 
 class DirectConfig(DakotaBaseModel):
@@ -443,6 +469,20 @@ class PythonConfig(DakotaBaseModel):
         },
     )
 
+    columnar: Literal[True] | None = DakotaField(
+        default=None,
+        description="Exchange batch evaluations with Python as one dictionary of numpy arrays",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "interface.python.columnar",
+                    "storage_type": "PRESENCE_TRUE",
+                    "ir_value_type": "bool",
+                }
+            ]
+        },
+    )
+
 
 class Scilab(DakotaBaseModel):
     "Run Scilab through a direct interface - requires special Dakota build"
@@ -1210,6 +1250,19 @@ class ForkConfig(DakotaBaseModel):
             ]
         },
     )
+    persistent: Literal[True] | None = DakotaField(
+        default=None,
+        description="Launch long-lived analysis drivers that exchange evaluations with Dakota over sockets",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "interface.application.persistent",
+                    "storage_type": "PRESENCE_TRUE",
+                    "ir_value_type": "bool",
+                }
+            ]
+        },
+    )
 
 
 class Asynchronous(DakotaBaseModel):
@@ -1377,6 +1430,20 @@ class InterfaceConfig(DakotaBaseModel):
         default=None,
         description="Deactivate Dakota interface features for simplicity or efficiency",
     )
+    cache_memory_limit: DakotaFloat | None = DakotaField(
+        default=None,
+        gt=0,
+        description="Limit the memory used by the function evaluation cache",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "interface.cache_memory_limit",
+                    "storage_type": "DIRECT_VALUE",
+                    "ir_value_type": "Real",
+                }
+            ]
+        },
+    )
     concurrency: Union[Batch, Asynchronous] | None = DakotaField(
         default=None,
         description="Concurrency Strategy",
@@ -1403,6 +1470,20 @@ class InterfaceConfig(DakotaBaseModel):
         description="Specify the scheduling of concurrent evaluations when Dakota is run in parallel",
         dakota={"union_pattern": 2},
     )
+    evaluation_prefetch: int | None = DakotaField(
+        default=None,
+        gt=0,
+        description="Number of evaluations sent to a synchronous server per message by a dedicated scheduler",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "interface.evaluation_prefetch",
+                    "storage_type": "DIRECT_VALUE",
+                    "ir_value_type": "int",
+                }
+            ]
+        },
+    )
     processors_per_evaluation: int | None = DakotaField(
         default=None,
         gt=0,
@@ -1192,6 +1192,19 @@ class ModelEvidence(DakotaBaseModel):
             ]
         },
     )
+    is_approx: Literal[True] | None = DakotaField(
+        default=None,
+        description="Calculate model evidence by importance sampling with a proposal fit to the posterior chain",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "method.is_approx",
+                    "storage_type": "PRESENCE_TRUE",
+                    "ir_value_type": "bool",
+                }
+            ]
+        },
+    )
 
 
 class DiscrepancyTypeGPConfig(DakotaBaseModel):
@@ -356,6 +356,20 @@ class MppSearch(MethodGradientSubProblemSolverMixin):
     integration: Integration | None = DakotaField(
         default=None, description="Integration approach"
     )
+    concurrent_mpp_searches: int | None = DakotaField(
+        default=None,
+        gt=0,
+        description="Maximum number of MPP searches over response levels performed concurrently",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "method.nond.concurrent_mpp_searches",
+                    "storage_type": "DIRECT_VALUE",
+                    "ir_value_type": "size_t",
+                }
+            ]
+        },
+    )
 
 
 class LocalReliabilityConfig(
@@ -269,6 +269,25 @@ class SamplingTolIntervals(DakotaBaseModel):
     )
 
 
+class SamplingColumnarStatistics(DakotaBaseModel):
+    "Accumulate statistics from columnar sample storage in place of retained responses"
+
+    quantile_sketch: int | None = DakotaField(
+        default=None,
+        gt=0,
+        description="Summarize samples with fixed-size quantile sketches rather than storing them",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "method.quantile_sketch",
+                    "storage_type": "DIRECT_VALUE",
+                    "ir_value_type": "size_t",
+                }
+            ]
+        },
+    )
+
+
 class LowDiscrepancyConfig(DakotaBaseModel):
     "Uses low-discrepancy points to sample variables"
 
@@ -451,6 +470,19 @@ class SamplingConfig(
             ]
         },
     )
+    columnar_statistics: SamplingColumnarStatistics | None = DakotaField(
+        default=None,
+        description="Accumulate statistics from columnar sample storage in place of retained responses",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "method.columnar_statistics",
+                    "storage_type": "PRESENCE_TRUE",
+                    "ir_value_type": "bool",
+                }
+            ]
+        },
+    )
 
 
 class SamplingSelection(MethodSelection):
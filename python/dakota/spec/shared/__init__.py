@@ -209,6 +209,9 @@ from .core import (
     LevelMappings,
     NumericalGradientOptionsIntervalTypeCentral,
     NumericalGradientOptionsIntervalTypeForward,
+    NumericalGradientOptionsJacobianSparsityDetect,
+    NumericalGradientOptionsJacobianSparsityNonzeroFunctions,
+    NumericalGradientOptionsJacobianSparsityNonzeroFunctionsConfig,
     NumericalGradientOptionsMethodSourceDakota,
     NumericalGradientOptionsMethodSourceDakotaAbsolute,
     NumericalGradientOptionsMethodSourceDakotaBounds,
@@ -748,6 +751,9 @@ from .responses import (
     MixedGradientsConfig,
     MixedGradientsIntervalTypeCentral,
     MixedGradientsIntervalTypeForward,
+    MixedGradientsJacobianSparsityDetect,
+    MixedGradientsJacobianSparsityNonzeroFunctions,
+    MixedGradientsJacobianSparsityNonzeroFunctionsConfig,
     MixedGradientsMethodSourceDakota,
     MixedGradientsMethodSourceDakotaAbsolute,
     MixedGradientsMethodSourceDakotaBounds,
@@ -760,6 +766,9 @@ from .responses import (
     NumericalGradientsConfig,
     NumericalGradientsIntervalTypeCentral,
     NumericalGradientsIntervalTypeForward,
+    NumericalGradientsJacobianSparsityDetect,
+    NumericalGradientsJacobianSparsityNonzeroFunctions,
+    NumericalGradientsJacobianSparsityNonzeroFunctionsConfig,
     NumericalGradientsMethodSourceDakota,
     NumericalGradientsMethodSourceDakotaAbsolute,
     NumericalGradientsMethodSourceDakotaBounds,
@@ -2250,6 +2259,9 @@ __all__ = [
     "ModelVarianceExportMixin",
     "NumericalGradientOptionsIntervalTypeCentral",
     "NumericalGradientOptionsIntervalTypeForward",
+    "NumericalGradientOptionsJacobianSparsityDetect",
+    "NumericalGradientOptionsJacobianSparsityNonzeroFunctions",
+    "NumericalGradientOptionsJacobianSparsityNonzeroFunctionsConfig",
     "NumericalGradientOptionsMethodSourceDakota",
     "NumericalGradientOptionsMethodSourceDakotaAbsolute",
     "NumericalGradientOptionsMethodSourceDakotaBounds",
@@ -2402,6 +2414,9 @@ __all__ = [
     "MixedGradientsConfig",
     "MixedGradientsIntervalTypeCentral",
     "MixedGradientsIntervalTypeForward",
+    "MixedGradientsJacobianSparsityDetect",
+    "MixedGradientsJacobianSparsityNonzeroFunctions",
+    "MixedGradientsJacobianSparsityNonzeroFunctionsConfig",
     "MixedGradientsMethodSourceDakota",
     "MixedGradientsMethodSourceDakotaAbsolute",
     "MixedGradientsMethodSourceDakotaBounds",
@@ -2414,6 +2429,9 @@ __all__ = [
     "NumericalGradientsConfig",
     "NumericalGradientsIntervalTypeCentral",
     "NumericalGradientsIntervalTypeForward",
+    "NumericalGradientsJacobianSparsityDetect",
+    "NumericalGradientsJacobianSparsityNonzeroFunctions",
+    "NumericalGradientsJacobianSparsityNonzeroFunctionsConfig",
     "NumericalGradientsMethodSourceDakota",
     "NumericalGradientsMethodSourceDakotaAbsolute",
     "NumericalGradientsMethodSourceDakotaBounds",
@@ -728,6 +728,63 @@ class MethodMfExpConvergenceToleranceMixin(
     pass
 
 
+class NumericalGradientOptionsJacobianSparsityNonzeroFunctionsConfig(DakotaBaseModel):
+    "Response function ids of the nonzero Jacobian entries"
+
+    values: list[int] = DakotaField(
+        description="Response function ids of the nonzero Jacobian entries",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "responses.jacobian_sparsity.nonzero_functions",
+                    "storage_type": "DIRECT_VALUE",
+                    "ir_value_type": "IntVector",
+                }
+            ]
+        },
+    )
+    nonzero_variables: list[int] = DakotaField(
+        description="Continuous variable ids of the nonzero Jacobian entries",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "responses.jacobian_sparsity.nonzero_variables",
+                    "storage_type": "DIRECT_VALUE",
+                    "ir_value_type": "IntVector",
+                }
+            ]
+        },
+    )
+
+
+class NumericalGradientOptionsJacobianSparsityNonzeroFunctions(DakotaBaseModel):
+    "Response function ids of the nonzero Jacobian entries"
+
+    nonzero_functions: NumericalGradientOptionsJacobianSparsityNonzeroFunctionsConfig = DakotaField(
+        default=...,
+        description="Response function ids of the nonzero Jacobian entries",
+        dakota={"argument": "values"},
+    )
+
+
+class NumericalGradientOptionsJacobianSparsityDetect(DakotaBaseModel):
+    "Detect the sparsity pattern from the first dense finite difference gradient"
+
+    detect: Literal[True] = DakotaField(
+        default=True,
+        description="Detect the sparsity pattern from the first dense finite difference gradient",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "responses.jacobian_sparsity.detect",
+                    "storage_type": "PRESENCE_TRUE",
+                    "ir_value_type": "bool",
+                }
+            ]
+        },
+    )
+
+
 class NumericalGradientOptionsMixin(DakotaBaseModel):
     "Generated model for NumericalGradientOptionsMixin"
 
@@ -767,6 +824,14 @@ class NumericalGradientOptionsMixin(DakotaBaseModel):
             ],
         },
     )
+    jacobian_sparsity: Union[
+        NumericalGradientOptionsJacobianSparsityNonzeroFunctions,
+        NumericalGradientOptionsJacobianSparsityDetect,
+    ] | None = DakotaField(
+        default=None,
+        description="Group finite difference gradient evaluations by the sparsity pattern of the Jacobian",
+        dakota={"union_pattern": 2},
+    )
 
 
 class ResponseLevelsComputeProbRelGenMixin(DakotaBaseModel):
@@ -1194,6 +1194,120 @@ class ResponseScalarDataFormatMixin(DakotaBaseModel):
     )
 
 
+class MixedGradientsJacobianSparsityNonzeroFunctionsConfig(DakotaBaseModel):
+    "Response function ids of the nonzero Jacobian entries"
+
+    values: list[int] = DakotaField(
+        description="Response function ids of the nonzero Jacobian entries",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "responses.jacobian_sparsity.nonzero_functions",
+                    "storage_type": "DIRECT_VALUE",
+                    "ir_value_type": "IntVector",
+                }
+            ]
+        },
+    )
+    nonzero_variables: list[int] = DakotaField(
+        description="Continuous variable ids of the nonzero Jacobian entries",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "responses.jacobian_sparsity.nonzero_variables",
+                    "storage_type": "DIRECT_VALUE",
+                    "ir_value_type": "IntVector",
+                }
+            ]
+        },
+    )
+
+
+class MixedGradientsJacobianSparsityNonzeroFunctions(DakotaBaseModel):
+    "Response function ids of the nonzero Jacobian entries"
+
+    nonzero_functions: MixedGradientsJacobianSparsityNonzeroFunctionsConfig = DakotaField(
+        default=...,
+        description="Response function ids of the nonzero Jacobian entries",
+        dakota={"argument": "values"},
+    )
+
+
+class MixedGradientsJacobianSparsityDetect(DakotaBaseModel):
+    "Detect the sparsity pattern from the first dense finite difference gradient"
+
+    detect: Literal[True] = DakotaField(
+        default=True,
+        description="Detect the sparsity pattern from the first dense finite difference gradient",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "responses.jacobian_sparsity.detect",
+                    "storage_type": "PRESENCE_TRUE",
+                    "ir_value_type": "bool",
+                }
+            ]
+        },
+    )
+
+
+class NumericalGradientsJacobianSparsityNonzeroFunctionsConfig(DakotaBaseModel):
+    "Response function ids of the nonzero Jacobian entries"
+
+    values: list[int] = DakotaField(
+        description="Response function ids of the nonzero Jacobian entries",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "responses.jacobian_sparsity.nonzero_functions",
+                    "storage_type": "DIRECT_VALUE",
+                    "ir_value_type": "IntVector",
+                }
+            ]
+        },
+    )
+    nonzero_variables: list[int] = DakotaField(
+        description="Continuous variable ids of the nonzero Jacobian entries",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "responses.jacobian_sparsity.nonzero_variables",
+                    "storage_type": "DIRECT_VALUE",
+                    "ir_value_type": "IntVector",
+                }
+            ]
+        },
+    )
+
+
+class NumericalGradientsJacobianSparsityNonzeroFunctions(DakotaBaseModel):
+    "Response function ids of the nonzero Jacobian entries"
+
+    nonzero_functions: NumericalGradientsJacobianSparsityNonzeroFunctionsConfig = DakotaField(
+        default=...,
+        description="Response function ids of the nonzero Jacobian entries",
+        dakota={"argument": "values"},
+    )
+
+
+class NumericalGradientsJacobianSparsityDetect(DakotaBaseModel):
+    "Detect the sparsity pattern from the first dense finite difference gradient"
+
+    detect: Literal[True] = DakotaField(
+        default=True,
+        description="Detect the sparsity pattern from the first dense finite difference gradient",
+        dakota={
+            "materialization": [
+                {
+                    "ir_key": "responses.jacobian_sparsity.detect",
+                    "storage_type": "PRESENCE_TRUE",
+                    "ir_value_type": "bool",
+                }
+            ]
+        },
+    )
+
+
 class MixedGradientsConfig(DakotaBaseModel):
     "Gradients are needed and will be obtained from a mix of numerical and analytic sources"
 
@@ -1255,6 +1369,13 @@ class MixedGradientsConfig(DakotaBaseModel):
             ],
         },
     )
+    jacobian_sparsity: Union[
+        MixedGradientsJacobianSparsityNonzeroFunctions, MixedGradientsJacobianSparsityDetect
+    ] | None = DakotaField(
+        default=None,
+        description="Group finite difference gradient evaluations by the sparsity pattern of the Jacobian",
+        dakota={"union_pattern": 2},
+    )
 
 
 class NumericalGradientsConfig(DakotaBaseModel):
@@ -1294,6 +1415,13 @@ class NumericalGradientsConfig(DakotaBaseModel):
             ],
         },
     )
+    jacobian_sparsity: Union[
+        NumericalGradientsJacobianSparsityNonzeroFunctions, NumericalGradientsJacobianSparsityDetect
+    ] | None = DakotaField(
+        default=None,
+        description="Group finite difference gradient evaluations by the sparsity pattern of the Jacobian",
+        dakota={"union_pattern": 2},
+    )
 
 
 class MixedHessiansConfig(DakotaBaseModel):
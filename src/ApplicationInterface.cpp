@@ -11,6 +11,7 @@
 #include "ApplicationInterface.hpp"
 //#include "ParamResponsePair.hpp"
 #include "ProblemDescDB.hpp"
+#include "WorkdirHelper.hpp"
 #include <thread>
 
 //#define DEBUG
@@ -50,6 +51,7 @@ ApplicationInterface(const ProblemDescDB& problem_db, ParallelLibrary& parallel_
   lenPRPairMessage(0),
   evalScheduling(problem_db.get_short("interface.evaluation_scheduling")),
   analysisScheduling(problem_db.get_short("interface.analysis_scheduling")),
+  evalPrefetch(problem_db.get_int("interface.evaluation_prefetch")),
   asynchLocalEvalStatic(
     problem_db.get_short("interface.local_evaluation_scheduling") ==
     STATIC_SCHEDULING),
@@ -80,6 +82,12 @@ ApplicationInterface(const ProblemDescDB& problem_db, ParallelLibrary& parallel_
 	 << "ApplicationInterface.\n" << std::endl;
     abort_handler(-1);
   }
+
+  // bound the memory of the evaluation cache, spilling to the working dir
+  Real cache_mem_limit = problem_db.get_real("interface.cache_memory_limit");
+  if (evalCacheFlag && cache_mem_limit > 0.)
+    boundedCache.initialize((size_t)(cache_mem_limit * 1048576.),
+      WorkdirHelper::unique_path("dakota_cache_%%%%%%%%.spill").string());
 }
 
 
@@ -505,7 +513,7 @@ void ApplicationInterface::map(const Variables& vars, const ActiveSet& set,
 	  // manage shallow/deep copy of vars/response with evalCacheFlag
 	  ParamResponsePair prp(vars, interfaceId, core_resp, currEvalId,
 				evalCacheFlag);
-	  if (evalCacheFlag)   data_pairs.insert(prp);
+	  if (evalCacheFlag)   boundedCache.insert(data_pairs, prp);
 	  if (restartFileFlag) parallelLib.write_restart(prp);
 	}
       }
@@ -592,7 +600,7 @@ duplication_detect(const Variables& vars, Response& response, bool asynch_flag)
   //   requiring an additional test to prefer positive id's in some use cases).
   PRPCacheOIter ord_it; PRPCacheHIter hash_it;
   ParamResponsePair cache_pr; int cache_eval_id; bool cache_hit = false;
-  if (nearbyDuplicateDetect) { // slow but allows tolerance on equality
+  if (nearbyDuplicateDetect) { // allows tolerance on equality (slab search)
     ord_it = lookup_by_nearby_val(data_pairs, interfaceId, vars,
 				  response.active_set(), nearbyTolerance);
     cache_hit = (ord_it != data_pairs.end());
@@ -601,24 +609,29 @@ duplication_detect(const Variables& vars, Response& response, bool asynch_flag)
       cache_eval_id = ord_it->eval_id();
       if (cache_eval_id <= 0)
 	{ cache_pr = *ord_it; data_pairs.erase(ord_it); }
+      else
+	boundedCache.touch(*ord_it);
     }
   }
-  else { // fast but requires exact binary match
-    hash_it = lookup_by_val(data_pairs, interfaceId, vars,
-			    response.active_set());
+  else { // fast but requires exact binary match; includes spilled records
+    hash_it = boundedCache.lookup_by_val(data_pairs, interfaceId, vars,
+					 response.active_set());
     cache_hit = (hash_it != data_pairs.get<hashed>().end());
     if (cache_hit) { // hashed-specific updates (shared updates below)
       response.update(hash_it->response(), true); // update metadata
       cache_eval_id = hash_it->eval_id();
       if (cache_eval_id <= 0)
 	{ cache_pr = *hash_it; data_pairs.get<hashed>().erase(hash_it); }
+      else
+	boundedCache.touch(*hash_it);
     }
   }
+  boundedCache.record_lookup(cache_hit);
   if (cache_hit) { // updates shared among ordered/hashed lookups
     if (cache_eval_id <= 0) {
       // ordered key is const; must remove (above) & change/add (below)
       cache_pr.eval_id(evalIdCntr); // promote
-      data_pairs.insert(cache_pr);  // shallow copy of previous vars/resp
+      boundedCache.insert(data_pairs, cache_pr); // shallow copy of vars/resp
     }
 
     if (asynch_flag) // asynch case: bookkeep
@@ -717,7 +730,8 @@ const IntResponseMap& ApplicationInterface::synchronize()
       Cout << std::endl;
 
       if (ieMessagePass) { // single or multi-processor servers
-	if (ieDedSchedFlag) dedicated_dynamic_scheduler_evaluations();
+	if (batched_evaluations()) dedicated_dynamic_scheduler_batches();
+	else if (ieDedSchedFlag)   dedicated_dynamic_scheduler_evaluations();
 	else {
 	  // utilize asynch local evals to accomplish a dynamic peer schedule
 	  // (even if hybrid mode not specified) unless precluded by direct
@@ -1028,6 +1042,82 @@ void ApplicationInterface::dedicated_dynamic_scheduler_evaluations()
 }
 
 
+/** This variant of dedicated_dynamic_scheduler_evaluations() is used
+    when an evaluation_prefetch greater than one is specified for
+    synchronous servers, for which each message otherwise carries a single
+    evaluation and a server idles for a scheduler round trip between jobs.
+    Consecutive jobs are packed into one message of up to evalPrefetch
+    evaluations (fewer as the queue drains, to balance the final batches),
+    and two messages are kept outstanding per server so that the next
+    batch is queued while the current one executes.  A server returns the
+    responses for a batch in one message.  It matches
+    serve_evaluations_synch_batches() on the servers. */
+void ApplicationInterface::dedicated_dynamic_scheduler_batches()
+{
+  size_t j, num_jobs = beforeSynchCorePRPQueue.size(),
+    num_slots = 2 * numEvalServers, send_cntr = 0, recv_cntr = 0, slot,
+    num_evals;
+  int i, server_id, out_count;
+
+  sendBuffers.resize(num_slots);
+  recvBuffers.resize(num_slots);
+  recvRequests.assign(num_slots, MPI_REQUEST_NULL);
+  // the jobs carried by the message in each slot are contiguous in the queue
+  std::vector<PRPQueueIter> batch_begin(num_slots);
+  SizetArray batch_size(num_slots, 0);
+
+  // send two batches to each server
+  PRPQueueIter prp_iter = beforeSynchCorePRPQueue.begin();
+  for (slot=0; slot<num_slots && send_cntr<num_jobs; ++slot) {
+    num_evals = std::min((size_t)evalPrefetch,
+			 std::max((size_t)1, (num_jobs - send_cntr)/num_slots));
+    server_id = slot%numEvalServers + 1; // from 1 to numEvalServers
+    batch_begin[slot] = prp_iter; batch_size[slot] = num_evals;
+    send_evaluation_batch(prp_iter, num_evals, slot, server_id);
+    std::advance(prp_iter, num_evals); send_cntr += num_evals;
+  }
+  Cout << "Dedicated scheduler: first pass assigning " << send_cntr
+       << " jobs among " << numEvalServers << " servers in batches of up to "
+       << evalPrefetch << '\n';
+  if (send_cntr < num_jobs)
+    Cout << "Dedicated scheduler: second pass scheduling "
+	 << num_jobs-send_cntr << " remaining jobs\n";
+
+  // process returned batches and refill their slots
+  auto status_array{std::vector<MPI_Status>(num_slots)};
+  auto index_array{std::vector<int>(num_slots)};
+  PRPQueueIter return_iter;
+  while (recv_cntr < num_jobs) {
+    if (outputLevel > SILENT_OUTPUT)
+      Cout << "Dedicated scheduler: waiting on completed jobs" << std::endl;
+    parallelLib.waitsome(num_slots, recvRequests, out_count, index_array,
+			 status_array);
+    for (i=0; i<out_count; ++i) {
+      slot      = index_array.at(i);
+      server_id = slot%numEvalServers + 1;
+      return_iter = batch_begin[slot];
+      for (j=0; j<batch_size[slot]; ++j, ++return_iter)
+	receive_evaluation(return_iter, slot, server_id, false); // !peer
+      recv_cntr += batch_size[slot];
+      if (send_cntr < num_jobs) {
+	num_evals = std::min((size_t)evalPrefetch,
+	  std::max((size_t)1, (num_jobs - send_cntr)/num_slots));
+	batch_begin[slot] = prp_iter; batch_size[slot] = num_evals;
+	send_evaluation_batch(prp_iter, num_evals, slot, server_id);
+	std::advance(prp_iter, num_evals); send_cntr += num_evals;
+      }
+      else
+	batch_size[slot] = 0;
+    }
+  }
+
+  // deallocate MPI & buffer arrays
+  sendBuffers.clear();
+  recvBuffers.clear();
+  recvRequests.clear();
+}
+
+
 /** This code runs on the iteratorCommRank 0 processor (the iterator) and is
     called from synchronize() in order to manage a static schedule for cases
     where peer 1 must block when evaluating its local job allocation (e.g.,
@@ -2184,6 +2274,10 @@ void ApplicationInterface::
 send_evaluation(PRPQueueIter& prp_it, size_t buff_index, int server_id,
 		bool peer_flag)
 {
+  // servers expecting batches receive a single job as a batch of one
+  if (!peer_flag && batched_evaluations())
+    { send_evaluation_batch(prp_it, 1, buff_index, server_id); return; }
+
   if (sendBuffers[buff_index].size()) // reuse of existing send/recv buffers
     { sendBuffers[buff_index].reset(); recvBuffers[buff_index].reset(); }
   else {                              // freshly allocated send/recv buffers
@@ -2223,6 +2317,43 @@ send_evaluation(PRPQueueIter& prp_it, size_t buff_index, int server_id,
   parallelLib.free(send_request); // no test/wait on send_request
 }
 
+
+/** The message for a batch of num_evals evaluations contains the count
+    followed by the id, variables, and active set of each evaluation, and
+    is tagged with the first id.  The matching receive is sized for the
+    num_evals responses that serve_evaluations_synch_batches() returns
+    under the same tag. */
+void ApplicationInterface::
+send_evaluation_batch(PRPQueueIter prp_it, size_t num_evals, size_t buff_index,
+		      int server_id)
+{
+  MPIPackBuffer&   send_buffer = sendBuffers[buff_index];
+  MPIUnpackBuffer& recv_buffer = recvBuffers[buff_index];
+  send_buffer.reset();
+  recv_buffer.resize(num_evals * lenResponseMessage);
+  recv_buffer.reset();
+
+  int batch_tag = prp_it->eval_id(), batch_len = num_evals;
+  send_buffer << batch_len;
+  for (size_t i=0; i<num_evals; ++i, ++prp_it) {
+    int fn_eval_id = prp_it->eval_id();
+    send_buffer << fn_eval_id << prp_it->variables() << prp_it->active_set();
+    if (outputLevel > SILENT_OUTPUT) {
+      Cout << "Dedicated scheduler assigning ";
+      if (!(interfaceId.empty() || interfaceId == "NO_ID"))
+	Cout << interfaceId << ' ';
+      Cout << "evaluation " << fn_eval_id << " to server " << server_id << '\n';
+    }
+  }
+
+  // pre-post nonblocking receive (to prevent any message buffering)
+  parallelLib.irecv_ie(recv_buffer, server_id, batch_tag,
+		       recvRequests[buff_index]);
+  MPI_Request send_request; // only 1 needed
+  parallelLib.isend_ie(send_buffer, server_id, batch_tag, send_request);
+  parallelLib.free(send_request); // no test/wait on send_request
+}
+
 void ApplicationInterface::
 launch_asynch_local(MPIUnpackBuffer& recv_buffer, int fn_eval_id)
 {
@@ -2266,8 +2397,9 @@ void ApplicationInterface::serve_evaluations()
     else              serve_evaluations_asynch();
   }
   else {
-    if (peer_server1) serve_evaluations_synch_peer();
-    else              serve_evaluations_synch();
+    if (peer_server1)               serve_evaluations_synch_peer();
+    else if (batched_evaluations()) serve_evaluations_synch_batches();
+    else                            serve_evaluations_synch();
   }
 }
 
@@ -2347,6 +2479,66 @@ void ApplicationInterface::serve_evaluations_synch()
 }
 
 
+/** This code is invoked by serve_evaluations() in place of
+    serve_evaluations_synch() when the dedicated scheduler sends batches
+    (see dedicated_dynamic_scheduler_batches()).  Each message carries one
+    or more evaluations, which are performed in order; their responses are
+    returned together under the tag of the incoming message.  Since the
+    scheduler keeps a second batch queued, the next message is usually
+    waiting when a batch completes. */
+void ApplicationInterface::serve_evaluations_synch_batches()
+{
+  int batch_tag = 1, batch_len, max_len = std::max(evalPrefetch, 1),
+    recv_len = MPIPackSize(batch_tag) +
+      max_len * (MPIPackSize(batch_tag) + lenVarsActSetMessage);
+  MPI_Status status; // holds source, tag, and number received in MPI_Recv
+  MPI_Request request = MPI_REQUEST_NULL; // bypass MPI_Wait on first pass
+  MPIPackBuffer send_buffer(max_len * lenResponseMessage);
+  MPIUnpackBuffer recv_buffer(recv_len);
+  currEvalId = 1;
+  while (batch_tag) {
+    recv_buffer.reset();
+    // blocking receive of the batch
+    if (evalCommRank == 0) { // 1-level or local comm. leader in 2-level
+      parallelLib.recv_ie(recv_buffer, 0, MPI_ANY_TAG, status);
+      batch_tag = status.MPI_TAG;
+    }
+    if (multiProcEvalFlag) { // multilevel must Bcast batch over evalComm
+      parallelLib.bcast_e(batch_tag);
+      if (batch_tag)
+        parallelLib.bcast_e(recv_buffer);
+    }
+    if (!batch_tag) // termination signal
+      { currEvalId = 0; break; }
+
+    // the previous batch's responses must be received before send_buffer
+    // is reused
+    if (request != MPI_REQUEST_NULL)
+      parallelLib.wait(request, status);
+    send_buffer.reset();
+
+    recv_buffer >> batch_len;
+    for (int i=0; i<batch_len; ++i) {
+      Variables vars; ActiveSet set;
+      recv_buffer >> currEvalId >> vars >> set;
+      Response local_response(sharedRespData, set); // special constructor
+      try { derived_map(vars, set, local_response, currEvalId); }
+      catch(const FunctionEvalFailure& fneval_except) {
+        manage_failure(vars, set, local_response, currEvalId);
+      }
+      if (evalCommRank == 0)
+	send_buffer << local_response;
+    }
+
+    if (evalCommRank == 0)
+      parallelLib.isend_ie(send_buffer, 0, batch_tag, request);
+  }
+  // send_buffer must outlive the last return
+  if (request != MPI_REQUEST_NULL)
+    parallelLib.wait(request, status);
+}
+
+
 /** This code is invoked by serve_evaluations() to perform a synchronous
     evaluation in coordination with the iteratorCommRank 0 processor
     (the iterator) for static schedules.  The bcast() matches either the
@@ -3032,7 +3224,7 @@ receive_evaluation(PRPQueueIter& prp_it, size_t buff_index, int server_id,
   raw_response.update(remote_response, true); // update metadata
 
   // insert into restart and eval cache ASAP
-  if (evalCacheFlag)   data_pairs.insert(*prp_it);
+  if (evalCacheFlag)   boundedCache.insert(data_pairs, *prp_it);
   if (restartFileFlag) parallelLib.write_restart(*prp_it);
 }
 
@@ -3056,7 +3248,7 @@ void ApplicationInterface::process_asynch_local(int fn_eval_id)
   }
 
   rawResponseMap[fn_eval_id] = prp_it->response();
-  if (evalCacheFlag)   data_pairs.insert(*prp_it);
+  if (evalCacheFlag)   boundedCache.insert(data_pairs, *prp_it);
   if (restartFileFlag) parallelLib.write_restart(*prp_it);
 
   asynchLocalActivePRPQueue.erase(prp_it);
@@ -3078,7 +3270,7 @@ void ApplicationInterface::process_synch_local(PRPQueueIter& prp_it)
     Cout << "evaluation " << fn_eval_id << std::endl;
   }
   rawResponseMap[fn_eval_id] = prp_it->response();
-  if (evalCacheFlag)   data_pairs.insert(*prp_it);
+  if (evalCacheFlag)   boundedCache.insert(data_pairs, *prp_it);
   if (restartFileFlag) parallelLib.write_restart(*prp_it);
 }
 
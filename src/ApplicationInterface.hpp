@@ -13,6 +13,7 @@
 #include "ParallelLibrary.hpp"
 #include "DakotaInterface.hpp"
 #include "PRPMultiIndex.hpp"
+#include "BoundedPRPCache.hpp"
 #include "DataMethod.hpp"
 #include <DataInterface.hpp>
 
@@ -78,6 +79,8 @@ protected:
   bool evaluation_cache() const override;
   /// return evalCacheFlag
   bool restart_file() const override;
+  /// print the counters of boundedCache, if bounded
+  void print_cache_summary(std::ostream& s) const override;
 
   /// form and return the final evaluation ID tag, appending iface ID if needed
   String final_eval_id_tag(int fn_eval_id) override;
@@ -298,6 +301,10 @@ private:
   /// using message passing on a dedicated scheduler partition; executes on
   /// iteratorComm dedicated scheduler
   void dedicated_dynamic_scheduler_evaluations();
+  /// blocking dynamic schedule of all evaluations in beforeSynchCorePRPQueue
+  /// on a dedicated scheduler partition, sending jobs in batches of up to
+  /// evalPrefetch and keeping a second batch queued on each server
+  void dedicated_dynamic_scheduler_batches();
   /// blocking static schedule of all evaluations in beforeSynchCorePRPQueue
   /// using message passing on a peer partition; executes on iteratorComm rank 0
   void peer_static_schedule_evaluations();
@@ -339,6 +346,13 @@ private:
   /// helper function for processing recvBuffers[buff_index] within scheduler
   void receive_evaluation(PRPQueueIter& prp_it, size_t buff_index,
 			  int server_id, bool peer_flag);
+  /// helper function for sending num_evals consecutive jobs starting at
+  /// prp_it to a server in sendBuffers[buff_index]
+  void send_evaluation_batch(PRPQueueIter prp_it, size_t num_evals,
+			     size_t buff_index, int server_id);
+  /// whether a dedicated scheduler and its synchronous servers exchange
+  /// evaluations in batches (see dedicated_dynamic_scheduler_batches())
+  bool batched_evaluations() const;
 
   /// launch an asynchronous local evaluation from a queue iterator 
   void launch_asynch_local(PRPQueueIter& prp_it);
@@ -369,6 +383,9 @@ private:
   /// serve the evaluation message passing schedulers and perform
   /// one synchronous evaluation at a time
   void serve_evaluations_synch();
+  /// serve a dedicated scheduler that sends evaluations in batches and
+  /// perform them one synchronous evaluation at a time
+  void serve_evaluations_synch_batches();
   /// serve the evaluation message passing schedulers and perform
   /// one synchronous evaluation at a time as part of the 1st peer
   void serve_evaluations_synch_peer();
@@ -467,6 +484,10 @@ private:
   /// {DEFAULT,PEER}_SCHEDULING.  Used for manual overrides of
   /// the auto-configure logic in ParallelLibrary::resolve_inputs().
   short analysisScheduling;
+  /// user specification of the number of evaluations per message (and
+  /// jobs queued ahead on each server) for a dedicated scheduler with
+  /// synchronous servers; values > 1 activate the batched protocol
+  int evalPrefetch;
 
   /// whether the asynchronous local evaluations are to be performed
   /// with a static schedule (default false)
@@ -495,6 +516,9 @@ private:
   bool nearbyDuplicateDetect;
   /// tolerance value for tolerance-based duplication detection
   Real nearbyTolerance;
+  /// memory bound and spill store for the records this interface inserts
+  /// into the data_pairs cache (from cache_memory_limit)
+  BoundedPRPCache boundedCache;
 
   /// used to manage a user request to deactivate the restart file (i.e., 
   /// insertions into write_restart).
@@ -627,6 +651,15 @@ inline bool ApplicationInterface::check_asynch_local_analyses() const
 }
 
 
+inline bool ApplicationInterface::batched_evaluations() const
+{
+  // servers run serve_evaluations_synch() unless asynch local concurrency
+  // is requested; the scheduler and servers evaluate this consistently
+  return ( ieDedSchedFlag && ieMessagePass && evalPrefetch > 1 &&
+	   asynchLocalEvalConcurrency <= 1 );
+}
+
+
 inline short ApplicationInterface::interface_synchronization() const
 {
   // Following initialize_comms --> set_{evaluation,analysis}_comms, local
@@ -644,6 +677,10 @@ inline bool ApplicationInterface::restart_file() const
 { return restartFileFlag; }
 
 
+inline void ApplicationInterface::print_cache_summary(std::ostream& s) const
+{ if (boundedCache.bounded()) boundedCache.print_summary(s); }
+
+
 inline void ApplicationInterface::
 derived_map(const Variables& vars, const ActiveSet& set, Response& response,
 	    int fn_eval_id)
@@ -188,6 +188,17 @@ map(const Variables& vars, const ActiveSet& set, Response& response,
   //if (asvControlFlag) // else leave response ActiveSet as initialized
   response.active_set(set); // set the current ActiveSet within the response
 
+  // defer the surface evaluations for asynchronous requests to synchronize(),
+  // which evaluates all queued points together
+  if (asynch_flag && batch_map(set)) {
+    bool same_view = (vars.view().first == actualModelVars.view().first);
+    if (!same_view) actualModelVars.map_variables_by_view(vars);
+    deferredVarsMap[evalIdCntr]
+      = (same_view) ? vars.copy() : actualModelVars.copy();
+    beforeSynchResponseMap[evalIdCntr] = response.copy();
+    return;
+  }
+
   // Subdivide set for algebraic_mappings() and derived_map()
   Response algebraic_response, core_response; // empty handles
   ActiveSet core_set;
@@ -307,10 +318,173 @@ map(const Variables& vars, const ActiveSet& set, Response& response,
 }
 
 
+/** Deferral covers the plain surrogate case: values and gradients of
+    scalar function surfaces, without algebraic mappings or verbose
+    per-evaluation output. */
+bool ApproximationInterface::batch_map(const ActiveSet& set) const
+{
+  if (algebraicMappings || !coreMappings || outputLevel > NORMAL_OUTPUT)
+    return false;
+  const ShortArray& asv = set.request_vector();
+  if (asv.size() != num_function_surfaces())
+    return false; // let map() report the mismatch
+  for (StSCIter it=approxFnIndices.begin(); it!=approxFnIndices.end(); ++it)
+    if ( (asv[*it] & 4) || function_surface(*it).num_components() > 1 )
+      return false;
+  return true;
+}
+
+
+/** Evaluations that share their request vector and all but their active
+    continuous variables are evaluated as one batch per function surface. */
+void ApproximationInterface::evaluate_deferred()
+{
+  SizetArray assign_dvv;
+  copy_data(actualModelVars.continuous_variable_ids(), assign_dvv);
+  IntVarsMCIter v_first = deferredVarsMap.begin(), v_last;
+  while (v_first != deferredVarsMap.end()) {
+    const Variables& vars = v_first->second;
+    IntRespMIter r_first = beforeSynchResponseMap.find(v_first->first);
+    const ShortArray& asv = r_first->second.active_set().request_vector();
+
+    // extent of the batch
+    size_t p, num_pts = 1, num_cv = vars.cv();
+    for (v_last=v_first, ++v_last; v_last!=deferredVarsMap.end(); ++v_last) {
+      const Variables& vars_p = v_last->second;
+      if (vars_p.inactive_continuous_variables() !=
+	    vars.inactive_continuous_variables() ||
+	  vars_p.all_discrete_int_variables() !=
+	    vars.all_discrete_int_variables() ||
+	  vars_p.all_discrete_real_variables() !=
+	    vars.all_discrete_real_variables() ||
+	  vars_p.all_discrete_string_variables() !=
+	    vars.all_discrete_string_variables() ||
+	  beforeSynchResponseMap[v_last->first].active_set().request_vector()
+	    != asv)
+	break;
+      ++num_pts;
+    }
+    RealMatrix c_vars(num_cv, num_pts, false);
+    std::vector<Response> responses(num_pts);
+    IntVarsMCIter v_it = v_first;
+    for (p=0; p<num_pts; ++p, ++v_it) {
+      copy_data(v_it->second.continuous_variables(), c_vars[p], num_cv);
+      responses[p] = beforeSynchResponseMap[v_it->first];
+    }
+
+    RealVector fn_vals;  RealMatrix fn_grads;
+    for (StSIter it=approxFnIndices.begin(); it!=approxFnIndices.end(); ++it) {
+      size_t fn_index = *it;
+      Approximation& approx = function_surface(fn_index);
+      if (asv[fn_index] & 1) {
+	approx.batch_value(vars, c_vars, fn_vals);
+	for (p=0; p<num_pts; ++p)
+	  responses[p].function_value(fn_vals[p], fn_index);
+      }
+      if (asv[fn_index] & 2) {
+	approx.batch_gradient(vars, c_vars, fn_grads);
+	SizetArray assign_indices, curr_indices;
+	for (p=0; p<num_pts; ++p) {
+	  // Manage potential DVV mismatch (all vs. active)
+	  responses[p].map_dvv_indices(assign_dvv, assign_indices,
+				       curr_indices);
+	  RealVector grad_p(Teuchos::View, fn_grads[p], fn_grads.numRows());
+	  responses[p].function_gradient(grad_p, fn_index, assign_indices,
+					 curr_indices);
+	}
+      }
+    }
+    v_first = v_last;
+  }
+  deferredVarsMap.clear();
+}
+
+
+const Variables& ApproximationInterface::
+surface_points(const Variables& vars, const RealMatrix& c_vars,
+	       RealMatrix& surf_c_vars)
+{
+  if (vars.view().first == actualModelVars.view().first) {
+    surf_c_vars = RealMatrix(Teuchos::View, c_vars, c_vars.numRows(),
+			     c_vars.numCols());
+    return vars;
+  }
+
+  // map each point between views
+  int p, num_pts = c_vars.numCols(), num_cv = c_vars.numRows();
+  Variables pt_vars = vars.copy();
+  for (p=0; p<num_pts; ++p) {
+    RealVector c_vars_p(Teuchos::View, const_cast<Real*>(c_vars[p]), num_cv);
+    pt_vars.continuous_variables(c_vars_p);
+    actualModelVars.map_variables_by_view(pt_vars);
+    const RealVector& surf_c_vars_p = actualModelVars.continuous_variables();
+    if (p == 0)
+      surf_c_vars.shapeUninitialized(surf_c_vars_p.length(), num_pts);
+    copy_data(surf_c_vars_p, surf_c_vars[p], surf_c_vars.numRows());
+  }
+  return actualModelVars;
+}
+
+
+/** fn_vals holds one row per response function and one column per point
+    in c_vars; rows of functions that are not approximated are zero. */
+void ApproximationInterface::
+approximation_values(const Variables& vars, const RealMatrix& c_vars,
+		     RealMatrix& fn_vals)
+{
+  RealMatrix surf_c_vars;
+  const Variables& surf_vars = surface_points(vars, c_vars, surf_c_vars);
+  int p, num_pts = c_vars.numCols();
+  fn_vals.shape(num_function_surfaces(), num_pts);
+  RealVector vals;
+  for (StSIter it=approxFnIndices.begin(); it!=approxFnIndices.end(); ++it) {
+    function_surface(*it).batch_value(surf_vars, surf_c_vars, vals);
+    for (p=0; p<num_pts; ++p)
+      fn_vals(*it, p) = vals[p];
+  }
+}
+
+
+/** fn_grads holds, for each approximated response function, one column
+    of continuous variable derivatives per point in c_vars. */
+void ApproximationInterface::
+approximation_gradients(const Variables& vars, const RealMatrix& c_vars,
+			RealMatrixArray& fn_grads)
+{
+  RealMatrix surf_c_vars;
+  const Variables& surf_vars = surface_points(vars, c_vars, surf_c_vars);
+  fn_grads.resize(num_function_surfaces());
+  for (StSIter it=approxFnIndices.begin(); it!=approxFnIndices.end(); ++it)
+    function_surface(*it).batch_gradient(surf_vars, surf_c_vars,
+					 fn_grads[*it]);
+}
+
+
+void ApproximationInterface::
+approximation_variances(const Variables& vars, const RealMatrix& c_vars,
+			RealMatrix& fn_vars)
+{
+  RealMatrix surf_c_vars;
+  const Variables& surf_vars = surface_points(vars, c_vars, surf_c_vars);
+  int p, num_pts = c_vars.numCols();
+  fn_vars.shape(num_function_surfaces(), num_pts);
+  RealVector variances;
+  for (StSIter it=approxFnIndices.begin(); it!=approxFnIndices.end(); ++it) {
+    function_surface(*it).batch_prediction_variance(surf_vars, surf_c_vars,
+						    variances);
+    for (p=0; p<num_pts; ++p)
+      fn_vars(*it, p) = variances[p];
+  }
+}
+
+
 // Little distinction between blocking and nonblocking synch since all 
 // responses are completed.
 const IntResponseMap& ApproximationInterface::synchronize()
 {
+  if (!deferredVarsMap.empty())
+    evaluate_deferred();
+
   // move data from beforeSynch map to completed map
   rawResponseMap.clear();
   std::swap(beforeSynchResponseMap, rawResponseMap);
@@ -325,6 +499,9 @@ const IntResponseMap& ApproximationInterface::synchronize()
 
 const IntResponseMap& ApproximationInterface::synchronize_nowait()
 {
+  if (!deferredVarsMap.empty())
+    evaluate_deferred();
+
   // move data from beforeSynch map to completed map
   rawResponseMap.clear();
   std::swap(beforeSynchResponseMap, rawResponseMap);
@@ -138,6 +138,13 @@ protected:
 
   const RealVector& approximation_variances(const Variables& vars) override;
 
+  void approximation_values(const Variables& vars, const RealMatrix& c_vars,
+			    RealMatrix& fn_vals) override;
+  void approximation_gradients(const Variables& vars, const RealMatrix& c_vars,
+			       RealMatrixArray& fn_grads) override;
+  void approximation_variances(const Variables& vars, const RealMatrix& c_vars,
+			       RealMatrix& fn_vars) override;
+
   void discrepancy_emulation_mode(short mode) override;
 
   bool formulation_updated() const override;
@@ -219,6 +226,18 @@ private:
   /// Load approximation test points from user challenge points file
   void read_challenge_points();
 
+  /// whether an asynchronous map() of set can be deferred to a batch
+  /// evaluation in synchronize()
+  bool batch_map(const ActiveSet& set) const;
+  /// evaluate the functionSurfaces for all evaluations in deferredVarsMap,
+  /// populating the responses in beforeSynchResponseMap
+  void evaluate_deferred();
+  /// map vars and the batch of continuous variables c_vars (columns) to
+  /// the variables view of the functionSurfaces
+  const Variables& surface_points(const Variables& vars,
+				  const RealMatrix& c_vars,
+				  RealMatrix& surf_c_vars);
+
   //
   //- Heading: Data
   //
@@ -276,6 +295,10 @@ private:
   /// operations (approximate responses are always computed synchronously,
   /// but asynchronous virtual functions are supported through bookkeeping).
   IntResponseMap beforeSynchResponseMap;
+  /// variables (in the view of the functionSurfaces) of asynchronous
+  /// evaluations whose responses in beforeSynchResponseMap are completed
+  /// together in synchronize()
+  IntVariablesMap deferredVarsMap;
 };
 
 
@@ -0,0 +1,201 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "BoundedPRPCache.hpp"
+#include "IndexedRestart.hpp"
+#include "DakotaBuildInfo.hpp"
+#include "dakota_global_defs.hpp"
+#include <filesystem>
+
+namespace Dakota {
+
+BoundedPRPCache::BoundedPRPCache():
+  memoryLimit(0), memoryUsage(0), numHits(0), numMisses(0), numEvictions(0),
+  numRestored(0)
+{ }
+
+
+BoundedPRPCache::~BoundedPRPCache()
+{
+  if (spillWriter) {
+    spillInput.close();
+    spillWriter.reset(); // writes the final chunk index
+    std::error_code ec;
+    std::filesystem::remove(spillFilename, ec);
+  }
+}
+
+
+void BoundedPRPCache::
+initialize(size_t memory_limit, const String& spill_filename)
+{
+  memoryLimit   = memory_limit;
+  spillFilename = spill_filename;
+}
+
+
+void BoundedPRPCache::insert(PRPCache& prp_cache, const ParamResponsePair& prp)
+{
+  prp_cache.insert(prp);
+  if (!memoryLimit)
+    return;
+
+  const IntStringPair& ids = prp.eval_interface_ids();
+  std::map<IntStringPair, TrackedRecord>::iterator t_it
+    = trackedRecords.find(ids);
+  if (t_it != trackedRecords.end()) // already tracked: refresh recency
+    recencyList.splice(recencyList.begin(), recencyList, t_it->second.position);
+  else {
+    recencyList.push_front(ids);
+    TrackedRecord& tracked = trackedRecords[ids];
+    tracked.position = recencyList.begin();
+    tracked.bytes    = record_bytes(prp);
+    memoryUsage     += tracked.bytes;
+    enforce_limit(prp_cache);
+  }
+}
+
+
+PRPCacheHIter BoundedPRPCache::
+lookup_by_val(PRPCache& prp_cache, const String& search_interface_id,
+	      const Variables& search_vars, const ActiveSet& search_set)
+{
+  PRPCacheHIter hash_it = Dakota::lookup_by_val(prp_cache, search_interface_id,
+						search_vars, search_set);
+  if (hash_it != prp_cache.get<hashed>().end() || spillIndex.empty())
+    return hash_it;
+
+  // consult the spill index, which is keyed by the same hash as the
+  // hashed index of the cache, and then decode only the candidates
+  Response search_resp(SIMULATION_RESPONSE, search_set);
+  ParamResponsePair search_pr(search_vars, search_interface_id, search_resp);
+  typedef std::unordered_multimap<size_t, SpillLocation>::iterator SIter;
+  std::pair<SIter, SIter> cands = spillIndex.equal_range(hash_value(search_pr));
+  for (SIter s_it=cands.first; s_it!=cands.second; ++s_it) {
+    ParamResponsePair spilled_pr;
+    read_spilled(s_it->second, spilled_pr);
+    if (id_vars_exact_compare(spilled_pr, search_pr) &&
+	set_compare(spilled_pr, search_set)) {
+      spillIndex.erase(s_it);
+      ++numRestored;
+      insert(prp_cache, spilled_pr);
+      return Dakota::lookup_by_val(prp_cache, search_pr);
+    }
+  }
+  return hash_it;
+}
+
+
+void BoundedPRPCache::touch(const ParamResponsePair& prp)
+{
+  std::map<IntStringPair, TrackedRecord>::iterator t_it
+    = trackedRecords.find(prp.eval_interface_ids());
+  if (t_it != trackedRecords.end())
+    recencyList.splice(recencyList.begin(), recencyList, t_it->second.position);
+}
+
+
+void BoundedPRPCache::enforce_limit(PRPCache& prp_cache)
+{
+  // the most recent record is retained even if it exceeds the limit alone
+  while (memoryUsage > memoryLimit && recencyList.size() > 1)
+    evict(prp_cache);
+}
+
+
+void BoundedPRPCache::evict(PRPCache& prp_cache)
+{
+  IntStringPair ids = recencyList.back();
+  std::map<IntStringPair, TrackedRecord>::iterator t_it
+    = trackedRecords.find(ids);
+  memoryUsage -= t_it->second.bytes;
+  trackedRecords.erase(t_it);
+  recencyList.pop_back();
+
+  PRPCacheOIter o_it = prp_cache.get<ordered>().find(ids);
+  if (o_it == prp_cache.get<ordered>().end()) // erased by another owner
+    return;
+
+  // always write the current record: a restored record may have been
+  // updated in the cache since it was last spilled
+  if (!spillWriter) {
+    RestartVersion rst_version(DakotaBuildInfo::get_release_num(),
+			       DakotaBuildInfo::get_rev_number());
+    spillWriter.reset(new IndexedRestartWriter(spillFilename, rst_version));
+  }
+  SpillLocation loc;
+  loc.offset = spillWriter->append_prp(*o_it);
+  loc.length = spillWriter->last_record_length();
+  spillIndex.insert(std::make_pair(hash_value(*o_it), loc));
+  prp_cache.get<ordered>().erase(o_it);
+  ++numEvictions;
+}
+
+
+void BoundedPRPCache::
+read_spilled(const SpillLocation& loc, ParamResponsePair& prp)
+{
+  spillWriter->flush();
+  if (!spillInput.is_open()) {
+    spillInput.open(spillFilename.c_str(), std::ios::binary);
+    if (!spillInput.good()) {
+      Cerr << "\nError: could not open evaluation cache spill file '"
+	   << spillFilename << "' for reading." << std::endl;
+      abort_handler(IO_ERROR);
+    }
+  }
+  String record_data(loc.length, '\0');
+  spillInput.clear(); // records may have been appended since the last read
+  spillInput.seekg(loc.offset);
+  spillInput.read(&record_data[0], loc.length);
+  if (!spillInput.good()) {
+    Cerr << "\nError: could not read evaluation cache spill file '"
+	 << spillFilename << "'." << std::endl;
+    abort_handler(IO_ERROR);
+  }
+  IndexedRestart::decode_record(record_data.data(), loc.length, prp);
+}
+
+
+void BoundedPRPCache::print_summary(std::ostream& s) const
+{
+  std::streamsize prec = s.precision(3);
+  s << "  Evaluation cache: " << numHits << " hits, " << numMisses
+    << " misses, " << numEvictions << " evictions (" << numRestored
+    << " restored from spill file), " << memoryUsage / 1048576. << " of "
+    << memoryLimit / 1048576. << " MB in use\n";
+  s.precision(prec);
+}
+
+
+size_t BoundedPRPCache::record_bytes(const ParamResponsePair& prp)
+{
+  // shared variable and response labels are not charged to the record
+  const Variables& vars = prp.variables();
+  size_t bytes = sizeof(ParamResponsePair) + prp.interface_id().size()
+    + sizeof(Real) * (vars.acv() + vars.adrv()) + sizeof(int) * vars.adiv();
+  StringMultiArrayConstView ads_vars = vars.all_discrete_string_variables();
+  for (size_t i=0; i<ads_vars.size(); ++i)
+    bytes += sizeof(String) + ads_vars[i].size();
+
+  const Response& resp = prp.response();
+  const ActiveSet& set = resp.active_set();
+  bytes += sizeof(short) * set.request_vector().size()
+    + sizeof(size_t) * set.derivative_vector().size()
+    + sizeof(Real) * resp.function_values().length()
+    + sizeof(RespMetadataT) * resp.metadata().size();
+  const RealMatrix& fn_grads = resp.function_gradients();
+  bytes += sizeof(Real) * fn_grads.numRows() * fn_grads.numCols();
+  const RealSymMatrixArray& fn_hessians = resp.function_hessians();
+  for (size_t i=0; i<fn_hessians.size(); ++i) // full storage
+    bytes += sizeof(Real) * fn_hessians[i].numRows() * fn_hessians[i].numRows();
+  return bytes;
+}
+
+} // namespace Dakota
@@ -0,0 +1,161 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#ifndef BOUNDED_PRP_CACHE_H
+#define BOUNDED_PRP_CACHE_H
+
+#include "PRPMultiIndex.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+namespace Dakota {
+
+class IndexedRestartWriter;
+
+
+/// Memory bound for the records an interface inserts into a PRPCache
+
+/** Tracks the estimated memory footprint of the records inserted through
+    insert() in least recently used order.  When the footprint exceeds
+    the memory limit, the least recently used records are removed from
+    the cache and appended to a spill file in the indexed restart format.
+    A hash index over the interface id and variables of the spilled
+    records, which holds only their file locations, allows
+    lookup_by_val() to restore a spilled record to the cache on a hit.
+    Records inserted into the cache by other means (e.g., from a restart
+    file) are not counted until they pass through insert().  Without a
+    memory limit, insert() and lookup_by_val() reduce to the PRPCache
+    operations and only the lookup counters are kept. */
+class BoundedPRPCache
+{
+public:
+
+  /// default constructor
+  BoundedPRPCache();
+  /// destructor removes the spill file
+  ~BoundedPRPCache();
+
+  /// bound the footprint of the tracked records to memory_limit bytes,
+  /// spilling evicted records to the file spill_filename
+  void initialize(size_t memory_limit, const String& spill_filename);
+  /// return true if a memory limit is active
+  bool bounded() const;
+
+  /// insert prp into prp_cache as its most recently used record,
+  /// evicting least recently used records as needed
+  void insert(PRPCache& prp_cache, const ParamResponsePair& prp);
+  /// find a record in prp_cache by interface id, variables, and active
+  /// set, restoring a matching spilled record to prp_cache if necessary
+  PRPCacheHIter lookup_by_val(PRPCache& prp_cache,
+			      const String& search_interface_id,
+			      const Variables& search_vars,
+			      const ActiveSet& search_set);
+  /// mark a record of prp_cache as most recently used
+  void touch(const ParamResponsePair& prp);
+
+  /// count a cache lookup as a hit or a miss
+  void record_lookup(bool hit);
+
+  /// number of lookups satisfied by the cache
+  size_t hits() const;
+  /// number of lookups not satisfied by the cache
+  size_t misses() const;
+  /// number of records spilled to disk
+  size_t evictions() const;
+  /// number of spilled records restored to the cache
+  size_t restorations() const;
+  /// estimated footprint in bytes of the tracked records in memory
+  size_t memory_usage() const;
+
+  /// print the cache counters
+  void print_summary(std::ostream& s) const;
+
+  /// estimated footprint in bytes of the variables and response data of prp
+  static size_t record_bytes(const ParamResponsePair& prp);
+
+private:
+
+  /// location of a spilled record payload within the spill file
+  struct SpillLocation {
+    std::uint64_t offset; ///< byte offset of the payload
+    size_t length;        ///< payload length in bytes
+  };
+
+  /// recency list entry of a tracked record
+  struct TrackedRecord {
+    std::list<IntStringPair>::iterator position; ///< place in recencyList
+    size_t bytes;                                ///< estimated footprint
+  };
+
+  /// spill least recently used records until within the memory limit
+  void enforce_limit(PRPCache& prp_cache);
+  /// remove the least recently used record from memory
+  void evict(PRPCache& prp_cache);
+  /// decode the record stored at loc
+  void read_spilled(const SpillLocation& loc, ParamResponsePair& prp);
+
+  /// memory limit in bytes (0 if unbounded)
+  size_t memoryLimit;
+  /// estimated footprint of the tracked records
+  size_t memoryUsage;
+
+  /// name of the spill file
+  String spillFilename;
+  /// writer appending evicted records to the spill file
+  std::unique_ptr<IndexedRestartWriter> spillWriter;
+  /// stream reading spilled records back from the spill file
+  std::ifstream spillInput;
+
+  /// eval/interface ids of the tracked records, most recent first
+  std::list<IntStringPair> recencyList;
+  /// tracked records by eval/interface ids
+  std::map<IntStringPair, TrackedRecord> trackedRecords;
+  /// spilled records by hash_value() of their interface id and variables
+  std::unordered_multimap<size_t, SpillLocation> spillIndex;
+
+  /// lookup and eviction counters
+  size_t numHits, numMisses, numEvictions, numRestored;
+};
+
+
+inline bool BoundedPRPCache::bounded() const
+{ return memoryLimit > 0; }
+
+
+inline void BoundedPRPCache::record_lookup(bool hit)
+{ if (hit) ++numHits; else ++numMisses; }
+
+
+inline size_t BoundedPRPCache::hits() const
+{ return numHits; }
+
+
+inline size_t BoundedPRPCache::misses() const
+{ return numMisses; }
+
+
+inline size_t BoundedPRPCache::evictions() const
+{ return numEvictions; }
+
+
+inline size_t BoundedPRPCache::restorations() const
+{ return numRestored; }
+
+
+inline size_t BoundedPRPCache::memory_usage() const
+{ return memoryUsage; }
+
+} // namespace Dakota
+
+#endif
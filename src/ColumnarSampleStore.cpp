@@ -0,0 +1,397 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "ColumnarSampleStore.hpp"
+#include "DakotaResponse.hpp"
+#include "dakota_thread_util.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <thread>
+
+
+namespace Dakota {
+
+/// samples per reduction task
+static const size_t chunk_samples = 65536;
+
+
+/** One thread per core (see worker_threads()), up to one per task;
+    DAKOTA_SAMPLING_THREADS overrides the default. */
+static size_t reduction_threads(size_t num_tasks)
+{
+  size_t num_threads = worker_threads("DAKOTA_SAMPLING_THREADS", num_tasks);
+  return std::max((size_t)1, std::min(num_threads, num_tasks));
+}
+
+
+/** Evaluates task(t) for t = 0,...,num_tasks-1, distributing the tasks
+    over worker threads. */
+template <typename TaskFn>
+static void run_tasks(size_t num_tasks, TaskFn task)
+{
+  size_t num_threads = reduction_threads(num_tasks);
+  if (num_threads == 1) {
+    for (size_t t=0; t<num_tasks; ++t)
+      task(t);
+    return;
+  }
+  std::atomic<size_t> next_task(0);
+  std::vector<std::thread> workers;
+  workers.reserve(num_threads);
+  for (size_t w=0; w<num_threads; ++w)
+    workers.emplace_back([&next_task, num_tasks, &task]() {
+      for (size_t t = next_task++; t < num_tasks; t = next_task++)
+	task(t);
+    });
+  for (size_t w=0; w<num_threads; ++w)
+    workers[w].join();
+}
+
+
+QuantileSketch::QuantileSketch(size_t sketch_size):
+  sketchSize(std::max(sketch_size, (size_t)8)), numValues(0),
+  offsetGenerator(1), levelValues(1)
+{ }
+
+
+/** Capacities decrease by a factor of 2/3 from the top level down, with
+    a minimum of two. */
+size_t QuantileSketch::capacity(size_t h) const
+{
+  size_t depth = levelValues.size() - 1 - h;
+  Real cap = std::ceil((Real)sketchSize * std::pow(2./3., (Real)depth));
+  return std::max((size_t)2, (size_t)cap);
+}
+
+
+void QuantileSketch::insert(Real value)
+{
+  levelValues[0].push_back(value);
+  ++numValues;
+  if (levelValues[0].size() >= capacity(0))
+    compress();
+}
+
+
+void QuantileSketch::compress()
+{
+  for (size_t h=0; h<levelValues.size(); ++h) {
+    if (levelValues[h].size() < capacity(h))
+      continue;
+    if (h+1 == levelValues.size())
+      levelValues.emplace_back();
+    RealArray& level = levelValues[h];
+    std::sort(level.begin(), level.end());
+    // an even number of values is halved so that the weight is preserved;
+    // an odd one out remains at this level.  The retained offset is
+    // random, so that rank errors of successive compactions cancel on
+    // average, but seeded, so that results are reproducible.
+    size_t num_pairs = level.size() / 2, offset = offsetGenerator() % 2;
+    Real odd_value = level.back();
+    bool odd = (level.size() % 2 == 1);
+    RealArray& next_level = levelValues[h+1];
+    for (size_t p=0; p<num_pairs; ++p)
+      next_level.push_back(level[2*p + offset]);
+    level.clear();
+    if (odd)
+      level.push_back(odd_value);
+  }
+}
+
+
+size_t QuantileSketch::retained() const
+{
+  size_t num_retained = 0;
+  for (size_t h=0; h<levelValues.size(); ++h)
+    num_retained += levelValues[h].size();
+  return num_retained;
+}
+
+
+void QuantileSketch::
+cumulative_weights(RealArray& values, RealArray& cum_weights) const
+{
+  std::vector<std::pair<Real, Real> > weighted;
+  weighted.reserve(retained());
+  Real weight = 1.;
+  for (size_t h=0; h<levelValues.size(); ++h, weight *= 2.)
+    for (size_t i=0; i<levelValues[h].size(); ++i)
+      weighted.push_back(std::make_pair(levelValues[h][i], weight));
+  std::sort(weighted.begin(), weighted.end());
+
+  size_t i, num_retained = weighted.size();
+  values.resize(num_retained);  cum_weights.resize(num_retained);
+  Real cum = 0.;
+  for (i=0; i<num_retained; ++i) {
+    values[i] = weighted[i].first;
+    cum_weights[i] = (cum += weighted[i].second);
+  }
+}
+
+
+ColumnarSampleStore::ColumnarSampleStore():
+  numFns(0), numSamples(0), sketchSize(0)
+{ }
+
+
+ColumnarSampleStore::~ColumnarSampleStore()
+{ }
+
+
+void ColumnarSampleStore::initialize(size_t num_fns, size_t sketch_size)
+{
+  numFns = num_fns;  numSamples = 0;  sketchSize = sketch_size;
+  fnColumns.assign(num_fns, RealArray());
+  validBits.assign(num_fns, BitArray());
+  numValid.assign(num_fns, 0);
+  if (sketchSize) {
+    streamSums.shape(5, num_fns);
+    streamExtremes.assign(num_fns, RealRealPair(DBL_MAX, -DBL_MAX));
+    fnSketches.assign(num_fns, QuantileSketch(sketchSize));
+  }
+  else {
+    streamSums.shape(0, 0);
+    streamExtremes.clear();
+    fnSketches.clear();
+  }
+}
+
+
+void ColumnarSampleStore::reserve(size_t num_samples)
+{
+  if (sketchSize)
+    return;
+  for (size_t fn=0; fn<numFns; ++fn) {
+    fnColumns[fn].reserve(num_samples);
+    validBits[fn].reserve(num_samples);
+  }
+}
+
+
+void ColumnarSampleStore::append(const RealVector& fn_vals)
+{
+  for (size_t fn=0; fn<numFns; ++fn) {
+    Real val = fn_vals[fn];
+    bool is_valid = std::isfinite(val); // neither NaN nor +/-Inf
+    if (is_valid)
+      ++numValid[fn];
+    if (sketchSize) {
+      if (!is_valid)
+	continue;
+      Real val_sums[5] = { 1., val, 0., 0., 0. };
+      merge_central_sums(streamSums[fn], val_sums);
+      RealRealPair& ext = streamExtremes[fn];
+      if (val < ext.first)  ext.first  = val;
+      if (val > ext.second) ext.second = val;
+      fnSketches[fn].insert(val);
+    }
+    else {
+      fnColumns[fn].push_back(val);
+      validBits[fn].push_back(is_valid);
+    }
+  }
+  ++numSamples;
+}
+
+
+void ColumnarSampleStore::append(const IntResponseMap& samples)
+{
+  for (IntRespMCIter it=samples.begin(); it!=samples.end(); ++it)
+    append(it->second.function_values());
+}
+
+
+/** Pairwise update of Pebay (2008) for count, mean, and the sums of
+    2nd through 4th powers of deviations from the mean. */
+void ColumnarSampleStore::merge_central_sums(Real* a, const Real* b)
+{
+  Real n_a = a[0], n_b = b[0];
+  if (n_b == 0.)
+    return;
+  if (n_a == 0.)
+    { std::copy(b, b+5, a); return; }
+  Real n = n_a + n_b, delta = b[1] - a[1], delta_n = delta / n,
+    delta_n2 = delta_n * delta_n, n_ab = n_a * n_b,
+    term1 = delta * delta_n * n_ab;
+  Real m2 = a[2] + b[2] + term1,
+    m3 = a[3] + b[3] + term1 * delta_n * (n_a - n_b)
+       + 3. * delta_n * (n_a * b[2] - n_b * a[2]),
+    m4 = a[4] + b[4] + term1 * delta_n2 * (n_a * n_a - n_ab + n_b * n_b)
+       + 6. * delta_n2 * (n_a * n_a * b[2] + n_b * n_b * a[2])
+       + 4. * delta_n * (n_a * b[3] - n_b * a[3]);
+  a[0] = n;  a[1] += delta_n * n_b;  a[2] = m2;  a[3] = m3;  a[4] = m4;
+}
+
+
+void ColumnarSampleStore::central_sums(RealMatrix& sums) const
+{
+  if (sketchSize)
+    { sums = streamSums; return; }
+  sums.shape(5, numFns);
+
+  // two-pass sums within each chunk, merged in chunk order so that the
+  // result does not depend on the number of threads
+  size_t num_chunks = std::max((size_t)1,
+    (numSamples + chunk_samples - 1) / chunk_samples);
+  RealMatrix chunk_sums(5, numFns * num_chunks);
+  run_tasks(numFns * num_chunks, [&](size_t t) {
+    size_t fn = t / num_chunks, c = t % num_chunks, s,
+      s_start = c * chunk_samples,
+      s_end = std::min(numSamples, s_start + chunk_samples);
+    const RealArray& col = fnColumns[fn];  const BitArray& bits = validBits[fn];
+    Real* c_sums = chunk_sums[t];
+    Real n = 0., mean = 0.;
+    for (s=s_start; s<s_end; ++s)
+      if (bits[s])
+	{ mean += col[s]; n += 1.; }
+    if (n == 0.)
+      return;
+    mean /= n;
+    Real m2 = 0., m3 = 0., m4 = 0.;
+    for (s=s_start; s<s_end; ++s)
+      if (bits[s]) {
+	Real dev = col[s] - mean, dev2 = dev * dev;
+	m2 += dev2;  m3 += dev2 * dev;  m4 += dev2 * dev2;
+      }
+    c_sums[0] = n;  c_sums[1] = mean;  c_sums[2] = m2;
+    c_sums[3] = m3;  c_sums[4] = m4;
+  });
+  for (size_t fn=0; fn<numFns; ++fn)
+    for (size_t c=0; c<num_chunks; ++c)
+      merge_central_sums(sums[fn], chunk_sums[fn * num_chunks + c]);
+}
+
+
+void ColumnarSampleStore::extremes(size_t fn, Real& min, Real& max) const
+{
+  if (sketchSize)
+    { min = streamExtremes[fn].first;  max = streamExtremes[fn].second; }
+  else {
+    min = DBL_MAX;  max = -DBL_MAX;
+    const RealArray& col = fnColumns[fn];  const BitArray& bits = validBits[fn];
+    for (size_t s=0; s<numSamples; ++s)
+      if (bits[s]) {
+	if (col[s] < min) min = col[s];
+	if (col[s] > max) max = col[s];
+      }
+  }
+}
+
+
+/** A sample falls in the first bin k for which it is <= levels[k], which
+    is the first k for which it is <= the running maximum of
+    levels[0:k], so bins are located by binary search on the running
+    maximum. */
+void ColumnarSampleStore::
+count_levels(size_t fn, const RealVector& levels, SizetArray& bins) const
+{
+  size_t k, num_lev = levels.length();
+  RealArray max_levels(num_lev);
+  for (k=0; k<num_lev; ++k)
+    max_levels[k] = (k) ? std::max(max_levels[k-1], levels[k]) : levels[k];
+  bins.assign(num_lev+1, 0);
+
+  if (sketchSize) {
+    // cumulative counts at each running maximum from the sketch weights
+    RealArray values, cum_weights;
+    fnSketches[fn].cumulative_weights(values, cum_weights);
+    size_t prev_count = 0;
+    for (k=0; k<num_lev; ++k) {
+      size_t num_le = std::upper_bound(values.begin(), values.end(),
+				       max_levels[k]) - values.begin();
+      size_t count = (num_le) ? (size_t)std::llround(cum_weights[num_le-1])
+	                      : 0;
+      bins[k] = count - prev_count;  prev_count = count;
+    }
+    bins[num_lev] = numValid[fn] - prev_count;
+    return;
+  }
+
+  size_t num_chunks = std::max((size_t)1,
+    (numSamples + chunk_samples - 1) / chunk_samples);
+  std::vector<SizetArray> chunk_bins(num_chunks, SizetArray(num_lev+1, 0));
+  const RealArray& col = fnColumns[fn];  const BitArray& bits = validBits[fn];
+  run_tasks(num_chunks, [&](size_t c) {
+    SizetArray& c_bins = chunk_bins[c];
+    size_t s_end = std::min(numSamples, (c+1) * chunk_samples);
+    for (size_t s=c*chunk_samples; s<s_end; ++s)
+      if (bits[s])
+	++c_bins[std::lower_bound(max_levels.begin(), max_levels.end(),
+				  col[s]) - max_levels.begin()];
+  });
+  for (size_t c=0; c<num_chunks; ++c)
+    for (k=0; k<=num_lev; ++k)
+      bins[k] += chunk_bins[c][k];
+}
+
+
+/** Stored samples are selected with successive nth_element partitions of
+    a copy of the valid samples (a full sort when many ranks are
+    requested); sketches return the first retained value whose cumulative
+    weight exceeds the rank. */
+void ColumnarSampleStore::
+order_statistics(size_t fn, const SizetArray& ranks, RealArray& values) const
+{
+  size_t i, num_ranks = ranks.size(), num_valid = numValid[fn];
+  values.resize(num_ranks);
+  if (!num_valid) {
+    values.assign(num_ranks, std::numeric_limits<Real>::quiet_NaN());
+    return;
+  }
+
+  if (sketchSize) {
+    RealArray sk_values, cum_weights;
+    fnSketches[fn].cumulative_weights(sk_values, cum_weights);
+    // the extremes are known exactly
+    for (i=0; i<num_ranks; ++i) {
+      size_t j = std::upper_bound(cum_weights.begin(), cum_weights.end(),
+				  (Real)ranks[i]) - cum_weights.begin();
+      if (ranks[i] == 0)
+	values[i] = streamExtremes[fn].first;
+      else if (ranks[i] >= num_valid - 1)
+	values[i] = streamExtremes[fn].second;
+      else
+	values[i] = sk_values[std::min(j, sk_values.size() - 1)];
+    }
+    return;
+  }
+
+  const RealArray& col = fnColumns[fn];  const BitArray& bits = validBits[fn];
+  RealArray sorted;  sorted.reserve(num_valid);
+  for (size_t s=0; s<numSamples; ++s)
+    if (bits[s])
+      sorted.push_back(col[s]);
+
+  SizetArray unique_ranks(ranks);
+  for (i=0; i<num_ranks; ++i)
+    unique_ranks[i] = std::min(unique_ranks[i], num_valid - 1);
+  std::sort(unique_ranks.begin(), unique_ranks.end());
+  unique_ranks.erase(std::unique(unique_ranks.begin(), unique_ranks.end()),
+		     unique_ranks.end());
+  if (unique_ranks.size() > 16)
+    std::sort(sorted.begin(), sorted.end());
+  else {
+    // elements following each partition point are not smaller than it,
+    // so each selection only needs to search the remainder
+    RealArray::iterator first = sorted.begin();
+    for (i=0; i<unique_ranks.size(); ++i) {
+      RealArray::iterator nth = sorted.begin() + unique_ranks[i];
+      std::nth_element(first, nth, sorted.end());
+      first = nth + 1;
+    }
+  }
+  for (i=0; i<num_ranks; ++i)
+    values[i] = sorted[std::min(ranks[i], num_valid - 1)];
+}
+
+} // namespace Dakota
@@ -0,0 +1,181 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#ifndef COLUMNAR_SAMPLE_STORE_H
+#define COLUMNAR_SAMPLE_STORE_H
+
+#include "dakota_data_types.hpp"
+#include <random>
+
+namespace Dakota {
+
+
+/// Streaming approximation of the distribution of a set of scalar samples
+
+/** A rank sketch in the style of Karnin, Lang, and Liberty (KLL): values
+    are buffered in levels of geometrically decreasing capacity, and a
+    full level is sorted and halved, promoting every other value, from a
+    random offset, to the next level with twice the weight.  Memory is O(k) for sketch size k,
+    independent of the number of values n, and rank queries are accurate
+    to O(n/k).  The total weight of the retained values is exactly n. */
+class QuantileSketch
+{
+public:
+
+  /// constructor
+  QuantileSketch(size_t sketch_size = 200);
+
+  /// add a value to the sketch
+  void insert(Real value);
+
+  /// number of values inserted
+  size_t count() const;
+  /// number of values retained
+  size_t retained() const;
+
+  /// retained values in ascending order together with the cumulative
+  /// weight of all values up to and including each one
+  void cumulative_weights(RealArray& values, RealArray& cum_weights) const;
+
+private:
+
+  /// capacity of level h
+  size_t capacity(size_t h) const;
+  /// halve the lowest full level(s)
+  void compress();
+
+  /// sketch size k (capacity of the top level)
+  size_t sketchSize;
+  /// number of values inserted
+  size_t numValues;
+  /// generator of the offsets of the values retained by a compaction
+  std::minstd_rand offsetGenerator;
+  /// retained values by level; a value in level h carries weight 2^h
+  std::vector<RealArray> levelValues;
+};
+
+
+inline size_t QuantileSketch::count() const
+{ return numValues; }
+
+
+/// Columnar storage of scalar response function samples
+
+/** Samples are appended as they are evaluated, one contiguous array per
+    response function plus a bitmap of its valid (finite) entries, in
+    place of a map of Response objects.  In sketch mode only the count,
+    mean, central sums, extremes, and a QuantileSketch of each function
+    are kept, so memory does not grow with the number of samples; order
+    statistics and level counts are then approximate.  Reductions over
+    stored columns are split into chunks evaluated by std::thread
+    workers. */
+class ColumnarSampleStore
+{
+public:
+
+  /// default constructor
+  ColumnarSampleStore();
+  /// destructor
+  ~ColumnarSampleStore();
+
+  /// clear the store and size it for num_fns functions; a nonzero
+  /// sketch_size selects sketch mode with that sketch size
+  void initialize(size_t num_fns, size_t sketch_size = 0);
+  /// reserve storage for num_samples samples (no-op in sketch mode)
+  void reserve(size_t num_samples);
+
+  /// append the function values of one sample
+  void append(const RealVector& fn_vals);
+  /// append the function values of a set of samples in eval id order
+  void append(const IntResponseMap& samples);
+
+  /// number of response functions
+  size_t num_functions() const;
+  /// number of samples appended
+  size_t num_samples() const;
+  /// return true if samples are summarized by sketches rather than stored
+  bool sketched() const;
+  /// number of valid samples of function fn
+  size_t num_valid(size_t fn) const;
+
+  /// stored samples of function fn (empty in sketch mode)
+  const RealArray& column(size_t fn) const;
+  /// valid (finite) entries of column(fn)
+  const BitArray& valid(size_t fn) const;
+
+  /// count, mean, and sums of the 2nd through 4th powers of deviations
+  /// from the mean of the valid samples, as the rows of a 5 x
+  /// num_functions() matrix
+  void central_sums(RealMatrix& sums) const;
+  /// minimum and maximum of the valid samples of function fn
+  void extremes(size_t fn, Real& min, Real& max) const;
+  /// number of valid samples of function fn within each bin: bin k holds
+  /// the samples that are <= levels[k] and not within a previous bin, and
+  /// bins[num_levels] holds the remaining samples
+  void count_levels(size_t fn, const RealVector& levels,
+		    SizetArray& bins) const;
+  /// values at positions ranks (zero-based) within the ascending sort of
+  /// the valid samples of function fn
+  void order_statistics(size_t fn, const SizetArray& ranks,
+			RealArray& values) const;
+
+private:
+
+  /// merge central sums b (count, mean, M2, M3, M4) into a
+  static void merge_central_sums(Real* a, const Real* b);
+
+  /// number of response functions
+  size_t numFns;
+  /// number of samples appended
+  size_t numSamples;
+  /// sketch size, or zero when samples are stored
+  size_t sketchSize;
+
+  /// stored samples, one array per function
+  std::vector<RealArray> fnColumns;
+  /// valid entries of fnColumns
+  std::vector<BitArray> validBits;
+  /// number of valid samples per function
+  SizetArray numValid;
+
+  /// central sums accumulated in sketch mode (5 x numFns)
+  RealMatrix streamSums;
+  /// extremes accumulated in sketch mode
+  RealRealPairArray streamExtremes;
+  /// per-function sketches in sketch mode
+  std::vector<QuantileSketch> fnSketches;
+};
+
+
+inline size_t ColumnarSampleStore::num_functions() const
+{ return numFns; }
+
+
+inline size_t ColumnarSampleStore::num_samples() const
+{ return numSamples; }
+
+
+inline bool ColumnarSampleStore::sketched() const
+{ return sketchSize > 0; }
+
+
+inline size_t ColumnarSampleStore::num_valid(size_t fn) const
+{ return numValid[fn]; }
+
+
+inline const RealArray& ColumnarSampleStore::column(size_t fn) const
+{ return fnColumns[fn]; }
+
+
+inline const BitArray& ColumnarSampleStore::valid(size_t fn) const
+{ return validBits[fn]; }
+
+} // namespace Dakota
+
+#endif
@@ -408,6 +408,9 @@ void CommandLineHandler::initialize_options()
   enroll("write_restart", GetLongOpt::OptionalValue,
          "Write a new DAKOTA restart file $val", NULL);
 
+  enroll("indexed_restart", GetLongOpt::Valueless,
+         "Write the restart file in the indexed, appendable format", NULL);
+
   //enroll("mpi", GetLongOpt::Valueless,
   //       "Turn on message passing within an executable built with MPI", 0);
 }
@@ -0,0 +1,239 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "CompletionNotifier.hpp"
+#include <chrono>
+#include <thread>
+
+#if defined(HAVE_SYS_EPOLL_H) && defined(HAVE_SYS_INOTIFY_H)
+#define DAKOTA_COMPLETION_EVENTS
+#include <sys/epoll.h>
+#include <sys/inotify.h>
+#include <sys/syscall.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+#endif
+
+namespace Dakota {
+
+CompletionNotifier::CompletionNotifier():
+  epollFd(-1), inotifyFd(-1), ownerPid(0)
+{ }
+
+
+CompletionNotifier::~CompletionNotifier()
+{ close_all(); }
+
+
+#ifdef DAKOTA_COMPLETION_EVENTS
+
+bool CompletionNotifier::open_epoll()
+{
+  // A forked copy of Dakota (e.g., the intermediate process managing
+  // asynchronous analyses) shares the parent's epoll instance; start over
+  // rather than altering the parent's interest list.
+  if (epollFd >= 0 && ownerPid != getpid()) {
+    for (auto& pid_fd : processFds)
+      close(pid_fd.second);
+    processFds.clear();
+    directoryWatches.clear();
+    if (inotifyFd >= 0)
+      { close(inotifyFd); inotifyFd = -1; }
+    close(epollFd); epollFd = -1;
+  }
+  if (epollFd < 0) {
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    ownerPid = getpid();
+  }
+  return (epollFd >= 0);
+}
+
+
+void CompletionNotifier::close_all()
+{
+  // only the creating process removes watches from the shared instance
+  if (epollFd < 0 || ownerPid != getpid())
+    return;
+  for (auto& pid_fd : processFds)
+    close(pid_fd.second);
+  processFds.clear();
+  directoryWatches.clear();
+  if (inotifyFd >= 0)
+    { close(inotifyFd); inotifyFd = -1; }
+  close(epollFd); epollFd = -1;
+}
+
+
+namespace {
+
+/// whether writes to dir may originate on other hosts, which inotify
+/// does not report (network and parallel file systems)
+bool remote_file_system(const std::string& dir)
+{
+  struct statfs fs;
+  if (statfs(dir.c_str(), &fs) != 0)
+    return true;
+  switch ((unsigned long)fs.f_type) {
+  case 0x6969UL:     // NFS
+  case 0x517BUL:     // SMB
+  case 0xFF534D42UL: // CIFS
+  case 0xFE534D42UL: // SMB2
+  case 0x65735546UL: // FUSE
+  case 0x0BD00BD0UL: // Lustre
+  case 0x47504653UL: // GPFS
+  case 0xAAD7AAEAUL: // PanFS
+  case 0x00C36400UL: // CephFS
+    return true;
+  default:
+    return false;
+  }
+}
+
+} // anonymous namespace
+
+
+bool CompletionNotifier::
+watch_processes(const std::map<pid_t, int>& process_id_map)
+{
+#ifdef SYS_pidfd_open
+  if (!open_epoll())
+    return false;
+
+  // release watches for processes that have been reaped
+  auto fd_it = processFds.begin();
+  while (fd_it != processFds.end())
+    if (process_id_map.find(fd_it->first) == process_id_map.end()) {
+      epoll_ctl(epollFd, EPOLL_CTL_DEL, fd_it->second, NULL);
+      close(fd_it->second);
+      fd_it = processFds.erase(fd_it);
+    }
+    else
+      ++fd_it;
+
+  // a pidfd becomes readable when the process exits, including a process
+  // that has already exited but not yet been reaped
+  bool all_watched = true;
+  for (const auto& pid_id : process_id_map) {
+    pid_t pid = pid_id.first;
+    if (processFds.find(pid) != processFds.end())
+      continue;
+    int pid_fd = (int)syscall(SYS_pidfd_open, pid, 0);
+    if (pid_fd < 0)
+      { all_watched = false; continue; } // e.g., kernel < 5.3
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN; ev.data.fd = pid_fd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, pid_fd, &ev) != 0)
+      { close(pid_fd); all_watched = false; continue; }
+    processFds[pid] = pid_fd;
+  }
+  return all_watched;
+#else
+  return false;
+#endif // SYS_pidfd_open
+}
+
+
+bool CompletionNotifier::
+watch_directories(const std::set<std::filesystem::path>& dirs)
+{
+  if (!open_epoll())
+    return false;
+  if (inotifyFd < 0) {
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0)
+      return false;
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN; ev.data.fd = inotifyFd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, inotifyFd, &ev) != 0)
+      { close(inotifyFd); inotifyFd = -1; return false; }
+  }
+
+  auto wd_it = directoryWatches.begin();
+  while (wd_it != directoryWatches.end())
+    if (dirs.find(wd_it->first) == dirs.end()) {
+      inotify_rm_watch(inotifyFd, wd_it->second);
+      wd_it = directoryWatches.erase(wd_it);
+    }
+    else
+      ++wd_it;
+
+  bool all_watched = true;
+  for (const auto& dir : dirs) {
+    if (directoryWatches.find(dir) != directoryWatches.end())
+      continue;
+    const std::string dir_str = dir.empty() ? std::string(".") : dir.string();
+    if (remote_file_system(dir_str))
+      { all_watched = false; continue; }
+    int wd = inotify_add_watch(inotifyFd, dir_str.c_str(),
+			       IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    if (wd < 0)
+      all_watched = false; // e.g., directory not yet created
+    else
+      directoryWatches[dir] = wd;
+  }
+  return all_watched;
+}
+
+
+bool CompletionNotifier::wait(int timeout_ms)
+{
+  if (epollFd < 0 || ownerPid != getpid() ||
+      (processFds.empty() && directoryWatches.empty())) {
+    if (timeout_ms > 0)
+      std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+    return false;
+  }
+
+  const int max_events = 16;
+  struct epoll_event events[max_events];
+  int num_events = epoll_wait(epollFd, events, max_events, timeout_ms);
+  if (num_events < 0) // EINTR: let the caller test for completions
+    return (errno == EINTR);
+
+  // drain directory events; pidfds remain readable until released by
+  // watch_processes() after the caller reaps the process
+  for (int i=0; i<num_events; ++i)
+    if (events[i].data.fd == inotifyFd) {
+      char buffer[4096];
+      while (read(inotifyFd, buffer, sizeof(buffer)) > 0)
+	{ }
+    }
+  return (num_events > 0);
+}
+
+#else
+
+bool CompletionNotifier::open_epoll()
+{ return false; }
+
+
+void CompletionNotifier::close_all()
+{ }
+
+
+bool CompletionNotifier::
+watch_processes(const std::map<pid_t, int>& process_id_map)
+{ return false; }
+
+
+bool CompletionNotifier::
+watch_directories(const std::set<std::filesystem::path>& dirs)
+{ return false; }
+
+
+bool CompletionNotifier::wait(int timeout_ms)
+{
+  if (timeout_ms > 0)
+    std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+  return false;
+}
+
+#endif // DAKOTA_COMPLETION_EVENTS
+
+} // namespace Dakota
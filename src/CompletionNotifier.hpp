@@ -0,0 +1,90 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#ifndef COMPLETION_NOTIFIER_H
+#define COMPLETION_NOTIFIER_H
+
+#include "dakota_system_defs.hpp"
+#include <filesystem>
+#include <map>
+#include <set>
+
+#ifdef _WIN32
+typedef intptr_t pid_t;
+#else
+#include <sys/types.h>
+#endif
+
+namespace Dakota {
+
+/// Event-driven detection of child process exits and results file
+/// creation for the process-based application interfaces
+
+/** Where available (Linux), child processes are watched through pidfds
+    and results directories through inotify, all multiplexed on one epoll
+    instance, so that wait() blocks until a watched process exits or a
+    file is written in a watched directory.  Elsewhere, or when a watch
+    cannot be established, the watch_*() functions return false and
+    wait() reduces to a sleep, so that callers retain their polling
+    behavior.  Events only indicate that something may have completed;
+    callers still reap processes with waitpid() and test for files. */
+class CompletionNotifier
+{
+public:
+
+  /// constructor; system resources are acquired on first use
+  CompletionNotifier();
+  /// destructor releases all watches
+  ~CompletionNotifier();
+
+  /// watch exactly the processes keyed in process_id_map, releasing
+  /// watches for processes no longer present; returns true if all
+  /// processes are watched
+  bool watch_processes(const std::map<pid_t, int>& process_id_map);
+
+  /// watch exactly the passed directories for files that are written,
+  /// created, or moved into them; returns true if all are watched
+  /// (directories on network file systems are not, since writes from
+  /// other hosts are not reported)
+  bool watch_directories(const std::set<std::filesystem::path>& dirs);
+
+  /// block until a watched event occurs or timeout_ms milliseconds
+  /// elapse (negative for no timeout); returns true if an event occurred
+  bool wait(int timeout_ms);
+
+private:
+
+  /// copy constructor is disallowed due to owned descriptors
+  CompletionNotifier(const CompletionNotifier&);
+  /// assignment is disallowed due to owned descriptors
+  const CompletionNotifier& operator=(const CompletionNotifier&);
+
+  /// create the epoll instance if needed and discard descriptors
+  /// inherited across fork() without exec(); returns false if unavailable
+  bool open_epoll();
+  /// close all descriptors and forget all watches
+  void close_all();
+
+  /// epoll instance multiplexing the process and directory descriptors
+  int epollFd;
+  /// inotify instance for results directories
+  int inotifyFd;
+  /// process that created the descriptors (a forked copy must not share
+  /// the epoll instance of its parent)
+  pid_t ownerPid;
+
+  /// pidfd for each watched child process
+  std::map<pid_t, int> processFds;
+  /// inotify watch descriptor for each watched directory
+  std::map<std::filesystem::path, int> directoryWatches;
+};
+
+} // namespace Dakota
+
+#endif
@@ -32,6 +32,8 @@
 #endif // HAVE_DAKOTA_SURROGATES
 #include "DakotaGraphics.hpp"
 
+#include <algorithm>
+
 //#define ALLOW_GLOBAL_HERMITE_INTERPOLATION
 //#define DEBUG
 
@@ -876,6 +878,63 @@ Real Approximation::prediction_variance(const RealVector& c_vars)
 }
 
 
+/** The default implementation evaluates the points one at a time.
+    Derived classes with multi-point kernels override it. */
+void Approximation::
+batch_value(const Variables& vars, const RealMatrix& c_vars,
+	    RealVector& fn_vals)
+{
+  if (approxRep)
+    { approxRep->batch_value(vars, c_vars, fn_vals); return; }
+
+  int p, num_pts = c_vars.numCols(), num_cv = c_vars.numRows();
+  fn_vals.sizeUninitialized(num_pts);
+  Variables pt_vars = vars.copy();
+  for (p=0; p<num_pts; ++p) {
+    RealVector c_vars_p(Teuchos::View, const_cast<Real*>(c_vars[p]), num_cv);
+    pt_vars.continuous_variables(c_vars_p);
+    fn_vals[p] = value(pt_vars);
+  }
+}
+
+
+void Approximation::
+batch_gradient(const Variables& vars, const RealMatrix& c_vars,
+	       RealMatrix& fn_grads)
+{
+  if (approxRep)
+    { approxRep->batch_gradient(vars, c_vars, fn_grads); return; }
+
+  int p, num_pts = c_vars.numCols(), num_cv = c_vars.numRows();
+  fn_grads.shapeUninitialized(num_cv, num_pts);
+  Variables pt_vars = vars.copy();
+  for (p=0; p<num_pts; ++p) {
+    RealVector c_vars_p(Teuchos::View, const_cast<Real*>(c_vars[p]), num_cv);
+    pt_vars.continuous_variables(c_vars_p);
+    const RealVector& grad = gradient(pt_vars);
+    std::copy(grad.values(), grad.values() + num_cv, fn_grads[p]);
+  }
+}
+
+
+void Approximation::
+batch_prediction_variance(const Variables& vars, const RealMatrix& c_vars,
+			  RealVector& fn_vars)
+{
+  if (approxRep)
+    { approxRep->batch_prediction_variance(vars, c_vars, fn_vars); return; }
+
+  int p, num_pts = c_vars.numCols(), num_cv = c_vars.numRows();
+  fn_vars.sizeUninitialized(num_pts);
+  Variables pt_vars = vars.copy();
+  for (p=0; p<num_pts; ++p) {
+    RealVector c_vars_p(Teuchos::View, const_cast<Real*>(c_vars[p]), num_cv);
+    pt_vars.continuous_variables(c_vars_p);
+    fn_vars[p] = prediction_variance(pt_vars);
+  }
+}
+
+
 bool Approximation::advancement_available()
 {
   if (approxRep) return approxRep->advancement_available();
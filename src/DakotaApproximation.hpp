@@ -135,6 +135,19 @@ public:
   /// retrieve the variance of the predicted value for a given parameter vector
   virtual Real prediction_variance(const RealVector& c_vars);
 
+  /// retrieve the approximate function values for a batch of points: the
+  /// columns of c_vars replace the continuous variables of vars
+  virtual void batch_value(const Variables& vars, const RealMatrix& c_vars,
+			   RealVector& fn_vals);
+  /// retrieve the approximate function gradients (one column per point)
+  /// for a batch of points
+  virtual void batch_gradient(const Variables& vars, const RealMatrix& c_vars,
+			      RealMatrix& fn_grads);
+  /// retrieve the variances of the predicted values for a batch of points
+  virtual void batch_prediction_variance(const Variables& vars,
+					 const RealMatrix& c_vars,
+					 RealVector& fn_vars);
+
   /// return the mean of the expansion, where all active vars are random
   virtual Real mean();
   /// return the mean of the expansion for a given parameter vector,
@@ -35,12 +35,12 @@ void invoke_parse_callback_if_requested(ProblemDescDB& problem_db,
 }
 
 void load_validated_json_input(ProblemDescDB& problem_db,
-                               const nlohmann::json& validated_json,
+                               nlohmann::json&& validated_json,
                                DbCallbackFunctionPtr callback,
                                void* callback_data,
                                int world_rank)
 {
-  problem_db.enable_json_input(validated_json);
+  problem_db.enable_json_input(std::move(validated_json));
   invoke_parse_callback_if_requested(problem_db, callback, callback_data,
                                      world_rank);
 }
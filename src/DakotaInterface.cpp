@@ -301,6 +301,7 @@ print_evaluation_summary(std::ostream& s, bool minimal_header,
                                       : newEvalIdCntr;
   s << ": " << fn_evals << " total (" << new_fn_evals << " new, "
     << fn_evals - new_fn_evals << " duplicate)\n";
+  print_cache_summary(s);
 
   // detailed evaluation summary
   if (fineGrainEvalCounters) {
@@ -997,6 +998,30 @@ const RealVector& Interface::approximation_variances(const Variables& vars)
 }
 
 
+void Interface::
+approximation_values(const Variables& vars, const RealMatrix& c_vars,
+		     RealMatrix& fn_vals)
+{
+  InterfaceUtils::no_derived_method_error();
+}
+
+
+void Interface::
+approximation_gradients(const Variables& vars, const RealMatrix& c_vars,
+			RealMatrixArray& fn_grads)
+{
+  InterfaceUtils::no_derived_method_error();
+}
+
+
+void Interface::
+approximation_variances(const Variables& vars, const RealMatrix& c_vars,
+			RealMatrix& fn_vars)
+{
+  InterfaceUtils::no_derived_method_error();
+}
+
+
 const StringArray& Interface::analysis_drivers() const
 {
   return InterfaceUtils::no_derived_method_error<StringArray>();
@@ -1027,6 +1052,12 @@ bool Interface::restart_file() const
 }
 
 
+void Interface::print_cache_summary(std::ostream& s) const
+{
+  // no-op
+}
+
+
 void Interface::file_cleanup() const
 {
   // no-op
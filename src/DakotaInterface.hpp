@@ -251,6 +251,21 @@ public:
   /// retrieve the approximation variances from each Approximation
   /// within an ApproximationInterface
   virtual const RealVector& approximation_variances(const Variables& vars);
+  /// retrieve the approximation values (one row per function) at the
+  /// points in the columns of c_vars, other variables taken from vars
+  virtual void approximation_values(const Variables& vars,
+				    const RealMatrix& c_vars,
+				    RealMatrix& fn_vals);
+  /// retrieve the approximation gradients (one column per point) at the
+  /// points in the columns of c_vars, other variables taken from vars
+  virtual void approximation_gradients(const Variables& vars,
+				       const RealMatrix& c_vars,
+				       RealMatrixArray& fn_grads);
+  /// retrieve the approximation variances (one row per function) at the
+  /// points in the columns of c_vars, other variables taken from vars
+  virtual void approximation_variances(const Variables& vars,
+				       const RealMatrix& c_vars,
+				       RealMatrix& fn_vars);
 
   /// retrieve the analysis drivers specification for application interfaces
   virtual const StringArray& analysis_drivers() const;
@@ -264,6 +279,8 @@ public:
   virtual bool evaluation_cache() const;
   /// return flag indicating usage of the restart file
   virtual bool restart_file() const;
+  /// print evaluation cache statistics within print_evaluation_summary()
+  virtual void print_cache_summary(std::ostream& s) const;
 
   /// clean up any interface parameter/response files when aborting
   virtual void file_cleanup() const;
@@ -137,7 +137,9 @@ Model::Model(ProblemDescDB& problem_db, ParallelLibrary& parallel_lib):
   modelEvaluationsDBState(EvaluationsDBState::UNINITIALIZED),
   interfEvaluationsDBState(EvaluationsDBState::UNINITIALIZED),
   modelId(problem_db.get_string("model.id")), modelEvalCntr(0),
-  estDerivsFlag(false), initCommsBcastFlag(false), modelAutoGraphicsFlag(false)
+  estDerivsFlag(false),
+  jacSparsityDetect(problem_db.get_bool("responses.jacobian_sparsity.detect")),
+  numFDGradColors(0), initCommsBcastFlag(false), modelAutoGraphicsFlag(false)
 {
   initialize_distribution(mvDist);
   initialize_distribution_parameters(mvDist);
@@ -201,6 +203,13 @@ Model::Model(ProblemDescDB& problem_db, ParallelLibrary& parallel_lib):
     }
   }
 
+  // Jacobian sparsity pattern for grouped finite difference gradients
+  const IntVector& sparse_fn_ids
+    = problem_db.get_iv("responses.jacobian_sparsity.nonzero_functions");
+  if (estimating_derivs && !sparse_fn_ids.empty())
+    initialize_jacobian_sparsity(sparse_fn_ids,
+      problem_db.get_iv("responses.jacobian_sparsity.nonzero_variables"));
+
   // TODO: Tried to be aggressive and swallow metadata when numerical
   // derivatives are active, even though they may be active for some
   // evals and inactive for others. Causes problems with reading the
@@ -276,8 +285,8 @@ Model(const ShortShortPair& vars_view,
   modelEvaluationsDBState(EvaluationsDBState::UNINITIALIZED),
   interfEvaluationsDBState(EvaluationsDBState::UNINITIALIZED),
   modelId(no_spec_id()), // to be replaced by derived ctors
-  modelEvalCntr(0), estDerivsFlag(false), initCommsBcastFlag(false),
-  modelAutoGraphicsFlag(false)
+  modelEvalCntr(0), estDerivsFlag(false), jacSparsityDetect(false),
+  numFDGradColors(0), initCommsBcastFlag(false), modelAutoGraphicsFlag(false)
 {
   bool same_view = (svd.view() == vars_view);
   if (share_svd && same_view) {
@@ -313,8 +322,8 @@ Model::Model(ProblemDescDB& problem_db, ParallelLibrary& parallel_lib, Model::Mo
   modelEvaluationsDBState(EvaluationsDBState::UNINITIALIZED),
   interfEvaluationsDBState(EvaluationsDBState::UNINITIALIZED),
   modelId(no_spec_id()), // to be replaced by derived ctors
-  modelEvalCntr(0), estDerivsFlag(false),
-  initCommsBcastFlag(false), modelAutoGraphicsFlag(false)
+  modelEvalCntr(0), estDerivsFlag(false), jacSparsityDetect(false),
+  numFDGradColors(0), initCommsBcastFlag(false), modelAutoGraphicsFlag(false)
 { /* empty ctor */ }
 
 
@@ -1684,9 +1693,13 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
       }
     }
   }
+  // gradients are grouped by color only when no Hessians are differenced
+  bool sparse_grads = (fd_grad_flag && sparse_fd_gradients(orig_dvv,
+							     fd_hess_flag));
   if (asynch_flag) { // communicate settings to synchronize_derivatives()
     initialMapList.push_back(initial_map);
     dbCaptureList.push_back(db_capture);
+    sparseFDList.push_back(sparse_grads);
   }
 
   if (initial_map) {
@@ -1737,7 +1750,10 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
       }
     }
   }
-  if (fd_grad_flag || fd_hess_flag) {
+  if (sparse_grads)
+    map_counter += estimate_sparse_gradients(orig_dvv, fd_grad_asv, new_set,
+      initial_map_response.function_values(), new_fn_grads, asynch_flag);
+  else if (fd_grad_flag || fd_hess_flag) {
 
     // define lower/upper bounds for finite differencing and cv_ids
     RealVector x0, fd_lb, fd_ub;
@@ -2265,6 +2281,10 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
           ifg += num_deriv_vars;
         }
 
+    if (fd_grad_flag && !sparse_grads && jacSparsityDetect &&
+	fdGradColors.empty())
+      detect_jacobian_sparsity(orig_dvv, fd_grad_asv, new_fn_grads);
+
     update_response(currentVariables, currentResponse, fd_grad_asv, fd_hess_asv,
                     quasi_hess_asv, original_set, initial_map_response,
                     new_fn_grads, new_fn_hessians);
@@ -2333,6 +2353,7 @@ synchronize_derivatives(const Variables& vars,
   // or from a DB capture in estimate_derivatives()
   bool initial_map = initialMapList.front(); initialMapList.pop_front();
   bool db_capture  = dbCaptureList.front();  dbCaptureList.pop_front();
+  bool sparse_grads = sparseFDList.front();  sparseFDList.pop_front();
   Response initial_map_response;
   IntRespMCIter fd_resp_cit = fd_responses.begin();
   if (initial_map) {
@@ -2356,7 +2377,34 @@ synchronize_derivatives(const Variables& vars,
   }
 
   // Postprocess the finite difference responses
-  if (fd_grad_flag || fd_hess_flag) {
+  if (sparse_grads) {
+    // deltas for each variable, then responses for each populated color,
+    // as ordered by estimate_sparse_gradients()
+    bool central = (intervalType == "central");
+    RealVector h(num_deriv_vars), h2(num_deriv_vars);
+    for (j=0; j<num_deriv_vars; ++j) {
+      h[j] = deltaList.front(); deltaList.pop_front();
+      if (central && h[j] != 0.)
+	{ h2[j] = deltaList.front(); deltaList.pop_front(); }
+    }
+    RealVectorArray fn_vals_plus_h(numFDGradColors),
+      fn_vals_minus_h(numFDGradColors);
+    for (size_t c=0; c<numFDGradColors; ++c) {
+      for (j=0; j<num_deriv_vars; ++j)
+	if (fdGradColors[j] == c && h[j] != 0.)
+	  break;
+      if (j == num_deriv_vars) // no variable of this color is differenced
+	continue;
+      fn_vals_plus_h[c] = fd_resp_cit->second.function_values(); ++fd_resp_cit;
+      if (central)
+	{ fn_vals_minus_h[c] = fd_resp_cit->second.function_values();
+	  ++fd_resp_cit; }
+    }
+    decompress_sparse_gradients(fd_grad_asv, h, h2,
+				initial_map_response.function_values(),
+				fn_vals_plus_h, fn_vals_minus_h, new_fn_grads);
+  }
+  else if (fd_grad_flag || fd_hess_flag) {
     SizetMultiArray cv_ids;
     if (orig_dvv == currentVariables.continuous_variable_ids()) {
       cv_ids.resize(boost::extents[current_variables().cv()]);
@@ -2544,12 +2592,277 @@ synchronize_derivatives(const Variables& vars,
             ifg += num_deriv_vars;
           }
 
+  if (fd_grad_flag && !sparse_grads && jacSparsityDetect &&
+      fdGradColors.empty())
+    detect_jacobian_sparsity(orig_dvv, fd_grad_asv, new_fn_grads);
+
   update_response(vars, new_response, fd_grad_asv, fd_hess_asv, quasi_hess_asv,
                   original_set, initial_map_response, new_fn_grads,
                   new_fn_hessians);
 }
 
 
+/** Grouped differencing applies to gradients with respect to the active
+    continuous variables, for which the sparsity pattern is defined, and
+    is not combined with finite difference Hessians. */
+bool Model::
+sparse_fd_gradients(const SizetArray& orig_dvv, bool fd_hess_flag) const
+{
+  return ( !fd_hess_flag && !fdGradColors.empty() &&
+	   orig_dvv.size() == fdGradColors.size() &&
+	   orig_dvv == currentVariables.continuous_variable_ids() );
+}
+
+
+/** Each evaluation perturbs all variables of one color by their individual
+    steps (as computed for dense differencing).  Since no response
+    function depends on two variables of the same color, each nonzero
+    Jacobian entry is recovered from the evaluations of its variable's
+    color.  For asynchronous evaluations, the steps of all variables are
+    queued in deltaList ahead of the evaluations of each color. */
+int Model::
+estimate_sparse_gradients(const SizetArray& orig_dvv,
+			  const ShortArray& fd_grad_asv, ActiveSet& new_set,
+			  const RealVector& fn_vals_x0,
+			  RealMatrix& new_fn_grads, const bool asynch_flag)
+{
+  RealVector x0, fd_lb, fd_ub;
+  bool active_derivs, inactive_derivs;
+  SizetMultiArrayConstView cv_ids =
+    initialize_x0_bounds(orig_dvv, active_derivs, inactive_derivs, x0,
+			 fd_lb, fd_ub);
+
+  size_t j, c, num_deriv_vars = orig_dvv.size();
+  bool central = (intervalType == "central");
+  SizetArray x_index(num_deriv_vars);
+  RealVector h(num_deriv_vars), h2(num_deriv_vars);
+  for (j=0; j<num_deriv_vars; ++j) {
+    size_t xj_index = x_index[j] = find_index(cv_ids, orig_dvv[j]);
+    Real x0_j = x0[xj_index], lb_j = fd_lb[j], ub_j = fd_ub[j];
+    if (ignoreBounds || lb_j < ub_j) { // else zero gradient
+      h[j] = forward_grad_step(num_deriv_vars, xj_index, x0_j, lb_j, ub_j);
+      if (central)
+	h2[j] = FDstep2(x0_j, lb_j, ub_j, h[j]);
+    }
+    if (asynch_flag) { // communicate settings to synchronize_derivatives()
+      deltaList.push_back(h[j]);
+      if (central && h[j] != 0.)
+	deltaList.push_back(h2[j]);
+    }
+  }
+
+  new_set.request_vector(fd_grad_asv);
+  int map_counter = 0;
+  RealVector x;
+  RealVectorArray fn_vals_plus_h(numFDGradColors),
+    fn_vals_minus_h(numFDGradColors);
+  for (c=0; c<numFDGradColors; ++c) {
+    for (int side=0; side<2; ++side) {
+      if (side && !central)
+	break;
+      const RealVector& steps = (side) ? h2 : h;
+      x = x0;
+      bool perturbed = false;
+      for (j=0; j<num_deriv_vars; ++j)
+	if (fdGradColors[j] == c && h[j] != 0.)
+	  { x[x_index[j]] += steps[j]; perturbed = true; }
+      if (!perturbed)
+	break;
+
+      if (outputLevel > SILENT_OUTPUT)
+	Cout << ">>>>> Dakota finite difference gradient evaluation for "
+	     << "variable group " << c+1 << ((side) ? " - h:\n" : " + h:\n");
+      if (active_derivs)
+	currentVariables.continuous_variables(x);
+      else if (inactive_derivs)
+	currentVariables.inactive_continuous_variables(x);
+      else
+	currentVariables.all_continuous_variables(x);
+      if (asynch_flag) {
+	derived_evaluate_nowait(new_set);
+	if (outputLevel > SILENT_OUTPUT)
+	  Cout << "\n\n";
+      }
+      else {
+	derived_evaluate(new_set);
+	RealVector& fn_vals = (side) ? fn_vals_minus_h[c] : fn_vals_plus_h[c];
+	fn_vals = currentResponse.function_values();
+      }
+      ++map_counter;
+    }
+  }
+
+  // Reset currentVariables to x0 (for graphics, etc.)
+  if (active_derivs)
+    currentVariables.continuous_variables(x0);
+  else if (inactive_derivs)
+    currentVariables.inactive_continuous_variables(x0);
+  else
+    currentVariables.all_continuous_variables(x0);
+
+  if (!asynch_flag)
+    decompress_sparse_gradients(fd_grad_asv, h, h2, fn_vals_x0,
+				fn_vals_plus_h, fn_vals_minus_h, new_fn_grads);
+  return map_counter;
+}
+
+
+/** Entries outside of jacSparsity and those of fixed variables (zero
+    step) are zero.  Central differences follow the dense logic: a
+    symmetric pair of steps is differenced directly, while a shortened
+    step near a bound uses the second-order formula with f(x0). */
+void Model::
+decompress_sparse_gradients(const ShortArray& fd_grad_asv,
+			    const RealVector& h, const RealVector& h2,
+			    const RealVector& fn_vals_x0,
+			    const RealVectorArray& fn_vals_plus_h,
+			    const RealVectorArray& fn_vals_minus_h,
+			    RealMatrix& new_fn_grads) const
+{
+  size_t i, j, num_deriv_vars = h.length();
+  bool central = (intervalType == "central");
+  new_fn_grads.shape(num_deriv_vars, numFns); // zero fill
+  for (i=0; i<numFns; ++i) {
+    if (!fd_grad_asv[i])
+      continue;
+    const BitArray& depends_i = jacSparsity[i];
+    for (j=0; j<num_deriv_vars; ++j) {
+      Real h_j = h[j];
+      if (!depends_i[j] || h_j == 0.)
+	continue;
+      size_t c = fdGradColors[j];
+      Real f_plus = fn_vals_plus_h[c][i];
+      if (!central)
+	new_fn_grads(j,i) = (f_plus - fn_vals_x0[i]) / h_j;
+      else {
+	Real h2_j = h2[j], f_minus = fn_vals_minus_h[c][i];
+	if (h_j + h2_j == 0.)
+	  new_fn_grads(j,i) = (f_plus - f_minus) / (h_j - h2_j);
+	else
+	  new_fn_grads(j,i) = ( h2_j*h2_j*(f_plus  - fn_vals_x0[i]) -
+				h_j*h_j  *(f_minus - fn_vals_x0[i]) )
+	                    / (h_j*h2_j*(h2_j-h_j));
+      }
+    }
+  }
+}
+
+
+void Model::
+initialize_jacobian_sparsity(const IntVector& fn_ids, const IntVector& var_ids)
+{
+  size_t k, num_nz = fn_ids.length();
+  if (var_ids.length() != num_nz) {
+    Cerr << "Error: jacobian_sparsity requires nonzero_functions and "
+	 << "nonzero_variables of equal length." << std::endl;
+    abort_handler(MODEL_ERROR);
+  }
+  jacSparsity.assign(numFns, BitArray(numDerivVars));
+  for (k=0; k<num_nz; ++k) {
+    int fn_id = fn_ids[k], var_id = var_ids[k];
+    if (fn_id < 1 || fn_id > (int)numFns || var_id < 1 ||
+	var_id > (int)numDerivVars) {
+      Cerr << "Error: jacobian_sparsity entry (" << fn_id << ", " << var_id
+	   << ") is outside of " << numFns << " response functions and "
+	   << numDerivVars << " continuous variables." << std::endl;
+      abort_handler(MODEL_ERROR);
+    }
+    jacSparsity[fn_id-1].set(var_id-1);
+  }
+  color_jacobian_columns();
+}
+
+
+/** A Jacobian entry is taken to be structurally nonzero if its finite
+    difference is nonzero: a response that does not depend on a variable
+    returns identical values when only that variable is perturbed.
+    Detection requires that the gradients of all numerically differenced
+    functions were estimated with respect to the active continuous
+    variables; otherwise it is deferred to a later evaluation. */
+void Model::
+detect_jacobian_sparsity(const SizetArray& orig_dvv,
+			 const ShortArray& fd_grad_asv,
+			 const RealMatrix& new_fn_grads)
+{
+  if (orig_dvv.size() != numDerivVars ||
+      orig_dvv != currentVariables.continuous_variable_ids())
+    return;
+  size_t i, j;
+  for (i=0; i<numFns; ++i)
+    if ( !fd_grad_asv[i] && ( gradientType == "numerical" ||
+			      contains(gradIdNumerical, i+1) ) )
+      return;
+
+  jacSparsity.assign(numFns, BitArray(numDerivVars));
+  for (i=0; i<numFns; ++i)
+    if (fd_grad_asv[i])
+      for (j=0; j<numDerivVars; ++j)
+	if (new_fn_grads(j,i) != 0.)
+	  jacSparsity[i].set(j);
+  color_jacobian_columns();
+}
+
+
+/** Greedy coloring of the column intersection graph, in which two columns
+    are adjacent if some row has nonzeros in both, visiting columns in
+    order of decreasing nonzero count (largest first).  Columns of one
+    color are structurally orthogonal and can be differenced together. */
+void Model::color_jacobian_columns()
+{
+  size_t i, j, k, num_cols = numDerivVars;
+  SizetArray col_nnz(num_cols, 0);
+  std::vector<SizetArray> row_cols(numFns);
+  for (i=0; i<numFns; ++i)
+    for (j=0; j<num_cols; ++j)
+      if (jacSparsity[i][j])
+	{ row_cols[i].push_back(j); ++col_nnz[j]; }
+  std::vector<SizetArray> col_rows(num_cols);
+  for (i=0; i<numFns; ++i)
+    for (k=0; k<row_cols[i].size(); ++k)
+      col_rows[row_cols[i][k]].push_back(i);
+
+  SizetArray order(num_cols);
+  for (j=0; j<num_cols; ++j)
+    order[j] = j;
+  std::stable_sort(order.begin(), order.end(),
+		   [&col_nnz](size_t a, size_t b)
+		   { return col_nnz[a] > col_nnz[b]; });
+
+  const size_t uncolored = _NPOS;
+  fdGradColors.assign(num_cols, uncolored);
+  numFDGradColors = 0;
+  SizetArray color_mark; // color_mark[c] == j if c is used by a neighbor of j
+  for (k=0; k<num_cols; ++k) {
+    j = order[k];
+    const SizetArray& rows_j = col_rows[j];
+    for (size_t r=0; r<rows_j.size(); ++r) {
+      const SizetArray& nbrs = row_cols[rows_j[r]];
+      for (size_t n=0; n<nbrs.size(); ++n) {
+	size_t c_n = fdGradColors[nbrs[n]];
+	if (c_n != uncolored)
+	  color_mark[c_n] = j;
+      }
+    }
+    size_t c = 0;
+    while (c < numFDGradColors && color_mark[c] == j)
+      ++c;
+    if (c == numFDGradColors)
+      { ++numFDGradColors; color_mark.push_back(_NPOS); }
+    fdGradColors[j] = c;
+  }
+
+  if (outputLevel >= NORMAL_OUTPUT) {
+    size_t num_nz = 0;
+    for (j=0; j<num_cols; ++j)
+      num_nz += col_nnz[j];
+    Cout << "\nJacobian sparsity for model '" << modelId << "': " << num_nz
+	 << " nonzeros; finite difference gradients group " << num_cols
+	 << " variables into " << numFDGradColors << " evaluation"
+	 << ((numFDGradColors == 1) ? "" : "s") << ".\n";
+  }
+}
+
+
 /** Overlay the initial_map_response with numerically estimated new_fn_grads
     and new_fn_hessians to populate new_response as governed by asv vectors.
     Quasi-Newton secant Hessian updates are also performed here, since this
@@ -4086,6 +4399,39 @@ const RealVector& Model::approximation_variances(const Variables& vars)
 }
 
 
+void Model::
+approximation_values(const Variables& vars, const RealMatrix& c_vars,
+		     RealMatrix& fn_vals)
+{
+  Cerr << "Error: Letter lacking redefinition of virtual approximation_"
+       << "values() function.\nThis model does not support approximations."
+       << std::endl;
+  abort_handler(MODEL_ERROR);
+}
+
+
+void Model::
+approximation_gradients(const Variables& vars, const RealMatrix& c_vars,
+			RealMatrixArray& fn_grads)
+{
+  Cerr << "Error: Letter lacking redefinition of virtual approximation_"
+       << "gradients() function.\nThis model does not support "
+       << "approximations." << std::endl;
+  abort_handler(MODEL_ERROR);
+}
+
+
+void Model::
+approximation_variances(const Variables& vars, const RealMatrix& c_vars,
+			RealMatrix& fn_vars)
+{
+  Cerr << "Error: Letter lacking redefinition of virtual approximation_"
+       << "variances() function.\nThis model does not support "
+       << "approximations." << std::endl;
+  abort_handler(MODEL_ERROR);
+}
+
+
 const RealVector& Model::error_estimates()
 {
   Cerr << "Error: Letter lacking redefinition of virtual error_estimates() "
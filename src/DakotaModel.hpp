@@ -503,6 +503,21 @@ public:
   /// retrieve the prediction variances from each Approximation within
   /// a DataFitSurrModel
   virtual const RealVector& approximation_variances(const Variables& vars);
+  /// retrieve the approximation values at the points in the columns of
+  /// c_vars (one row per function) from a DataFitSurrModel
+  virtual void approximation_values(const Variables& vars,
+				    const RealMatrix& c_vars,
+				    RealMatrix& fn_vals);
+  /// retrieve the approximation gradients at the points in the columns
+  /// of c_vars (one matrix per function) from a DataFitSurrModel
+  virtual void approximation_gradients(const Variables& vars,
+				       const RealMatrix& c_vars,
+				       RealMatrixArray& fn_grads);
+  /// retrieve the prediction variances at the points in the columns of
+  /// c_vars (one row per function) from a DataFitSurrModel
+  virtual void approximation_variances(const Variables& vars,
+				       const RealMatrix& c_vars,
+				       RealMatrix& fn_vars);
 
   /// set discrepancy emulation mode used in SurrogateModels for
   /// approximating response differences
@@ -742,6 +757,9 @@ public:
   const IntSet& gradient_id_analytic() const;
   /// return the mixed gradient numerical IDs (gradIdNumerical)
   const IntSet& gradient_id_numerical() const;
+  /// return the number of colors of the Jacobian sparsity pattern
+  /// (numFDGradColors; 0 if finite difference gradients are not grouped)
+  size_t num_fd_gradient_colors() const;
 
   /// return the Hessian evaluation type (hessianType)
   const String& hessian_type() const;
@@ -1191,6 +1209,39 @@ private:
 			       const ShortArray& quasi_hess_asv,
 			       const ActiveSet& original_set);
 
+  /// return true if the finite difference gradients of a derivative
+  /// request are grouped according to fdGradColors
+  bool sparse_fd_gradients(const SizetArray& orig_dvv,
+			   bool fd_hess_flag) const;
+  /// evaluate finite difference gradients with one evaluation (two for
+  /// central differences) per color of the Jacobian sparsity pattern
+  int estimate_sparse_gradients(const SizetArray& orig_dvv,
+				const ShortArray& fd_grad_asv,
+				ActiveSet& new_set,
+				const RealVector& fn_vals_x0,
+				RealMatrix& new_fn_grads,
+				const bool asynch_flag);
+  /// recover gradients from the differences of the grouped evaluations of
+  /// estimate_sparse_gradients()
+  void decompress_sparse_gradients(const ShortArray& fd_grad_asv,
+				   const RealVector& h, const RealVector& h2,
+				   const RealVector& fn_vals_x0,
+				   const RealVectorArray& fn_vals_plus_h,
+				   const RealVectorArray& fn_vals_minus_h,
+				   RealMatrix& new_fn_grads) const;
+  /// define jacSparsity from 1-based (function, variable) ids of the
+  /// structural nonzeros and color its columns
+  void initialize_jacobian_sparsity(const IntVector& fn_ids,
+				    const IntVector& var_ids);
+  /// define jacSparsity from the nonzeros of dense finite difference
+  /// gradients and color its columns
+  void detect_jacobian_sparsity(const SizetArray& orig_dvv,
+				const ShortArray& fd_grad_asv,
+				const RealMatrix& new_fn_grads);
+  /// group the columns of jacSparsity into structurally orthogonal sets
+  /// (Curtis-Powell-Reid coloring)
+  void color_jacobian_columns();
+
   /// overlay results to update a response object
   void update_response(const Variables& vars, Response& new_response,
 		       const ShortArray& fd_grad_asv,
@@ -1236,6 +1287,17 @@ private:
   /// flags finite-difference step size adjusted by bounds
   bool shortStep;
 
+  /// Jacobian sparsity pattern: the active continuous variables on which
+  /// each response function depends
+  std::vector<BitArray> jacSparsity;
+  /// detect jacSparsity from the first dense finite difference gradients
+  bool jacSparsityDetect;
+  /// color of each active continuous variable for grouped finite
+  /// difference gradients; empty when gradients are not grouped
+  SizetArray fdGradColors;
+  /// number of colors in fdGradColors
+  size_t numFDGradColors;
+
   /// map<> used for tracking modelPCIter instances using depth of parallelism
   /// level and max evaluation concurrency as the lookup keys
   std::map<SizetIntPair, ParConfigLIter> modelPCIterMap;
@@ -1269,6 +1331,9 @@ private:
   ResponseList dbResponseList;
   /// transfers deltas from estimate_derivatives() to synchronize_derivatives()
   RealList deltaList;
+  /// transfers grouped differencing flags from estimate_derivatives() to
+  /// synchronize_derivatives()
+  BoolList sparseFDList;
 
   /// tracks the number of evaluations used within estimate_derivatives().
   /// Used in synchronize() as a key for combining finite difference
@@ -1428,6 +1493,10 @@ inline const IntSet& Model::gradient_id_numerical() const
 { return gradIdNumerical; }
 
 
+inline size_t Model::num_fd_gradient_colors() const
+{ return numFDGradColors; }
+
+
 inline const String& Model::hessian_type() const
 { return hessianType; }
 
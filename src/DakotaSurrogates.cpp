@@ -14,6 +14,7 @@
 #include "DakotaVariables.hpp"
 #include "DataMethod.hpp"
 #include "SharedSurfpackApproxData.hpp"
+#include "dakota_thread_util.hpp"
 
 // Headers from Surrogates module
 #include "SurrogatesBase.hpp"
@@ -80,8 +81,11 @@ SurrogatesBaseApprox::cv_diagnostic(const StringArray& metric_types,
   MatrixXd vars, resp;
   convert_surrogate_data(vars,resp);
 
+  // folds are fit concurrently; one thread per core, except in a
+  // parallel MPI run, where the ranks may already occupy every core
   VectorXd cv_metrics_eigen =
-    model->cross_validate(vars, resp, metric_types, num_folds, 6716);
+    model->cross_validate(vars, resp, metric_types, num_folds, 6716,
+			  (int)worker_threads(NULL));
 
   return RealArray(cv_metrics_eigen.data(),
 		   cv_metrics_eigen.data() + cv_metrics_eigen.size());
@@ -318,6 +322,62 @@ const RealSymMatrix& SurrogatesBaseApprox::hessian(const RealVector& c_vars)
 }
 
 
+MatrixXd SurrogatesBaseApprox::
+map_eval_vars(const Variables& vars, const RealMatrix& c_vars)
+{
+  int p, num_pts = c_vars.numCols(), num_cv = c_vars.numRows();
+  size_t j, num_v = sharedDataRep->numVars;
+  MatrixXd eval_pts(num_pts, num_v);
+  Variables pt_vars = vars.copy();
+  for (p=0; p<num_pts; ++p) {
+    RealVector c_vars_p(Teuchos::View, const_cast<Real*>(c_vars[p]), num_cv);
+    pt_vars.continuous_variables(c_vars_p);
+    RealVector surr_vars = map_eval_vars(pt_vars);
+    for (j=0; j<num_v; ++j)
+      eval_pts(p,j) = surr_vars[j];
+  }
+  return eval_pts;
+}
+
+
+void SurrogatesBaseApprox::
+batch_value(const Variables& vars, const RealMatrix& c_vars,
+	    RealVector& fn_vals)
+{
+  if (!model) {
+    Cerr << "Error: surface is null in SurrogatesBaseApprox::batch_value()"
+	 << std::endl;
+    abort_handler(-1);
+  }
+
+  VectorXd vals = model->value(map_eval_vars(vars, c_vars));
+  int p, num_pts = c_vars.numCols();
+  fn_vals.sizeUninitialized(num_pts);
+  for (p=0; p<num_pts; ++p)
+    fn_vals[p] = vals(p);
+}
+
+
+void SurrogatesBaseApprox::
+batch_gradient(const Variables& vars, const RealMatrix& c_vars,
+	       RealMatrix& fn_grads)
+{
+  if (!model) {
+    Cerr << "Error: surface is null in SurrogatesBaseApprox::batch_gradient()"
+	 << std::endl;
+    abort_handler(-1);
+  }
+
+  // one row per point
+  MatrixXd pred_grad = model->gradient(map_eval_vars(vars, c_vars));
+  int p, num_pts = c_vars.numCols(), num_v = pred_grad.cols();
+  fn_grads.shapeUninitialized(num_v, num_pts);
+  for (p=0; p<num_pts; ++p)
+    for (int j=0; j<num_v; ++j)
+      fn_grads(j,p) = pred_grad(p,j);
+}
+
+
 void SurrogatesBaseApprox::
 import_model(const ProblemDescDB& problem_db)
 {
@@ -89,6 +89,14 @@ protected:
 
   const RealSymMatrix& hessian(const RealVector& c_vars) override;
 
+  /// evaluate the surrogate at all points in a single call
+  void batch_value(const Variables& vars, const RealMatrix& c_vars,
+		   RealVector& fn_vals) override;
+
+  /// evaluate the surrogate gradient at all points in a single call
+  void batch_gradient(const Variables& vars, const RealMatrix& c_vars,
+		      RealMatrix& fn_grads) override;
+
   /// set the surrogate's verbosity level according to Dakota's verbosity
   void set_verbosity();
 
@@ -101,6 +109,11 @@ protected:
   /// extract active or all view as vector, mapping if needed for import
   RealVector map_eval_vars(const Variables& vars);
 
+  /// extract the active or all view for each point in the columns of
+  /// c_vars (one row per point), other variables taken from vars
+  dakota::MatrixXd map_eval_vars(const Variables& vars,
+				 const RealMatrix& c_vars);
+
   /// export the model to disk
   void
   export_model(const StringArray& var_labels, const String& fn_label,
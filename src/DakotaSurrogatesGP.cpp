@@ -12,6 +12,7 @@
 #include "DakotaVariables.hpp"
 #include "ProblemDescDB.hpp"
 #include "SharedSurfpackApproxData.hpp"
+#include "dakota_thread_util.hpp"
 
 // Headers from Surrogates module
 #include "SurrogatesGaussianProcess.hpp"
@@ -65,6 +66,9 @@ SurrogatesGPApprox(const ProblemDescDB& problem_db,
   // Number of optimization restarts
   int num_restarts = problem_db.get_int("model.surrogate.num_restarts");
   surrogateOpts.set("num restarts", num_restarts);
+  // restarts are threaded; one thread per core, except in a parallel
+  // MPI run, where the ranks may already occupy every core
+  surrogateOpts.set("num threads", (int)worker_threads(NULL));
 
   // validate supported metrics
   std::set<std::string> allowed_metrics =
@@ -92,6 +96,7 @@ SurrogatesGPApprox(const SharedApproxData& shared_data):
   //surrogateOpts.sublist("Trend").sublist("Options").set("reduced basis", true);
 
   surrogateOpts.set("num restarts", 20);
+  surrogateOpts.set("num threads", (int)worker_threads(NULL));
 
   // allow larger bounds for functions with high variability
   //VectorXd sig_bnds(2);
@@ -189,6 +194,25 @@ Real SurrogatesGPApprox::prediction_variance(const RealVector& c_vars)
   return gp_model->variance(eval_point)(0);
 }
 
+void SurrogatesGPApprox::
+batch_prediction_variance(const Variables& vars, const RealMatrix& c_vars,
+			  RealVector& fn_vars)
+{
+  if (!model) {
+    Cerr << "Error: surface is null in SurrogatesGPApprox::"
+	 << "batch_prediction_variance()" << std::endl;
+    abort_handler(-1);
+  }
+
+  auto gp_model =
+      std::static_pointer_cast<dakota::surrogates::GaussianProcess>(model);
+  VectorXd vars_vec = gp_model->variance(map_eval_vars(vars, c_vars));
+  int p, num_pts = c_vars.numCols();
+  fn_vars.sizeUninitialized(num_pts);
+  for (p=0; p<num_pts; ++p)
+    fn_vars[p] = vars_vec(p);
+}
+
 void set_model_gp_options(Model& model, const String& options_file) {
   #ifdef DISABLE_YAML_SURROGATES_CONFIG
     throw std::runtime_error("Configuring a surrogate using a YAML file not supported by this build of Dakota");
@@ -51,6 +51,10 @@ protected:
 
   Real prediction_variance(const RealVector& c_vars) override;
 
+  void batch_prediction_variance(const Variables& vars,
+				 const RealMatrix& c_vars,
+				 RealVector& fn_vars) override;
+
 };
 
 // free function for setting up experimental GPs with an
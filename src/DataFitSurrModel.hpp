@@ -283,6 +283,18 @@ public:
   /// return the approximation variance from each Approximation
   /// (request forwarded to approxInterface)
   const RealVector& approximation_variances(const Variables& vars) override;
+  /// return the approximation values at a set of points
+  /// (request forwarded to approxInterface)
+  void approximation_values(const Variables& vars, const RealMatrix& c_vars,
+			    RealMatrix& fn_vals) override;
+  /// return the approximation gradients at a set of points
+  /// (request forwarded to approxInterface)
+  void approximation_gradients(const Variables& vars, const RealMatrix& c_vars,
+			       RealMatrixArray& fn_grads) override;
+  /// return the approximation variances at a set of points
+  /// (request forwarded to approxInterface)
+  void approximation_variances(const Variables& vars, const RealMatrix& c_vars,
+			       RealMatrix& fn_vars) override;
   /// return the approximation data from a particular Approximation
   /// (request forwarded to approxInterface)
   const Pecos::SurrogateData& approximation_data(size_t fn_index) override;
@@ -899,6 +911,24 @@ approximation_variances(const Variables& vars)
 { return approxInterface->approximation_variances(vars); }
 
 
+inline void DataFitSurrModel::
+approximation_values(const Variables& vars, const RealMatrix& c_vars,
+		     RealMatrix& fn_vals)
+{ approxInterface->approximation_values(vars, c_vars, fn_vals); }
+
+
+inline void DataFitSurrModel::
+approximation_gradients(const Variables& vars, const RealMatrix& c_vars,
+			RealMatrixArray& fn_grads)
+{ approxInterface->approximation_gradients(vars, c_vars, fn_grads); }
+
+
+inline void DataFitSurrModel::
+approximation_variances(const Variables& vars, const RealMatrix& c_vars,
+			RealMatrix& fn_vars)
+{ approxInterface->approximation_variances(vars, c_vars, fn_vars); }
+
+
 inline const Pecos::SurrogateData& DataFitSurrModel::
 approximation_data(size_t fn_index)
 { return approxInterface->approximation_data(fn_index); }
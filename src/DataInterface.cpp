@@ -17,19 +17,22 @@ namespace Dakota {
 DataInterfaceRep::DataInterfaceRep():
   interfaceType(DEFAULT_INTERFACE),
   allowExistingResultsFlag(false), verbatimFlag(false),
+  persistentFlag(false),
   parametersFileFormat(PARAMETERS_FILE_STANDARD), 
   resultsFileFormat(RESULTS_FILE_STANDARD), dakotaResultsFileLabeled(false),
   fileTagFlag(false), fileSaveFlag(false),
   batchEvalFlag(false), asynchFlag(false),
   asynchLocalEvalConcurrency(0), asynchLocalEvalScheduling(DEFAULT_SCHEDULING),
   asynchLocalAnalysisConcurrency(0), evalServers(0),
-  evalScheduling(DEFAULT_SCHEDULING), procsPerEval(0), analysisServers(0),
+  evalScheduling(DEFAULT_SCHEDULING), evalPrefetch(1), procsPerEval(0),
+  analysisServers(0),
   analysisScheduling(DEFAULT_SCHEDULING), procsPerAnalysis(0),
   failAction("abort"), retryLimit(1), activeSetVectorFlag(true),
   evalCacheFlag(true), nearbyEvalCacheFlag(false),
   nearbyEvalCacheTol(DBL_EPSILON), // default relative tolerance is tight
-  restartFileFlag(true), useWorkdir(false), dirTag(false),
-  dirSave(false), templateReplace(false), numpyFlag(false)
+  evalCacheMemLimit(0.), restartFileFlag(true), useWorkdir(false),
+  dirTag(false), dirSave(false), templateReplace(false), dirRecycle(false),
+  numpyFlag(false), columnarFlag(false)
   // asynchLocal{Eval,Analysis}Concurrency, procsPer{Eval,Analysis} and
   // {eval,analysis}Servers default to zero in order to allow detection of
   // user overrides > 0
@@ -40,17 +43,19 @@ void DataInterfaceRep::write(MPIPackBuffer& s) const
 {
   s << idInterface << interfaceType << algebraicMappings << analysisDrivers
     << analysisComponents << inputFilter << outputFilter << parametersFile
-    << resultsFile << allowExistingResultsFlag  << verbatimFlag  
+    << resultsFile << allowExistingResultsFlag  << verbatimFlag  << persistentFlag
     << parametersFileFormat << resultsFileFormat 
     << dakotaResultsFileLabeled << fileTagFlag << fileSaveFlag //<< gridHostNames << gridProcsPerHost
     << batchEvalFlag << asynchFlag << asynchLocalEvalConcurrency
     << asynchLocalEvalScheduling << asynchLocalAnalysisConcurrency
-    << evalServers << evalScheduling << procsPerEval << analysisServers
-    << analysisScheduling << procsPerAnalysis << failAction << retryLimit
-    << recoveryFnVals << activeSetVectorFlag << evalCacheFlag
-    << nearbyEvalCacheFlag << nearbyEvalCacheTol << restartFileFlag
+    << evalServers << evalScheduling << evalPrefetch << procsPerEval
+    << analysisServers << analysisScheduling << procsPerAnalysis << failAction
+    << retryLimit << recoveryFnVals << activeSetVectorFlag << evalCacheFlag
+    << nearbyEvalCacheFlag << nearbyEvalCacheTol << evalCacheMemLimit
+    << restartFileFlag
     << useWorkdir << workDir << dirTag << dirSave << linkFiles
-    << copyFiles << templateReplace << pluginLibraryPath << numpyFlag;
+    << copyFiles << templateReplace << dirRecycle << pluginLibraryPath
+    << numpyFlag << columnarFlag;
 }
 
 
@@ -58,17 +63,19 @@ void DataInterfaceRep::read(MPIUnpackBuffer& s)
 {
   s >> idInterface >> interfaceType >> algebraicMappings >> analysisDrivers
     >> analysisComponents >> inputFilter >> outputFilter >> parametersFile
-    >> resultsFile >> allowExistingResultsFlag  >> verbatimFlag  
+    >> resultsFile >> allowExistingResultsFlag  >> verbatimFlag  >> persistentFlag
     >> parametersFileFormat >> resultsFileFormat 
     >> dakotaResultsFileLabeled >> fileTagFlag >> fileSaveFlag //>> gridHostNames >> gridProcsPerHost
     >> batchEvalFlag >> asynchFlag >> asynchLocalEvalConcurrency
     >> asynchLocalEvalScheduling >> asynchLocalAnalysisConcurrency
-    >> evalServers >> evalScheduling >> procsPerEval >> analysisServers
-    >> analysisScheduling >> procsPerAnalysis >> failAction >> retryLimit
-    >> recoveryFnVals >> activeSetVectorFlag >> evalCacheFlag
-    >> nearbyEvalCacheFlag >> nearbyEvalCacheTol >> restartFileFlag
+    >> evalServers >> evalScheduling >> evalPrefetch >> procsPerEval
+    >> analysisServers >> analysisScheduling >> procsPerAnalysis >> failAction
+    >> retryLimit >> recoveryFnVals >> activeSetVectorFlag >> evalCacheFlag
+    >> nearbyEvalCacheFlag >> nearbyEvalCacheTol >> evalCacheMemLimit
+    >> restartFileFlag
     >> useWorkdir >> workDir >> dirTag >> dirSave >> linkFiles
-    >> copyFiles >> templateReplace >> pluginLibraryPath >> numpyFlag;
+    >> copyFiles >> templateReplace >> dirRecycle >> pluginLibraryPath
+    >> numpyFlag >> columnarFlag;
 }
 
 
@@ -76,17 +83,19 @@ void DataInterfaceRep::write(std::ostream& s) const
 {
   s << idInterface << interfaceType << algebraicMappings << analysisDrivers
     << analysisComponents << inputFilter << outputFilter << parametersFile
-    << resultsFile << allowExistingResultsFlag  << verbatimFlag  
+    << resultsFile << allowExistingResultsFlag  << verbatimFlag  << persistentFlag
     << parametersFileFormat << resultsFileFormat 
     << dakotaResultsFileLabeled << fileTagFlag << fileSaveFlag //<< gridHostNames << gridProcsPerHost
     << batchEvalFlag << asynchFlag << asynchLocalEvalConcurrency
     << asynchLocalEvalScheduling << asynchLocalAnalysisConcurrency
-    << evalServers << evalScheduling << procsPerEval << analysisServers
-    << analysisScheduling << procsPerAnalysis << failAction << retryLimit
-    << recoveryFnVals << activeSetVectorFlag << evalCacheFlag
-    << nearbyEvalCacheFlag << nearbyEvalCacheTol << restartFileFlag
+    << evalServers << evalScheduling << evalPrefetch << procsPerEval
+    << analysisServers << analysisScheduling << procsPerAnalysis << failAction
+    << retryLimit << recoveryFnVals << activeSetVectorFlag << evalCacheFlag
+    << nearbyEvalCacheFlag << nearbyEvalCacheTol << evalCacheMemLimit
+    << restartFileFlag
     << useWorkdir << workDir << dirTag << dirSave << linkFiles
-    << copyFiles << templateReplace << pluginLibraryPath << numpyFlag;
+    << copyFiles << templateReplace << dirRecycle << pluginLibraryPath
+    << numpyFlag << columnarFlag;
 }
 
 
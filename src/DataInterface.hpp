@@ -110,6 +110,10 @@ public:
   /// analysis_drivers/input_filter/output_filter syntax (from the \c
   /// verbatim specification in \ref InterfApplicSC and \ref InterfApplicF)
   bool verbatimFlag;
+  /// flag for launching the analysis driver once per concurrent evaluation
+  /// and exchanging evaluations with it over a socket (from the \c
+  /// persistent specification in \ref InterfApplicF)
+  bool persistentFlag;
   /// Expected format of results file
   unsigned short resultsFileFormat;
   /// Parameters file format
@@ -153,6 +157,10 @@ public:
   /// within an iterator: {DEFAULT,MASTER,PEER_DYNAMIC,PEER_STATIC}_SCHEDULING 
   /// (from the \c evaluation_scheduling specification in \ref InterfIndControl)
   short evalScheduling;
+  /// number of evaluations per message from a dedicated scheduler to
+  /// synchronous servers (from the \c evaluation_prefetch specification
+  /// in \ref InterfIndControl)
+  int evalPrefetch;
   /// processors per parallel evaluation within the parallel configuration
   /// (from the \c processors_per_evaluation spec in \ref InterfIndControl)
   int procsPerEval;
@@ -191,6 +199,10 @@ public:
   bool nearbyEvalCacheFlag;
   /// numerical tolerance for nearby evaluation cache lookups
   Real nearbyEvalCacheTol;
+  /// memory limit in megabytes for the records of the function evaluation
+  /// cache, beyond which least recently used records spill to disk (from
+  /// the \c cache_memory_limit specification in \ref InterfIndControl)
+  Real evalCacheMemLimit;
   /// function evaluation cache: 1=active (all new evaluations written to
   /// restart), 0=inactive (no records written to restart) (from the
   /// \c deactivate \c restart_file specification in \ref InterfIndControl)
@@ -209,10 +221,15 @@ public:
   StringArray copyFiles;
   /// whether to replace / overwrite existing files
   bool templateReplace;
+  /// whether to reuse work directories across evaluations
+  bool dirRecycle;
   /// path to plugin to runtime load
   String pluginLibraryPath;
   /// Python interface: use NumPy data structures (default is list data)
   bool numpyFlag;
+  /// Python interface: exchange a batch as one dictionary of NumPy arrays
+  /// (default is a list of per-evaluation dictionaries)
+  bool columnarFlag;
 
 private:
 
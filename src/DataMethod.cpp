@@ -129,7 +129,7 @@ DataMethodRep::DataMethodRep():
   wilksConfidenceLevel(0.95), wilksSidedInterval(ONE_SIDED_UPPER),
   // NonD
   toleranceIntervalsFlag(false), tiCoverage(0.95), tiConfidenceLevel(0.90),
-  stdRegressionCoeffs(false),
+  stdRegressionCoeffs(false), columnarStats(false), quantileSketchSize(0),
   respScalingFlag(false), vbdOrder(0), covarianceControl(DEFAULT_COVARIANCE),
   rngName("mt19937"), refinementType(Pecos::NO_REFINEMENT),
   refinementMetric(Pecos::DEFAULT_METRIC), refinementControl(Pecos::NO_CONTROL),
@@ -138,7 +138,8 @@ DataMethodRep::DataMethodRep():
   piecewiseBasis(false), expansionBasisType(Pecos::DEFAULT_BASIS),
   quadratureOrder(USHRT_MAX), sparseGridLevel(USHRT_MAX),
   expansionOrder(USHRT_MAX), collocationPoints(SZ_MAX),
-  expansionSamples(SZ_MAX),  ensemblePilotSolnMode(ONLINE_PILOT),
+  expansionSamples(SZ_MAX), concurrentMPPSearches(1),
+  ensemblePilotSolnMode(ONLINE_PILOT),
   pilotGroupSampling(SHARED_PILOT), groupThrottleType(NO_GROUP_THROTTLE),
   groupSizeThrottle(USHRT_MAX), rCondBestThrottle(SZ_MAX),
   rCondTolThrottle(DBL_MAX), truthPilotConstraint(false),
@@ -196,7 +197,8 @@ DataMethodRep::DataMethodRep():
   logitTransform(false), gpmsaNormalize(false), posteriorStatsKL(false),
   posteriorStatsMutual(false), posteriorStatsKDE(false),
   chainDiagnostics(false), chainDiagnosticsCI(false), modelEvidence(false),
-  modelEvidMC(false), modelEvidLaplace(false), priorPropCovMult(1.0),
+  modelEvidMC(false), modelEvidLaplace(false), modelEvidIS(false),
+  priorPropCovMult(1.0),
   proposalCovUpdatePeriod(std::numeric_limits<int>::max()),
   fitnessMetricType("predicted_variance"), batchSelectionType("naive"),
   lipschitzType("local"), calibrateErrorMode(CALIBRATE_NONE),
@@ -359,7 +361,8 @@ void DataMethodRep::write(MPIPackBuffer& s) const
 
   // NonD
   s << toleranceIntervalsFlag << tiCoverage << tiConfidenceLevel
-    << stdRegressionCoeffs << respScalingFlag << vbdOrder << covarianceControl
+    << stdRegressionCoeffs << columnarStats << quantileSketchSize
+    << respScalingFlag << vbdOrder << covarianceControl
     << rngName << refinementType << refinementMetric<< refinementControl
     << nestingOverride << growthOverride << expansionType << piecewiseBasis
     << expansionBasisType << quadratureOrderSeq << sparseGridLevelSeq
@@ -381,7 +384,8 @@ void DataMethodRep::write(MPIPackBuffer& s) const
     << mostSignificantBitFirst << leastSignificantBitFirst << numberOfBits
     << scrambleSize << joe_kuo << sobol_order_2 << grayCodeOrdering
     << dOptimal << numCandidateDesigns //<< reliabilitySearchType
-    << reliabilityIntegration << integrationRefine << refineSamples
+    << reliabilityIntegration << concurrentMPPSearches << integrationRefine
+    << refineSamples
     << optSubProbSolver << numericalSolveMode << modelReordering
     << estVarMetricType << estVarMetricNormOrder << pilotSamples
     << ensemblePilotSolnMode << pilotGroupSampling << groupThrottleType
@@ -401,7 +405,7 @@ void DataMethodRep::write(MPIPackBuffer& s) const
     << standardizedSpace << adaptPosteriorRefine << logitTransform
     << gpmsaNormalize << posteriorStatsKL << posteriorStatsMutual
     << posteriorStatsKDE << chainDiagnostics << chainDiagnosticsCI
-    << modelEvidence << modelEvidLaplace << modelEvidMC
+    << modelEvidence << modelEvidLaplace << modelEvidMC << modelEvidIS
     << proposalCovType << priorPropCovMult << proposalCovUpdatePeriod
     << proposalCovInputType << proposalCovData << proposalCovFile
     << advancedOptionsFilename << quesoOptionsFilename << fitnessMetricType
@@ -567,7 +571,8 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
 
   // NonD
   s >> toleranceIntervalsFlag >> tiCoverage >> tiConfidenceLevel
-    >> stdRegressionCoeffs >> respScalingFlag >> vbdOrder >> covarianceControl
+    >> stdRegressionCoeffs >> columnarStats >> quantileSketchSize
+    >> respScalingFlag >> vbdOrder >> covarianceControl
     >> rngName >> refinementType >> refinementMetric>> refinementControl
     >> nestingOverride >> growthOverride >> expansionType >> piecewiseBasis
     >> expansionBasisType >> quadratureOrderSeq >> sparseGridLevelSeq
@@ -589,7 +594,8 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
     >> mostSignificantBitFirst >> leastSignificantBitFirst >> numberOfBits
     >> scrambleSize >> joe_kuo >> sobol_order_2 >> grayCodeOrdering
     >> dOptimal >> numCandidateDesigns //>> reliabilitySearchType
-    >> reliabilityIntegration >> integrationRefine >> refineSamples
+    >> reliabilityIntegration >> concurrentMPPSearches >> integrationRefine
+    >> refineSamples
     >> optSubProbSolver >> numericalSolveMode >> modelReordering
     >> estVarMetricType >> estVarMetricNormOrder >> pilotSamples
     >> ensemblePilotSolnMode >> pilotGroupSampling >> groupThrottleType
@@ -609,7 +615,7 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
     >> standardizedSpace >> adaptPosteriorRefine >> logitTransform
     >> gpmsaNormalize >> posteriorStatsKL >> posteriorStatsMutual
     >> posteriorStatsKDE >> chainDiagnostics >> chainDiagnosticsCI
-    >> modelEvidence >> modelEvidLaplace >> modelEvidMC
+    >> modelEvidence >> modelEvidLaplace >> modelEvidMC >> modelEvidIS
     >> proposalCovType >> priorPropCovMult >> proposalCovUpdatePeriod
     >> proposalCovInputType >> proposalCovData >> proposalCovFile
     >> advancedOptionsFilename >> quesoOptionsFilename >> fitnessMetricType
@@ -775,7 +781,8 @@ void DataMethodRep::write(std::ostream& s) const
 
   // NonD
   s << toleranceIntervalsFlag << tiCoverage << tiConfidenceLevel
-    << stdRegressionCoeffs << respScalingFlag << vbdOrder << covarianceControl
+    << stdRegressionCoeffs << columnarStats << quantileSketchSize
+    << respScalingFlag << vbdOrder << covarianceControl
     << rngName << refinementType << refinementMetric<< refinementControl
     << nestingOverride << growthOverride << expansionType << piecewiseBasis
     << expansionBasisType << quadratureOrderSeq << sparseGridLevelSeq
@@ -797,7 +804,8 @@ void DataMethodRep::write(std::ostream& s) const
     << mostSignificantBitFirst << leastSignificantBitFirst << numberOfBits
     << scrambleSize << joe_kuo << sobol_order_2 << grayCodeOrdering
     << dOptimal << numCandidateDesigns //<< reliabilitySearchType
-    << reliabilityIntegration << integrationRefine << refineSamples
+    << reliabilityIntegration << concurrentMPPSearches << integrationRefine
+    << refineSamples
     << optSubProbSolver << numericalSolveMode << modelReordering
     << estVarMetricType << estVarMetricNormOrder << pilotSamples
     << ensemblePilotSolnMode << pilotGroupSampling << groupThrottleType
@@ -817,7 +825,7 @@ void DataMethodRep::write(std::ostream& s) const
     << standardizedSpace << adaptPosteriorRefine << logitTransform
     << gpmsaNormalize << posteriorStatsKL << posteriorStatsMutual
     << posteriorStatsKDE << chainDiagnostics << chainDiagnosticsCI
-    << modelEvidence << modelEvidLaplace << modelEvidMC
+    << modelEvidence << modelEvidLaplace << modelEvidMC << modelEvidIS
     << proposalCovType << priorPropCovMult << proposalCovUpdatePeriod
     << proposalCovInputType << proposalCovData << proposalCovFile
     << advancedOptionsFilename << quesoOptionsFilename << fitnessMetricType
@@ -690,6 +690,13 @@ public:
 
   /// flag indicating the calculation/output of standardized regression coefficients
   bool stdRegressionCoeffs;
+
+  /// flag to accumulate sampling statistics from columnar sample storage
+  /// in place of retained Response objects
+  bool columnarStats;
+  /// sketch size for streaming (sketch-based) columnar statistics; zero
+  /// retains all samples
+  size_t quantileSketchSize;
   
   /// Flag to specify use of double sided tolerance interval equivalent normal
   bool toleranceIntervalsFlag;
@@ -830,6 +837,9 @@ public:
   /// the \c first_order or \c second_order integration selection in
   /// \ref MethodNonDLocalRel
   String reliabilityIntegration;
+  /// maximum number of MPP searches over response levels performed
+  /// concurrently in \ref MethodNonDLocalRel
+  size_t concurrentMPPSearches;
   /// the \c import, \c adapt_import, or \c mm_adapt_import integration
   /// refinement selection in \ref MethodNonDLocalRel, \ref MethodNonDPCE,
   /// and \ref MethodNonDSC
@@ -983,6 +993,9 @@ public:
   int evidenceSamples;
   /// flag indicating use of Laplace approximation for evidence calc.
   bool modelEvidLaplace;
+  /// flag indicating use of importance sampling from the posterior chain
+  /// for evidence calc.
+  bool modelEvidIS;
   /// the type of proposal covariance: user, derivatives, or prior
   String proposalCovType;
   /// optional multiplier for prior-based proposal covariance
@@ -25,7 +25,8 @@ DataResponsesRep::DataResponsesRep():
   calibrationDataFlag(false), numExperiments(1), numExpConfigVars(0),
   scalarDataFormat(TABULAR_EXPER_ANNOT), ignoreBounds(false), centralHess(false), 
   methodSource("dakota"), intervalType("forward"), interpolateFlag(false),
-  fdGradStepType("relative"), fdHessStepType("relative"), readFieldCoords(false)
+  fdGradStepType("relative"), fdHessStepType("relative"),
+  jacSparsityDetect(false), readFieldCoords(false)
 { }
 
 
@@ -55,6 +56,7 @@ void DataResponsesRep::write(MPIPackBuffer& s) const
     << fdGradStepSize << fdGradStepType << fdHessStepSize << fdHessStepType
     << idNumericalGrads << idAnalyticGrads
     << idNumericalHessians << idQuasiHessians << idAnalyticHessians
+    << jacSparsityFns << jacSparsityVars << jacSparsityDetect
     // field data
     << fieldLengths << numCoordsPerField 
     << readFieldCoords << varianceType << metadataLabels;
@@ -87,6 +89,7 @@ void DataResponsesRep::read(MPIUnpackBuffer& s)
     >> fdGradStepSize >> fdGradStepType >> fdHessStepSize >> fdHessStepType
     >> idNumericalGrads >> idAnalyticGrads
     >> idNumericalHessians >> idQuasiHessians >> idAnalyticHessians
+    >> jacSparsityFns >> jacSparsityVars >> jacSparsityDetect
     // field data
     >> fieldLengths >> numCoordsPerField
     >> readFieldCoords >> varianceType >> metadataLabels;
@@ -120,6 +123,7 @@ void DataResponsesRep::write(std::ostream& s) const
     << fdGradStepSize << fdGradStepType << fdHessStepSize << fdHessStepType
     << idNumericalGrads << idAnalyticGrads
     << idNumericalHessians << idQuasiHessians << idAnalyticHessians
+    << jacSparsityFns << jacSparsityVars << jacSparsityDetect
     // field data
     << fieldLengths << numCoordsPerField  
     << readFieldCoords << varianceType << metadataLabels;
@@ -210,6 +210,19 @@ public:
   /// absolute - step length is what is specified
   /// bounds - step length is relative to range of x
   String fdHessStepType;
+  /// response function identifiers of the structurally nonzero Jacobian
+  /// entries used to group finite difference gradients (from the \c
+  /// jacobian_sparsity \c nonzero_functions specification in \ref
+  /// RespGradNum and \ref RespGradMixed)
+  IntVector jacSparsityFns;
+  /// continuous variable identifiers of the structurally nonzero Jacobian
+  /// entries, paired with jacSparsityFns (from the \c jacobian_sparsity
+  /// \c nonzero_variables specification)
+  IntVector jacSparsityVars;
+  /// option to detect the Jacobian sparsity pattern from the first dense
+  /// finite difference gradient (from the \c jacobian_sparsity \c detect
+  /// specification)
+  bool jacSparsityDetect;
   /// mixed gradient numerical identifiers (from the \c id_numerical_gradients
   /// specification in \ref RespGradMixed)
   IntSet idNumericalGrads;
@@ -162,11 +162,11 @@ mostSignificantBitFirst(mostSignificantBitFirst)
   ///
   if ( ordering == DIGITAL_NET_NATURAL_ORDERING )
   {
-    reorder = &DigitalNet::reorder_natural;
+    point_digits = &DigitalNet::digits_natural;
   }
   else if ( ordering == DIGITAL_NET_GRAY_CODE_ORDERING )
   {
-    reorder = &DigitalNet::reorder_gray_code;
+    point_digits = &DigitalNet::digits_gray_code;
   }
   else
   {
@@ -698,86 +698,98 @@ void DigitalNet::bitreverse_generating_matrices()
   }
 }
 
+/// Check if a power of 2 number of points is requested when using natural
+/// ordering
+void DigitalNet::check_request(
+  const size_t nMin,
+  const size_t nMax
+)
+{
+  if ( ordering == DIGITAL_NET_NATURAL_ORDERING && !ispow2(nMax - nMin) )
+  {
+    Cerr << "Error: natural ordering requires the requested number of points to be "
+      << "a power of 2." << std::endl;
+    abort_handler(METHOD_ERROR);
+  }
+}
+
 /// Generates digital net points without error checking
 /// Returns the points with index `nMin`, `nMin` + 1, ..., `nMax` - 1
 /// This function will store the points in-place in the matrix `points`
 /// Each column of `points` contains a `dimension`-dimensional point
 /// where `dimension` is equal to the number of rows of `points`
+/// NOTE: the point with index `k` is the XOR of the columns of the generating
+/// matrices selected by the binary digits of `k` (natural ordering) or of its
+/// Gray code (Gray code ordering). The first point is computed directly from
+/// `nMin`, so that the cost does not depend on `nMin`, and each following
+/// point is updated from its predecessor by XOR'ing in only the columns for
+/// the digits that change, as in the Antonov & Saleev (1979) construction.
 void DigitalNet::unsafe_get_points(
   const size_t nMin,
   const size_t nMax, 
   RealMatrix& points
 )
 {
-  /// Check if a power of 2 number of points is request when using natural ordering
-  if ( ordering == DIGITAL_NET_NATURAL_ORDERING && !ispow2(points.numCols()))
-  {
-    Cerr << "Error: natural ordering requires the requested number of points to be "
-      << "a power of 2." << std::endl;
-    abort_handler(METHOD_ERROR);
-  }
-
-  /// Iterativey generate all points up to `nMin-1`
-  UInt64Vector current_point(points.numRows()); /// Set to 0 by default
-  for ( size_t k = 0; k < nMin; k++ )
-  {
-    next(k, current_point);
-  }
+  size_t dimension = points.numRows();
+  UInt64Vector current_point(dimension); /// Set to 0 by default
+  const UInt64* x = current_point.values();
+  const UInt64* shift = digitalShift.values();
 
   /// Generate points between `nMin` and `nMax`
   int digits = std::numeric_limits<UInt64>::digits;
   double oneOnPow2tScramble = 1 / Real(UInt64(1) << digits - 1) / 2; /// 1 / 2^(-tMax)
+  UInt64 previous_digits = 0; /// digits of the zero point
   for ( UInt64 k = nMin; k < nMax; ++k ) /// Loop over all points
   {
-    next(k, current_point); /// Generate the next point as UInt64Vector
-    auto idx = (this->*reorder)(k);
-    for ( int j = 0; j < points.numRows(); j++ ) /// Loop over all dimensions
+    UInt64 k_digits = (this->*point_digits)(k);
+    xor_columns(k_digits ^ previous_digits, current_point);
+    previous_digits = k_digits;
+    Real* point = points[k - nMin];
+    for ( size_t j = 0; j < dimension; j++ ) /// Loop over all dimensions
     {
-      points(j, idx - nMin) = 
-        (current_point[j] ^ digitalShift[j]) * oneOnPow2tScramble; // apply digital shift
+      point[j] = (x[j] ^ shift[j]) * oneOnPow2tScramble; // apply digital shift
     }
   }
 }
 
-/// Get the next point of the sequence represented as an unsigned integer
-/// vector
-/// NOTE: Uses the Antonov & Saleev (1979) iterative construction:
-/// knowing the current point with index `k`, the next point with index `k + 1`
-/// is obtained by XOR'ing the current point with the `n`-th column of the 
-/// `j`-th generating matrix, i.e.,
-///
-///                   x_{k+1}[j] = x_{k}[j] ^ C[j][n]
-///
-/// where `n` is the rightmost zero-bit of `k` (= the position of the bit that 
-/// will change from `k` to `k+1` in Gray code)
-void DigitalNet::next(
-  int k,
+/// XOR the columns of the generating matrices selected by the set bits of
+/// `digits` into the point `current_point`
+/// NOTE: the generating matrices are stored column-major with one row per
+/// dimension, so each column is contiguous and the loop over the dimensions
+/// vectorizes
+void DigitalNet::xor_columns(
+  UInt64 digits,
   UInt64Vector& current_point
-)
+) const
 {
-  if ( k == 0 )
-    return;
-  auto n = count_consecutive_trailing_zero_bits(k); // From "dakota_bit_utils"
-  for ( size_t j = 0; j < current_point.length(); j++ ) // Loop over dimensions
+  size_t dimension = current_point.length();
+  UInt64* x = current_point.values();
+  while ( digits )
   {
-    current_point[j] ^= scrambledGeneratingMatrices(j, n); // ^ is xor
+    const UInt64* column = scrambledGeneratingMatrices[
+      count_consecutive_trailing_zero_bits(digits)]; // From "dakota_bit_utils"
+    for ( size_t j = 0; j < dimension; j++ ) // Loop over dimensions
+    {
+      x[j] ^= column[j]; // ^ is xor
+    }
+    digits &= digits - 1; // clear the lowest set bit
   }
 }
 
-/// Position of the `k`th digital net point in DIGITAL_NET_NATURAL_ORDERING
-inline UInt64 DigitalNet::reorder_natural(
+/// Digits of the `k`th digital net point in DIGITAL_NET_NATURAL_ORDERING
+inline UInt64 DigitalNet::digits_natural(
   UInt64 k
 )
 {
-  return binary2gray(k);
+  return k;
 }
 
-/// Position of the `k`th digital net point in DIGITAL_NET_GRAY_CODE_ORDERING
-inline UInt64 DigitalNet::reorder_gray_code(
+/// Digits of the `k`th digital net point in DIGITAL_NET_GRAY_CODE_ORDERING
+inline UInt64 DigitalNet::digits_gray_code(
   UInt64 k
 )
 {
-  return k;
+  return binary2gray(k);
 }
 
 } // namespace Dakota
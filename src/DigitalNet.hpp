@@ -156,6 +156,13 @@ private:
   /// Reverse the bits in the scrambled generating matrices
   void bitreverse_generating_matrices();
 
+  /// Checks that a power of 2 number of points is requested when using
+  /// natural ordering
+  void check_request(
+    const size_t nMin,
+    const size_t nMax
+  ) override;
+
   /// Generates digital net points without error checking
   void unsafe_get_points(
     const size_t nMin,
@@ -163,25 +170,27 @@ private:
     RealMatrix& points
   ) override;
 
-  /// Get the next point of the sequence represented as an unsigned integer
-  /// vector
-  void next(
-    int n,
+  /// XOR the generating matrix columns selected by `digits` into the point
+  /// `current_point` represented as an unsigned integer vector
+  void xor_columns(
+    UInt64 digits,
     UInt64Vector& current_point
-  );
+  ) const;
 
-  /// Position of the `k`th digital net point in DIGITAL_NET_NATURAL_ORDERING
-  inline UInt64 reorder_natural(
+  /// Binary digits that select the generating matrix columns of the `k`th
+  /// digital net point in DIGITAL_NET_NATURAL_ORDERING
+  inline UInt64 digits_natural(
     UInt64 k
   );
 
-  /// Position of the `k`th digital net point in DIGITAL_NET_GRAY_CODE_ORDERING
-  inline UInt64 reorder_gray_code(
+  /// Binary digits that select the generating matrix columns of the `k`th
+  /// digital net point in DIGITAL_NET_GRAY_CODE_ORDERING
+  inline UInt64 digits_gray_code(
     UInt64 k
   );
 
   /// Function pointer to the chosen order of the points
-  UInt64 (DigitalNet::*reorder)(UInt64);
+  UInt64 (DigitalNet::*point_digits)(UInt64);
 
 };
 
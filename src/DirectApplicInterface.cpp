@@ -274,68 +274,87 @@ int DirectApplicInterface::derived_map_of(const String& of_name)
 }
 
 
+/** When the (derived) simulator mapping is thread safe, evaluations
+    are executed on a pool of asynchLocalEvalConcurrency worker threads
+    (hardware concurrency if unlimited).  The Variables, ActiveSet, and
+    Response envelopes are shallow copies sharing representations with
+    the PRP in asynchLocalActivePRPQueue, so results are available to
+    the scheduler once the evaluation is reported as complete. */
 void DirectApplicInterface::derived_map_asynch(const ParamResponsePair& pair)
 {
-  Cerr << "Error: asynchronous capability (multiple threads) not installed in"
-       << "\nDirectApplicInterface." << std::endl;
-  abort_handler(-1);
-
-  //pthread_create/thr_create(derived_map(...)) launches a new thread
-  //threadIdMap[tid] = fn_eval_id;
-
-  // Design note, 10/2013: the heavy fork() approach that already exists in
-  // ProcessHandleApplicInterface::create_evaluation_process() would be a
-  // quick and easy substitute for POSIX threads.  While this would work
-  // nicely for managing job concurrency with code that's already in hand
-  // (assuming sufficient memory for the required heavy fork() concurrency),
-  // there is no simple way to get response results back to the parent
-  // process from the child.  Short of resorting to the file system, there
-  // are examples of using pipes to accomplish this, but this moves the
-  // idea away from the state of low risk / high payoff.
+  if (!thread_safe_evaluations()) {
+    Cerr << "Error: asynchronous capability (multiple threads) not supported "
+	 << "by this\nDirectApplicInterface; derived_map() is not thread safe."
+	 << std::endl;
+    abort_handler(INTERFACE_ERROR);
+  }
+
+  if (!evalThreadPool) {
+    size_t num_threads = (asynchLocalEvalConcurrency > 0) ?
+      (size_t)asynchLocalEvalConcurrency : 0; // 0 = hardware concurrency
+    evalThreadPool.reset(new EvaluationThreadPool(num_threads));
+    if (outputLevel >= VERBOSE_OUTPUT)
+      Cout << "Direct interface: launched " << evalThreadPool->num_threads()
+	   << " evaluation threads." << std::endl;
+  }
+
+  int fn_eval_id = pair.eval_id();
+  Variables vars(pair.variables());  // shallow copy
+  ActiveSet set(pair.active_set());
+  Response response(pair.response()); // shallow copy
+  evalThreadPool->submit(fn_eval_id, [this, vars, set, response, fn_eval_id]()
+    mutable { derived_map(vars, set, response, fn_eval_id); });
 }
 
 
 void DirectApplicInterface::wait_local_evaluations(PRPQueue& prp_queue)
 {
-  Cerr << "Error: asynchronous capability (multiple threads) not installed in"
-       << "\nDirectApplicInterface." << std::endl;
-  abort_handler(-1);
-
-  /*
-  PRPQueueIter queue_it = lookup_by_eval_id(prp_queue, fn_eval_id);
-  if (queue_it == prp_queue.end()) {
-    Cerr << "Error: failure in queue lookup within DirectApplicInterface::"
-	 << "wait_local_evaluations()." << std::endl;
-    abort_handler(-1);
+  if (!evalThreadPool) {
+    Cerr << "Error: asynchronous capability (multiple threads) not active in"
+	 << "\nDirectApplicInterface::wait_local_evaluations()." << std::endl;
+    abort_handler(INTERFACE_ERROR);
   }
-  int fail_code = 0, id = queue_it->eval_id();
-  Variables    vars = queue_it->variables(); // shallow copy
-  Response response = queue_it->response();  // shallow copy
-
-  // pthread_join/thr_join(target_thread, ..., status) recovers threads.
-  // status provides a mechanism to return failure codes from analyses.
-  // The Solaris thr_join allows completion of any thread in the set if 
-  // target_thread is set to 0; unfortunately, this does not appear to be part
-  // of the POSIX standard (pthread_join must complete a valid target_thread).
-
-  // Possible better solution: look at OpenMP ??
-
-  // For the asynch case, Direct (unlike SysCall) can manage failures w/o 
-  // throwing exceptions.  See ApplicationInterface::manage_failure for notes.
-  if (fail_code)
-    manage_failure(vars, response.active_set(), response, id);
-
-  Cout << "Thread for evaluation " << id << " captured.\n";
-  queue_it->response(response);
-  */
+  process_thread_completions(prp_queue, BLOCK);
 }
 
 
 void DirectApplicInterface::test_local_evaluations(PRPQueue& prp_queue)
 {
-  Cerr << "Error: asynchronous capability (multiple threads) not installed in"
-       << "\nDirectApplicInterface." << std::endl;
-  abort_handler(-1);
+  if (!evalThreadPool) {
+    Cerr << "Error: asynchronous capability (multiple threads) not active in"
+	 << "\nDirectApplicInterface::test_local_evaluations()." << std::endl;
+    abort_handler(INTERFACE_ERROR);
+  }
+  process_thread_completions(prp_queue, FALL_THROUGH);
+}
+
+
+/** For the asynch case, Direct (unlike SysCall) can manage failures
+    w/o throwing exceptions: a FunctionEvalFailure captured on a worker
+    thread is processed here on the scheduling thread through
+    manage_failure().  See ApplicationInterface::manage_failure() notes. */
+void DirectApplicInterface::
+process_thread_completions(PRPQueue& prp_queue, short block_flag)
+{
+  std::map<int, std::exception_ptr> failures;
+  if (block_flag == BLOCK) evalThreadPool->wait_some(completionSet, failures);
+  else                     evalThreadPool->test_some(completionSet, failures);
+
+  for (const auto& fail : failures) {
+    int fn_eval_id = fail.first;
+    PRPQueueIter queue_it = lookup_by_eval_id(prp_queue, fn_eval_id);
+    if (queue_it == prp_queue.end()) {
+      Cerr << "Error: failure in queue lookup within DirectApplicInterface::"
+	   << "process_thread_completions()." << std::endl;
+      abort_handler(INTERFACE_ERROR);
+    }
+    try { std::rethrow_exception(fail.second); }
+    catch (const FunctionEvalFailure& fneval_except) {
+      Response response(queue_it->response()); // shallow copy
+      manage_failure(queue_it->variables(), response.active_set(), response,
+		     fn_eval_id);
+    }
+  }
 }
 
 
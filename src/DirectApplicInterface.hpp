@@ -11,9 +11,7 @@
 #define DIRECT_APPLIC_INTERFACE_H
 
 #include "ApplicationInterface.hpp"
-//#ifndef OSF
-//#include <pthread.h>
-//#endif
+#include "EvaluationThreadPool.hpp"
 
 namespace Dakota {
 
@@ -98,8 +96,6 @@ public:
   void init_communicators_checks(int max_eval_concurrency) override;
   void  set_communicators_checks(int max_eval_concurrency) override;
 
-  //void clear_bookkeeping(); // clears threadIdMap
-
 protected:
 
   //
@@ -113,6 +109,13 @@ protected:
   /// execute the output filter portion of a direct evaluation invocation
   virtual int derived_map_of(const Dakota::String& of_name);
 
+  /// indicates whether derived_map() may be invoked concurrently from
+  /// multiple threads, enabling asynchronous local evaluations on
+  /// evalThreadPool (as for thread-safe PluginInterface plug-ins);
+  /// library-mode plug-ins that override derived_map() without the
+  /// class-scope simulator data below (xC, fnVals, etc.) may return true
+  virtual bool thread_safe_evaluations() const;
+
   //
   //- Heading: Methods
   //
@@ -144,8 +147,9 @@ protected:
   driver_t iFilterType; ///< enum type of the direct function input filter
   driver_t oFilterType; ///< enum type of the direct function output filter
 
-  // map of pthread id's to function evaluation id's for asynch evaluations
-  //std::map<pthread_t, int> threadIdMap;
+  /// pool of worker threads for asynchronous local evaluations (lazily
+  /// constructed on first derived_map_asynch())
+  std::unique_ptr<EvaluationThreadPool> evalThreadPool;
 
   // data used by direct fns is class scope to allow common utility usage
   bool gradFlag;  ///< signals use of fnGrads in direct simulator functions
@@ -227,6 +231,10 @@ private:
   void map_labels_to_enum(StringMultiArrayConstView &src,
       std::vector<var_t> &dest);
 
+  /// update completionSet from evalThreadPool, managing failures for
+  /// evaluations that threw; blocking if block_flag is BLOCK
+  void process_thread_completions(PRPQueue& prp_queue, short block_flag);
+
   //
   //- Heading: Data
   //
@@ -258,7 +266,9 @@ inline void DirectApplicInterface::
 init_communicators_checks(int max_eval_concurrency)
 {
   bool warn = true;
-  check_asynchronous(warn, max_eval_concurrency);
+  // thread-safe derived_map() supports asynchronous local evaluations
+  if (!thread_safe_evaluations() || asynchLocalAnalysisFlag)
+    check_asynchronous(warn, max_eval_concurrency);
   check_multiprocessor_asynchronous(warn, max_eval_concurrency);
 }
 
@@ -267,15 +277,19 @@ init_communicators_checks(int max_eval_concurrency)
 inline void DirectApplicInterface::
 set_communicators_checks(int max_eval_concurrency)
 {
-  bool warn = false,  mp1 = check_asynchronous(warn, max_eval_concurrency),
-       mp2 = check_multiprocessor_asynchronous(warn, max_eval_concurrency);
+  bool warn = false,
+    mp1 = (thread_safe_evaluations() && !asynchLocalAnalysisFlag) ? false :
+      check_asynchronous(warn, max_eval_concurrency),
+    mp2 = check_multiprocessor_asynchronous(warn, max_eval_concurrency);
   if (mp1 || mp2)
     abort_handler(-1);
 }
 
 
-//inline void DirectApplicInterface::clear_bookkeeping()
-//{ threadIdMap.clear(); }
+/** Default is false since the direct simulators map through class-scope
+    data (see set_local_data()). */
+inline bool DirectApplicInterface::thread_safe_evaluations() const
+{ return false; }
 
 
 inline void DirectApplicInterface::
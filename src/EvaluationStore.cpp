@@ -44,12 +44,48 @@ DefaultSet::DefaultSet(const ActiveSet &in_set, const size_t num_metadata) : set
 
 
 const int HDF5_CHUNK_SIZE = 40000;
+/// Default number of evaluations of a model or interface to buffer
+const size_t EVAL_BUFFER_SIZE = 64;
+
+EvaluationStore::EvaluationStore() : bufferSize(EVAL_BUFFER_SIZE),
+  chunkSize(HDF5_CHUNK_SIZE), compressionLevel(0)
+{ }
+
 #ifdef DAKOTA_HAVE_HDF5
 void EvaluationStore::set_database(std::shared_ptr<HDF5IOHelper> db_ptr) {
+  // evaluations buffered for a previous database belong to it
+  flush();
+  evaluationBuffers.clear();
   hdf5Stream = db_ptr;
 }
 #endif
 
+void EvaluationStore::buffer_size(const size_t &num_evals) {
+  bufferSize = num_evals;
+}
+
+void EvaluationStore::chunk_size(const int &num_bytes) {
+  chunkSize = num_bytes;
+}
+
+void EvaluationStore::compression_level(const int &level) {
+  compressionLevel = level;
+}
+
+/// Write all buffered evaluations, including those awaiting responses, to the
+/// database. Responses that arrive later are written directly to their rows.
+void EvaluationStore::flush() {
+#ifdef DAKOTA_HAVE_HDF5
+  if(!active())
+    return;
+  for(auto &b : evaluationBuffers)
+    flush_buffer(b.first, b.second, b.second.numRows);
+  hdf5Stream->flush();
+#else
+  return;
+#endif
+}
+
 bool EvaluationStore::active() {
   #ifdef DAKOTA_HAVE_HDF5
   return bool(hdf5Stream);
@@ -197,7 +233,7 @@ EvaluationsDBState EvaluationStore::model_allocate(const String &model_id, const
   // Create evaluation ID dataset, which is attached as a scale to many datasets
   String eval_ids_scale = scale_root + "evaluation_ids";
   hdf5Stream->create_empty_dataset(eval_ids_scale, {0}, 
-      ResultsOutputType::INTEGER, HDF5_CHUNK_SIZE);
+      ResultsOutputType::INTEGER, chunkSize, NULL, compressionLevel);
   
   std::shared_ptr<Pecos::MarginalsCorrDistribution> mvd_rep =
     std::static_pointer_cast<Pecos::MarginalsCorrDistribution>
@@ -207,6 +243,7 @@ EvaluationsDBState EvaluationStore::model_allocate(const String &model_id, const
   allocate_response(root_group, response, default_set);
   allocate_properties(root_group, variables, response, default_set);
   allocate_metadata(root_group, response);
+  allocate_buffer(root_group, variables, default_set);
   return EvaluationsDBState::ACTIVE;
 #else
   return EvaluationsDBState::INACTIVE;
@@ -229,12 +266,13 @@ EvaluationsDBState EvaluationStore::interface_allocate(const String &model_id, c
   // Create evaluation ID dataset, which is attached as a scale to many datasets
   String eval_ids_scale = scale_root + "evaluation_ids";
   hdf5Stream->create_empty_dataset(eval_ids_scale, {0}, 
-      ResultsOutputType::INTEGER, HDF5_CHUNK_SIZE);
+      ResultsOutputType::INTEGER, chunkSize, NULL, compressionLevel);
   
   allocate_variables(root_group, variables);
   allocate_response(root_group, response, default_set);
   allocate_properties(root_group, variables, response, default_set, an_comp);
   allocate_metadata(root_group, response);
+  allocate_buffer(root_group, variables, default_set);
   return EvaluationsDBState::ACTIVE;
 #else
   return EvaluationsDBState::INACTIVE;
@@ -260,6 +298,11 @@ void EvaluationStore::store_model_variables(const String &model_id, const String
   }
   resizedModels.erase(model_id);
   String root_group = create_model_root(model_id, model_type);
+  if(bufferSize) {
+    int resp_idx = buffer_variables(root_group, eval_id, set, variables, default_set_s);
+    modelResponseIndexCache.emplace(std::make_tuple(model_id, eval_id), resp_idx);
+    return;
+  }
   String scale_root = create_scale_root(root_group);
   // Create evaluation ID dataset, which is attached as a scale to many datasets
   String eval_ids_scale = scale_root + "evaluation_ids";
@@ -294,8 +337,10 @@ void EvaluationStore::store_model_response(const String &model_id, const String
   if(response_index == -1)
     return;
   String root_group = create_model_root(model_id, model_type);
-  store_response(root_group, response_index, response, default_set_s);
-  store_metadata(root_group, response_index, response);
+  if(!buffer_response(root_group, response_index, response, default_set_s)) {
+    store_response(root_group, response_index, response, default_set_s);
+    store_metadata(root_group, response_index, response);
+  }
   auto cache_entry = modelResponseIndexCache.find(key);
   modelResponseIndexCache.erase(cache_entry);
 #else
@@ -313,6 +358,11 @@ void EvaluationStore::store_interface_variables(const String &model_id, const St
   String scale_root = create_scale_root(root_group);
   const auto set_key = std::make_pair(model_id, interface_id);
   const DefaultSet &default_set_s = interfaceDefaultSets[set_key];
+  if(bufferSize) {
+    int resp_idx = buffer_variables(root_group, eval_id, set, variables, default_set_s);
+    interfaceResponseIndexCache.emplace(std::make_tuple(model_id, interface_id, eval_id), resp_idx);
+    return;
+  }
   // Create evaluation ID dataset, which is attached as a scale to many datasets
   String eval_ids_scale = scale_root + "evaluation_ids";
   hdf5Stream->append_scalar(eval_ids_scale, eval_id);
@@ -341,8 +391,11 @@ void EvaluationStore::store_interface_response(const String &model_id, const Str
   std::tuple<String, String, int> key(model_id, interface_id, eval_id);
   int response_index = interfaceResponseIndexCache[key];
   String root_group = create_interface_root(model_id, interface_id);
-  store_response(root_group, response_index, response, interfaceDefaultSets[std::make_pair(model_id, interface_id)]);
-  store_metadata(root_group, response_index, response);
+  const DefaultSet &default_set_s = interfaceDefaultSets[std::make_pair(model_id, interface_id)];
+  if(!buffer_response(root_group, response_index, response, default_set_s)) {
+    store_response(root_group, response_index, response, default_set_s);
+    store_metadata(root_group, response_index, response);
+  }
   auto cache_entry = interfaceResponseIndexCache.find(key);
   interfaceResponseIndexCache.erase(cache_entry);
 #else
@@ -382,7 +435,7 @@ void EvaluationStore::allocate_variables(const String &root_group, const Variabl
     String types_name = variables_scale_root + "continuous_types";
 
     hdf5Stream->create_empty_dataset(data_name, {0, int(variables.acv())}, 
-        ResultsOutputType::REAL, HDF5_CHUNK_SIZE);
+        ResultsOutputType::REAL, chunkSize, NULL, compressionLevel);
     hdf5Stream->store_vector(labels_name,
                              variables.all_continuous_variable_labels());
     hdf5Stream->attach_scale(data_name, eval_ids, "evaluation_ids", 0);
@@ -405,7 +458,7 @@ void EvaluationStore::allocate_variables(const String &root_group, const Variabl
     String types_name = variables_scale_root + "discrete_integer_types";
     
     hdf5Stream->create_empty_dataset(data_name, {0, int(variables.adiv())}, 
-        ResultsOutputType::INTEGER, HDF5_CHUNK_SIZE);
+        ResultsOutputType::INTEGER, chunkSize, NULL, compressionLevel);
     hdf5Stream->store_vector(labels_name,
                              variables.all_discrete_int_variable_labels());
     hdf5Stream->attach_scale(data_name, eval_ids, "evaluation_ids", 0);
@@ -428,7 +481,7 @@ void EvaluationStore::allocate_variables(const String &root_group, const Variabl
     String types_name = variables_scale_root + "discrete_string_types";
 
     hdf5Stream->create_empty_dataset(data_name, {0, int(variables.adsv())}, 
-        ResultsOutputType::STRING, HDF5_CHUNK_SIZE);
+        ResultsOutputType::STRING, chunkSize, NULL, compressionLevel);
     hdf5Stream->store_vector(labels_name,
                              variables.all_discrete_string_variable_labels());
     hdf5Stream->attach_scale(data_name, eval_ids, "evaluation_ids", 0);
@@ -451,7 +504,7 @@ void EvaluationStore::allocate_variables(const String &root_group, const Variabl
     String types_name = variables_scale_root + "discrete_real_types";
 
     hdf5Stream->create_empty_dataset(data_name, {0, int(variables.adrv())}, 
-        ResultsOutputType::REAL, HDF5_CHUNK_SIZE);
+        ResultsOutputType::REAL, chunkSize, NULL, compressionLevel);
     hdf5Stream->store_vector(labels_name,
                              variables.all_discrete_real_variable_labels());
     hdf5Stream->attach_scale(data_name, eval_ids, "evaluation_ids", 0);
@@ -1809,7 +1862,7 @@ void EvaluationStore::allocate_response(const String &root_group, const Response
   // Create functions dataset
   String functions_name = response_root_group + "functions";
   hdf5Stream->create_empty_dataset(functions_name, {0, num_functions}, 
-      ResultsOutputType::REAL, HDF5_CHUNK_SIZE, &REAL_DSET_FILL_VAL);
+      ResultsOutputType::REAL, chunkSize, &REAL_DSET_FILL_VAL, compressionLevel);
   hdf5Stream->attach_scale(functions_name, eval_ids, "evaluation_ids", 0);
   hdf5Stream->attach_scale(functions_name, function_labels_name, "responses", 1);
   // Create gradients dataset, if needed
@@ -1820,7 +1873,7 @@ void EvaluationStore::allocate_response(const String &root_group, const Response
     int dvv_length = set_s.set.derivative_vector().size();
     String gradients_name = response_root_group + "gradients";
     hdf5Stream->create_empty_dataset(gradients_name, {0, num_gradients, dvv_length},
-      ResultsOutputType::REAL, HDF5_CHUNK_SIZE, &REAL_DSET_FILL_VAL);
+      ResultsOutputType::REAL, chunkSize, &REAL_DSET_FILL_VAL, compressionLevel);
     hdf5Stream->attach_scale(gradients_name, eval_ids, "evaluation_ids", 0);
     if(num_gradients == num_functions)
       hdf5Stream->attach_scale(gradients_name, function_labels_name, "resposnes", 1);
@@ -1839,7 +1892,7 @@ void EvaluationStore::allocate_response(const String &root_group, const Response
     int dvv_length = set_s.set.derivative_vector().size();
     String hessians_name = response_root_group + "hessians";
     hdf5Stream->create_empty_dataset(hessians_name, {0, num_hessians, dvv_length, dvv_length},
-      ResultsOutputType::REAL, HDF5_CHUNK_SIZE, &REAL_DSET_FILL_VAL);
+      ResultsOutputType::REAL, chunkSize, &REAL_DSET_FILL_VAL, compressionLevel);
     hdf5Stream->attach_scale(hessians_name, eval_ids, "evaluation_ids", 0);
     if(num_hessians == num_functions)
       hdf5Stream->attach_scale(hessians_name, function_labels_name, "resposnes", 1);
@@ -1872,7 +1925,8 @@ void EvaluationStore::allocate_properties(const String &root_group, const Variab
   int num_deriv_vars = dvv.size();
   // ASV
   String asv_name = properties_root + "active_set_vector";
-  hdf5Stream->create_empty_dataset(asv_name, {0, num_functions}, ResultsOutputType::INTEGER, HDF5_CHUNK_SIZE);
+  hdf5Stream->create_empty_dataset(asv_name, {0, num_functions}, ResultsOutputType::INTEGER,
+      chunkSize, NULL, compressionLevel);
   hdf5Stream->attach_scale(asv_name, eval_ids, "evaluation_ids", 0);
   hdf5Stream->attach_scale(asv_name, scale_root+"responses/function_descriptors", "responses", 1);
   hdf5Stream->store_vector(properties_scale_root + "default_asv", asv);
@@ -1882,7 +1936,8 @@ void EvaluationStore::allocate_properties(const String &root_group, const Variab
 
   if(set_s.numGradients || set_s.numHessians) {
     String dvv_name = properties_root + "derivative_variables_vector";
-    hdf5Stream->create_empty_dataset(dvv_name, {0, num_deriv_vars}, ResultsOutputType::INTEGER,  HDF5_CHUNK_SIZE);
+    hdf5Stream->create_empty_dataset(dvv_name, {0, num_deriv_vars}, ResultsOutputType::INTEGER,
+        chunkSize, NULL, compressionLevel);
     hdf5Stream->attach_scale(dvv_name, eval_ids, "evaluation_ids", 0);
     // The ids are 1-based, not 0-based
     StringMultiArrayConstView cont_labels = variables.all_continuous_variable_labels();
@@ -1920,7 +1975,8 @@ void EvaluationStore::allocate_metadata(const String &root_group, const Response
   hdf5Stream->store_vector(metadata_labels_name, metadata_labels);
 
   String metadata_name = metadata_root + "metadata";
-  hdf5Stream->create_empty_dataset(metadata_name, {0, num_metadata}, ResultsOutputType::REAL, HDF5_CHUNK_SIZE);
+  hdf5Stream->create_empty_dataset(metadata_name, {0, num_metadata}, ResultsOutputType::REAL,
+      chunkSize, NULL, compressionLevel);
   hdf5Stream->attach_scale(metadata_name, eval_ids, "evaluation_ids", 0);
   hdf5Stream->attach_scale(metadata_name, metadata_labels_name, "metadata", 1);
 #else
@@ -2073,6 +2129,34 @@ void EvaluationStore::store_response(const String &root_group, const int &resp_i
 #endif
 }
 
+#ifdef DAKOTA_HAVE_HDF5
+/// Set the "bits" in dvv_row (length of default_dvv, initialized to 0) for
+/// the entries of default_dvv that are present in dvv
+static void set_dvv_bits(const SizetArray &dvv, const SizetArray &default_dvv,
+                         int *dvv_row) {
+  // Most of the time, all possible derivative variables will be "active" (the lengths of the 
+  // current and default DVV will match), so we don't need to examine the DVV entry by entry.
+  if(dvv.size() == default_dvv.size())
+    std::fill(dvv_row, dvv_row + default_dvv.size(), 1);
+  else {
+    // This logic assumes that the entries in dvv and default_dvv are sorted in ascending order.
+    // It iterates over the entries of the current dvv, and for each, advances through the default
+    // dvv until the entry is found. It then sets the bit for that entry and goes to the next one
+    // in the current dvv.
+    int di = 0;
+    for(int si = 0; si < dvv.size(); ++si) {
+      for(; di < default_dvv.size(); ++di) {
+        if(dvv[si] == default_dvv[di]) {
+          dvv_row[di] = 1;
+          ++di;
+          break;
+        }
+      }
+    }
+  }
+}
+#endif
+
 void EvaluationStore::store_properties(const String &root_group, const ActiveSet &set, 
         const DefaultSet &default_set_s) {
 #ifdef DAKOTA_HAVE_HDF5
@@ -2080,32 +2164,11 @@ void EvaluationStore::store_properties(const String &root_group, const ActiveSet
   hdf5Stream->append_vector(properties_root + "active_set_vector", set.request_vector());
   // DVV. The dvv in set may be shorter than the default one, and so it has to be properties  // by ID.
   const SizetArray &default_dvv = default_set_s.set.derivative_vector();
-  const ShortArray &default_asv = default_set_s.set.request_vector();
   // The DVV dataset doesn't exist unless gradients or hessians can be provided
   if(default_set_s.numGradients || default_set_s.numHessians) {
-    const SizetArray &dvv = set.derivative_vector();
     // vector that will be apppended to the dataset. "bits" defaulted to 0 ("off")
     IntArray dvv_row(default_dvv.size(), 0);
-    // Most of the time, all possible derivative variables will be "active" (the lengths of the 
-    // current and default DVV will match), so we don't need to examine the DVV entry by entry.
-    if(dvv.size() == default_dvv.size())
-      std::fill(dvv_row.begin(), dvv_row.end(), 1);
-    else {
-      // This logic assumes that the entries in dvv and default_dvv are sorted in ascending order.
-      // It iterates over the entries of the current dvv, and for each, advances through the default
-      // dvv until the entry is found. It then sets the bit for that entry and goes to the next one
-      // in the current dvv.
-      int di = 0;
-      for(int si = 0; si < dvv.size(); ++si) {
-        for(; di < default_dvv.size(); ++di) {
-          if(dvv[si] == default_dvv[di]) {
-            dvv_row[di] = 1;
-            ++di;
-            break;
-          }
-        }
-      }
-    }
+    set_dvv_bits(set.derivative_vector(), default_dvv, dvv_row.data());
     hdf5Stream->append_vector(properties_root + "derivative_variables_vector", dvv_row);
   }
   return;
@@ -2126,6 +2189,223 @@ void EvaluationStore::store_metadata(const String &root_group, const int &resp_i
 #endif
 }
 
+/// Size the write-behind buffer for evaluations stored under root_group
+void EvaluationStore::allocate_buffer(const String &root_group, const Variables &variables,
+    const DefaultSet &set_s) {
+  EvaluationBuffer &buffer = evaluationBuffers[root_group];
+  buffer = EvaluationBuffer();
+  buffer.numContinuous = variables.acv();
+  buffer.numDiscreteInt = variables.adiv();
+  buffer.numDiscreteString = variables.adsv();
+  buffer.numDiscreteReal = variables.adrv();
+  buffer.numFunctions = set_s.numFunctions;
+  // The DVV dataset doesn't exist unless gradients or hessians can be provided
+  const size_t num_dvv = set_s.set.derivative_vector().size();
+  if(set_s.numGradients || set_s.numHessians)
+    buffer.numDerivVars = num_dvv;
+  buffer.gradientsLength = set_s.numGradients*num_dvv;
+  buffer.hessiansLength = set_s.numHessians*num_dvv*num_dvv;
+  buffer.numMetadata = set_s.numMetadata;
+}
+
+/// Add a row for the evaluation to the buffer. The row index, which is the
+/// same one the datasets will have when the buffer is flushed, is returned.
+int EvaluationStore::buffer_variables(const String &root_group, const int &eval_id,
+    const ActiveSet &set, const Variables &variables, const DefaultSet &default_set_s) {
+#ifdef DAKOTA_HAVE_HDF5
+  EvaluationBuffer &buffer = evaluationBuffers[root_group];
+  if(variables.acv() != buffer.numContinuous || variables.adiv() != buffer.numDiscreteInt ||
+     variables.adsv() != buffer.numDiscreteString || variables.adrv() != buffer.numDiscreteReal ||
+     set.request_vector().size() != buffer.numFunctions) {
+    hdf5Stream->flush();
+    throw std::runtime_error(String("Attempt to store evaluation ") + std::to_string(eval_id) +
+                             " in " + root_group + " failed; number of variables or " +
+                             "responses differs from allocation");
+  }
+  buffer.evalIds.push_back(eval_id);
+  const RealVector &cv = variables.all_continuous_variables();
+  buffer.continuous.insert(buffer.continuous.end(), cv.values(), cv.values() + cv.length());
+  const IntVector &div = variables.all_discrete_int_variables();
+  buffer.discreteInt.insert(buffer.discreteInt.end(), div.values(), div.values() + div.length());
+  StringMultiArrayConstView dsv = variables.all_discrete_string_variables();
+  buffer.discreteString.insert(buffer.discreteString.end(), dsv.begin(), dsv.end());
+  const RealVector &drv = variables.all_discrete_real_variables();
+  buffer.discreteReal.insert(buffer.discreteReal.end(), drv.values(), drv.values() + drv.length());
+  const ShortArray &asv = set.request_vector();
+  buffer.asv.insert(buffer.asv.end(), asv.begin(), asv.end());
+  if(buffer.numDerivVars) {
+    buffer.dvv.resize(buffer.dvv.size() + buffer.numDerivVars, 0);
+    set_dvv_bits(set.derivative_vector(), default_set_s.set.derivative_vector(),
+                 &buffer.dvv[buffer.dvv.size() - buffer.numDerivVars]);
+  }
+  // Responses are filled in when they arrive; until then they have the same values
+  // as the fill values of the datasets.
+  buffer.functions.resize(buffer.functions.size() + buffer.numFunctions, REAL_DSET_FILL_VAL);
+  buffer.gradients.resize(buffer.gradients.size() + buffer.gradientsLength, REAL_DSET_FILL_VAL);
+  buffer.hessians.resize(buffer.hessians.size() + buffer.hessiansLength, REAL_DSET_FILL_VAL);
+  buffer.metadata.resize(buffer.metadata.size() + buffer.numMetadata, 0.0);
+  buffer.complete.push_back(false);
+  int resp_idx = buffer.firstRow + buffer.numRows++;
+  // Bound the memory held by evaluations whose responses are outstanding (e.g. a
+  // large asynchronous batch). Their responses are written directly when they arrive.
+  if(size_t(buffer.numRows) >= 2*bufferSize)
+    flush_buffer(root_group, buffer, buffer.numRows);
+  return resp_idx;
+#else
+  return -1;
+#endif
+}
+
+/// Copy the response into its buffered row. Only the values that are present are
+/// copied; the rest retain the NaN fill value. Gradients and hessians are placed
+/// according to the default DVV, and only for the responses that can have them
+/// (see store_response()).
+bool EvaluationStore::buffer_response(const String &root_group, const int &resp_idx,
+    const Response &response, const DefaultSet &default_set_s) {
+#ifdef DAKOTA_HAVE_HDF5
+  auto b_iter = evaluationBuffers.find(root_group);
+  if(!bufferSize || b_iter == evaluationBuffers.end())
+    return false;
+  EvaluationBuffer &buffer = b_iter->second;
+  if(resp_idx < buffer.firstRow) // already written
+    return false;
+  const int row = resp_idx - buffer.firstRow;
+  const ActiveSet &set = response.active_set();
+  const ShortArray &asv = set.request_vector();
+  const SizetArray &dvv = set.derivative_vector();
+  const size_t num_functions = asv.size();
+  const auto &metadata = response.metadata();
+  if(num_functions != buffer.numFunctions ||
+     (!metadata.empty() && metadata.size() != buffer.numMetadata)) {
+    // let store_response()/store_metadata() handle (and report) the mismatch
+    flush_buffer(root_group, buffer, buffer.numRows);
+    return false;
+  }
+  const ShortArray &default_asv = default_set_s.set.request_vector();
+  const SizetArray &default_dvv = default_set_s.set.derivative_vector();
+  const size_t num_default_deriv_vars = default_dvv.size();
+
+  Real *f_row = &buffer.functions[row*buffer.numFunctions];
+  const RealVector &f = response.function_values();
+  for(size_t i = 0; i < num_functions; ++i)
+    if(asv[i] & 1) f_row[i] = f[i];
+
+  // indexes into the default dvv of the current deriv vars
+  SizetArray dvv_idx(dvv.size());
+  if(dvv.size() == num_default_deriv_vars)
+    for(size_t i = 0; i < dvv.size(); ++i)
+      dvv_idx[i] = i;
+  else
+    for(size_t i = 0; i < dvv.size(); ++i)
+      dvv_idx[i] = find_index(default_dvv, dvv[i]);
+
+  if(buffer.gradientsLength &&
+     std::any_of(asv.begin(), asv.end(), [](const short &a){return a & 2;})) {
+    Real *g_row = &buffer.gradients[row*buffer.gradientsLength];
+    for(size_t i = 0; i < num_functions; ++i) {
+      if(!(default_asv[i] & 2))
+        continue;
+      const RealVector col = response.function_gradient_view(i);
+      for(size_t j = 0; j < dvv.size(); ++j)
+        if(dvv_idx[j] != _NPOS)
+          g_row[dvv_idx[j]] = col[j];
+      g_row += num_default_deriv_vars;
+    }
+  }
+
+  if(buffer.hessiansLength &&
+     std::any_of(asv.begin(), asv.end(), [](const short &a){return a & 4;})) {
+    Real *h_row = &buffer.hessians[row*buffer.hessiansLength];
+    for(size_t mi = 0; mi < num_functions; ++mi) {
+      if(!(default_asv[mi] & 4))
+        continue;
+      const RealSymMatrix &resp_hessian = response.function_hessian_view(mi);
+      for(size_t i = 0; i < dvv.size(); ++i) {
+        const size_t &dvv_i = dvv_idx[i];
+        if(dvv_i == _NPOS)
+          continue;
+        h_row[dvv_i*num_default_deriv_vars + dvv_i] = resp_hessian(i,i);
+        for(size_t j = i+1; j < dvv.size(); ++j) {
+          const size_t &dvv_j = dvv_idx[j];
+          if(dvv_j == _NPOS)
+            continue;
+          h_row[dvv_i*num_default_deriv_vars + dvv_j] =
+            h_row[dvv_j*num_default_deriv_vars + dvv_i] = resp_hessian(i,j);
+        }
+      }
+      h_row += num_default_deriv_vars*num_default_deriv_vars;
+    }
+  }
+
+  if(!metadata.empty())
+    std::copy(metadata.begin(), metadata.end(), &buffer.metadata[row*buffer.numMetadata]);
+
+  buffer.complete[row] = true;
+  // Write the leading complete rows once there are enough of them
+  size_t num_complete = std::find(buffer.complete.begin(), buffer.complete.end(), false) -
+    buffer.complete.begin();
+  if(num_complete >= bufferSize)
+    flush_buffer(root_group, buffer, num_complete);
+  return true;
+#else
+  return false;
+#endif
+}
+
+/// Write the leading num_rows rows of the buffer with one hyperslab write per
+/// dataset and remove them from the buffer
+void EvaluationStore::flush_buffer(const String &root_group, EvaluationBuffer &buffer,
+    const int &num_rows) {
+#ifdef DAKOTA_HAVE_HDF5
+  if(num_rows <= 0)
+    return;
+  String scale_root = create_scale_root(root_group);
+  String variables_root = root_group + "variables/";
+  String properties_root = root_group + "properties/";
+  String response_root = root_group + "responses/";
+  hdf5Stream->append_rows(scale_root + "evaluation_ids", buffer.evalIds.data(), num_rows);
+  if(buffer.numContinuous)
+    hdf5Stream->append_rows(variables_root + "continuous", buffer.continuous.data(), num_rows);
+  if(buffer.numDiscreteInt)
+    hdf5Stream->append_rows(variables_root + "discrete_integer", buffer.discreteInt.data(), num_rows);
+  if(buffer.numDiscreteString)
+    hdf5Stream->append_rows(variables_root + "discrete_string", buffer.discreteString.data(), num_rows);
+  if(buffer.numDiscreteReal)
+    hdf5Stream->append_rows(variables_root + "discrete_real", buffer.discreteReal.data(), num_rows);
+  hdf5Stream->append_rows(properties_root + "active_set_vector", buffer.asv.data(), num_rows);
+  if(buffer.numDerivVars)
+    hdf5Stream->append_rows(properties_root + "derivative_variables_vector", buffer.dvv.data(), num_rows);
+  if(buffer.numFunctions)
+    hdf5Stream->append_rows(response_root + "functions", buffer.functions.data(), num_rows);
+  if(buffer.gradientsLength)
+    hdf5Stream->append_rows(response_root + "gradients", buffer.gradients.data(), num_rows);
+  if(buffer.hessiansLength)
+    hdf5Stream->append_rows(response_root + "hessians", buffer.hessians.data(), num_rows);
+  if(buffer.numMetadata)
+    hdf5Stream->append_rows(root_group + "metadata", buffer.metadata.data(), num_rows);
+
+  auto erase_rows = [num_rows](auto &data, const size_t &row_length) {
+    data.erase(data.begin(), data.begin() + num_rows*row_length);
+  };
+  erase_rows(buffer.evalIds, 1);
+  erase_rows(buffer.continuous, buffer.numContinuous);
+  erase_rows(buffer.discreteInt, buffer.numDiscreteInt);
+  erase_rows(buffer.discreteString, buffer.numDiscreteString);
+  erase_rows(buffer.discreteReal, buffer.numDiscreteReal);
+  erase_rows(buffer.asv, buffer.numFunctions);
+  erase_rows(buffer.dvv, buffer.numDerivVars);
+  erase_rows(buffer.functions, buffer.numFunctions);
+  erase_rows(buffer.gradients, buffer.gradientsLength);
+  erase_rows(buffer.hessians, buffer.hessiansLength);
+  erase_rows(buffer.metadata, buffer.numMetadata);
+  erase_rows(buffer.complete, 1);
+  buffer.firstRow += num_rows;
+  buffer.numRows -= num_rows;
+#else
+  return;
+#endif
+}
+
 void EvaluationStore::model_selection(const unsigned short &selection) {
   modelSelection = selection;
 }
@@ -42,13 +42,82 @@ struct DefaultSet {
     DefaultSet() {};
 };
 
+/// Write-behind buffer of evaluations for a model or interface+model
+
+/** Rows of the evaluation datasets are accumulated in row-major order
+    and written in a single hyperslab write per dataset.  The response
+    portions of a row are prefilled (NaN for responses, 0 for metadata)
+    so that partial ASVs can be stored in place. */
+struct EvaluationBuffer {
+    /// index into the 0th dimension of the datasets of the first buffered row
+    int firstRow = 0;
+    /// number of buffered rows
+    int numRows = 0;
+    /// length of a continuous variables row
+    size_t numContinuous = 0;
+    /// length of a discrete integer variables row
+    size_t numDiscreteInt = 0;
+    /// length of a discrete string variables row
+    size_t numDiscreteString = 0;
+    /// length of a discrete real variables row
+    size_t numDiscreteReal = 0;
+    /// length of a functions (and ASV) row
+    size_t numFunctions = 0;
+    /// length of a DVV row (0 if the DVV is not stored)
+    size_t numDerivVars = 0;
+    /// length of a gradients row
+    size_t gradientsLength = 0;
+    /// length of a hessians row
+    size_t hessiansLength = 0;
+    /// length of a metadata row
+    size_t numMetadata = 0;
+    /// evaluation ids
+    IntArray evalIds;
+    /// continuous variables
+    RealArray continuous;
+    /// discrete integer variables
+    IntArray discreteInt;
+    /// discrete string variables
+    StringArray discreteString;
+    /// discrete real variables
+    RealArray discreteReal;
+    /// active set vectors
+    IntArray asv;
+    /// derivative variables vector "bits"
+    IntArray dvv;
+    /// function values
+    RealArray functions;
+    /// gradients (gradient-major)
+    RealArray gradients;
+    /// full (not symmetric) hessians
+    RealArray hessians;
+    /// response metadata
+    RealArray metadata;
+    /// whether the response for each buffered row has been stored
+    BoolDeque complete;
+};
+
 class EvaluationStore {
   public:
+    /// Constructor
+    EvaluationStore();
 #ifdef DAKOTA_HAVE_HDF5
     /// Set the HDF5IOHelper to use
     void set_database(std::shared_ptr<HDF5IOHelper> db_ptr);
 #endif
 
+    /// Set the number of evaluations of a model or interface to accumulate
+    /// before they are written; 0 writes each evaluation immediately
+    void buffer_size(const size_t &num_evals);
+    /// Set the target size in bytes of chunks of the evaluation datasets
+    void chunk_size(const int &num_bytes);
+    /// Set the deflate compression level (1-9) of the evaluation datasets;
+    /// 0 disables compression
+    void compression_level(const int &level);
+
+    /// Write all buffered evaluations to the database
+    void flush();
+
     /// Database is open for writing
     bool active();
     
@@ -200,6 +269,25 @@ class EvaluationStore {
     /// Store metadata
     void store_metadata(const String &root_group, const int &resp_idx, const Response &response);
 
+    /// Size the write-behind buffer for the root group
+    void allocate_buffer(const String &root_group, const Variables &variables,
+        const DefaultSet &set_s);
+
+    /// Add the variables and properties of an evaluation to the buffer for
+    /// the root group and return the index of its row
+    int buffer_variables(const String &root_group, const int &eval_id,
+        const ActiveSet &set, const Variables &variables, const DefaultSet &default_set_s);
+
+    /// Store the response (including metadata) in the buffer for the root group;
+    /// returns false if the row is no longer buffered
+    bool buffer_response(const String &root_group, const int &resp_idx,
+        const Response &response, const DefaultSet &default_set_s);
+
+    /// Write the leading num_rows rows of the buffer to the database
+    void flush_buffer(const String &root_group, EvaluationBuffer &buffer,
+        const int &num_rows);
+
+
     /// Return true if the model is active
     bool model_active(const String &model_id);
 
@@ -240,6 +328,15 @@ class EvaluationStore {
     /// were initially allocated.
     std::set<String> resizedModels;
 
+    /// Write-behind buffers, keyed by root group
+    std::map<String, EvaluationBuffer> evaluationBuffers;
+    /// Number of evaluations to buffer per model or interface
+    size_t bufferSize;
+    /// Target size in bytes of dataset chunks
+    int chunkSize;
+    /// Deflate compression level of evaluation datasets
+    int compressionLevel;
+
     /// Map from variable type enum to string description
     static const std::map<unsigned short, String> variableTypes;
     
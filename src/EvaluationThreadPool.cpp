@@ -0,0 +1,150 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "EvaluationThreadPool.hpp"
+#include <algorithm>
+
+namespace Dakota {
+
+EvaluationThreadPool::EvaluationThreadPool(size_t num_threads):
+  pendingTasks(0), nextQueue(0), numOutstanding(0), shutdownFlag(false)
+{
+  if (num_threads == 0)
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  workerQueues.reserve(num_threads);
+  for (size_t i=0; i<num_threads; ++i)
+    workerQueues.emplace_back(new WorkerQueue());
+
+  workerThreads.reserve(num_threads);
+  for (size_t i=0; i<num_threads; ++i)
+    workerThreads.emplace_back(&EvaluationThreadPool::worker_loop, this, i);
+}
+
+
+EvaluationThreadPool::~EvaluationThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(idleMutex);
+    shutdownFlag = true;
+  }
+  idleCondition.notify_all();
+  for (auto& worker : workerThreads)
+    worker.join();
+}
+
+
+void EvaluationThreadPool::submit(int eval_id, std::function<void()> task)
+{
+  WorkerQueue& wq = *workerQueues[nextQueue];
+  nextQueue = (nextQueue + 1) % workerQueues.size();
+  {
+    std::lock_guard<std::mutex> lock(wq.queueMutex);
+    wq.tasks.push_back(Task{eval_id, std::move(task)});
+  }
+  {
+    // increment under idleMutex so that a worker cannot miss the wakeup
+    // between testing pendingTasks and blocking on idleCondition
+    std::lock_guard<std::mutex> lock(idleMutex);
+    ++pendingTasks;
+  }
+  idleCondition.notify_one();
+  ++numOutstanding;
+}
+
+
+bool EvaluationThreadPool::acquire_task(size_t worker_index, Task& task)
+{
+  size_t i, num_queues = workerQueues.size();
+  // own queue first (FIFO preserves the launch order of the scheduler) ...
+  {
+    WorkerQueue& own = *workerQueues[worker_index];
+    std::lock_guard<std::mutex> lock(own.queueMutex);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.front()); own.tasks.pop_front();
+      --pendingTasks;
+      return true;
+    }
+  }
+  // ... then steal from the back of a peer's queue
+  for (i=1; i<num_queues; ++i) {
+    WorkerQueue& victim = *workerQueues[(worker_index + i) % num_queues];
+    std::lock_guard<std::mutex> lock(victim.queueMutex);
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.back()); victim.tasks.pop_back();
+      --pendingTasks;
+      return true;
+    }
+  }
+  return false;
+}
+
+
+void EvaluationThreadPool::worker_loop(size_t worker_index)
+{
+  Task task;
+  while (true) {
+    if (!acquire_task(worker_index, task)) {
+      std::unique_lock<std::mutex> lock(idleMutex);
+      idleCondition.wait(lock,
+	[this]{ return shutdownFlag || pendingTasks.load() > 0; });
+      if (shutdownFlag && pendingTasks.load() == 0)
+	return;
+      continue;
+    }
+
+    std::exception_ptr failure;
+    try { task.work(); }
+    catch (...) { failure = std::current_exception(); }
+    // release any envelope handles captured by the task on this thread
+    task.work = nullptr;
+
+    {
+      std::lock_guard<std::mutex> lock(completionMutex);
+      completedIds.push_back(task.evalId);
+      if (failure)
+	completedFailures[task.evalId] = failure;
+    }
+    completionCondition.notify_one();
+  }
+}
+
+
+void EvaluationThreadPool::
+drain_completions(IntSet& completed,
+		  std::map<int, std::exception_ptr>& failures)
+{
+  for (int id : completedIds)
+    completed.insert(id);
+  numOutstanding -= completedIds.size();
+  completedIds.clear();
+  failures.insert(completedFailures.begin(), completedFailures.end());
+  completedFailures.clear();
+}
+
+
+void EvaluationThreadPool::
+wait_some(IntSet& completed, std::map<int, std::exception_ptr>& failures)
+{
+  if (!numOutstanding)
+    return;
+  std::unique_lock<std::mutex> lock(completionMutex);
+  completionCondition.wait(lock, [this]{ return !completedIds.empty(); });
+  drain_completions(completed, failures);
+}
+
+
+void EvaluationThreadPool::
+test_some(IntSet& completed, std::map<int, std::exception_ptr>& failures)
+{
+  std::lock_guard<std::mutex> lock(completionMutex);
+  drain_completions(completed, failures);
+}
+
+} // namespace Dakota
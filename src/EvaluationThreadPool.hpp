@@ -0,0 +1,149 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#ifndef EVALUATION_THREAD_POOL_H
+#define EVALUATION_THREAD_POOL_H
+
+#include "dakota_data_types.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Dakota {
+
+/// Work-stealing pool of threads for asynchronous local evaluations
+
+/** EvaluationThreadPool executes in-process evaluation tasks on a
+    fixed set of worker threads.  Each worker owns a task deque; tasks
+    are dealt round-robin by the (single) scheduling thread and idle
+    workers steal from the back of their peers' deques.  Completed
+    evaluation ids are queued in completion order and retrieved with
+    wait_some() (blocking, modeled after MPI_Waitsome()) or test_some()
+    (nonblocking, modeled after MPI_Testsome()).  Exceptions thrown by a
+    task are captured and returned to the scheduling thread rather than
+    propagated on the worker. */
+class EvaluationThreadPool
+{
+public:
+
+  //
+  //- Heading: Constructors and destructor
+  //
+
+  /// constructor launches num_threads workers (hardware concurrency if 0)
+  EvaluationThreadPool(size_t num_threads = 0);
+  /// destructor drains outstanding tasks and joins the workers
+  ~EvaluationThreadPool();
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// enqueue a task for evaluation eval_id
+  void submit(int eval_id, std::function<void()> task);
+
+  /// block until at least one task completes, then append all completed
+  /// eval ids to completed and any captured exceptions to failures
+  void wait_some(IntSet& completed,
+		 std::map<int, std::exception_ptr>& failures);
+  /// nonblocking: append any already-completed eval ids to completed and
+  /// any captured exceptions to failures
+  void test_some(IntSet& completed,
+		 std::map<int, std::exception_ptr>& failures);
+
+  /// number of submitted tasks that have not yet been retrieved through
+  /// wait_some() / test_some()
+  size_t num_outstanding() const;
+
+  /// number of worker threads
+  size_t num_threads() const;
+
+private:
+
+  //
+  //- Heading: Convenience types
+  //
+
+  /// a pending evaluation task
+  struct Task {
+    int evalId;
+    std::function<void()> work;
+  };
+
+  /// per-worker task deque; owner pops from the front, thieves from the back
+  struct WorkerQueue {
+    std::mutex queueMutex;
+    std::deque<Task> tasks;
+  };
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// worker thread main loop
+  void worker_loop(size_t worker_index);
+  /// pop from own queue or steal from a peer
+  bool acquire_task(size_t worker_index, Task& task);
+  /// move completed ids / exceptions out of the completion queue
+  /// (completionMutex must be held)
+  void drain_completions(IntSet& completed,
+			 std::map<int, std::exception_ptr>& failures);
+
+  //
+  //- Heading: Data
+  //
+
+  /// one task deque per worker
+  std::vector<std::unique_ptr<WorkerQueue>> workerQueues;
+  /// the worker threads
+  std::vector<std::thread> workerThreads;
+
+  /// number of tasks enqueued but not yet acquired by a worker
+  std::atomic<size_t> pendingTasks;
+  /// round-robin index for dealing new tasks to worker queues
+  size_t nextQueue;
+  /// submitted but not yet retrieved evaluations
+  size_t numOutstanding;
+  /// signals pool shutdown to the workers
+  bool shutdownFlag;
+
+  /// protects the idle wait of workers on new tasks
+  std::mutex idleMutex;
+  /// notifies idle workers of new tasks or shutdown
+  std::condition_variable idleCondition;
+
+  /// protects completedIds and completedFailures
+  std::mutex completionMutex;
+  /// notifies the scheduling thread of completed tasks
+  std::condition_variable completionCondition;
+  /// eval ids of completed tasks, in completion order
+  std::deque<int> completedIds;
+  /// exceptions captured from failed tasks, keyed by eval id
+  std::map<int, std::exception_ptr> completedFailures;
+};
+
+
+inline size_t EvaluationThreadPool::num_outstanding() const
+{ return numOutstanding; }
+
+
+inline size_t EvaluationThreadPool::num_threads() const
+{ return workerThreads.size(); }
+
+} // namespace Dakota
+
+#endif
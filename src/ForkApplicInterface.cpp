@@ -16,14 +16,82 @@
 #include <sys/wait.h> // for wait and waitpid
 #include <unistd.h>   // for fork, execvp, setgpid
 #include <algorithm>
-#include <thread>
+#include <sstream>
 
 namespace Dakota {
 
 ForkApplicInterface::
 ForkApplicInterface(const ProblemDescDB& problem_db, ParallelLibrary& parallel_lib):
-  ProcessHandleApplicInterface(problem_db, parallel_lib)
-{ }
+  ProcessHandleApplicInterface(problem_db, parallel_lib),
+  persistentDrivers(problem_db.get_bool("interface.application.persistent")),
+  persistentReplyReader(true)
+{
+  // a persistent driver serves whole evaluations, so there is no point
+  // at which filters, additional drivers, or per-evaluation work
+  // directories could be applied
+  if (persistentDrivers) {
+    if (programNames.size() != 1 || !iFilterName.empty() ||
+	!oFilterName.empty()) {
+      Cerr << "\nError: persistent analysis drivers require a single "
+	   << "analysis_driver and no\n       input_filter or output_filter."
+	   << std::endl;
+      abort_handler(-1);
+    }
+    if (batchEval || useWorkdir) {
+      Cerr << "\nError: persistent analysis drivers do not support batch "
+	   << "evaluation or\n       work_directory." << std::endl;
+      abort_handler(-1);
+    }
+  }
+}
+
+
+void ForkApplicInterface::
+derived_map(const Variables& vars, const ActiveSet& set, Response& response,
+	    int fn_eval_id)
+{
+  if (!persistentDrivers) {
+    ProcessHandleApplicInterface::derived_map(vars, set, response, fn_eval_id);
+    return;
+  }
+  if (evalCommSize > 1) {
+    Cerr << "\nError: persistent analysis drivers do not support "
+	 << "multiprocessor evaluations." << std::endl;
+    abort_handler(-1);
+  }
+
+  submit_persistent_evaluation(vars, set, response, fn_eval_id);
+  std::map<int, String> replies; IntSet failures;
+  while (replies.find(fn_eval_id) == replies.end() &&
+	 failures.find(fn_eval_id) == failures.end())
+    driverPool->wait_some(replies, failures);
+
+  // a blocking evaluation may be a retry from manage_failure() while
+  // asynchronous evaluations are running: defer their completions to the
+  // next wait/test
+  bool failed = failures.erase(fn_eval_id);
+  String reply;
+  if (!failed)
+    { reply = replies[fn_eval_id]; replies.erase(fn_eval_id); }
+  deferredReplies.insert(replies.begin(), replies.end());
+  deferredFailures.insert(failures.begin(), failures.end());
+
+  if (failed)
+    // rethrown to the catch in manage_failure(), as for a "fail" result
+    throw FunctionEvalFailure("persistent analysis driver exited during "
+			      "evaluation " + std::to_string(fn_eval_id));
+  read_persistent_reply(response, fn_eval_id, reply);
+}
+
+
+void ForkApplicInterface::derived_map_asynch(const ParamResponsePair& pair)
+{
+  if (persistentDrivers)
+    submit_persistent_evaluation(pair.variables(), pair.active_set(),
+				 pair.response(), pair.eval_id());
+  else
+    ProcessHandleApplicInterface::derived_map_asynch(pair);
+}
 
 
 void ForkApplicInterface::wait_local_evaluation_sequence(PRPQueue& prp_queue)
@@ -35,6 +103,17 @@ void ForkApplicInterface::wait_local_evaluation_sequence(PRPQueue& prp_queue)
   // could always accept the same completion - the case of very inexpensive fn.
   // evals. - and starve some servers).
 
+  if (persistentDrivers) {
+    std::map<int, String> replies; IntSet failures;
+    replies.swap(deferredReplies); failures.swap(deferredFailures);
+    if (replies.empty() && failures.empty())
+      driverPool->wait_some(replies, failures);
+    else
+      driverPool->test_some(replies, failures);
+    process_persistent_evaluations(prp_queue, replies, failures);
+    return;
+  }
+
   // wait for any process within the process group to finish.  No need for
   // usleep in wait_local_evaluation_sequence() since blocking wait is already
   // system optimized.
@@ -51,13 +130,27 @@ void ForkApplicInterface::test_local_evaluation_sequence(PRPQueue& prp_queue)
   // Check for return of process id's corresponding to those stored in PRPairs.
   // Do not wait - complete all jobs that are immediately available.
 
+  if (persistentDrivers) {
+    // as below, throttle testing when nothing has finished, returning as
+    // soon as a reply arrives
+    std::map<int, String> replies; IntSet failures;
+    replies.swap(deferredReplies); failures.swap(deferredFailures);
+    driverPool->wait_some(replies, failures,
+			  (replies.empty() && failures.empty()) ? 1 : 0);
+    process_persistent_evaluations(prp_queue, replies, failures);
+    return;
+  }
+
   pid_t pid;
   while ( !evalProcessIdMap.empty() && (pid=wait_evaluation(false)) > 0 )
     process_local_evaluation(prp_queue, pid);
 
-  // reduce processor load from DAKOTA testing if jobs are not finishing
-  if (completionSet.empty())
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  // reduce processor load from DAKOTA testing if jobs are not finishing,
+  // returning as soon as a child exits when exits can be watched
+  if (completionSet.empty()) {
+    completionNotifier.watch_processes(evalProcessIdMap);
+    completionNotifier.wait(1);
+  }
 }
 
 
@@ -220,7 +313,8 @@ wait(pid_t process_group_id, std::map<pid_t, int>& process_id_map,
     // This fallback is consistent with Approach 3 below: abandon
     // group id and manually test each pid within the process_id_map
     std::map<pid_t, int>::iterator gp_it;
-    bool done = false;
+    bool done = false,
+      watched = block_flag && completionNotifier.watch_processes(process_id_map);
     while (!done) {
       for (gp_it=process_id_map.begin(); gp_it!=process_id_map.end(); ++gp_it) {
 	pid = waitpid(gp_it->first, &status, WNOHANG);
@@ -229,8 +323,10 @@ wait(pid_t process_group_id, std::map<pid_t, int>& process_id_map,
 	  { done = true; break; }
       }
       if (block_flag) {
+	// block until a child exits (the timeout is only a safeguard) or,
+	// if exits cannot be watched, poll
 	if (!done)
-	  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	  completionNotifier.wait(watched ? 1000 : 1);
       }
       else done = true;
     }
@@ -282,6 +378,89 @@ join_process_group(pid_t& process_group_id, bool new_group)
 }
 
 
+void ForkApplicInterface::
+submit_persistent_evaluation(const Variables& vars, const ActiveSet& set,
+			     const Response& response, int fn_eval_id)
+{
+  if (!driverPool) {
+    // the driver is launched without parameters/results file arguments
+    String driver_subbed = substitute_params_and_results(programNames[0],
+							 String(), String());
+    driverPool.reset(new PersistentDriverPool(
+      WorkdirHelper::tokenize_driver(driver_subbed)));
+  }
+
+  if (evalCommRank == 0 && !suppressOutput)
+    Cout << "persistent driver: " << programNames[0] << '\n';
+
+  std::vector<String> an_comps;
+  if (!analysisComponents.empty())
+    copy_data(analysisComponents, an_comps);
+  std::ostringstream request;
+  persistentRequestWriter.write_parameters(vars, set, response,
+    programNames[0], an_comps, final_eval_id_tag(fn_eval_id), request);
+  driverPool->submit(fn_eval_id, request.str());
+}
+
+
+void ForkApplicInterface::
+read_persistent_reply(Response& response, int fn_eval_id, const String& reply)
+{
+  std::istringstream reply_stream(reply);
+  try {
+    persistentReplyReader.read_results(response, reply_stream,
+				       "persistent driver reply", fn_eval_id);
+  }
+  catch(const FileReadException& fr_except) {
+    // the reply is complete, so a malformed reply is a true error
+    Cerr << fr_except.what() << std::endl;
+    abort_handler(INTERFACE_ERROR);
+  }
+}
+
+
+void ForkApplicInterface::
+process_persistent_evaluations(PRPQueue& prp_queue,
+			       std::map<int, String>& replies,
+			       IntSet& failures)
+{
+  for (auto& id_reply : replies) {
+    int fn_eval_id = id_reply.first;
+    PRPQueueIter queue_it = lookup_by_eval_id(prp_queue, fn_eval_id);
+    if (queue_it == prp_queue.end()) {
+      Cerr << "Error: failure in queue lookup within ForkApplicInterface::"
+	   << "process_persistent_evaluations()." << std::endl;
+      abort_handler(-1);
+    }
+    Response response = queue_it->response(); // shallow copy
+    try
+      { read_persistent_reply(response, fn_eval_id, id_reply.second); }
+    catch(const FunctionEvalFailure& fneval_except) {
+      manage_failure(queue_it->variables(), response.active_set(), response,
+		     fn_eval_id);
+    }
+    completionSet.insert(fn_eval_id);
+  }
+
+  // a worker that exited is replaced when the next evaluation is
+  // submitted; its evaluation is handled as a failed evaluation
+  for (int fn_eval_id : failures) {
+    PRPQueueIter queue_it = lookup_by_eval_id(prp_queue, fn_eval_id);
+    if (queue_it == prp_queue.end()) {
+      Cerr << "Error: failure in queue lookup within ForkApplicInterface::"
+	   << "process_persistent_evaluations()." << std::endl;
+      abort_handler(-1);
+    }
+    Cerr << "Warning: persistent analysis driver exited during evaluation "
+	 << fn_eval_id << "." << std::endl;
+    Response response = queue_it->response(); // shallow copy
+    manage_failure(queue_it->variables(), response.active_set(), response,
+		   fn_eval_id);
+    completionSet.insert(fn_eval_id);
+  }
+}
+
+
 void ForkApplicInterface::check_group(int err, pid_t proc_group_id)
 {
   if (err) {
@@ -11,6 +11,10 @@
 #define FORK_APPLIC_INTERFACE_H
 
 #include "ProcessHandleApplicInterface.hpp"
+#include "CompletionNotifier.hpp"
+#include "PersistentDriverPool.hpp"
+#include "JSONParametersFileWriter.hpp"
+#include "JSONResultsFileReader.hpp"
 
 
 namespace Dakota {
@@ -40,6 +44,10 @@ protected:
   //- Heading: Virtual function redefinitions
   //
 
+  void derived_map(const Variables& vars, const ActiveSet& set,
+		   Response& response, int fn_eval_id) override;
+  void derived_map_asynch(const ParamResponsePair& pair) override;
+
   void wait_local_evaluation_sequence(PRPQueue& prp_queue) override;
   void test_local_evaluation_sequence(PRPQueue& prp_queue) override;
 
@@ -86,6 +94,20 @@ private:
   /// core code used by join_{evaluation,analysis}_process_group()
   void join_process_group(pid_t& process_group_id, bool new_group);
 
+  /// send an evaluation request to the persistent driver pool, creating
+  /// the pool on first use
+  void submit_persistent_evaluation(const Variables& vars,
+				    const ActiveSet& set,
+				    const Response& response, int fn_eval_id);
+  /// populate response from the reply of a persistent driver
+  void read_persistent_reply(Response& response, int fn_eval_id,
+			     const String& reply);
+  /// common processing of persistent driver completions and failures
+  /// used by {wait,test}_local_evaluation_sequence()
+  void process_persistent_evaluations(PRPQueue& prp_queue,
+				      std::map<int, String>& replies,
+				      IntSet& failures);
+
   //
   //- Heading: Data
   //
@@ -98,6 +120,26 @@ private:
   /// used by this interface instance (to distinguish from other interface
   /// instances that could be running at the same time)
   pid_t analysisProcGroupId;
+
+  /// event-driven detection of child exits, replacing sleeps between
+  /// nonblocking waitpid() tests where supported
+  CompletionNotifier completionNotifier;
+
+  /// flags evaluation by long-lived analysis driver processes that
+  /// exchange parameters and results over sockets (persistent keyword)
+  bool persistentDrivers;
+  /// pool of persistent analysis driver processes (created on first use)
+  std::unique_ptr<PersistentDriverPool> driverPool;
+  /// persistent driver replies received during a blocking evaluation
+  /// for other (asynchronous) evaluations
+  std::map<int, String> deferredReplies;
+  /// asynchronous evaluations whose persistent driver exited during a
+  /// blocking evaluation
+  IntSet deferredFailures;
+  /// JSON encoding of persistent driver requests
+  JSONParametersFileWriter persistentRequestWriter;
+  /// JSON decoding of persistent driver replies
+  JSONResultsFileReader persistentReplyReader;
 };
 
 
@@ -7,6 +7,7 @@
     For more information, see the README file in the top Dakota directory.
     _______________________________________________________________________ */
 
+#include <algorithm>
 #include <limits>
 #include "GaussProcApproximation.hpp"
 #include "dakota_data_types.hpp"
@@ -213,6 +214,110 @@ Real GaussProcApproximation::prediction_variance(const Variables& vars)
 { GPmodel_apply(vars.continuous_variables(),true,false); return approxVariance;}
 
 
+/** Predictions at all points are formed with matrix products against
+    the training data, rather than one covariance vector at a time. */
+void GaussProcApproximation::
+batch_value(const Variables& vars, const RealMatrix& c_vars,
+	    RealVector& fn_vals)
+{
+  RealMatrix norm_pts, cov_mat, trend_mat;
+  get_cov_matrix(c_vars, norm_pts, cov_mat);
+  get_trend(norm_pts, trend_mat);
+
+  int num_pts = c_vars.numCols();
+  fn_vals.sizeUninitialized(num_pts);
+  RealMatrix vals(Teuchos::View, fn_vals.values(), num_pts, num_pts, 1);
+  vals.multiply(Teuchos::TRANS, Teuchos::NO_TRANS, 1., cov_mat, Rinv_YFb, 0.);
+  vals.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1., trend_mat,
+		betaCoeffs, 1.);
+}
+
+
+void GaussProcApproximation::
+batch_gradient(const Variables& vars, const RealMatrix& c_vars,
+	       RealMatrix& fn_grads)
+{
+  RealMatrix norm_pts, cov_mat;
+  get_cov_matrix(c_vars, norm_pts, cov_mat);
+
+  // d/dx_i of sum_j w_j r_j(x) = -2 exp(theta_i)/s_i (x_i sum_j w_j r_j(x)
+  //   - sum_j w_j r_j(x) t_ji), with w = Rinv_YFb
+  int i, j, p, num_pts = c_vars.numCols(),
+    num_v = (int)sharedDataRep->numVars;
+  RealMatrix w_cov(numObs, num_pts, false);
+  RealVector w_sum(num_pts);
+  for (p=0; p<num_pts; ++p)
+    for (j=0; j<(int)numObs; ++j)
+      w_sum[p] += w_cov(j,p) = Rinv_YFb(j,0) * cov_mat(j,p);
+  fn_grads.shapeUninitialized(num_v, num_pts);
+  fn_grads.multiply(Teuchos::TRANS, Teuchos::NO_TRANS, 1., normTrainPoints,
+		    w_cov, 0.);
+  for (p=0; p<num_pts; ++p)
+    for (i=0; i<num_v; ++i) {
+      Real& grad_ip = fn_grads(i,p);
+      grad_ip = -2. * std::exp(thetaParams[i]) *
+	(norm_pts(p,i) * w_sum[p] - grad_ip) / trainStdvs(i);
+      switch (trendOrder) {
+      case 1:
+	grad_ip +=   betaCoeffs(i+1,0) / trainStdvs(i);  break;
+      case 2:
+	grad_ip += ( betaCoeffs(i+1,0) + 2.*betaCoeffs(num_v+i+1,0) *
+		     norm_pts(p,i) ) / trainStdvs(i); break;
+      }
+    }
+}
+
+
+/** Uses the full variance expression of predict(), with the solves
+    against the covariance and trend Gram matrices performed once for
+    all points. */
+void GaussProcApproximation::
+batch_prediction_variance(const Variables& vars, const RealMatrix& c_vars,
+			  RealVector& fn_vars)
+{
+  RealMatrix norm_pts, cov_mat, trend_mat;
+  get_cov_matrix(c_vars, norm_pts, cov_mat);
+  get_trend(norm_pts, trend_mat);
+
+  int j, p, num_pts = c_vars.numCols(), trend_dim = trendFunction.numCols();
+  RealMatrix Rinv_cov(numObs, num_pts, false);
+  covSlvr.setVectors( rcp(&Rinv_cov, false), rcp(&cov_mat, false) );
+  covSlvr.solve();
+
+  // f(x) - F^T R^{-1} r(x) for each point, solved against F^T R^{-1} F
+  RealMatrix f_FT_Rinv_r(trend_dim, num_pts, false);
+  for (p=0; p<num_pts; ++p)
+    for (j=0; j<trend_dim; ++j)
+      f_FT_Rinv_r(j,p) = trend_mat(p,j);
+  f_FT_Rinv_r.multiply(Teuchos::TRANS, Teuchos::NO_TRANS, -1., trendFunction,
+		       Rinv_cov, 1.);
+  RealMatrix Rinv_F(numObs, trend_dim, false);
+  covSlvr.setVectors( rcp(&Rinv_F, false), rcp(&trendFunction, false) );
+  covSlvr.solve();
+  RealMatrix FT_Rinv_F(trend_dim, trend_dim, false),
+    temp9(trend_dim, num_pts, false);
+  FT_Rinv_F.multiply(Teuchos::TRANS, Teuchos::NO_TRANS, 1., trendFunction,
+		     Rinv_F, 0.);
+  RealSolver Temp_slvr;
+  Temp_slvr.setMatrix( rcp(&FT_Rinv_F, false) );
+  Temp_slvr.setVectors( rcp(&temp9, false), rcp(&f_FT_Rinv_r, false) );
+  Temp_slvr.factorWithEquilibration(true);
+  Temp_slvr.factor();
+  Temp_slvr.solve();
+
+  fn_vars.sizeUninitialized(num_pts);
+  for (p=0; p<num_pts; ++p) {
+    Real rT_Rinv_r = 0., trend_term = 0.;
+    for (j=0; j<(int)numObs; ++j)
+      rT_Rinv_r += cov_mat(j,p) * Rinv_cov(j,p);
+    for (j=0; j<trend_dim; ++j)
+      trend_term += temp9(j,p) * f_FT_Rinv_r(j,p);
+    // check for small (possibly negative) variance
+    fn_vars[p] = std::max(procVar*(1.- rT_Rinv_r + trend_term), 1.e-9);
+  }
+}
+
+
 void GaussProcApproximation::GPmodel_build()
 {
   // Point selection is off by default, but will be forced if a large
@@ -597,6 +702,66 @@ void GaussProcApproximation::get_cov_vector()
 #endif //DEBUG_FULL
 }
 
+/** The squared distances are expanded so that the cross terms between
+    the points and the training data form a single matrix product. */
+void GaussProcApproximation::
+get_cov_matrix(const RealMatrix& c_vars, RealMatrix& norm_pts,
+	       RealMatrix& cov_mat)
+{
+  int i, j, p, num_pts = c_vars.numCols(),
+    num_v = (int)sharedDataRep->numVars;
+  if (c_vars.numRows() != num_v) {
+    Cerr << "Error: Dimension mismatch in GaussProcApproximation::"
+	 << "get_cov_matrix()" << std::endl;
+    abort_handler(-1);
+  }
+
+  RealVector expThetaParms(num_v);
+  for (i=0; i<num_v; i++)
+    expThetaParms[i] = std::exp(thetaParams[i]);
+
+  norm_pts.shapeUninitialized(num_pts, num_v);
+  RealVector pt_sq(num_pts), train_sq(numObs);
+  for (p=0; p<num_pts; ++p)
+    for (i=0; i<num_v; ++i) {
+      Real x_pi = norm_pts(p,i) = (c_vars(i,p) - trainMeans(i))/trainStdvs(i);
+      pt_sq[p] += expThetaParms[i] * x_pi * x_pi;
+    }
+  RealMatrix scaled_train(numObs, num_v, false);
+  for (i=0; i<num_v; ++i)
+    for (j=0; j<(int)numObs; ++j) {
+      Real t_ji = normTrainPoints(j,i);
+      train_sq[j] += expThetaParms[i] * t_ji * t_ji;
+      scaled_train(j,i) = expThetaParms[i] * t_ji;
+    }
+
+  cov_mat.shapeUninitialized(numObs, num_pts);
+  cov_mat.multiply(Teuchos::NO_TRANS, Teuchos::TRANS, -2., scaled_train,
+		   norm_pts, 0.);
+  for (p=0; p<num_pts; ++p)
+    for (j=0; j<(int)numObs; ++j)
+      cov_mat(j,p) = std::exp(-std::max(0., cov_mat(j,p) + train_sq[j]
+					   + pt_sq[p]));
+}
+
+
+void GaussProcApproximation::
+get_trend(const RealMatrix& norm_pts, RealMatrix& trend_mat)
+{
+  int i, p, num_pts = norm_pts.numRows(), num_v = norm_pts.numCols();
+  trend_mat.shapeUninitialized(num_pts, trendFunction.numCols());
+  for (p=0; p<num_pts; ++p) {
+    trend_mat(p,0) = 1.;
+    if (trendOrder > 0)
+      for (i=0; i<num_v; ++i) {
+	trend_mat(p,i+1) = norm_pts(p,i);
+	if (trendOrder == 2)
+	  trend_mat(p,num_v+i+1) = norm_pts(p,i)*norm_pts(p,i);
+      }
+  }
+}
+
+
 void GaussProcApproximation::predict(bool variance_flag, bool gradients_flag)
 {
   size_t i, j, k, num_v = sharedDataRep->numVars;
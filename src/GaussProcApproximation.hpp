@@ -79,6 +79,17 @@ protected:
   /// retrieve the variance of the predicted value for a given parameter set
   Real prediction_variance(const Variables& vars) override;
 
+  /// retrieve the function values for a batch of points
+  void batch_value(const Variables& vars, const RealMatrix& c_vars,
+		   RealVector& fn_vals) override;
+  /// retrieve the function gradients for a batch of points
+  void batch_gradient(const Variables& vars, const RealMatrix& c_vars,
+		      RealMatrix& fn_grads) override;
+  /// retrieve the variances of the predicted values for a batch of points
+  void batch_prediction_variance(const Variables& vars,
+				 const RealMatrix& c_vars,
+				 RealVector& fn_vars) override;
+
 private: 
 
   //
@@ -113,6 +124,13 @@ private:
   /// calculates the covariance vector between a new point x and the 
   /// set of inputs upon which the GP is based
   void get_cov_vector();
+  /// normalizes the points in the columns of c_vars (one row of
+  /// norm_pts per point) and calculates the covariance matrix between
+  /// them and the training points (one column per point)
+  void get_cov_matrix(const RealMatrix& c_vars, RealMatrix& norm_pts,
+		      RealMatrix& cov_mat);
+  /// evaluates the trend functions at normalized points (one row per point)
+  void get_trend(const RealMatrix& norm_pts, RealMatrix& trend_mat);
   /// sets up and performs the optimization of the negative 
   /// log likelihood to determine the optimal values of the covariance
   /// parameters using NCSUDirect
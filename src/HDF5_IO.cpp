@@ -163,6 +163,49 @@ void HDF5IOHelper::append_vector(const String &dset_name, const StringMultiArray
   append_vector(dset_name, ptrs_to_data, row);
 }
 
+/// Set num_rows consecutive "layers" of Strings in a dataset
+void HDF5IOHelper::set_rows(const String &dset_name, const String *data,
+                            const int &first_row, const int &num_rows) {
+  if(num_rows <= 0)
+    return;
+  // The number of Strings is the number of rows times the size of a layer
+  auto ds_iter = datasetCache.find(dset_name);
+  H5::DataSet ds = (ds_iter != datasetCache.end()) ? ds_iter->second :
+    h5File.openDataSet(dset_name);
+  H5::DataSpace f_space = ds.getSpace();
+  int rank = f_space.getSimpleExtentNdims();
+  std::unique_ptr<hsize_t[]> dims(new hsize_t[rank]);
+  f_space.getSimpleExtentDims(dims.get());
+  size_t len = std::accumulate(&dims[1], &dims[rank], size_t(num_rows),
+                               std::multiplies<size_t>());
+  std::vector<const char *> ptrs_to_data(len);
+  std::transform(data, data + len, ptrs_to_data.begin(),
+      [](const String &s){return s.c_str();});
+  set_rows(dset_name, ptrs_to_data.data(), first_row, num_rows);
+}
+
+/// Append num_rows "layers" of Strings to a dataset
+int HDF5IOHelper::append_rows(const String &dset_name, const String *data,
+                              const int &num_rows) {
+  H5::DataSet &ds = datasetCache[dset_name];
+  H5::DataSpace f_space = ds.getSpace();
+  int rank = f_space.getSimpleExtentNdims();
+  std::unique_ptr<hsize_t[]> dims(new hsize_t[rank]), maxdims(new hsize_t[rank]);
+  f_space.getSimpleExtentDims(dims.get(), maxdims.get());
+  if(maxdims[0] != H5S_UNLIMITED) {
+    flush();
+    throw std::runtime_error(String("Attempt to append rows to ") +
+                               dset_name + " failed; dimensions are fixed.");
+  }
+  int first_row = dims[0];
+  if(num_rows <= 0)
+    return first_row;
+  dims[0] += num_rows;
+  ds.extend(dims.get());
+  set_rows(dset_name, data, first_row, num_rows);
+  return first_row;
+}
+
 
 /// Store vector (1D) information to a dataset
 void HDF5IOHelper::store_vector(const std::string & dset_name,
@@ -359,7 +402,7 @@ H5::Group HDF5IOHelper::create_group(const H5::H5Location &loc, const std::strin
 void HDF5IOHelper::
 create_empty_dataset(const String &dset_name, const IntArray &dims, 
                   ResultsOutputType stored_type, int chunk_size, 
-                  const void* fill_val) 
+                  const void* fill_val, int compression_level) 
 {
   create_groups(dset_name);
   H5::DataType h5_type = h5_file_dtype(stored_type);
@@ -413,6 +456,10 @@ create_empty_dataset(const String &dset_name, const IntArray &dims,
     create_plist.setChunk(rank, chunks.get());
     if(fill_val)
       create_plist.setFillValue(fill_type, fill_val);
+    // deflate is applied chunk by chunk, so it is available only for the
+    // (chunked) unlimited datasets
+    if(compression_level > 0)
+      create_plist.setDeflate(std::min(compression_level, 9));
     H5::DSetAccPropList access_plist;
     // See the C API documentation for H5P_set_chunk_cache for guidance
     const size_t cache_size = 20*actual_chunksize;
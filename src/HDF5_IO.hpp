@@ -31,6 +31,8 @@
 #include <cmath>
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <numeric>
 
 
 namespace Dakota
@@ -379,6 +381,26 @@ class HDF5IOHelper
                      const std::vector<Teuchos::SerialDenseMatrix<int, T> > &data,
                      const bool &transpose = false);
 
+  /// Set num_rows consecutive "layers" of a dataset, beginning at index
+  /// first_row into the 0th dimension, using a single hyperslab write. The
+  /// trailing dimensions are written in full, and data must hold
+  /// num_rows layers contiguously in row-major order.
+  template<typename T>
+  void set_rows(const String &dset_name, const T *data,
+                const int &first_row, const int &num_rows);
+  /// Set num_rows consecutive "layers" of Strings in a dataset
+  void set_rows(const String &dset_name, const String *data,
+                const int &first_row, const int &num_rows);
+  /// Append num_rows "layers" to a dataset with an unlimited 0th dimension
+  /// using a single extend and hyperslab write, and return the index of the
+  /// first of them. data must hold num_rows layers contiguously in row-major
+  /// order.
+  template<typename T>
+  int append_rows(const String &dset_name, const T *data, const int &num_rows);
+  /// Append num_rows "layers" of Strings to a dataset with an unlimited 0th
+  /// dimension
+  int append_rows(const String &dset_name, const String *data, const int &num_rows);
+
   /// Read scalar data from a dataset
   template <typename T>
   void read_scalar(const std::string& dset_name, T& val);
@@ -415,10 +437,12 @@ class HDF5IOHelper
   void report_num_open();
   /// Create an empty dataset. Setting the first element of dims to 0 makes
   /// the dataset unlimited in that dimension. DSs unlimited in other dimensions
-  /// currently are unsupported.
+  /// currently are unsupported. For unlimited datasets, chunk_size is the
+  /// target size of a chunk in bytes, and a compression_level of 1-9 enables
+  /// deflate compression of the chunks.
   void create_empty_dataset(const String &dset_name, const IntArray &dims, 
                          ResultsOutputType stored_type, int chunk_size=0, 
-                         const void *fill_val = NULL);
+                         const void *fill_val = NULL, int compression_level = 0);
 
   /// Create a dataset with compound type
   void create_empty_dataset(const String &dset_name, const IntArray &dims, 
@@ -1147,6 +1171,63 @@ void HDF5IOHelper::append_vector_matrix(const String &dset_name,
   set_vector_matrix(dset_name, ds, data, dims[0]-1, transpose);
 }
 
+template<typename T>
+void HDF5IOHelper::set_rows(const String &dset_name, const T *data,
+                            const int &first_row, const int &num_rows) {
+  // 1. open the dataset
+  // 2. discover the rank and dimensions
+  // 3. Raise an error if the rows don't fit in the 0th dimension
+  // 4. Select a hyperslab spanning the rows and all trailing dimensions
+  // 5. Write
+  if(num_rows <= 0)
+    return;
+  auto ds_iter = datasetCache.find(dset_name);
+  H5::DataSet ds = (ds_iter != datasetCache.end()) ? ds_iter->second :
+    h5File.openDataSet(dset_name);
+  H5::DataSpace f_space = ds.getSpace();
+  int rank = f_space.getSimpleExtentNdims();
+  std::unique_ptr<hsize_t[]> dims(new hsize_t[rank]), start(new hsize_t[rank]);
+  f_space.getSimpleExtentDims(dims.get());
+  if(first_row < 0 || first_row + num_rows > dims[0]) {
+    flush();
+    throw std::runtime_error(String("Attempt to set rows of ") + dset_name +
+                               " failed; requested rows are " + std::to_string(first_row) +
+                               " through " + std::to_string(first_row + num_rows - 1) +
+                               " but dataset has " + std::to_string(dims[0]));
+  }
+  std::fill(start.get(), start.get() + rank, 0);
+  start[0] = first_row;
+  dims[0] = num_rows;
+  f_space.selectHyperslab(H5S_SELECT_SET, dims.get(), start.get());
+  H5::DataSpace m_space(rank, dims.get());
+  ds.write(data, h5_mem_dtype(data[0]), m_space, f_space);
+}
+
+template<typename T>
+int HDF5IOHelper::append_rows(const String &dset_name, const T *data, const int &num_rows) {
+  // 1. Open the dataset
+  // 2. Discover the rank and current shape
+  // 3. Extend the dataset by num_rows
+  // 4. Write
+  H5::DataSet &ds = datasetCache[dset_name];
+  H5::DataSpace f_space = ds.getSpace();
+  int rank = f_space.getSimpleExtentNdims();
+  std::unique_ptr<hsize_t[]> dims(new hsize_t[rank]), maxdims(new hsize_t[rank]);
+  f_space.getSimpleExtentDims(dims.get(), maxdims.get());
+  if(maxdims[0] != H5S_UNLIMITED) {
+    flush();
+    throw std::runtime_error(String("Attempt to append rows to ") +
+                               dset_name + " failed; dimensions are fixed.");
+  }
+  int first_row = dims[0];
+  if(num_rows <= 0)
+    return first_row;
+  dims[0] += num_rows;
+  ds.extend(dims.get());
+  set_rows(dset_name, data, first_row, num_rows);
+  return first_row;
+}
+
 /// Read scalar data from a dataset
 template <typename T>
 void HDF5IOHelper::read_scalar(const std::string& dset_name, T& val) {
@@ -0,0 +1,116 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#ifndef DAKOTA_IR_KEYS_H
+#define DAKOTA_IR_KEYS_H
+
+#include "generated_ir_keys.hpp"
+#include "generated_ir_table_types.hpp"
+
+#include <algorithm>
+#include <string_view>
+
+/// Lookups between interned IR keys (irgen::IRKey) and their names.  Names
+/// are only needed to translate string queries; stores and typed queries
+/// index by key.
+namespace Dakota::ir_keys {
+
+inline constexpr size_t num_blocks = 6;
+
+static_assert(sizeof(dakota::irgen::kIRKeyBlockOffsets) /
+              sizeof(dakota::irgen::kIRKeyBlockOffsets[0]) == num_blocks + 1,
+              "generated_ir_keys.hpp block layout does not match BlockType");
+
+/// block prefixes in BlockType order
+inline constexpr std::string_view block_names[num_blocks] =
+  { "environment", "method", "model", "variables", "interface", "responses" };
+
+/// block containing key
+inline dakota::irgen::BlockType block(dakota::irgen::IRKey key)
+{
+  const auto id = static_cast<std::uint32_t>(key);
+  size_t b = 0;
+  while (id >= dakota::irgen::kIRKeyBlockOffsets[b+1])
+    ++b;
+  return static_cast<dakota::irgen::BlockType>(b);
+}
+
+/// number of keys in a block
+inline size_t num_keys(dakota::irgen::BlockType block)
+{
+  const auto b = static_cast<size_t>(block);
+  return dakota::irgen::kIRKeyBlockOffsets[b+1] -
+    dakota::irgen::kIRKeyBlockOffsets[b];
+}
+
+/// position of key among the keys of its block
+inline size_t slot(dakota::irgen::IRKey key)
+{
+  return static_cast<std::uint32_t>(key) -
+    dakota::irgen::kIRKeyBlockOffsets[static_cast<size_t>(block(key))];
+}
+
+/// block-qualified name, e.g., "method.max_iterations"
+inline std::string_view full_name(dakota::irgen::IRKey key)
+{ return dakota::irgen::kIRKeyNames[static_cast<std::uint32_t>(key)]; }
+
+/// name within the block, e.g., "max_iterations"
+inline std::string_view local_name(dakota::irgen::IRKey key)
+{
+  return full_name(key).substr(
+    block_names[static_cast<size_t>(block(key))].size() + 1);
+}
+
+/// binary search for local_key among the (sorted) keys of block; returns
+/// false if the key is not interned
+inline bool find(dakota::irgen::BlockType block, std::string_view local_key,
+                 dakota::irgen::IRKey& key)
+{
+  const auto b = static_cast<size_t>(block);
+  const size_t prefix_len = block_names[b].size() + 1;
+  const std::string_view* first =
+    dakota::irgen::kIRKeyNames + dakota::irgen::kIRKeyBlockOffsets[b];
+  const std::string_view* last =
+    dakota::irgen::kIRKeyNames + dakota::irgen::kIRKeyBlockOffsets[b+1];
+  const std::string_view* it = std::lower_bound(first, last, local_key,
+    [prefix_len](std::string_view name, std::string_view local)
+    { return name.substr(prefix_len) < local; });
+  if (it == last || it->substr(prefix_len) != local_key)
+    return false;
+  key = static_cast<dakota::irgen::IRKey>(it - dakota::irgen::kIRKeyNames);
+  return true;
+}
+
+/// find() for a block-qualified key such as "method.max_iterations"
+inline bool find(std::string_view full_key, dakota::irgen::IRKey& key)
+{
+  const size_t dot = full_key.find('.');
+  if (dot == std::string_view::npos)
+    return false;
+  const std::string_view prefix = full_key.substr(0, dot);
+  size_t b = 0;
+  while (b < num_blocks && prefix != block_names[b])
+    ++b;
+  if (b == num_blocks)
+    return false;
+  // names within a block share the prefix, so full names compare directly
+  const std::string_view* first =
+    dakota::irgen::kIRKeyNames + dakota::irgen::kIRKeyBlockOffsets[b];
+  const std::string_view* last =
+    dakota::irgen::kIRKeyNames + dakota::irgen::kIRKeyBlockOffsets[b+1];
+  const std::string_view* it = std::lower_bound(first, last, full_key);
+  if (it == last || *it != full_key)
+    return false;
+  key = static_cast<dakota::irgen::IRKey>(it - dakota::irgen::kIRKeyNames);
+  return true;
+}
+
+} // namespace Dakota::ir_keys
+
+#endif // DAKOTA_IR_KEYS_H
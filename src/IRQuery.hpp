@@ -40,9 +40,29 @@ inline ParsedIRKey parse_full_pdb_key(const String& full_key)
   throw std::runtime_error("ir_query::parse_full_pdb_key: unknown block in key '" + full_key + "'");
 }
 
+/// typed query of the active store by interned key
+template <class T>
+inline const T& get(const IRState& state, irgen::IRKey key)
+{
+  return state.active_store(ir_keys::block(key)).template get<T>(key);
+}
+
+/// value of key in the active store if stored with type T, otherwise NULL
+template <class T>
+inline const T* find(const IRState& state, irgen::IRKey key)
+{
+  return state.active_store(ir_keys::block(key)).template find<T>(key);
+}
+
+/// query by block-qualified name; interned keys are resolved without
+/// allocation and served from the store slots
 template <class T>
 inline const T& get(const IRState& state, const String& full_pdb_key)
 {
+  irgen::IRKey key;
+  if (ir_keys::find(full_pdb_key, key))
+    return get<T>(state, key);
+
   const ParsedIRKey parsed = parse_full_pdb_key(full_pdb_key);
   return state.active_store(parsed.block).template get<T>(parsed.local_key);
 }
@@ -18,6 +18,7 @@
 
 namespace Dakota {
 
+/// Top-level blocks, in the order of irgen::BlockType.
 enum class IRBlockType {
   Environment,
   Method,
@@ -27,6 +28,10 @@ enum class IRBlockType {
   Responses
 };
 
+static_assert(static_cast<int>(IRBlockType::Responses) ==
+              static_cast<int>(irgen::BlockType::Responses),
+              "IRBlockType must follow irgen::BlockType");
+
 struct IRActiveSelection {
   size_t method{0};
   size_t model{0};
@@ -37,7 +42,7 @@ struct IRActiveSelection {
 
 /// Complete materialized IR state across all top-level blocks.
 struct IRState {
-  IRStore environment;
+  IRStore environment{irgen::BlockType::Environment};
   std::vector<IRStore> method;
   std::vector<IRStore> model;
   std::vector<IRStore> variables;
@@ -71,6 +76,11 @@ struct IRState {
     return const_cast<IRState*>(this)->active_store(block);
   }
 
+  const IRStore& active_store(irgen::BlockType block) const
+  {
+    return active_store(static_cast<IRBlockType>(block));
+  }
+
   bool set_active_method(const String& id)
   {
     auto it = method_id_to_index.find(id);
@@ -12,9 +12,14 @@
 
 #include "dakota_data_types.hpp"
 #include "generated_ir_types.hpp"
+#include "IRKeys.hpp"
 
+#include <algorithm>
+#include <map>
+#include <optional>
 #include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
 namespace Dakota {
 
@@ -24,37 +29,170 @@ namespace irgen = dakota::irgen;
 using IRValue = dakota::irgen::IRValue;
 
 /// Block-local key/value storage for materialized IR data.
+
+/** A store constructed for a block holds the values of that block's
+    interned keys (irgen::IRKey) in a flat vector indexed by
+    ir_keys::slot(), so typed queries by key involve no string handling.
+    Local keys that are not interned, and all keys of a default-constructed
+    store, are kept in a map. */
 class IRStore
 {
 public:
   using Map = std::map<String, IRValue>;
 
+  /// store without interned slots
+  IRStore() = default;
+
+  /// store with a slot for each interned key of block
+  explicit IRStore(irgen::BlockType block):
+    block_(block), slot_values_(ir_keys::num_keys(block)),
+    slot_set_(ir_keys::num_keys(block), false)
+  { }
+
   bool contains(const String& local_key) const
-  { return values_.find(local_key) != values_.end(); }
+  {
+    size_t s;
+    if (find_slot(local_key, s))
+      return slot_set_[s];
+    return values_.find(local_key) != values_.end();
+  }
+
+  bool contains(irgen::IRKey key) const
+  {
+    size_t s;
+    if (key_slot(key, s))
+      return slot_set_[s];
+    return values_.find(String(ir_keys::local_name(key))) != values_.end();
+  }
 
   void set_value(const String& local_key, IRValue value)
   {
-    values_[local_key] = std::move(value);
+    size_t s;
+    if (find_slot(local_key, s))
+      { slot_values_[s] = std::move(value); slot_set_[s] = true; }
+    else
+      values_[local_key] = std::move(value);
+  }
+
+  void set_value(irgen::IRKey key, IRValue value)
+  {
+    size_t s;
+    if (key_slot(key, s))
+      { slot_values_[s] = std::move(value); slot_set_[s] = true; }
+    else
+      values_[String(ir_keys::local_name(key))] = std::move(value);
   }
 
   template <class T>
   const T& get(const String& local_key) const
   {
-    auto it = values_.find(local_key);
-    if (it == values_.end())
-      throw std::runtime_error("IRStore::get: missing key '" + local_key + "'");
-
-    const T* ptr = std::get_if<T>(&it->second);
+    const IRValue* value = nullptr;
+    size_t s;
+    if (find_slot(local_key, s)) {
+      if (slot_set_[s])
+        value = &slot_values_[s];
+    }
+    else {
+      auto it = values_.find(local_key);
+      if (it != values_.end())
+        value = &it->second;
+    }
+    if (!value)
+      lookup_error("missing key", local_key);
+    const T* ptr = std::get_if<T>(value);
     if (!ptr)
-      throw std::runtime_error("IRStore::get: type mismatch for key '" + local_key + "'");
+      lookup_error("type mismatch for key", local_key);
+    return *ptr;
+  }
 
+  /// typed query by interned key; this is the lookup used on hot paths
+  template <class T>
+  const T& get(irgen::IRKey key) const
+  {
+    size_t s;
+    if (!key_slot(key, s))
+      return get<T>(String(ir_keys::local_name(key)));
+    if (!slot_set_[s])
+      lookup_error("missing key", ir_keys::local_name(key));
+    const T* ptr = std::get_if<T>(&slot_values_[s]);
+    if (!ptr)
+      lookup_error("type mismatch for key", ir_keys::local_name(key));
     return *ptr;
   }
 
-  const Map& values() const
-  { return values_; }
+  /// value of key if it is stored with type T, otherwise NULL
+  template <class T>
+  const T* find(irgen::IRKey key) const
+  {
+    size_t s;
+    if (key_slot(key, s))
+      return (slot_set_[s]) ? std::get_if<T>(&slot_values_[s]) : nullptr;
+    auto it = values_.find(String(ir_keys::local_name(key)));
+    return (it == values_.end()) ? nullptr : std::get_if<T>(&it->second);
+  }
+
+  /// number of stored values
+  size_t size() const
+  {
+    return values_.size() +
+      std::count(slot_set_.begin(), slot_set_.end(), true);
+  }
+
+  bool empty() const
+  { return size() == 0; }
+
+  /// all stored values by local key (a copy, for dumps and diagnostics)
+  Map values() const
+  {
+    Map all(values_);
+    for (size_t s = 0; s < slot_set_.size(); ++s)
+      if (slot_set_[s])
+        all.emplace(String(ir_keys::local_name(slot_key(s))), slot_values_[s]);
+    return all;
+  }
 
 private:
+
+  /// slot of an interned local_key of block_
+  bool find_slot(const String& local_key, size_t& s) const
+  {
+    irgen::IRKey key;
+    if (!block_ || !ir_keys::find(*block_, local_key, key))
+      return false;
+    s = ir_keys::slot(key);
+    return true;
+  }
+
+  /// slot of key, if key belongs to block_
+  bool key_slot(irgen::IRKey key, size_t& s) const
+  {
+    if (!block_ || ir_keys::block(key) != *block_)
+      return false;
+    s = ir_keys::slot(key);
+    return true;
+  }
+
+  /// key stored in slot s
+  irgen::IRKey slot_key(size_t s) const
+  {
+    return static_cast<irgen::IRKey>(
+      irgen::kIRKeyBlockOffsets[static_cast<size_t>(*block_)] + s);
+  }
+
+  [[noreturn]] static void lookup_error(const char* what,
+                                       std::string_view local_key)
+  {
+    throw std::runtime_error("IRStore::get: " + String(what) + " '" +
+                             String(local_key) + "'");
+  }
+
+  /// block of the interned slots, if any
+  std::optional<irgen::BlockType> block_;
+  /// values of the interned keys of block_, indexed by ir_keys::slot()
+  std::vector<IRValue> slot_values_;
+  /// whether each slot has been assigned
+  std::vector<bool> slot_set_;
+  /// values of keys without a slot
   Map values_;
 };
 
@@ -0,0 +1,455 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "IndexedRestart.hpp"
+#include "dakota_global_defs.hpp"
+#include "ParamResponsePair.hpp"
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Dakota {
+
+namespace {
+
+/// bytes in a record frame header: magic, eval id, payload length
+const size_t FrameHeaderBytes =
+  sizeof(std::uint32_t) + sizeof(std::int32_t) + sizeof(std::uint64_t);
+/// bytes in a chunk index entry: frame offset, payload length, eval id
+const size_t IndexEntryBytes =
+  2*sizeof(std::uint64_t) + sizeof(std::int32_t);
+/// bytes in a chunk index trailer: previous offset, this offset, end magic
+const size_t IndexTrailerBytes = 2*sizeof(std::uint64_t) + sizeof(std::uint32_t);
+/// bytes in the leading chunk index fields: magic, number of entries
+const size_t IndexLeaderBytes = 2*sizeof(std::uint32_t);
+
+/// unaligned read of a fixed-size value from a byte buffer
+template <typename T>
+inline T read_value(const char* data)
+{ T value; std::memcpy(&value, data, sizeof(T)); return value; }
+
+/// write a fixed-size value to a binary stream
+template <typename T>
+inline void write_value(std::ostream& os, T value)
+{ os.write(reinterpret_cast<const char*>(&value), sizeof(T)); }
+
+/// read-only stream buffer over a range of the mapped file, allowing a
+/// Boost archive to decode a record in place
+class RecordStreamBuf: public std::streambuf
+{
+public:
+  RecordStreamBuf(const char* data, size_t length)
+  {
+    char* begin = const_cast<char*>(data);
+    setg(begin, begin, begin + length);
+  }
+};
+
+/// serialize data to a string using a headerless Boost binary archive
+template <typename T>
+String serialize_to_string(const T& data)
+{
+  std::stringbuf sbuf(std::ios::out | std::ios::binary);
+  {
+    boost::archive::binary_oarchive
+      oarch(sbuf, boost::archive::no_header);
+    oarch & data;
+  }
+  return sbuf.str();
+}
+
+} // anonymous namespace
+
+
+bool IndexedRestart::is_indexed_restart(const String& filename)
+{
+  std::ifstream ifs(filename, std::ios::binary);
+  char magic[sizeof(FileMagic)];
+  if (!ifs.read(magic, sizeof(FileMagic)))
+    return false;
+  return std::memcmp(magic, FileMagic, sizeof(FileMagic)) == 0;
+}
+
+
+IndexedRestartReader::IndexedRestartReader(const String& filename):
+  fileName(filename), fileData(NULL), fileLength(0), mappedFlag(false),
+  cleanClose(false), validLength(0), lastIndexOffset(IndexedRestart::NoIndex),
+  numUnindexed(0)
+{
+  map_file();
+  size_t first_frame = read_header();
+  if (walk_indices(first_frame)) {
+    cleanClose = true;
+    validLength = fileLength;
+    numUnindexed = 0;
+  }
+  else
+    scan_frames(first_frame);
+}
+
+
+IndexedRestartReader::~IndexedRestartReader()
+{
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (mappedFlag)
+    munmap(const_cast<char*>(fileData), fileLength);
+#endif
+}
+
+
+void IndexedRestartReader::map_file()
+{
+#if !defined(_WIN32) && !defined(_WIN64)
+  int fd = open(fileName.c_str(), O_RDONLY);
+  struct stat file_stat;
+  if (fd < 0 || fstat(fd, &file_stat) != 0) {
+    Cerr << "\nError: could not open restart file '" << fileName
+	 << "' for reading." << std::endl;
+    abort_handler(IO_ERROR);
+  }
+  fileLength = file_stat.st_size;
+  if (fileLength) {
+    void* addr = mmap(NULL, fileLength, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED) {
+      fileData = static_cast<const char*>(addr);
+      mappedFlag = true;
+      // records are decoded front to back in the common case
+      madvise(addr, fileLength, MADV_SEQUENTIAL);
+    }
+  }
+  close(fd);
+  if (mappedFlag || !fileLength)
+    return;
+#endif
+
+  // fall back to reading the whole file
+  std::ifstream ifs(fileName, std::ios::binary | std::ios::ate);
+  if (!ifs.good()) {
+    Cerr << "\nError: could not open restart file '" << fileName
+	 << "' for reading." << std::endl;
+    abort_handler(IO_ERROR);
+  }
+  fileLength = ifs.tellg();
+  ifs.seekg(0);
+  fileBuffer.resize(fileLength);
+  if (fileLength)
+    ifs.read(fileBuffer.data(), fileLength);
+  fileData = fileBuffer.data();
+}
+
+
+size_t IndexedRestartReader::read_header()
+{
+  const size_t leader = sizeof(IndexedRestart::FileMagic)
+    + sizeof(std::uint32_t) + sizeof(std::uint64_t);
+  if (fileLength < leader ||
+      std::memcmp(fileData, IndexedRestart::FileMagic,
+		  sizeof(IndexedRestart::FileMagic)) != 0) {
+    Cerr << "\nError: '" << fileName << "' is not an indexed restart file."
+	 << std::endl;
+    abort_handler(IO_ERROR);
+  }
+
+  size_t pos = sizeof(IndexedRestart::FileMagic);
+  std::uint32_t format_version = read_value<std::uint32_t>(fileData + pos);
+  pos += sizeof(std::uint32_t);
+  if (format_version > IndexedRestart::FormatVersion) {
+    Cerr << "\nError: indexed restart file '" << fileName << "' has layout "
+	 << "version " << format_version << "; this Dakota supports version "
+	 << IndexedRestart::FormatVersion << " and earlier." << std::endl;
+    abort_handler(IO_ERROR);
+  }
+  std::uint64_t version_length = read_value<std::uint64_t>(fileData + pos);
+  pos += sizeof(std::uint64_t);
+  if (version_length > fileLength - pos) {
+    Cerr << "\nError: truncated header in indexed restart file '" << fileName
+	 << "'." << std::endl;
+    abort_handler(IO_ERROR);
+  }
+
+  RecordStreamBuf version_buf(fileData + pos, version_length);
+  boost::archive::binary_iarchive
+    version_archive(version_buf, boost::archive::no_header);
+  version_archive & rstVersion;
+  if (RestartVersion::latestRestartVersion < rstVersion.restartVersion)
+    Cerr << "\nWarning: restart file '" << fileName << "' was created with "
+	 << "newer Dakota version " << rstVersion.dakotaRelease
+	 << " (restart version " << rstVersion.friendly_rst_version()
+	 << "); use with caution." << std::endl;
+
+  return pos + version_length;
+}
+
+
+bool IndexedRestartReader::walk_indices(size_t first_frame)
+{
+  if (fileLength < first_frame + IndexLeaderBytes + IndexTrailerBytes)
+    return false;
+  const char* trailer = fileData + fileLength - IndexTrailerBytes;
+  if (read_value<std::uint32_t>(trailer + 2*sizeof(std::uint64_t))
+      != IndexedRestart::IndexEndMagic)
+    return false;
+
+  // collect the chunks from last to first, then reverse
+  std::vector<std::vector<size_t> > chunk_entries;
+  std::uint64_t index_offset = read_value<std::uint64_t>(trailer + 8),
+    index_end = fileLength;
+  const std::uint64_t last_index = index_offset;
+  while (index_offset != IndexedRestart::NoIndex) {
+    if (index_offset < first_frame ||
+	index_offset + IndexLeaderBytes + IndexTrailerBytes > index_end)
+      return false;
+    const char* index = fileData + index_offset;
+    if (read_value<std::uint32_t>(index) != IndexedRestart::IndexMagic)
+      return false;
+    std::uint64_t num_entries = read_value<std::uint32_t>(index + 4);
+    std::uint64_t this_end = index_offset + IndexLeaderBytes
+      + num_entries*IndexEntryBytes + IndexTrailerBytes;
+    if (this_end > index_end)
+      return false;
+    const char* this_trailer = fileData + this_end - IndexTrailerBytes;
+    if (read_value<std::uint64_t>(this_trailer + 8) != index_offset ||
+	read_value<std::uint32_t>(this_trailer + 16)
+	!= IndexedRestart::IndexEndMagic)
+      return false;
+
+    // validate the entries against the frames they reference
+    std::vector<size_t> entries;
+    entries.reserve(num_entries);
+    const char* entry = index + IndexLeaderBytes;
+    for (size_t i=0; i<num_entries; ++i, entry += IndexEntryBytes) {
+      std::uint64_t frame = read_value<std::uint64_t>(entry),
+	length = read_value<std::uint64_t>(entry + 8);
+      if (frame < first_frame || frame + FrameHeaderBytes > index_offset ||
+	  length > index_offset - frame - FrameHeaderBytes ||
+	  read_value<std::uint32_t>(fileData + frame)
+	  != IndexedRestart::RecordMagic)
+	return false;
+      entries.push_back(entry - fileData);
+    }
+    chunk_entries.push_back(entries);
+
+    std::uint64_t prev_offset = read_value<std::uint64_t>(this_trailer);
+    if (prev_offset != IndexedRestart::NoIndex && prev_offset >= index_offset)
+      return false;
+    index_end = index_offset;
+    index_offset = prev_offset;
+  }
+
+  std::reverse(chunk_entries.begin(), chunk_entries.end());
+  for (const auto& entries : chunk_entries)
+    for (size_t entry_offset : entries) {
+      const char* entry = fileData + entry_offset;
+      std::uint64_t frame = read_value<std::uint64_t>(entry);
+      frameOffsets.push_back(frame);
+      recordOffsets.push_back(frame + FrameHeaderBytes);
+      recordLengths.push_back(read_value<std::uint64_t>(entry + 8));
+      recordEvalIds.push_back(read_value<std::int32_t>(entry + 16));
+    }
+  lastIndexOffset = last_index;
+  return true;
+}
+
+
+void IndexedRestartReader::scan_frames(size_t first_frame)
+{
+  frameOffsets.clear(); recordOffsets.clear();
+  recordLengths.clear(); recordEvalIds.clear();
+  lastIndexOffset = IndexedRestart::NoIndex;
+  numUnindexed = 0;
+
+  size_t pos = first_frame;
+  while (pos + sizeof(std::uint32_t) <= fileLength) {
+    std::uint32_t magic = read_value<std::uint32_t>(fileData + pos);
+    if (magic == IndexedRestart::RecordMagic) {
+      if (pos + FrameHeaderBytes > fileLength)
+	break;
+      std::uint64_t length = read_value<std::uint64_t>(fileData + pos + 8);
+      if (length > fileLength - pos - FrameHeaderBytes)
+	break; // torn record
+      frameOffsets.push_back(pos);
+      recordOffsets.push_back(pos + FrameHeaderBytes);
+      recordLengths.push_back(length);
+      recordEvalIds.push_back(read_value<std::int32_t>(fileData + pos + 4));
+      ++numUnindexed;
+      pos += FrameHeaderBytes + length;
+    }
+    else if (magic == IndexedRestart::IndexMagic) {
+      if (pos + IndexLeaderBytes > fileLength)
+	break;
+      std::uint64_t num_entries
+	= read_value<std::uint32_t>(fileData + pos + 4);
+      std::uint64_t index_end = pos + IndexLeaderBytes
+	+ num_entries*IndexEntryBytes + IndexTrailerBytes;
+      if (index_end > fileLength ||
+	  read_value<std::uint64_t>(fileData + index_end - 12) != pos ||
+	  read_value<std::uint32_t>(fileData + index_end - 4)
+	  != IndexedRestart::IndexEndMagic)
+	break; // torn index
+      lastIndexOffset = pos;
+      numUnindexed = 0;
+      pos = index_end;
+    }
+    else
+      break;
+  }
+  validLength = pos;
+}
+
+
+void IndexedRestart::
+decode_record(const char* data, size_t length, ParamResponsePair& prp)
+{
+  RecordStreamBuf record_buf(data, length);
+  boost::archive::binary_iarchive
+    record_archive(record_buf, boost::archive::no_header);
+  record_archive & prp;
+}
+
+
+void IndexedRestartReader::read_record(size_t i, ParamResponsePair& prp) const
+{ IndexedRestart::decode_record(record_data(i), record_length(i), prp); }
+
+
+IndexedRestartWriter::
+IndexedRestartWriter(const String& filename, const RestartVersion& rst_version,
+		     size_t chunk_records):
+  restartOutputFilename(filename), filePos(0),
+  chunkRecords(std::max(chunk_records, (size_t)1)),
+  prevIndexOffset(IndexedRestart::NoIndex), lastLength(0)
+{
+  open_stream(std::ios::binary | std::ios::trunc);
+
+  String version_data = serialize_to_string(rst_version);
+  restartOutputFS.write(IndexedRestart::FileMagic,
+			sizeof(IndexedRestart::FileMagic));
+  write_value<std::uint32_t>(restartOutputFS, IndexedRestart::FormatVersion);
+  write_value<std::uint64_t>(restartOutputFS, version_data.size());
+  restartOutputFS.write(version_data.data(), version_data.size());
+  filePos = sizeof(IndexedRestart::FileMagic) + sizeof(std::uint32_t)
+    + sizeof(std::uint64_t) + version_data.size();
+  restartOutputFS.flush();
+}
+
+
+IndexedRestartWriter::
+IndexedRestartWriter(const String& filename,
+		     const IndexedRestartReader& reader, size_t chunk_records):
+  restartOutputFilename(filename), filePos(reader.valid_length()),
+  chunkRecords(std::max(chunk_records, (size_t)1)),
+  prevIndexOffset(reader.last_index_offset()), lastLength(0)
+{
+  // discard a torn trailing record or index left by an abnormal exit
+  if (!reader.clean_close() &&
+      std::filesystem::file_size(filename) > reader.valid_length())
+    std::filesystem::resize_file(filename, reader.valid_length());
+
+  open_stream(std::ios::binary | std::ios::app);
+
+  // records following the last complete index join the first new chunk
+  size_t num_rec = reader.num_records(),
+    num_unindexed = reader.num_unindexed_records();
+  for (size_t i=num_rec-num_unindexed; i<num_rec; ++i) {
+    chunkOffsets.push_back(reader.record_frame_offset(i));
+    chunkLengths.push_back(reader.record_length(i));
+    chunkEvalIds.push_back(reader.record_eval_id(i));
+  }
+}
+
+
+IndexedRestartWriter::~IndexedRestartWriter()
+{
+  // an empty file still gets an index so that it reads as cleanly closed
+  if (!chunkOffsets.empty() || prevIndexOffset == IndexedRestart::NoIndex)
+    write_chunk_index();
+  restartOutputFS.flush();
+}
+
+
+void IndexedRestartWriter::open_stream(std::ios::openmode mode)
+{
+  restartOutputFS.open(restartOutputFilename.c_str(), mode);
+  if (!restartOutputFS.good()) {
+    Cerr << "\nError: could not open restart file '"
+	 << restartOutputFilename << "' for writing." << std::endl;
+    abort_handler(IO_ERROR);
+  }
+}
+
+
+std::uint64_t IndexedRestartWriter::append_prp(const ParamResponsePair& prp)
+{
+  String record_data = serialize_to_string(prp);
+  return write_frame(record_data.data(), record_data.size(), prp.eval_id());
+}
+
+
+void IndexedRestartWriter::
+append_serialized(const char* data, size_t length, int eval_id)
+{ write_frame(data, length, eval_id); }
+
+
+std::uint64_t IndexedRestartWriter::
+write_frame(const char* data, size_t length, int eval_id)
+{
+  write_value<std::uint32_t>(restartOutputFS, IndexedRestart::RecordMagic);
+  write_value<std::int32_t>(restartOutputFS, eval_id);
+  write_value<std::uint64_t>(restartOutputFS, length);
+  restartOutputFS.write(data, length);
+
+  chunkOffsets.push_back(filePos);
+  chunkLengths.push_back(length);
+  chunkEvalIds.push_back(eval_id);
+  std::uint64_t payload_offset = filePos + FrameHeaderBytes;
+  filePos = payload_offset + length;
+  lastLength = length;
+
+  if (chunkOffsets.size() >= chunkRecords) {
+    write_chunk_index();
+    restartOutputFS.flush();
+  }
+  return payload_offset;
+}
+
+
+void IndexedRestartWriter::flush()
+{ restartOutputFS.flush(); }
+
+
+void IndexedRestartWriter::write_chunk_index()
+{
+  std::uint64_t index_offset = filePos;
+  size_t i, num_entries = chunkOffsets.size();
+  write_value<std::uint32_t>(restartOutputFS, IndexedRestart::IndexMagic);
+  write_value<std::uint32_t>(restartOutputFS, num_entries);
+  for (i=0; i<num_entries; ++i) {
+    write_value<std::uint64_t>(restartOutputFS, chunkOffsets[i]);
+    write_value<std::uint64_t>(restartOutputFS, chunkLengths[i]);
+    write_value<std::int32_t>(restartOutputFS, chunkEvalIds[i]);
+  }
+  write_value<std::uint64_t>(restartOutputFS, prevIndexOffset);
+  write_value<std::uint64_t>(restartOutputFS, index_offset);
+  write_value<std::uint32_t>(restartOutputFS, IndexedRestart::IndexEndMagic);
+
+  filePos += IndexLeaderBytes + num_entries*IndexEntryBytes + IndexTrailerBytes;
+  prevIndexOffset = index_offset;
+  chunkOffsets.clear(); chunkLengths.clear(); chunkEvalIds.clear();
+}
+
+} // namespace Dakota
@@ -0,0 +1,277 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#ifndef DAKOTA_INDEXED_RESTART_H
+#define DAKOTA_INDEXED_RESTART_H
+
+#include "dakota_data_types.hpp"
+#include "RestartVersion.hpp"
+
+#include <cstdint>
+#include <fstream>
+
+namespace Dakota {
+
+class ParamResponsePair;
+
+/// Layout of the chunked, indexed restart file format
+
+/** An indexed restart file consists of a header followed by a sequence of
+    framed records, with a chunk index written after every chunk of
+    records and when the file is closed:
+
+    \verbatim
+    header:  char[8] "DAKRSTIX" | u32 format version | u64 n | n bytes
+             (RestartVersion, Boost binary archive w/o header)
+    record:  u32 RecordMagic | i32 eval id | u64 n | n bytes
+             (ParamResponsePair, Boost binary archive w/o header)
+    index:   u32 IndexMagic | u32 m | m x (u64 offset | u64 n | i32 eval id)
+             | u64 previous index offset | u64 this index offset
+             | u32 IndexEndMagic
+    \endverbatim
+
+    Since every record is self-delimiting and independently serialized,
+    a file can be reopened in append mode without rewriting its contents,
+    and records can be decoded individually from a memory-mapped file.
+    When the file ends in a complete index, the chain of indices is
+    followed backward to locate all records without touching them;
+    otherwise (e.g., after an abort) the records are located by a forward
+    scan of the frames and any torn trailing frame is discarded. */
+namespace IndexedRestart {
+
+/// leading file signature
+static const char FileMagic[8] = { 'D','A','K','R','S','T','I','X' };
+/// current version of the indexed layout
+static const std::uint32_t FormatVersion = 1;
+/// record frame signature ("REC1")
+static const std::uint32_t RecordMagic   = 0x31434552;
+/// chunk index signature ("IDX1")
+static const std::uint32_t IndexMagic    = 0x31584449;
+/// chunk index trailer signature ("IEND")
+static const std::uint32_t IndexEndMagic = 0x444e4549;
+/// sentinel for the previous index offset of the first chunk
+static const std::uint64_t NoIndex = ~std::uint64_t(0);
+
+/// default number of records per indexed chunk
+static const size_t DefaultChunkRecords = 256;
+
+/// whether the named file begins with the indexed restart signature
+bool is_indexed_restart(const String& filename);
+
+/// decode a record payload of the given length
+void decode_record(const char* data, size_t length, ParamResponsePair& prp);
+
+} // namespace IndexedRestart
+
+
+/// Read-only, memory-mapped view of an indexed restart file
+
+/** The constructor maps the file and locates all complete records, but
+    does not decode them; read_record() decodes an individual record on
+    demand. */
+class IndexedRestartReader
+{
+public:
+
+  /// map and index the named file; aborts on an invalid header
+  IndexedRestartReader(const String& filename);
+  /// destructor unmaps the file
+  ~IndexedRestartReader();
+
+  /// version information from the file header
+  const RestartVersion& restart_version() const;
+
+  /// number of complete records located
+  size_t num_records() const;
+  /// evaluation id of record i (available without decoding)
+  int record_eval_id(size_t i) const;
+  /// decode record i
+  void read_record(size_t i, ParamResponsePair& prp) const;
+  /// raw serialized bytes of record i, e.g., for copying without decoding
+  const char* record_data(size_t i) const;
+  /// length in bytes of the serialized record i
+  size_t record_length(size_t i) const;
+
+  /// true if the file ended with a complete chunk index
+  bool clean_close() const;
+  /// number of bytes through the end of the last complete frame
+  size_t valid_length() const;
+  /// offset of the last complete chunk index (NoIndex if none)
+  std::uint64_t last_index_offset() const;
+  /// number of trailing records not covered by a chunk index
+  size_t num_unindexed_records() const;
+  /// byte offset of the frame for record i
+  size_t record_frame_offset(size_t i) const;
+
+private:
+
+  /// copy constructor is disallowed due to mapped file
+  IndexedRestartReader(const IndexedRestartReader&);
+  /// assignment is disallowed due to mapped file
+  const IndexedRestartReader& operator=(const IndexedRestartReader&);
+
+  /// map the file into memory (or read it into fileBuffer as a fallback)
+  void map_file();
+  /// read and validate the header, returning the offset of the first frame
+  size_t read_header();
+  /// locate records by walking the chunk index chain backward from the
+  /// end of the file; returns false if the chain is incomplete
+  bool walk_indices(size_t first_frame);
+  /// locate records by scanning frames forward from first_frame
+  void scan_frames(size_t first_frame);
+
+  /// the name of the restart file
+  String fileName;
+
+  /// start of the mapped (or buffered) file contents
+  const char* fileData;
+  /// length of the file contents
+  size_t fileLength;
+  /// whether fileData refers to a memory map
+  bool mappedFlag;
+  /// fallback storage when memory mapping is unavailable
+  std::vector<char> fileBuffer;
+
+  /// version information from the header
+  RestartVersion rstVersion;
+
+  /// offsets of the record frames
+  std::vector<std::uint64_t> frameOffsets;
+  /// offsets of the serialized record payloads
+  std::vector<std::uint64_t> recordOffsets;
+  /// lengths of the serialized record payloads
+  std::vector<std::uint64_t> recordLengths;
+  /// evaluation ids of the records
+  std::vector<int> recordEvalIds;
+
+  /// whether the file ends with a complete index
+  bool cleanClose;
+  /// bytes through the last complete frame
+  size_t validLength;
+  /// offset of the last complete chunk index
+  std::uint64_t lastIndexOffset;
+  /// number of trailing records after the last complete chunk index
+  size_t numUnindexed;
+};
+
+
+inline const RestartVersion& IndexedRestartReader::restart_version() const
+{ return rstVersion; }
+
+inline size_t IndexedRestartReader::num_records() const
+{ return recordOffsets.size(); }
+
+inline int IndexedRestartReader::record_eval_id(size_t i) const
+{ return recordEvalIds[i]; }
+
+inline const char* IndexedRestartReader::record_data(size_t i) const
+{ return fileData + recordOffsets[i]; }
+
+inline size_t IndexedRestartReader::record_length(size_t i) const
+{ return recordLengths[i]; }
+
+inline bool IndexedRestartReader::clean_close() const
+{ return cleanClose; }
+
+inline size_t IndexedRestartReader::valid_length() const
+{ return validLength; }
+
+inline std::uint64_t IndexedRestartReader::last_index_offset() const
+{ return lastIndexOffset; }
+
+inline size_t IndexedRestartReader::num_unindexed_records() const
+{ return numUnindexed; }
+
+inline size_t IndexedRestartReader::record_frame_offset(size_t i) const
+{ return frameOffsets[i]; }
+
+
+/// Append-only writer for indexed restart files
+
+/** Each record is framed and written immediately (flush() makes it
+    durable), and a chunk index is emitted every chunkRecords records and
+    on destruction.  A writer may reopen an existing indexed file in
+    append mode, in which case the existing records are neither read nor
+    copied. */
+class IndexedRestartWriter
+{
+public:
+
+  /// create (or overwrite) the named file, writing a header with rst_version
+  IndexedRestartWriter(const String& filename,
+		       const RestartVersion& rst_version,
+		       size_t chunk_records = IndexedRestart::DefaultChunkRecords);
+  /// reopen the file viewed by reader for appending, discarding any
+  /// torn trailing frame; the existing records are not rewritten
+  IndexedRestartWriter(const String& filename,
+		       const IndexedRestartReader& reader,
+		       size_t chunk_records = IndexedRestart::DefaultChunkRecords);
+  /// destructor writes the index for any partial chunk
+  ~IndexedRestartWriter();
+
+  /// output filename for this writer
+  const String& filename() const;
+
+  /// serialize and append the passed pair, returning the offset of
+  /// its payload within the file
+  std::uint64_t append_prp(const ParamResponsePair& prp);
+  /// length in bytes of the most recently appended payload
+  size_t last_record_length() const;
+  /// append an already serialized record (e.g., from a reader)
+  void append_serialized(const char* data, size_t length, int eval_id);
+
+  /// flush appended records to the file
+  void flush();
+
+private:
+
+  /// copy constructor is disallowed due to file stream
+  IndexedRestartWriter(const IndexedRestartWriter&);
+  /// assignment is disallowed due to file stream
+  const IndexedRestartWriter& operator=(const IndexedRestartWriter&);
+
+  /// open restartOutputFS, aborting on failure
+  void open_stream(std::ios::openmode mode);
+  /// write a frame header and payload at the end of the file, returning
+  /// the offset of the payload
+  std::uint64_t write_frame(const char* data, size_t length, int eval_id);
+  /// write the index for the records of the current chunk
+  void write_chunk_index();
+
+  /// the name of the restart output file
+  String restartOutputFilename;
+  /// binary stream to which frames are written
+  std::ofstream restartOutputFS;
+  /// current end-of-file offset
+  std::uint64_t filePos;
+  /// number of records per chunk index
+  size_t chunkRecords;
+  /// offset of the most recent chunk index
+  std::uint64_t prevIndexOffset;
+  /// payload length of the most recently written record
+  size_t lastLength;
+
+  /// offsets of the frames in the current chunk
+  std::vector<std::uint64_t> chunkOffsets;
+  /// payload lengths of the records in the current chunk
+  std::vector<std::uint64_t> chunkLengths;
+  /// evaluation ids of the records in the current chunk
+  std::vector<int> chunkEvalIds;
+};
+
+
+inline const String& IndexedRestartWriter::filename() const
+{ return restartOutputFilename; }
+
+inline size_t IndexedRestartWriter::last_record_length() const
+{ return lastLength; }
+
+} // namespace Dakota
+
+#endif
@@ -120,30 +120,31 @@ IRState InstructionMaterializer::materialize(const nlohmann::json& validated_jso
     std::cerr << std::endl;
   }
 
-  const auto resize_block = [&](const char* key, auto& stores) {
-    auto it = validated_json.find(key);
-    if (it == validated_json.end())
-      return;
-    if (!it->is_array()) {
-      throw std::runtime_error(
-        "InstructionMaterializer::materialize expected top-level array for block '" +
-        std::string(key) + "'");
-    }
-    stores.resize(it->size());
-    if (debug_logging_enabled()) {
-      std::cerr << "InstructionMaterializer: block '" << key
-                << "' has " << stores.size() << " entries" << std::endl;
-    }
-  };
+  const auto resize_block =
+    [&](const char* key, irgen::BlockType block, auto& stores) {
+      auto it = validated_json.find(key);
+      if (it == validated_json.end())
+        return;
+      if (!it->is_array()) {
+        throw std::runtime_error(
+          "InstructionMaterializer::materialize expected top-level array for block '" +
+          std::string(key) + "'");
+      }
+      stores.resize(it->size(), IRStore(block));
+      if (debug_logging_enabled()) {
+        std::cerr << "InstructionMaterializer: block '" << key
+                  << "' has " << stores.size() << " entries" << std::endl;
+      }
+    };
 
-  resize_block("method", state.method);
-  resize_block("model", state.model);
-  resize_block("variables", state.variables);
-  resize_block("interface", state.interface);
-  resize_block("responses", state.responses);
+  resize_block("method", irgen::BlockType::Method, state.method);
+  resize_block("model", irgen::BlockType::Model, state.model);
+  resize_block("variables", irgen::BlockType::Variables, state.variables);
+  resize_block("interface", irgen::BlockType::Interface, state.interface);
+  resize_block("responses", irgen::BlockType::Responses, state.responses);
 
   if (state.model.empty()) {
-    state.model.resize(1);
+    state.model.resize(1, IRStore(irgen::BlockType::Model));
     if (debug_logging_enabled()) {
       std::cerr << "InstructionMaterializer: synthesizing default model block"
                 << std::endl;
@@ -151,7 +152,7 @@ IRState InstructionMaterializer::materialize(const nlohmann::json& validated_jso
   }
 
   if (state.interface.empty()) {
-    state.interface.resize(1);
+    state.interface.resize(1, IRStore(irgen::BlockType::Interface));
     if (debug_logging_enabled()) {
       std::cerr << "InstructionMaterializer: synthesizing default interface block"
                 << std::endl;
@@ -273,9 +274,12 @@ void InstructionMaterializer::materialize_block(const nlohmann::json& block_json
               << std::endl;
   }
 
-  std::function<void(const nlohmann::json&, std::string_view)> visit =
-    [&](const nlohmann::json& node, std::string_view path) {
-      const auto it = tables.instructions.find(std::string(path));
+  // one path buffer is extended and truncated in place as the walk descends,
+  // rather than building a new string per node
+  std::string path;
+  std::function<void(const nlohmann::json&)> visit =
+    [&](const nlohmann::json& node) {
+      const auto it = tables.instructions.find(path);
       if (it != tables.instructions.end()) {
         if (debug_logging_enabled()) {
           std::cerr << "InstructionMaterializer: path '" << path
@@ -288,14 +292,17 @@ void InstructionMaterializer::materialize_block(const nlohmann::json& block_json
       if (!node.is_object())
         return;
 
+      const size_t path_len = path.size();
       for (auto iter = node.begin(); iter != node.end(); ++iter) {
-        const std::string child_path =
-          path.empty() ? iter.key() : std::string(path) + "/" + iter.key();
-        visit(iter.value(), child_path);
+        if (path_len)
+          path += '/';
+        path += iter.key();
+        visit(iter.value());
+        path.resize(path_len);
       }
     };
 
-  visit(block_json, "");
+  visit(block_json);
 }
 
 void InstructionMaterializer::apply_write_op(const nlohmann::json& block_json,
@@ -147,6 +147,8 @@ void InstructionMaterializer::handle_discrete_set_values(const irgen::WriteOp& o
       std::string(ctx.current_path) + "'");
   }
 
+  // set elements are normally listed in increasing order, so inserting with
+  // an end hint keeps construction linear for large sets
   size_t offset = 0;
   switch (contract.ir_value_type) {
   case irgen::IrValueType::IntSetArray: {
@@ -154,7 +156,7 @@ void InstructionMaterializer::handle_discrete_set_values(const irgen::WriteOp& o
     for (int i = 0; i < num_vars; ++i) {
       IntSet& set_i = sets[static_cast<size_t>(i)];
       for (int j = 0; j < elems_per_var[static_cast<size_t>(i)]; ++j, ++offset)
-        set_i.insert(elements[offset].get<int>());
+        set_i.insert(set_i.end(), elements[offset].get<int>());
     }
     ctx.store.set_value(op.target_local_ir_key, IRValue(std::move(sets)));
     return;
@@ -164,7 +166,7 @@ void InstructionMaterializer::handle_discrete_set_values(const irgen::WriteOp& o
     for (int i = 0; i < num_vars; ++i) {
       StringSet& set_i = sets[static_cast<size_t>(i)];
       for (int j = 0; j < elems_per_var[static_cast<size_t>(i)]; ++j, ++offset)
-        set_i.insert(elements[offset].get<String>());
+        set_i.insert(set_i.end(), elements[offset].get<String>());
     }
     ctx.store.set_value(op.target_local_ir_key, IRValue(std::move(sets)));
     return;
@@ -178,7 +180,7 @@ void InstructionMaterializer::handle_discrete_set_values(const irgen::WriteOp& o
         const Real v = e.is_number()
           ? e.get<Real>()
           : static_cast<Real>(std::stod(e.get<std::string>()));
-        set_i.insert(v);
+        set_i.insert(set_i.end(), v);
       }
     }
     ctx.store.set_value(op.target_local_ir_key, IRValue(std::move(sets)));
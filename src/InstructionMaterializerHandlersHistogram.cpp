@@ -20,24 +20,37 @@ namespace Dakota {
 
 namespace {
 
-template <typename MapArray, typename GetX>
-MapArray build_histogram_point_maps(const nlohmann::json& value,
-                                    const std::vector<Real>& counts,
-                                    const std::vector<int>& pairs_per_var,
-                                    GetX&& get_x)
+/// Pairs per variable: explicit pairs_per_variable, else an even split of
+/// num_pairs over count variables
+std::vector<int> histogram_pairs_per_variable(const nlohmann::json& value,
+                                              size_t num_pairs)
 {
-  MapArray out;
-  out.resize(pairs_per_var.size());
+  const auto ppv = value.find("pairs_per_variable");
+  if (ppv != value.end() && !ppv->is_null())
+    return ppv->get<std::vector<int>>();
+  const size_t count = value.at("count").get<size_t>();
+  return std::vector<int>(count, static_cast<int>(num_pairs / count));
+}
+
+/// Normalized point histograms; abscissas are increasing within each
+/// variable, so each pair is appended at the end of its map
+template <typename MapArray, typename X>
+MapArray build_histogram_point_maps(const nlohmann::json& value)
+{
+  const auto& abscissas = value.at("abscissas");
+  const std::vector<Real> counts = value.at("counts").get<std::vector<Real>>();
+  const std::vector<int> pairs_per_var =
+    histogram_pairs_per_variable(value, abscissas.size());
 
+  MapArray out(pairs_per_var.size());
   size_t idx = 0;
   for (size_t i = 0; i < pairs_per_var.size(); ++i) {
     auto& map_i = out[i];
     Real sum = 0.0;
     const int n = pairs_per_var[i];
     for (int j = 0; j < n; ++j, ++idx) {
-      const auto x = get_x(idx);
       const Real y = counts[idx];
-      map_i[x] = y;
+      map_i.insert_or_assign(map_i.end(), abscissas[idx].get<X>(), y);
       sum += y;
     }
     if (sum > 0.0) {
@@ -61,37 +74,18 @@ void InstructionMaterializer::handle_histogram_bin_uncertain(const irgen::WriteO
     ctx.block_json, ctx.current_path);
 
   const auto abscissas = value.at("abscissas").get<std::vector<Real>>();
-  const size_t num_a = abscissas.size();
-
-  const bool has_ppv = value.contains("pairs_per_variable") &&
-                       !value["pairs_per_variable"].is_null();
-  std::vector<int> ppv;
-  if (has_ppv)
-    ppv = value["pairs_per_variable"].get<std::vector<int>>();
-
-  const size_t count = value.at("count").get<size_t>();
+  const std::vector<int> pairs_per_var =
+    histogram_pairs_per_variable(value, abscissas.size());
+  const size_t m = pairs_per_var.size();
 
   const auto& density = value.at("density");
-  const bool has_ordinates = density.contains("ordinates");
   const bool has_counts = density.contains("counts");
 
-  std::vector<Real> yvals = has_counts
+  const std::vector<Real> yvals = has_counts
     ? density["counts"].get<std::vector<Real>>()
     : density["ordinates"].get<std::vector<Real>>();
 
-  size_t m = 0;
-  std::vector<int> pairs_per_var;
-  if (has_ppv) {
-    m = ppv.size();
-    pairs_per_var = ppv;
-  }
-  else {
-    m = count;
-    pairs_per_var.assign(m, static_cast<int>(num_a / m));
-  }
-
-  RealRealMapArray out;
-  out.resize(m);
+  RealRealMapArray out(m);
   size_t idx = 0;
   for (size_t i = 0; i < m; ++i) {
     const int n = pairs_per_var[i];
@@ -110,7 +104,8 @@ void InstructionMaterializer::handle_histogram_bin_uncertain(const irgen::WriteO
           norm += y * w;
         }
       }
-      map_i[x] = y;
+      // bin abscissas increase, so each insertion is at the end
+      map_i.insert_or_assign(map_i.end(), x, y);
     }
     if (map_i.size() >= 2 && norm > 0.0) {
       auto it_end = map_i.end();
@@ -132,60 +127,18 @@ void InstructionMaterializer::handle_histogram_point_uncertain(const irgen::Writ
     ctx.block_json, ctx.current_path);
 
   switch (contract.ir_value_type) {
-  case irgen::IrValueType::IntRealMapArray: {
-    const size_t count = value.at("count").get<size_t>();
-    const std::vector<Real> counts = value.at("counts").get<std::vector<Real>>();
-    const size_t num_a = value["abscissas"].size();
-    std::vector<int> pairs_per_var;
-    if (value.contains("pairs_per_variable") && !value["pairs_per_variable"].is_null()) {
-      pairs_per_var = value["pairs_per_variable"].get<std::vector<int>>();
-    }
-    else {
-      pairs_per_var.assign(count, static_cast<int>(num_a / count));
-    }
-
-    auto out = build_histogram_point_maps<IntRealMapArray>(
-      value, counts, pairs_per_var,
-      [&](size_t idx) { return value["abscissas"][idx].get<int>(); });
-    ctx.store.set_value(op.target_local_ir_key, IRValue(std::move(out)));
+  case irgen::IrValueType::IntRealMapArray:
+    ctx.store.set_value(op.target_local_ir_key, IRValue(
+      build_histogram_point_maps<IntRealMapArray, int>(value)));
     return;
-  }
-  case irgen::IrValueType::StringRealMapArray: {
-    const size_t count = value.at("count").get<size_t>();
-    const std::vector<Real> counts = value.at("counts").get<std::vector<Real>>();
-    const size_t num_a = value["abscissas"].size();
-    std::vector<int> pairs_per_var;
-    if (value.contains("pairs_per_variable") && !value["pairs_per_variable"].is_null()) {
-      pairs_per_var = value["pairs_per_variable"].get<std::vector<int>>();
-    }
-    else {
-      pairs_per_var.assign(count, static_cast<int>(num_a / count));
-    }
-
-    auto out = build_histogram_point_maps<StringRealMapArray>(
-      value, counts, pairs_per_var,
-      [&](size_t idx) { return value["abscissas"][idx].get<String>(); });
-    ctx.store.set_value(op.target_local_ir_key, IRValue(std::move(out)));
+  case irgen::IrValueType::StringRealMapArray:
+    ctx.store.set_value(op.target_local_ir_key, IRValue(
+      build_histogram_point_maps<StringRealMapArray, String>(value)));
     return;
-  }
-  case irgen::IrValueType::RealRealMapArray: {
-    const size_t count = value.at("count").get<size_t>();
-    const std::vector<Real> counts = value.at("counts").get<std::vector<Real>>();
-    const size_t num_a = value["abscissas"].size();
-    std::vector<int> pairs_per_var;
-    if (value.contains("pairs_per_variable") && !value["pairs_per_variable"].is_null()) {
-      pairs_per_var = value["pairs_per_variable"].get<std::vector<int>>();
-    }
-    else {
-      pairs_per_var.assign(count, static_cast<int>(num_a / count));
-    }
-
-    auto out = build_histogram_point_maps<RealRealMapArray>(
-      value, counts, pairs_per_var,
-      [&](size_t idx) { return value["abscissas"][idx].get<Real>(); });
-    ctx.store.set_value(op.target_local_ir_key, IRValue(std::move(out)));
+  case irgen::IrValueType::RealRealMapArray:
+    ctx.store.set_value(op.target_local_ir_key, IRValue(
+      build_histogram_point_maps<RealRealMapArray, Real>(value)));
     return;
-  }
   default:
     throw std::runtime_error(
       "handle_histogram_point_uncertain: unsupported contract type");
@@ -11,29 +11,50 @@
 
 #include <nlohmann/json.hpp>
 
-#include <sstream>
 #include <stdexcept>
 #include <string>
 
 namespace Dakota::InstructionMaterializerUtils {
 
+namespace {
+
+/// Walk '/'-separated object keys from block_json.  Handlers resolve paths
+/// once per write op, so this is called for every materialized keyword;
+/// it splits the path in place and does one object lookup per token.
+const nlohmann::json* find_path(const nlohmann::json& block_json,
+                                std::string_view path)
+{
+  const nlohmann::json* node = &block_json;
+  std::string token;
+  while (!path.empty()) {
+    const size_t slash = path.find('/');
+    token.assign(path.substr(0, slash));
+    path = (slash == std::string_view::npos) ?
+      std::string_view() : path.substr(slash + 1);
+    if (token.empty())
+      continue;
+    if (!node->is_object())
+      return nullptr;
+    const auto it = node->find(token);
+    if (it == node->end())
+      return nullptr;
+    node = &*it;
+  }
+  return node;
+}
+
+} // namespace
+
 const nlohmann::json& required_path(const nlohmann::json& block_json,
                                     std::string_view path)
 {
   if (path.empty())
     return block_json;
 
-  const nlohmann::json* node = &block_json;
-  std::string token;
-  std::istringstream iss{std::string(path)};
-  while (std::getline(iss, token, '/')) {
-    if (token.empty())
-      continue;
-    if (!node->is_object() || !node->contains(token)) {
-      throw std::runtime_error(
-        "InstructionMaterializer: missing JSON path '" + std::string(path) + "'");
-    }
-    node = &((*node)[token]);
+  const nlohmann::json* node = find_path(block_json, path);
+  if (!node) {
+    throw std::runtime_error(
+      "InstructionMaterializer: missing JSON path '" + std::string(path) + "'");
   }
   return *node;
 }
@@ -44,17 +65,7 @@ const nlohmann::json* optional_path(const nlohmann::json& block_json,
   if (path.empty())
     return &block_json;
 
-  const nlohmann::json* node = &block_json;
-  std::string token;
-  std::istringstream iss{std::string(path)};
-  while (std::getline(iss, token, '/')) {
-    if (token.empty())
-      continue;
-    if (!node->is_object() || !node->contains(token))
-      return nullptr;
-    node = &((*node)[token]);
-  }
-  return node;
+  return find_path(block_json, path);
 }
 
 } // namespace Dakota::InstructionMaterializerUtils
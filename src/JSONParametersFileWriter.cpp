@@ -42,6 +42,22 @@ void JSONParametersFileWriter::write_parameters_file(const Variables& vars, cons
 }
 
 
+void JSONParametersFileWriter::write_parameters(const Variables& vars, const ActiveSet& set,
+                                        const Response& response, const std::string& prog,
+                                        const std::vector<std::string>& an_comps,
+                                        const std::string& full_eval_id,
+                                        std::ostream& parameter_stream) const {
+    std::string formatted_eval_id(full_eval_id);
+    formatted_eval_id.erase(0,1);
+    boost::algorithm::replace_all(formatted_eval_id, String("."), String(":"));
+    json json_out;
+    write_evaluation_to_json(vars, set, response, prog, an_comps, formatted_eval_id, json_out);
+
+    // without indentation, dump() escapes any newlines within strings
+    parameter_stream << json_out.dump();
+}
+
+
         /// Write a parameters file for a batch of evalulations
 void JSONParametersFileWriter::write_parameters_file(const PRPQueue& prp_queue,
                                         const std::string &prog,
@@ -36,6 +36,14 @@ class JSONParametersFileWriter : public ParametersFileWriter {
                                         int batch_id,
                                         const std::string & params_fname) const override;
 
+        /// Write a single evaluation as compact, single-line JSON to a
+        /// stream (e.g., a request to a persistent analysis driver)
+        void write_parameters(const Variables& vars, const ActiveSet& set,
+                                        const Response& response, const std::string& prog,
+                                        const std::vector<std::string>& an_comps,
+                                        const std::string& full_eval_id,
+                                        std::ostream& parameter_stream) const;
+
     private:
         /// Helper for writing a single evaluation to JSON
         void write_evaluation_to_json(const Variables& vars,
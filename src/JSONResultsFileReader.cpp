@@ -21,21 +21,25 @@ void JSONResultsFileReader::read_results_file(Response& response, const std::fil
 	    << " for evaluation " << std::to_string(id) << std::endl;
         abort_handler(INTERFACE_ERROR); // will clean up files unless file_save was specified
     }
+    read_results(response, results_file, "results file " + results_path.string(), id);
+    results_file.close(); 
+}
+
+void JSONResultsFileReader::read_results(Response& response, std::istream& results_stream,
+		const std::string& source, const int id) const {
     json j;
     try {
-        // results_file >> j;
-        j = json::parse(results_file);
+        j = json::parse(results_stream);
     } catch(const json::parse_error& e) {
-        throw FileReadException("Error(s) encountered reading results file " + results_path.string() +
+        throw FileReadException("Error(s) encountered reading " + source +
 			" for Evaluation " + std::to_string(id) + ":\n" + e.what());
     }
-    results_file.close(); 
     try {
         response.read(j, false);
     }
     catch(const FileReadException& fr_except) {
-        throw FileReadException("Error(s) encountered reading results file " + 
-            results_path.string() + " for Evaluation " + 
+        throw FileReadException("Error(s) encountered reading " + 
+            source + " for Evaluation " + 
             std::to_string(id) + ":\n" + fr_except.what()); 
     }
 }
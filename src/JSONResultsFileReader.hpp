@@ -21,6 +21,9 @@ class JSONResultsFileReader : public ResultsFileReader {
         void read_results_file(Response& response, const std::filesystem::path &results_path, const int id) const override;
 	/// Read JSON-format results for a batch of evaluations
         void read_results_file(PRPQueue& prp_queue, const std::string &results_path, const int batch_id, IntSet& completion_set) const override;
+	/// Read JSON-format results for a single evaluation from a stream;
+	/// source describes the stream in error messages
+        void read_results(Response& response, std::istream& results_stream, const std::string& source, const int id) const;
 };
 
 }
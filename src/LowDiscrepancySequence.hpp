@@ -13,6 +13,7 @@
 #include "dakota_data_types.hpp"
 #include "dakota_stat_util.hpp"
 // #include "ProblemDescDB.hpp"
+#include <thread>
 
 namespace Dakota {
 
@@ -24,6 +25,12 @@ namespace Dakota {
     Derived classes must provide implementations for the private virtual method 
     `unsafe_get_points(nMin, nMax, points)` and the public virtual method 
     `randomize()`
+
+    Since `unsafe_get_points` generates each point directly from its index,
+    any range of points can be generated at a cost independent of `nMin`.
+    `get_points_parallel` uses this to generate blocks of points concurrently,
+    and `block_range` provides the same partition for generating blocks on
+    separate processors (e.g., MPI ranks).
 */
 class LowDiscrepancySequence
 {
@@ -84,26 +91,78 @@ public:
   {
     /// Check sizes of the matrix `points`
     check_sizes(nMin, nMax, points);
+    check_request(nMin, nMax);
 
     /// Get the low-discrepancy points
     unsafe_get_points(nMin, nMax, points);
 
     /// Print summary info
-    if ( outputLevel >= Pecos::VERBOSE_OUTPUT )
+    print_points(nMin, points);
+  }
+
+  /// Generates low-discrepancy points between given indices
+  /// Returns the same points as `get_points(nMin, nMax, points)`, but splits
+  /// the columns of `points` into `numBlocks` contiguous blocks that are
+  /// generated concurrently (by default, one block per hardware thread)
+  void get_points_parallel(
+    const size_t nMin,
+    const size_t nMax, 
+    RealMatrix& points,
+    size_t numBlocks = 0
+  )
+  {
+    /// Check sizes of the matrix `points`
+    check_sizes(nMin, nMax, points);
+    check_request(nMin, nMax);
+
+    /// Blocks of fewer than `minBlockSize` points are not worth a thread
+    /// unless explicitly requested
+    const size_t minBlockSize = 1024;
+    size_t numPoints = nMax - nMin;
+    if ( numBlocks == 0 )
     {
-      Cout << "Successfully generated " << points.numCols()
-        << " low-discrepancy points in " << points.numRows() << " dimensions:"
-        << std::endl;
-      for ( int col=0; col<points.numCols(); ++col )
+      numBlocks = std::min<size_t>(std::max(1u,
+        std::thread::hardware_concurrency()), numPoints / minBlockSize + 1);
+    }
+    numBlocks = std::max<size_t>(1, std::min(numBlocks, numPoints));
+
+    /// Generate each block of points in a view of its columns of `points`
+    std::vector<std::thread> workers;
+    for ( size_t block = 0; block < numBlocks; ++block )
+    {
+      auto range = block_range(nMin, nMax, block, numBlocks);
+      auto generate_block = [this, range, nMin, &points]()
       {
-        Cout << col + nMin << ": ";
-        for ( int row=0; row<points.numRows(); ++row )
-        {
-          Cout << points[col][row] << " ";
-        }
-        Cout << std::endl;
-      }
+        RealMatrix block_points(Teuchos::View, points[range.first - nMin],
+          points.stride(), points.numRows(), range.second - range.first);
+        unsafe_get_points(range.first, range.second, block_points);
+      };
+      if ( block + 1 < numBlocks )
+        workers.emplace_back(generate_block);
+      else
+        generate_block();
     }
+    for ( auto& worker : workers )
+      worker.join();
+
+    /// Print summary info
+    print_points(nMin, points);
+  }
+
+  /// Returns the index range [`first`, `second`) of block `block` when the
+  /// points with index `nMin`, ..., `nMax` - 1 are split into `numBlocks`
+  /// contiguous blocks of (nearly) equal size, e.g., to shard the points
+  /// over MPI ranks, each of which calls `get_points(first, second, points)`
+  static std::pair<size_t, size_t> block_range(
+    const size_t nMin,
+    const size_t nMax,
+    const size_t block,
+    const size_t numBlocks
+  )
+  {
+    size_t numPoints = nMax - nMin;
+    return std::make_pair(nMin + numPoints * block / numBlocks,
+      nMin + numPoints * (block + 1) / numBlocks);
   }
 
   /// Returns the random seed value
@@ -186,7 +245,17 @@ protected:
     }
   }
 
+  /// Perform checks on the requested index range that are specific to a
+  /// derived class (e.g., a required number of points for an ordering)
+  virtual void check_request(
+    const size_t nMin,
+    const size_t nMax
+  )
+  { }
+
   /// Generate points from this low-discrepancy sequence
+  /// NOTE: `get_points_parallel` calls this function concurrently for
+  /// disjoint index ranges, so it must not modify the state of this sequence
   virtual void unsafe_get_points(
       const size_t nMin,
       const size_t nMax, 
@@ -195,6 +264,29 @@ protected:
 
 private:
 
+  /// Print the generated points when the output level is verbose
+  void print_points(
+    const size_t nMin,
+    const RealMatrix& points
+  )
+  {
+    if ( outputLevel >= Pecos::VERBOSE_OUTPUT )
+    {
+      Cout << "Successfully generated " << points.numCols()
+        << " low-discrepancy points in " << points.numRows() << " dimensions:"
+        << std::endl;
+      for ( int col=0; col<points.numCols(); ++col )
+      {
+        Cout << col + nMin << ": ";
+        for ( int row=0; row<points.numRows(); ++row )
+        {
+          Cout << points[col][row] << " ";
+        }
+        Cout << std::endl;
+      }
+    }
+  }
+
   /// Perform checks on dMax
   /// Checks if dMax is positive (> 0)
   void check_dMax()
@@ -8,7 +8,11 @@
     _______________________________________________________________________ */
 
 #include "MorseSmaleComplex.hpp"
+#include "dakota_thread_util.hpp"
+#include <algorithm>
+#include <cfloat>
 #include <map>
+#include <thread>
 #include <vector>
 // From the Dionysus package
 #include "topology/persistence-diagram.h"
@@ -22,15 +26,11 @@
 ///////////////////////////////////////////////////
 //Vertex
 //////////////////////////////////////////////////
-Vertex::Vertex(int n, double *p, double _val, int _id)
+Vertex::Vertex(int n, const double *p, double _val, int _id)
 {
 	d = n;
-	x = new double[n];
-	for(int i=0; i < n; i++)
-		x[i] = p[i];
-
-	e = -1;
-	PC_UF_min = PC_UF_max = UF_min = UF_max = ID = _id;
+	x = p;
+	ID = _id;
 	persistence = 0;
 	val = _val;
 	classification = REGULAR;
@@ -41,25 +41,6 @@ double Vertex::GetXi(int i)
 	return x[i];
 }
 
-int Vertex::GetIthNeighbor(int i, KNN_Edge * E[])
-{
-	int neighborID = E[this->e]->end;
-	int nextKNN_EdgeID = E[this->e]->nextKNN_Edge;
-	for(int j = 0; j < i; j++)
-	{
-		if(nextKNN_EdgeID != -1)
-		{
-			neighborID = E[nextKNN_EdgeID]->end;
-			nextKNN_EdgeID = E[nextKNN_EdgeID]->nextKNN_Edge;
-		}
-		else
-		{
-			neighborID = -1;
-		}
-	}
-	return neighborID;
-}
-
 void Vertex::CreateANNpoint(ANNpoint &p)
 {
 	if(p != NULL)
@@ -69,43 +50,6 @@ void Vertex::CreateANNpoint(ANNpoint &p)
 		p[i] = this->x[i];
 }
 
-void Vertex::Union_Max(Vertex * v, Vertex * V[])
-{
-	Vertex *a = V[this->Find_Max(V)];
-	Vertex *b = V[v->Find_Max(V)];
-	if(a->val > b->val)
-	{
-		b->UF_max = this->ID;
-		b->PC_UF_max = a->ID;
-	}
-	else if(a->val == b->val)
-	{
-		if(a->ID > b->ID)
-		{
-			b->UF_max = this->ID;
-			b->PC_UF_max = a->ID;
-		}
-		else
-		{
-			a->UF_max = v->ID;
-			a->PC_UF_max = b->ID;
-		}
-	}
-	else
-	{
-		a->UF_max = v->ID;
-		a->PC_UF_max = b->ID;
-	}
-}
-int Vertex::Find_Max(Vertex * V[])
-{
-	if(this->UF_max == this->ID)
-		return this->ID;
-
-	this->PC_UF_max = V[this->PC_UF_max]->Find_Max(V);	
-	return this->PC_UF_max;
-}
-
 double Vertex::SDistance(Vertex *v)
 {
 	double sDist = 0;
@@ -114,79 +58,7 @@ double Vertex::SDistance(Vertex *v)
 	return sDist;
 }
 
-void Vertex::Union_Min(Vertex * v, Vertex * V[])
-{
-	Vertex *a = V[this->Find_Min(V)];
-	Vertex *b = V[v->Find_Min(V)];
-	if(a->val < b->val)
-	{
-		b->UF_min = this->ID;
-		b->PC_UF_min = a->ID;
-	}
-	else if(a->val == b->val)
-	{
-		if(a->ID < b->ID)
-		{
-			b->UF_min = this->ID;
-			b->PC_UF_min = a->ID;
-		}
-		else
-		{
-			a->UF_min = v->ID;
-			a->PC_UF_min = b->ID;
-		}
-	}
-	else
-	{
-		a->UF_min = v->ID;
-		a->PC_UF_min = b->ID;
-	}
-}
-int Vertex::Find_Min(Vertex * V[])
-{
-	if(this->UF_min == this->ID)
-		return this->ID;
-
-	this->PC_UF_min = V[this->PC_UF_min]->Find_Min(V);	
-	return this->PC_UF_min;
-}
-void Vertex::ResetExtrema()
-{
-	UF_max = UF_min = PC_UF_min = PC_UF_max = ID;
-	persistence = 0;
-}
 double Vertex::Value() { return val; }
-Vertex::Vertex(Vertex &v)
-{
-	classification = v.classification;
-	d = v.d;
-	e = v.e;
-	ID = v.ID;
-	PC_UF_max = v.PC_UF_max;
-	PC_UF_min = v.PC_UF_min;
-	UF_max = v.UF_max;
-	UF_min = v.UF_max;
-	val = v.val;
-	x = new double[d];
-	for(int i = 0; i < d; i++)
-		x[i] = v.x[i];
-	persistence = 0;
-}
-Vertex::~Vertex() { delete [] x; }
-///////////////////////////////////////////////////
-//KNN_Edge
-//////////////////////////////////////////////////
-KNN_Edge::KNN_Edge(Vertex * _start, Vertex * _end, KNN_Edge * E[], int id)
-{
-	ID = id;
-	E[id] = this;
-
-	start = _start->ID;
-	end = _end->ID;
-
-	this->nextKNN_Edge = _start->e;
-	_start->e = id;
-}
 ///////////////////////////////////////////////////
 //Crystal
 //////////////////////////////////////////////////
@@ -323,16 +195,14 @@ MS_Complex::MS_Complex(double  *points, int dimension, int count, int _k, bool p
 	d = dimension-1;
 	numKneighbors = _k;
 	szV = numV = count;
-	//szE = szV*numKneighbors;
-  //Edges should be bi-directional
-	szE = szV*szV;
 
 	V = new Vertex *[szV];
-	E = new KNN_Edge *[szE];
+	coordBlocks.push_back(std::make_shared< std::vector<double> >(count*d));
+	double *coords = coordBlocks.back()->data();
+	vertexStore.reserve(count);
 
 	// NOTE: Not removing use of srand/rand as code likely to be retired
   srand(8);
-	double *p = new double[dimension];
 	for(int i=0; i < count; i++)
 	{
     double eps = (double)rand() / (double)RAND_MAX;
@@ -340,59 +210,151 @@ MS_Complex::MS_Complex(double  *points, int dimension, int count, int _k, bool p
     if(rand() > RAND_MAX / 2)
       eps = -eps;
 
-		for(int j = 0; j < dimension; j++)
-			p[j] = points[i*dimension+j];
-    p[dimension-1] += (perturbed ? eps : 0);
-		V[i] = new Vertex(d, p, p[d], i);
+		for(int j = 0; j < d; j++)
+			coords[i*d+j] = points[i*dimension+j];
+		vertexStore.push_back(Vertex(d, coords + i*d,
+		  points[i*dimension+d] + (perturbed ? eps : 0), i));
 	}	
-	delete [] p;
-
-//  std::cout << "numV=" << numV << std::endl;
-//  std::cout << "d=" << d << std::endl;
-//  std::cout << "numKneighbors=" << numKneighbors << std::endl;
+	for(int i=0; i < count; i++)
+		V[i] = &vertexStore[i];
 
 	KNN();
 	Compute();
   maxDist = -1;
 }
 
-MS_Complex::MS_Complex(MS_Complex &Complex, double  *new_point)
+MS_Complex::MS_Complex(const MS_Complex &Complex, double  *new_point)
 {
   perturbed = Complex.perturbed;
   d = Complex.d;
   numKneighbors = Complex.numKneighbors;
 	szV = numV = Complex.numV + 1;
-	//szE = szV*numKneighbors;
-  szE = szV*szV;
+	int n = Complex.numV, k = numKneighbors, p = numV-1;
+
+  double eps = 0;
+  if(perturbed)
+  {
+    eps = (double)rand() / (double)RAND_MAX;
+    eps = eps * 1e-6;
+    if(rand() > RAND_MAX / 2)
+      eps = -eps;
+  }
 
+	// The vertices of Complex keep pointing to its coordinates
+	coordBlocks = Complex.coordBlocks;
+	coordBlocks.push_back(
+	  std::make_shared< std::vector<double> >(new_point, new_point + d));
+	vertexStore.reserve(numV);
+	vertexStore.assign(Complex.vertexStore.begin(), Complex.vertexStore.end());
+	vertexStore.push_back(Vertex(d, coordBlocks.back()->data(),
+	  new_point[d] + (perturbed ? eps : 0), p));
 	V = new Vertex *[szV];
-	E = new KNN_Edge *[szE];
-	
-	double *p = new double[d+1];
-	for(int i=0; i < Complex.numV; i++)
+	for(int i=0; i < numV; i++)
+		V[i] = &vertexStore[i];
+
+	knnIds = Complex.knnIds;
+	knnSqDists = Complex.knnSqDists;
+	knnIds.resize(numV*k, -1);
+	knnSqDists.resize(numV*k, DBL_MAX);
+	adjacency = Complex.adjacency;
+	adjacency.resize(numV);
+
+	// Exact nearest neighbors of the new point
+	std::vector<double> sq_dists(n);
+	for(int i = 0; i < n; i++)
+		sq_dists[i] = V[p]->SDistance(V[i]);
+	int kp = std::min(k, n);
+	std::vector<int> order(n);
+	for(int i = 0; i < n; i++)
+		order[i] = i;
+	std::partial_sort(order.begin(), order.begin()+kp, order.end(),
+	  [&sq_dists](int a, int b) { return sq_dists[a] < sq_dists[b]; });
+	for(int j = 0; j < kp; j++)
 	{
-		for(int j = 0; j < d; j++)
-			p[j] = Complex.V[i]->GetXi(j);
-    p[d] = Complex.V[i]->Value();
-		V[i] = new Vertex(d, p, p[d], i);
-	}	
+		knnIds[p*k+j] = order[j];
+		knnSqDists[p*k+j] = sq_dists[order[j]];
+	}
 
-  double eps = (double)rand() / (double)RAND_MAX;
-  eps = eps * 1e-6;
-  if(rand() > RAND_MAX / 2)
-    eps = -eps;
+	// The new point displaces the farthest of the k nearest neighbors of
+	// the vertices it is closer to; only these vertices, the new point's
+	// neighbors, and the endpoints of dropped edges change neighborhoods
+	std::vector<char> changed(numV, 0);
+	changed[p] = 1;
+	std::vector< std::pair<int,int> > displaced;
+	for(int i = 0; i < n && k > 0; i++)
+	{
+		int *ids = &knnIds[i*k];
+		double *dists = &knnSqDists[i*k];
+		if(!(sq_dists[i] < dists[k-1]))
+			continue;
+		if(ids[k-1] >= 0)
+			displaced.push_back(std::make_pair(i, ids[k-1]));
+		int j = k-1;
+		for( ; j > 0 && dists[j-1] > sq_dists[i]; j--)
+		{
+			ids[j] = ids[j-1];
+			dists[j] = dists[j-1];
+		}
+		ids[j] = p;
+		dists[j] = sq_dists[i];
+		AddEdge(i, p);
+		AddEdge(p, i);
+		changed[i] = 1;
+	}
+	for(int j = 0; j < kp; j++)
+	{
+		AddEdge(p, order[j]);
+		AddEdge(order[j], p);
+		changed[order[j]] = 1;
+	}
+	for(size_t e = 0; e < displaced.size(); e++)
+	{
+		int i = displaced[e].first, q = displaced[e].second;
+		// the edge remains if i is still a nearest neighbor of q
+		if(std::find(&knnIds[q*k], &knnIds[q*k]+k, i) != &knnIds[q*k]+k)
+			continue;
+		RemoveEdge(i, q);
+		RemoveEdge(q, i);
+		changed[q] = 1;
+	}
+	numE = 0;
+	for(int i = 0; i < numV; i++)
+		numE += adjacency[i].size();
 
-  V[numV-1] = new Vertex(d, new_point, new_point[d] + (perturbed ? eps : 0), numV-1);
-	delete [] p;
-	KNN();
-	Compute();
+	steepestA = Complex.steepestA;
+	steepestD = Complex.steepestD;
+	steepestA.resize(numV);
+	steepestD.resize(numV);
+	for(int i = 0; i < numV; i++)
+		if(changed[i])
+			ComputeSteepest(i);
+	maxLabel = Complex.maxLabel;
+	minLabel = Complex.minLabel;
+	UpdateManifolds(changed);
+
+	Simplify();
   maxDist = -1;
 }
 
+void MS_Complex::AddEdge(int v1, int v2)
+{
+	if(!DoesEdgeExist(v1, v2))
+		adjacency[v1].push_back(v2);
+}
+
+void MS_Complex::RemoveEdge(int v1, int v2)
+{
+	std::vector<int> &adj = adjacency[v1];
+	std::vector<int>::iterator it = std::find(adj.begin(), adj.end(), v2);
+	if(it != adj.end())
+		adj.erase(it);
+}
+
 void MS_Complex::KNN()
 {
-	int eIndex = 0;
 	int i,k;
+	// the nearest neighbor of each point is itself
+	int num_query = std::min(numKneighbors+1, numV);
 
 	ANNpointArray pa = new ANNpoint[numV];
 	for(i = 0; i < numV; i++)
@@ -401,110 +363,159 @@ void MS_Complex::KNN()
 		V[i]->CreateANNpoint(pa[i]);
 	}
 
-	SearchStructure = new ANNkd_tree(pa,numV,d);
-	ANNidxArray nn_idx;
-	ANNdistArray dists;
+	ANNkd_tree *SearchStructure = new ANNkd_tree(pa,numV,d);
+	ANNidxArray nn_idx = new ANNidx[num_query];
+	ANNdistArray dists = new ANNdist[num_query];
+	knnIds.assign(numV*numKneighbors, -1);
+	knnSqDists.assign(numV*numKneighbors, DBL_MAX);
+	adjacency.assign(numV, std::vector<int>());
 	for(i = 0; i < numV; i++)
 	{		
-		nn_idx = new ANNidx[numKneighbors+1];
-		dists = new ANNdist[numKneighbors+1];
-
-		SearchStructure->annkSearch(pa[i],numKneighbors+1,nn_idx,dists);
+		SearchStructure->annkSearch(pa[i],num_query,nn_idx,dists);
 
-		for(k=1;k<numKneighbors+1;k++)
+		//Edges should be bi-directional
+		for(k=1;k<num_query;k++)
 		{
-      if(!DoesEdgeExist(i, nn_idx[k], eIndex))
-      {
-			  E[eIndex] = new KNN_Edge(V[i],V[nn_idx[k]],E, eIndex);
-			  eIndex++;
-      }
-      if(!DoesEdgeExist(nn_idx[k],i, eIndex))
-      {
-			  E[eIndex] = new KNN_Edge(V[nn_idx[k]],V[i],E, eIndex);
-			  eIndex++;
-      }
+			knnIds[i*numKneighbors+k-1] = nn_idx[k];
+			knnSqDists[i*numKneighbors+k-1] = dists[k];
+			AddEdge(i, nn_idx[k]);
+			AddEdge(nn_idx[k], i);
 		}
-		delete [] nn_idx;
-		delete [] dists;
 	}
+	delete [] nn_idx;
+	delete [] dists;
+	delete SearchStructure;
 
 	for(i = 0; i < numV; i++)
 		delete [] pa[i];
 
 	delete [] pa;
-	numE = eIndex;
+
+	numE = 0;
+	for(i = 0; i < numV; i++)
+		numE += adjacency[i].size();
 }
 
-void MS_Complex::Compute()
+void MS_Complex::ComputeSteepest(int i)
 {
-  int i,j;
-	int maxCount=0;
-	int minCount=0;
-	double globalMax = V[0]->Value();
-	double globalMin = V[0]->Value();
-	for(i = 0; i < numV; i++)
+	Vertex *v = V[i];
+	double maximum = v->Value();
+	double minimum = v->Value();
+	Vertex *steepA = v;
+	Vertex *steepD = v;
+
+	// visit the neighbors latest edge first, as in the former edge lists
+	const std::vector<int> &neighbors = adjacency[i];
+	for(int j = (int)neighbors.size()-1; j >= 0; j--)
 	{
-		Vertex *v = V[i];
+		Vertex *currentNeighbor = V[neighbors[j]];
 
-		if(globalMax < v->Value())
-			globalMax = v->Value();
-		if(globalMin > v->Value())
-			globalMin = v->Value();
-
-		//Vertex **neighbors = new Vertex *[numKneighbors];
-    std::vector<Vertex *> neighbors;
-		//for(int j = 0; j < numKneighbors; j++)
-    j = 0;
-    while(v->GetIthNeighbor(j,E) != -1)
+		if(currentNeighbor->Value() > maximum ||
+			(currentNeighbor->Value() == maximum &&
+			 currentNeighbor->ID > v->ID))
 		{
-			//neighbors[j] = V[v->GetIthNeighbor(j,E)];
-      neighbors.push_back(V[v->GetIthNeighbor(j,E)]);
-      j++;
+			maximum = currentNeighbor->Value();
+			steepA = currentNeighbor;
 		}
 
-		double maximum = v->Value();
-		double minimum = v->Value();
-		Vertex *steepestA = v;
-		Vertex *steepestD = v;
-
-		//for(int j = 0; j < numKneighbors; j++)
-    j = 0;
-    while(v->GetIthNeighbor(j,E) != -1)
+		if(currentNeighbor->Value() < minimum  ||
+			(currentNeighbor->Value() == minimum &&
+			 currentNeighbor->ID < v->ID))
 		{
-			Vertex *currentNeighbor = neighbors[j];
+			minimum = currentNeighbor->Value();
+			steepD = currentNeighbor;
+		}
+	}
+	steepestA[i] = steepA->ID;
+	steepestD[i] = steepD->ID;
+}
 
-			if(currentNeighbor->Value() > maximum ||
-				(currentNeighbor->Value() == maximum &&
-				 currentNeighbor->ID > v->ID))
+//The ascending (descending) manifold of a vertex is labeled by the maximum
+// (minimum) reached by following steepest neighbors.  Only vertices whose
+// path passes through a changed vertex are relabeled.
+void MS_Complex::UpdateManifolds(const std::vector<char> &changed)
+{
+	for(int dir = 0; dir < 2; dir++)
+	{
+		const std::vector<int> &steepest = (dir == 0) ? steepestA : steepestD;
+		std::vector<int> &label = (dir == 0) ? maxLabel : minLabel;
+		label.resize(numV, -1);
+
+		//0 = unknown, 1 = label is current, 2 = affected
+		std::vector<char> status(numV, 0);
+		std::vector<int> path;
+		for(int i = 0; i < numV; i++)
+		{
+			int j = i;
+			while(status[j] == 0 && !changed[j] && steepest[j] != j)
 			{
-				maximum = currentNeighbor->Value();
-				steepestA = currentNeighbor;
+				path.push_back(j);
+				j = steepest[j];
 			}
+			char s = status[j];
+			if(s == 0)
+				s = status[j] = changed[j] ? 2 : 1;
+			for(size_t m = 0; m < path.size(); m++)
+				status[path[m]] = s;
+			path.clear();
+		}
 
-			if(currentNeighbor->Value() < minimum  ||
-				(currentNeighbor->Value() == minimum &&
-				 currentNeighbor->ID < v->ID))
+		for(int i = 0; i < numV; i++)
+		{
+			if(status[i] != 2)
+				continue;
+			int j = i;
+			while(status[j] == 2 && steepest[j] != j)
 			{
-				minimum = currentNeighbor->Value();
-				steepestD = currentNeighbor;
+				path.push_back(j);
+				j = steepest[j];
 			}
-      j++;
-		}
-		if(steepestA == v)
-		{
-			v->classification = LOCAL_MAX;
-			maxCount++;
-		}
-		else if(steepestD == v)
-		{
-			v->classification = LOCAL_MIN;
-			minCount++;
+			if(status[j] == 2)
+			{
+				label[j] = j;
+				status[j] = 1;
+			}
+			for(size_t m = 0; m < path.size(); m++)
+			{
+				label[path[m]] = label[j];
+				status[path[m]] = 1;
+			}
+			path.clear();
 		}
+	}
+}
 
-		v->Union_Max(steepestA, V);
-		v->Union_Min(steepestD, V);
+void MS_Complex::Compute()
+{
+	steepestA.resize(numV);
+	steepestD.resize(numV);
+	for(int i = 0; i < numV; i++)
+		ComputeSteepest(i);
+	UpdateManifolds(std::vector<char>(numV, 1));
+	Simplify();
+}
+
+void MS_Complex::Simplify()
+{
+  int i,j;
+	double globalMax = V[0]->Value();
+	double globalMin = V[0]->Value();
+	for(i = 0; i < numV; i++)
+	{
+		Vertex *v = V[i];
+
+		if(globalMax < v->Value())
+			globalMax = v->Value();
+		if(globalMin > v->Value())
+			globalMin = v->Value();
 
-		//delete [] neighbors;
+		if(steepestA[i] == i)
+			v->classification = LOCAL_MAX;
+		else if(steepestD[i] == i)
+			v->classification = LOCAL_MIN;
+		else
+			v->classification = REGULAR;
+		v->persistence = 0;
 	}
 
 	//Go through each vertex, examine its neighbors, if maxima are different, create or update the entry in a map
@@ -517,22 +528,11 @@ void MS_Complex::Compute()
 		if(V[i]->classification == LOCAL_MAX || V[i]->classification == LOCAL_MIN)
 			continue;
 
-		//Vertex **neighbors = new Vertex *[numKneighbors];
-    std::vector<Vertex *> neighbors;
-    j = 0;
-    
-		//for(int j = 0; j < numKneighbors; j++)
-    while(V[i]->GetIthNeighbor(j,E) != -1)
-		{
-			//neighbors[j] = V[V[i]->GetIthNeighbor(j,E)];
-      neighbors.push_back(V[V[i]->GetIthNeighbor(j,E)]);
-      j++;
-		}
-		//for(int Bindex = 0; Bindex < numKneighbors; Bindex++)
-    for(int Bindex = 0; Bindex < j; Bindex++)
+		const std::vector<int> &neighbors = adjacency[i];
+		for(size_t Bindex = 0; Bindex < neighbors.size(); Bindex++)
 		{
-			int AmaxIndex = V[i]->Find_Max(V);
-			int BmaxIndex = neighbors[Bindex]->Find_Max(V);
+			int AmaxIndex = maxLabel[i];
+			int BmaxIndex = maxLabel[neighbors[Bindex]];
 
 			if(AmaxIndex != BmaxIndex)
 			{
@@ -549,7 +549,6 @@ void MS_Complex::Compute()
 				}
 			}
 		}
-		//delete [] neighbors;
 	}
 	//Saddles between Minima
 	std::map<std::pair<int, int>, int> minSaddles = std::map<std::pair<int, int>, int>();
@@ -558,23 +557,11 @@ void MS_Complex::Compute()
 		if(V[i]->classification == LOCAL_MAX || V[i]->classification == LOCAL_MIN)
 			continue;
 
-		//Vertex **neighbors = new Vertex *[numKneighbors];
-    std::vector<Vertex *> neighbors;
-    j = 0;
-		//for(int j = 0; j < numKneighbors; j++)
-    while(V[i]->GetIthNeighbor(j,E) != -1)
+		const std::vector<int> &neighbors = adjacency[i];
+		for(size_t Bindex = 0; Bindex < neighbors.size(); Bindex++)
 		{
-			//neighbors[j] = V[V[i]->GetIthNeighbor(j,E)];
-      neighbors.push_back(V[V[i]->GetIthNeighbor(j,E)]);
-      j++;
-		}
-
-		int Bindex = 0;
-		//for(; Bindex < numKneighbors; Bindex++)
-    for(; Bindex < j; Bindex++)
-		{
-			int AminIndex = V[i]->Find_Min(V);
-			int BminIndex = neighbors[Bindex]->Find_Min(V);
+			int AminIndex = minLabel[i];
+			int BminIndex = minLabel[neighbors[Bindex]];
 
 			if(AminIndex != BminIndex)
 			{
@@ -591,7 +578,6 @@ void MS_Complex::Compute()
 				}
 			}
 		}
-		//delete [] neighbors;
 	}
 
 	///////////////////////
@@ -701,8 +687,8 @@ void MS_Complex::Compute()
 		if(V[i]->classification == LOCAL_MIN || V[i]->classification == LOCAL_MAX)
 			continue;
 
-		int minI = V[i]->Find_Min(V);
-		int maxI = V[i]->Find_Max(V);
+		int minI = minLabel[i];
+		int maxI = maxLabel[i];
 		std::pair<int,int> minMaxPair = std::pair<int,int>(minI,maxI);
 		if(Crystals.find(minMaxPair) == Crystals.end())
 		{
@@ -1057,7 +1043,7 @@ void MS_Complex::Compute()
 	delete [] S;
 }
 
-double MS_Complex::CompareExtremaCount(MS_Complex &_C)
+double MS_Complex::CompareExtremaCount(MS_Complex &_C) const
 {
 	int maxNumV = _C.numV;
 	int minNumV = numV;
@@ -1099,7 +1085,7 @@ double MS_Complex::CompareExtremaCount(MS_Complex &_C)
 	return abs(countThisMin - countThatMin + countThisMax - countThatMax + countThisSaddle - countThatSaddle);
 }
 
-double MS_Complex::CompareClassChange(MS_Complex &_C)
+double MS_Complex::CompareClassChange(MS_Complex &_C) const
 {
 	int maxNumV = _C.numV;
 	int minNumV = numV;
@@ -1116,7 +1102,7 @@ double MS_Complex::CompareClassChange(MS_Complex &_C)
 	return countChanged;
 }
 
-double MS_Complex::ComparePersistence(MS_Complex &_C)
+double MS_Complex::ComparePersistence(MS_Complex &_C) const
 {
 	int maxNumV = _C.numV;
 	int minNumV = numV;
@@ -1133,7 +1119,7 @@ double MS_Complex::ComparePersistence(MS_Complex &_C)
 	return (sumP)/(double)(minNumV);
 }
 
-double MS_Complex::ComparePersistenceNoSaddles(MS_Complex &_C)
+double MS_Complex::ComparePersistenceNoSaddles(MS_Complex &_C) const
 {
 	int maxNumV = _C.numV;
 	int minNumV = numV;
@@ -1152,7 +1138,7 @@ double MS_Complex::ComparePersistenceNoSaddles(MS_Complex &_C)
 }
 
 
-double MS_Complex::CompareBottleneck(MS_Complex &_C)
+double MS_Complex::CompareBottleneck(MS_Complex &_C) const
 {
   PersistenceDiagram<double> pDia(1);
   for(int i = 0; i < numV; i++)
@@ -1203,7 +1189,7 @@ double MS_Complex::CompareBottleneck(MS_Complex &_C)
   return ret_value;
 }
 
-double MS_Complex::CompareLabels(MS_Complex &_C, double p)
+double MS_Complex::CompareLabels(MS_Complex &_C, double p) const
 {
   int diff_labels = 0;
   double testPersistence = p*persistences[szP-1];
@@ -1341,36 +1327,24 @@ double MS_Complex::FarFromSaddle(double *v, double p)
 
 MS_Complex::~MS_Complex()
 {
-	for(int i = 0; i < numV; i++)
-		delete V[i];
 	delete [] V;
-	for(int i = 0; i < numE; i++)
-		delete E[i];
-	delete [] E;
 	for(int i = 0; i < numC; i++)
 		delete C[i];
 	delete [] C;
 	
 	delete [] V_to_C;
   delete [] persistences;
-	delete SearchStructure;
 }
 
 void MS_Complex::Destroy()
 {
-	for(int i = 0; i < numV; i++)
-		delete V[i];
 	delete [] V;
-	for(int i = 0; i < numE; i++)
-		delete E[i];
-	delete [] E;
 	for(int i = 0; i < numC; i++)
 		delete C[i];
 	delete [] C;
 	
 	delete [] V_to_C;
   delete [] persistences;
-	delete SearchStructure;
 }
 
 int MS_Complex::GetIthHighestPersistence(int i)
@@ -1472,18 +1446,44 @@ Vertex *   MS_Complex::GetVertex(int i)
   return (j < numV && j >= 0) ? V[j] : NULL;
 }
 
-double ScoreTOPOB(MS_Complex &C1, double *x)
+double ScoreTOPOB(const MS_Complex &C1, double *x)
 {
-  MS_Complex C2 = MS_Complex(C1,x);
+  MS_Complex C2(C1,x);
   return C1.CompareBottleneck(C2);
 }
 
-double ScoreTOPOP(MS_Complex &C1, double *x)
+double ScoreTOPOP(const MS_Complex &C1, double *x)
 {
-  MS_Complex C2 = MS_Complex(C1,x);
+  MS_Complex C2(C1,x);
   return C1.ComparePersistenceNoSaddles(C2);
 }
 
+void ScoreCandidates(const MS_Complex &C, double (*score)(const MS_Complex &, double *),
+  double *candidates, int dimension, int count, double *scores,
+  int num_threads)
+{
+  if(num_threads <= 0)
+    num_threads = (int)Dakota::worker_threads(NULL, std::max(count, 1));
+  num_threads = std::min(num_threads, count);
+
+  // each candidate is inserted into its own copy-on-insert complex
+  auto score_range = [&](int t)
+  {
+    for(int i = t; i < count; i += num_threads)
+      scores[i] = score(C, candidates + i*(dimension+1));
+  };
+  if(num_threads <= 1)
+  {
+    score_range(0);
+    return;
+  }
+  std::vector<std::thread> workers;
+  for(int t = 0; t < num_threads; t++)
+    workers.push_back(std::thread(score_range, t));
+  for(size_t t = 0; t < workers.size(); t++)
+    workers[t].join();
+}
+
 std::vector<int> ScoreTOPOHP(int dimension, int knn,
   double *training, double *trainingY, int n_training, 
   double *candidates, double *candidateY, int n_candidates)
@@ -1648,11 +1648,13 @@ void MS_Complex::Draw(double gMin, double gMax,bool flatMode)
 
 	glLineWidth(1.0);
 	glBegin(GL_LINES);
-	for(int i = 0; i < numE; i++)
+	for(int i = 0; i < numV; i++)
+	for(size_t k = 0; k < adjacency[i].size(); k++)
 	{
+		int j = adjacency[i][k];
 		glColor3f(0.25,0.25,0.25);
-		glVertex3f(V[E[i]->start]->GetXi(0),V[E[i]->start]->GetXi(1), flatMode ? 0 : ((V[E[i]->start]->Value()-gMin)/(gMax-gMin) - 1./2.));
-		glVertex3f(V[E[i]->end]->GetXi(0),  V[E[i]->end]->GetXi(1),  flatMode ? 0 : ((V[E[i]->end]->Value()-gMin)/(gMax-gMin) - 1./2.));
+		glVertex3f(V[i]->GetXi(0),V[i]->GetXi(1), flatMode ? 0 : ((V[i]->Value()-gMin)/(gMax-gMin) - 1./2.));
+		glVertex3f(V[j]->GetXi(0),V[j]->GetXi(1), flatMode ? 0 : ((V[j]->Value()-gMin)/(gMax-gMin) - 1./2.));
 	}
 	glEnd();
 
@@ -1679,24 +1681,24 @@ void MS_Complex::Draw(double gMin, double gMax,bool flatMode)
     glEnable(GL_BLEND);
 		glColor3f(0,0,0);
 		glLineWidth(6.0);
-		for(int k = 0; k < numKneighbors; k++)
+		for(size_t k = 0; k < adjacency[i].size(); k++)
 		{
-			int nextIdx = curV->GetIthNeighbor(k, E);
+			int nextIdx = adjacency[i][k];
 			Vertex *nextV = V[nextIdx];
-			if(nextIdx == curV->NeighborMax() || nextIdx == curV->NeighborMin())
+			if(nextIdx == steepestA[i] || nextIdx == steepestD[i])
 			{
 				glBegin(GL_LINES);
-					if(i == nextV->NeighborMax())
+					if(i == steepestA[nextIdx])
 						glColor4f(1,0,0,1);
-					else if(i == nextV->NeighborMin())
+					else if(i == steepestD[nextIdx])
 						glColor4f(0.8,1.,1,1);
 					else
 						glColor4f(0,0,0,0);
 
 					glVertex3f(curV->GetXi(0),curV->GetXi(1), flatMode ? 0 : ((curV->Value()-gMin)/(gMax-gMin) - 1./2.));
-					if(nextIdx == curV->NeighborMax())
+					if(nextIdx == steepestA[i])
 						glColor4f(1,0,0,1);
-					else if(nextIdx == curV->NeighborMin())
+					else if(nextIdx == steepestD[i])
 						glColor4f(0.8,1.,1,1);
 					else
 						glColor4f(0,0,0,0);
@@ -1763,7 +1765,7 @@ void MS_Complex::DrawBurst()
     glColor3f(0,0,0);
     for(int j = 0; j < numV; j++)
     {
-      if(V[j]->Find_Min(V) == midx && midx != j)
+      if(minLabel[j] == midx && midx != j)
       {
         glBegin(GL_LINES);
           glVertex3f(x,0.5,y);
@@ -1795,7 +1797,7 @@ void MS_Complex::DrawBurst()
     glColor3f(0,0,0);
     for(int j = 0; j < numV; j++)
     {
-      if(V[j]->Find_Max(V) == midx && midx != j)
+      if(maxLabel[j] == midx && midx != j)
       {
         glBegin(GL_LINES);
           glVertex3f(x,0.5,y);
@@ -14,6 +14,7 @@
 #include "ANN/ANNperf.h"
 #include "ANN/ANNx.h"
 
+#include <memory>
 #include <vector>
 #include <cstdlib>
 #include <cstdio>
@@ -26,41 +27,25 @@
 #define SADDLE 2
 #define REGULAR 3
 
-class KNN_Edge;
-
+/// A sample point; the coordinates are owned by the complex (and shared
+/// with complexes built from it by inserting a point), so copies are cheap
 class Vertex
 {
 public:
-	Vertex(int n, double *p, double _val, int _id);
+	Vertex(int n, const double *p, double _val, int _id);
 	void CreateANNpoint(ANNpoint &p);
 	double GetXi(int i);
-	void Union_Max(Vertex * v, Vertex * V[]);
-	int Find_Max(Vertex * V[]);
-	void Union_Min(Vertex * v, Vertex * V[]);
-	int Find_Min(Vertex * V[]);
-	int GetIthNeighbor(int i, KNN_Edge * E[]);
-	void ResetExtrema();
 	double Value();
   double SDistance(Vertex *v);
-	Vertex(Vertex &v);
-	~Vertex();
-
-	int NeighborMax() { return UF_max;}
-	int NeighborMin() { return UF_min;}
 
-	int e;
 	int classification;		//0 = minimum, 1=maximmum, 2=saddle, 3=regular
 	int ID;
 	double persistence;
 
 private:
-	double *x;
+	const double *x;
 	double val;
 	int d;
-	int UF_max; //The neighboring maximumm
-	int UF_min; //The neighboring minimum
-	int PC_UF_max; //The MS-Cell-max
-	int PC_UF_min; //The MS-Cell-min
 };
 
 struct Saddle
@@ -72,15 +57,6 @@ struct Saddle
 	Saddle *next;
 };
 
-class KNN_Edge
-{
-public:
-	KNN_Edge(Vertex * _start, Vertex * _end, KNN_Edge * E[], int id);
-	int ID;
-	int start,end;
-	int nextKNN_Edge;
-};
-
 class MS_Crystal
 {
 public:
@@ -111,18 +87,23 @@ class MS_Complex
 {
 public:
 	MS_Complex(double  *points, int dimension, int count, int _k=15, bool perturb=false);
-	MS_Complex(MS_Complex &C, double *new_point);
+	/// Complex of the points of C and new_point, updated incrementally:
+	/// only the kNN lists, edges, and steepest neighbors near new_point are
+	/// recomputed, as are the ascending and descending manifolds that
+	/// flow through them.  C is only read, so many candidate points may
+	/// be inserted into the same C concurrently.
+	MS_Complex(const MS_Complex &C, double *new_point);
 	~MS_Complex();
 	void Destroy();
 	void KNN();
 	void Compute();
   void Print(std::ostream &out);
 	Vertex * *V;
-	KNN_Edge * *E;
+	/// symmetric kNN graph: the neighbors of each vertex
+	std::vector< std::vector<int> > adjacency;
 	MS_Crystal * *C;
 	//Saddle * *S;
 	int szV;
-	int szE;
 	int numV;
 	int numE;
 	int numC;
@@ -141,12 +122,12 @@ public:
 	void DrawBurst();
 #endif
 
-	double CompareExtremaCount(MS_Complex &_C);
-  double CompareClassChange(MS_Complex &_C);
-  double ComparePersistence(MS_Complex &_C);
-	double ComparePersistenceNoSaddles(MS_Complex &_C);
-  double CompareBottleneck(MS_Complex &_C);
-  double CompareLabels(MS_Complex &_C, double p);
+	double CompareExtremaCount(MS_Complex &_C) const;
+  double CompareClassChange(MS_Complex &_C) const;
+  double ComparePersistence(MS_Complex &_C) const;
+	double ComparePersistenceNoSaddles(MS_Complex &_C) const;
+  double CompareBottleneck(MS_Complex &_C) const;
+  double CompareLabels(MS_Complex &_C, double p) const;
 	double CloseToExtrema(double *v, double p);
 	double FarFromExtrema(double *v, double p);
   double FarFromSaddle(double *v, double p);
@@ -169,17 +150,44 @@ public:
 
 private:
   bool perturbed;
-  bool DoesEdgeExist(int v1, int v2, int maxIndex)
+  bool DoesEdgeExist(int v1, int v2) const
   {
-    for(int i = 0; i < maxIndex; i++)
-      if(E[i]->start == v1 && E[i]->end == v2)
+    const std::vector<int> &adj = adjacency[v1];
+    for(size_t i = 0; i < adj.size(); i++)
+      if(adj[i] == v2)
         return true;
     return false;
   }
-	ANNkd_tree *SearchStructure;
+  void AddEdge(int v1, int v2);
+  void RemoveEdge(int v1, int v2);
+  void ComputeSteepest(int i);
+  void UpdateManifolds(const std::vector<char> &changed);
+  void Simplify();
+
+  /// storage of the vertices and of their coordinates (shared with
+  /// complexes built by inserting a point)
+  std::vector<Vertex> vertexStore;
+  std::vector< std::shared_ptr< std::vector<double> > > coordBlocks;
+  /// numKneighbors nearest neighbors of each vertex, nearest first, and
+  /// their squared distances
+  std::vector<int> knnIds;
+  std::vector<double> knnSqDists;
+  /// steepest ascending and descending neighbor of each vertex (itself
+  /// at a maximum or minimum)
+  std::vector<int> steepestA;
+  std::vector<int> steepestD;
+  /// maximum and minimum whose manifolds contain each vertex
+  std::vector<int> maxLabel;
+  std::vector<int> minLabel;
 };
-double ScoreTOPOB(MS_Complex &C, double *x);
-double ScoreTOPOP(MS_Complex &C, double *x);
+double ScoreTOPOB(const MS_Complex &C, double *x);
+double ScoreTOPOP(const MS_Complex &C, double *x);
+/// scores[i] = score(C, candidates + i*(dimension+1)) for count candidate
+/// points (coordinates then value), computed by num_threads threads (by
+/// default, one per core, or one in a parallel MPI run); C is not modified
+void ScoreCandidates(const MS_Complex &C, double (*score)(const MS_Complex &, double *),
+  double *candidates, int dimension, int count, double *scores,
+  int num_threads = 0);
 std::vector<int> ScoreTOPOHP(int dimension, int knn,
   double *training, double *trainingY, int n_training, 
   double *candidates, double *candidateY, int n_candidates);
@@ -1898,6 +1898,15 @@ make_response_defaults(std::list<DataResponses>* drl)
 	       rdvc->what, (UL)n1, (UL)n);
     if (dr->methodSource == "vendor" && dr->fdGradStepSize.length() > 1)
       squawk("vendor numerical gradients only support a single fd_gradient_step_size");
+    if ((n = dr->jacSparsityFns.length()) != (size_t)dr->jacSparsityVars.length())
+      squawk("jacobian_sparsity nonzero_variables needs %lu elements, not %lu",
+	     (UL)n, (UL)dr->jacSparsityVars.length());
+    for(i = 0; i < n; ++i)
+      if (dr->jacSparsityFns[i] < 1 || dr->jacSparsityFns[i] > (int)nf) {
+	squawk("jacobian_sparsity nonzero_functions must be between 1 and %lu",
+	       (UL)nf);
+	break;
+      }
 
     ni = (int)nf;
     if (dr->gradientType == "mixed") {
@@ -7012,7 +7021,9 @@ static bool
 	MP_(allowExistingResultsFlag),
 	MP_(asynchFlag),
 	MP_(batchEvalFlag),
+	MP_(columnarFlag),
         MP_(dakotaResultsFileLabeled),
+	MP_(dirRecycle),
 	MP_(dirSave),
 	MP_(dirTag),
 	MP_(evalCacheFlag),
@@ -7020,6 +7031,7 @@ static bool
 	MP_(fileTagFlag),
 	MP_(nearbyEvalCacheFlag),
 	MP_(numpyFlag),
+	MP_(persistentFlag),
 	MP_(restartFileFlag),
 	MP_(templateReplace),
 	MP_(useWorkdir),
@@ -7029,11 +7041,13 @@ static int
 	MP_(analysisServers),
 	MP_(asynchLocalAnalysisConcurrency),
 	MP_(asynchLocalEvalConcurrency),
+	MP_(evalPrefetch),
 	MP_(evalServers),
 	MP_(procsPerAnalysis),
 	MP_(procsPerEval);
 
 static Real
+	MP_(evalCacheMemLimit),
 	MP_(nearbyEvalCacheTol);
 
 #undef MP3
@@ -7381,6 +7395,7 @@ static bool
 	MP_(calModelDiscrepancy),
 	MP_(chainDiagnostics),
 	MP_(chainDiagnosticsCI),
+	MP_(columnarStats),
 	MP_(constantPenalty),
 	MP_(crossValidation),
 	MP_(crossValidNoiseOnly),
@@ -7405,6 +7420,7 @@ static bool
         MP_(modelEvidence),
         MP_(modelEvidLaplace),
         MP_(modelEvidMC),
+        MP_(modelEvidIS),
 	MP_(mutualInfoKSG2),
 	MP_(mutationAdaptive),
 	MP_(normalizedCoeffs),
@@ -7512,6 +7528,7 @@ static int
 
 static size_t
 	MP_(collocationPoints),
+	MP_(concurrentMPPSearches),
         MP_(expansionSamples),
         MP_(kickRank),
         MP_(maxCVRankCandidates),
@@ -7528,6 +7545,7 @@ static size_t
 	MP_(numOffspring),
 	MP_(numParents),
 	MP_(numPredConfigs),
+	MP_(quantileSketchSize),
 	MP_(rCondBestThrottle),
 	//MP_(startOrder),
 	MP_(startRank);
@@ -8151,6 +8169,8 @@ static IntSet
 
 static IntVector
 	MP_(fieldLengths),
+	MP_(jacSparsityFns),
+	MP_(jacSparsityVars),
 	MP_(numCoordsPerField);
 
 static RealVector
@@ -8208,6 +8228,7 @@ static bool
 	MP_(centralHess),
 	MP_(interpolateFlag),
         MP_(ignoreBounds),
+        MP_(jacSparsityDetect),
         MP_(readFieldCoords);
 
 static size_t
@@ -537,32 +537,28 @@ namespace Dakota
 
 		#if defined(HAVE_MORSE_SMALE) && defined(HAVE_DIONYSUS)
 		emulEvalScores.resize(numEmulEval);
-		double *temp_x = NULL;
-
-		if(numEmulEval > 0)
-			temp_x = new double[gpCvars[0].length()+1];
-
-
-		for (int i = 0; i < numEmulEval; i++)
+		if (numEmulEval == 0)
+			return;
+
+		// candidates are scored concurrently against the (read-only) AMSC
+		int dim = gpCvars[0].length();
+		std::vector<double> candidates(numEmulEval*(dim+1));
+		std::vector<double> scores(numEmulEval);
+		for (int respFnCount = 0; respFnCount < numFunctions; respFnCount++)
 		{
-
-			for(int d = 0; d < gpCvars[i].length(); d++)
-			{
-				temp_x[d] = gpCvars[i][d];
-			}
-
-			Real max_score;
-			for (int respFnCount = 0; respFnCount < numFunctions; respFnCount++)
+			for (int i = 0; i < numEmulEval; i++)
 			{
-				temp_x[gpCvars[i].length()] = gpMeans[i][respFnCount];
-				Real score = ScoreTOPOB((*AMSC), temp_x);
-				if (respFnCount == 0 || score > max_score) max_score = score;
+				for(int d = 0; d < dim; d++)
+					candidates[i*(dim+1)+d] = gpCvars[i][d];
+				candidates[i*(dim+1)+dim] = gpMeans[i][respFnCount];
 			}
-			emulEvalScores(i) = max_score;
+			ScoreCandidates(*AMSC, ScoreTOPOB, candidates.data(), dim,
+					numEmulEval, scores.data());
+			for (int i = 0; i < numEmulEval; i++)
+				if (respFnCount == 0 || scores[i] > emulEvalScores(i))
+					emulEvalScores(i) = scores[i];
 		}
 
-		delete [] temp_x;
-
 		#else
 	  	  #ifdef HAVE_MORSE_SMALE
 			Cout << "Dionysus library not enabled, therefore cannot compute the "
@@ -1077,18 +1073,19 @@ void NonDAdaptiveSampling::calc_score_topo_avg_persistence(int respFnCount)
 
 #ifdef HAVE_MORSE_SMALE
   emulEvalScores.resize(numEmulEval);
+  if (numEmulEval == 0)
+    return;
 
-  double *temp_x = NULL;
-  if(numEmulEval > 0)
-    temp_x = new double[gpCvars[0].length()+1];
-
+  // candidates are scored concurrently against the (read-only) AMSC
+  int dim = gpCvars[0].length();
+  std::vector<double> candidates(numEmulEval*(dim+1));
   for (int i = 0; i<numEmulEval; i++) {   
-    for(int d = 0; d < gpCvars[i].length(); d++)
-        temp_x[d] = gpCvars[i][d];
-    temp_x[gpCvars[i].length()] = gpMeans[i][respFnCount];
-    emulEvalScores(i) = ScoreTOPOP((*AMSC), temp_x);
-  }    
-  delete [] temp_x;
+    for(int d = 0; d < dim; d++)
+      candidates[i*(dim+1)+d] = gpCvars[i][d];
+    candidates[i*(dim+1)+dim] = gpMeans[i][respFnCount];
+  }
+  ScoreCandidates(*AMSC, ScoreTOPOP, candidates.data(), dim, numEmulEval,
+                  emulEvalScores.values());
 #else
   Cout << "ANN library not enabled, therefore cannot compute approximate "
        << "Morse-Smale complex or avg_persistence score, setting all scores to " 
@@ -1101,27 +1098,30 @@ void NonDAdaptiveSampling::calc_score_topo_alm_hybrid(int respFnCount)
 { 
 #ifdef HAVE_MORSE_SMALE
   emulEvalScores.resize(numEmulEval);
-  double *temp_x = NULL;
-  if(numEmulEval > 0)
-    temp_x = new double[gpCvars[0].length()+1];
+  if (numEmulEval == 0)
+    return;
 
+  // the GP variances are evaluated first; the candidates (mean and mean
+  // plus/minus one standard deviation) are then scored concurrently
+  // against the (read-only) AMSC
+  int dim = gpCvars[0].length();
+  std::vector<double> candidates(3*numEmulEval*(dim+1));
   for (int i = 0; i<numEmulEval; i++) {
-    for(int d = 0; d < gpCvars[i].length(); d++)
-        temp_x[d] = gpCvars[i][d];
-    temp_x[gpCvars[i].length()] = gpMeans[i][respFnCount];
-
-    Real score_val = ScoreTOPOP((*AMSC), temp_x);
-
 	  ModelUtils::continuous_variables(*gpModel, gpCvars[i]);
-    temp_x[gpCvars[i].length()] = gpMeans[i][respFnCount] 
-      + sqrt(gpModel->approximation_variances(gpModel->current_variables())[respFnCount]);
-    Real score_val_plus_std = ScoreTOPOP((*AMSC), temp_x);
-    temp_x[gpCvars[i].length()] = gpMeans[i][respFnCount] 
-      - sqrt(gpModel->approximation_variances(gpModel->current_variables())[respFnCount]);
-    Real score_val_minus_std = ScoreTOPOP((*AMSC), temp_x);
-    emulEvalScores(i) = (score_val + score_val_plus_std + score_val_minus_std) / 3.;
-  }    
-  delete [] temp_x;
+    Real std_dev =
+      sqrt(gpModel->approximation_variances(gpModel->current_variables())[respFnCount]);
+    for (int j = 0; j < 3; j++) {
+      double *x = &candidates[(3*i+j)*(dim+1)];
+      for(int d = 0; d < dim; d++)
+        x[d] = gpCvars[i][d];
+      x[dim] = gpMeans[i][respFnCount] + (j - 1) * std_dev;
+    }
+  }
+  std::vector<double> scores(3*numEmulEval);
+  ScoreCandidates(*AMSC, ScoreTOPOP, candidates.data(), dim, 3*numEmulEval,
+                  scores.data());
+  for (int i = 0; i<numEmulEval; i++)
+    emulEvalScores(i) = (scores[3*i+1] + scores[3*i+2] + scores[3*i]) / 3.;
 #else
   Cout << "ANN library not enabled, therefore cannot compute approximate "
        << "Morse-Smale complex or hybrid score, setting all scores to " 
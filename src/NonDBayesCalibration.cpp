@@ -125,6 +125,7 @@ NonDBayesCalibration(ProblemDescDB& problem_db, ParallelLibrary& parallel_lib, s
   calModelEvidence(probDescDB.get_bool("method.model_evidence")),
   calModelEvidMC(probDescDB.get_bool("method.mc_approx")),
   calModelEvidLaplace(probDescDB.get_bool("method.laplace_approx")),
+  calModelEvidIS(probDescDB.get_bool("method.is_approx")),
   evidenceSamples(probDescDB.get_int("method.evidence_samples")),
   subSamplingPeriod(probDescDB.get_int("method.sub_sampling_period")),
   exportMCMCFilename(
@@ -2956,33 +2957,47 @@ calculate_kde()
   
 }
 
+/** Adds exp(log_w) to the running sum exp(max_log_w) * sum_w, rescaling
+    so that no term exceeds one.  Terms with log_w = -inf contribute zero. */
+static void
+accumulate_log_sum_exp(Real log_w, Real& max_log_w, Real& sum_w)
+{
+  if (log_w == -std::numeric_limits<Real>::infinity())
+    return;
+  if (log_w > max_log_w) {
+    sum_w = sum_w * std::exp(max_log_w - log_w) + 1.;
+    max_log_w = log_w;
+  }
+  else
+    sum_w += std::exp(log_w - max_log_w);
+}
+
+
 void NonDBayesCalibration::calculate_evidence()
 {
-  // set default to MC approximation if neither method specified
-  if (!calModelEvidMC && !calModelEvidLaplace)
+  // set default to MC approximation if no method specified
+  if (!calModelEvidMC && !calModelEvidLaplace && !calModelEvidIS)
+    calModelEvidMC = true;
+  int num_evid_samples = (evidenceSamples>0) ? evidenceSamples : chainSamples;
+  if (calModelEvidIS && !importance_sampling_evidence(num_evid_samples)) {
+    Cerr << "Warning: importance sampling of model evidence unavailable; "
+	 << "using Monte Carlo approximation." << std::endl;
     calModelEvidMC = true;
+  }
   if (calModelEvidMC) {
-    //int num_prior_samples = chainSamples; //KAM: replace later
-    int num_prior_samples = (evidenceSamples>0) ? evidenceSamples : chainSamples;
     int num_params = numContinuousVars + numHyperparams;
     // Draw samples from prior distribution 
-    RealMatrix prior_dist_samples(num_params, num_prior_samples);
+    RealMatrix prior_dist_samples(num_params, num_evid_samples);
     prior_sample_matrix(prior_dist_samples);
-    // Calculate likelihood for each sample
-    double sum_like = 0.;
-    for (int i = 0; i < num_prior_samples; i++) {
-      RealVector params = Teuchos::getCol(Teuchos::View, prior_dist_samples, i);
-      RealVector cont_params = params;
-      cont_params.resize(numContinuousVars);  
-      ModelUtils::continuous_variables(*residualModel, cont_params);
-      residualModel->evaluate();
-      RealVector residual = residualModel->current_response().function_values();
-      double log_like = log_likelihood(residual, params);
-      sum_like += std::exp(log_like);
-    }
-    double evidence = sum_like/num_prior_samples;
-    Cout << "Model evidence (Monte Carlo) = " << evidence << '\n';
-    //Cout << "num samples = " << num_prior_samples << '\n';
+    // Average the likelihood of the samples in log space, since the
+    // likelihood itself underflows for informative data
+    Real max_log_like = -std::numeric_limits<Real>::infinity(), sum_like = 0.;
+    accumulate_log_evidence(prior_dist_samples, RealVector(), max_log_like,
+			    sum_like);
+    Real log_evidence = max_log_like + std::log(sum_like)
+      - std::log((Real)num_evid_samples);
+    Cout << "Model evidence (Monte Carlo) = " << std::exp(log_evidence)
+	 << "\nLog model evidence (Monte Carlo) = " << log_evidence << '\n';
   }
   if (calModelEvidLaplace) {
     if (obsErrorMultiplierMode > CALIBRATE_NONE) {
@@ -3306,6 +3321,190 @@ void NonDBayesCalibration::kl_post_prior(RealMatrix& acceptanceChain)
   kl_est = knn_kl_div(knn_post_samples, prior_dist_samples, numContinuousVars);
 }
 
+/** Evaluates the likelihood at each column of samples (active continuous
+    variables followed by hyper-parameters) and accumulates exp(log
+    likelihood + log_offsets[i]) into the running log-sum-exp (max_log_w,
+    sum_w).  Samples with a log offset of -inf are not evaluated.  When
+    residualModel supports asynchronous evaluation, each batch is
+    scheduled with evaluate_nowait() and collected with synchronize();
+    batches bound the number of responses held at once. */
+void NonDBayesCalibration::
+accumulate_log_evidence(const RealMatrix& samples, const RealVector& log_offsets,
+			Real& max_log_w, Real& sum_w)
+{
+  int i, num_samples = samples.numCols(), num_params = samples.numRows(),
+    batch_size = std::max(residualModel->evaluation_capacity(), 1000);
+  bool asynch_flag = residualModel->asynch_flag(),
+    offsets = !log_offsets.empty();
+  IntArray batch_samples;
+  for (int b_start=0; b_start<num_samples; b_start+=batch_size) {
+    int b_end = std::min(b_start + batch_size, num_samples);
+    batch_samples.clear();
+    for (i=b_start; i<b_end; ++i) {
+      if (offsets &&
+	  log_offsets[i] == -std::numeric_limits<Real>::infinity())
+	continue;
+      // hyper-parameters are trailing variables of residualModel, which
+      // scales the residuals by the error multipliers
+      RealVector params(Teuchos::View, const_cast<Real*>(samples[i]),
+			num_params);
+      ModelUtils::continuous_variables(*residualModel, params);
+      if (asynch_flag) {
+	residualModel->evaluate_nowait();
+	batch_samples.push_back(i);
+      }
+      else {
+	residualModel->evaluate();
+	Real log_w = log_likelihood(
+	  residualModel->current_response().function_values(), params);
+	accumulate_log_sum_exp((offsets) ? log_w + log_offsets[i] : log_w,
+			       max_log_w, sum_w);
+      }
+    }
+    if (!batch_samples.empty()) {
+      // responses are ordered by evaluation id, i.e., by submission
+      const IntResponseMap& resp_map = residualModel->synchronize();
+      size_t j = 0;
+      for (IntRespMCIter r_it=resp_map.begin(); r_it!=resp_map.end();
+	   ++r_it, ++j) {
+	i = batch_samples[j];
+	RealVector params(Teuchos::View, const_cast<Real*>(samples[i]),
+			  num_params);
+	Real log_w = log_likelihood(r_it->second.function_values(), params);
+	accumulate_log_sum_exp((offsets) ? log_w + log_offsets[i] : log_w,
+			       max_log_w, sum_w);
+      }
+    }
+  }
+}
+
+
+/** Importance sampling estimate of the model evidence, using as proposal
+    the defensive mixture q = a prior + (1-a) N(mu, Sigma), where mu and
+    Sigma are the mean and covariance of the posterior chain in the space
+    of residualModel.  The prior component bounds the weights prior/q by
+    1/a in the tails the Gaussian underrepresents.  Returns false if the
+    chain does not define a proposal. */
+bool NonDBayesCalibration::importance_sampling_evidence(int num_samples)
+{
+  int i, j, k, num_params = numContinuousVars + numHyperparams,
+    num_chain = acceptanceChain.numCols();
+  if (num_chain <= num_params)
+    return false;
+
+  // the chain is stored in user space; map it to the space of the prior
+  RealMatrix chain(num_params, num_chain, false);
+  for (k=0; k<num_chain; ++k) {
+    if (standardizedSpace) {
+      RealVector x_rv(Teuchos::View, acceptanceChain[k], numContinuousVars),
+	u_rv;
+      mcmcModel->trans_X_to_U(x_rv, u_rv);
+      for (i=0; i<numContinuousVars; ++i)
+	chain(i,k) = u_rv[i];
+    }
+    else
+      for (i=0; i<numContinuousVars; ++i)
+	chain(i,k) = acceptanceChain(i,k);
+    for (i=numContinuousVars; i<num_params; ++i)
+      chain(i,k) = acceptanceChain(i,k);
+  }
+
+  // Gaussian component: chain mean and Cholesky factor of chain covariance
+  RealVector mean(num_params);
+  for (k=0; k<num_chain; ++k)
+    for (i=0; i<num_params; ++i)
+      mean[i] += chain(i,k);
+  mean.scale(1./num_chain);
+  RealSymMatrix cov(num_params);
+  for (k=0; k<num_chain; ++k)
+    for (i=0; i<num_params; ++i) {
+      Real d_i = chain(i,k) - mean[i];
+      for (j=0; j<=i; ++j)
+	cov(i,j) += d_i * (chain(j,k) - mean[j]);
+    }
+  for (i=0; i<num_params; ++i)
+    for (j=0; j<=i; ++j)
+      cov(j,i) = cov(i,j) /= (num_chain - 1);
+  Teuchos::SerialSpdDenseSolver<int, Real> cov_solver;
+  cov_solver.setMatrix(Teuchos::rcp(&cov, false));
+  if (cov_solver.factor()) // not positive definite
+    return false;
+  // factor() overwrites the upper triangle with U = L^T
+  RealMatrix chol(num_params, num_params);
+  Real log_det = 0.;
+  for (i=0; i<num_params; ++i) {
+    for (j=0; j<=i; ++j)
+      chol(i,j) = cov(j,i);
+    log_det += 2. * std::log(chol(i,i));
+  }
+  const Real defensive_wt = 0.1,
+    log_norm = -num_params * HALF_LOG_2PI - .5 * log_det;
+
+  // sample the mixture; weights vanish outside the support of the prior
+  const RealVector& l_bnds = ModelUtils::continuous_lower_bounds(*residualModel);
+  const RealVector& u_bnds = ModelUtils::continuous_upper_bounds(*residualModel);
+  boost::mt19937 rnumGenerator;
+  rnumGenerator.seed(randomSeed);
+  boost::uniform_real<Real> mix_dist(0., 1.);
+  boost::normal_distribution<Real> std_normal(0., 1.);
+  RealMatrix samples(num_params, num_samples, false);
+  RealVector log_offsets(num_samples, false), theta(num_params, false),
+    z(num_params, false);
+  for (k=0; k<num_samples; ++k) {
+    if (mix_dist(rnumGenerator) < defensive_wt)
+      prior_sample(rnumGenerator, theta);
+    else {
+      for (i=0; i<num_params; ++i)
+	z[i] = std_normal(rnumGenerator);
+      for (i=0; i<num_params; ++i) {
+	theta[i] = mean[i];
+	for (j=0; j<=i; ++j)
+	  theta[i] += chol(i,j) * z[j];
+      }
+    }
+    Teuchos::setCol(theta, k, samples);
+
+    // calibration parameters within their bounds and hyperparameters
+    // (inverse gamma distributed) positive
+    bool in_support = true;
+    for (i=0; i<numContinuousVars; ++i)
+      if (theta[i] < l_bnds[i] || theta[i] > u_bnds[i])
+	{ in_support = false; break; }
+    for (i=numContinuousVars; in_support && i<num_params; ++i)
+      if (theta[i] <= 0.)
+	in_support = false;
+    if (!in_support)
+      { log_offsets[k] = -std::numeric_limits<Real>::infinity(); continue; }
+
+    // Mahalanobis distance of theta by forward substitution
+    Real sum_sq = 0.;
+    for (i=0; i<num_params; ++i) {
+      z[i] = theta[i] - mean[i];
+      for (j=0; j<i; ++j)
+	z[i] -= chol(i,j) * z[j];
+      z[i] /= chol(i,i);
+      sum_sq += z[i] * z[i];
+    }
+    Real log_prior = log_prior_density(theta),
+      log_prior_comp = std::log(defensive_wt) + log_prior,
+      log_gauss_comp = std::log(1. - defensive_wt) + log_norm - .5 * sum_sq,
+      max_comp = std::max(log_prior_comp, log_gauss_comp),
+      log_q = max_comp + std::log(std::exp(log_prior_comp - max_comp) +
+				  std::exp(log_gauss_comp - max_comp));
+    log_offsets[k] = log_prior - log_q;
+  }
+
+  Real max_log_w = -std::numeric_limits<Real>::infinity(), sum_w = 0.;
+  accumulate_log_evidence(samples, log_offsets, max_log_w, sum_w);
+  Real log_evidence = max_log_w + std::log(sum_w)
+    - std::log((Real)num_samples);
+  Cout << "Model evidence (importance sampling) = " << std::exp(log_evidence)
+       << "\nLog model evidence (importance sampling) = " << log_evidence
+       << '\n';
+  return true;
+}
+
+
 void NonDBayesCalibration::prior_sample_matrix(RealMatrix& prior_dist_samples)
 {
   // Create matrix containing samples from the prior distribution
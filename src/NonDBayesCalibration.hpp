@@ -218,6 +218,14 @@ protected:
   void calculate_kde();
   /// calculate the model evidence
   void calculate_evidence();
+  /// accumulate the likelihoods of the samples, scaled by the exponentials
+  /// of log_offsets (if not empty), into a running log-sum-exp
+  void accumulate_log_evidence(const RealMatrix& samples,
+			       const RealVector& log_offsets,
+			       Real& max_log_w, Real& sum_w);
+  /// estimate the model evidence by importance sampling with a proposal
+  /// fit to the posterior chain; false if no proposal can be formed
+  bool importance_sampling_evidence(int num_samples);
 
   void extract_selected_posterior_samples(const std::vector<int> &points_to_keep,
 					  const RealMatrix &samples_for_posterior_eval, 
@@ -444,6 +452,9 @@ protected:
   bool calModelEvidMC;
   /// flag indicating use of Laplace approximation to calculate evidence
   bool calModelEvidLaplace;
+  /// flag indicating use of importance sampling from the posterior chain
+  /// to calculate evidence
+  bool calModelEvidIS;
   /// number of samples to be used in model evidence calculation
   int evidenceSamples;
   /// flag indicating usage of adaptive posterior refinement; currently makes
@@ -18,6 +18,9 @@
 #include "ActiveKey.hpp"
 #include "SharedPolyApproxData.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 static const char rcsId[]="@(#) $Id: NonDGenACVSampling.cpp 7035 2010-10-22 21:45:39Z mseldre $";
 
 namespace Dakota {
@@ -723,33 +726,7 @@ void NonDGenACVSampling::generalized_acv_online_pilot()
     bool no_solve = precompute_allocations(); // independent of DAG
     if (no_solve) no_solve_solution();
     else {
-      for (activeModelSetIter  = modelDAGs.begin();
-	   activeModelSetIter != modelDAGs.end(); ++activeModelSetIter) {
-	const UShortArray& approx_set = activeModelSetIter->first;
-	const UShortArraySet& dag_set = activeModelSetIter->second;
-	soln_key.first = approx_set;
-	for (activeDAGIter  = dag_set.begin();
-	     activeDAGIter != dag_set.end(); ++activeDAGIter) {
-	  // sample set definitions are enabled by reversing the DAG direction:
-	  const UShortArray& active_dag = *activeDAGIter;
-	  soln_key.second  = active_dag;
-	  if (outputLevel >= QUIET_OUTPUT) {
-	    Cout << "Evaluating active DAG:\n";
-	    print_dag(active_dag, approx_set);
-	  }
-	  generate_reverse_dag(approx_set, active_dag);
-	  // Use default ordering in root list, prior to final eval ratios soln.
-	  // Sufficient for finding best DAG, but not for approx_increments().
-	  unroll_reverse_dag_from_root(numApprox, orderedRootList);
-	  // compute the LF/HF evaluation ratios from shared samples and compute
-	  // ratio of MC and ACV mean sq errors (which incorporates anticipated
-	  // variance reduction from application of avg_eval_ratios).
-	  MFSolutionData& soln = dagSolns[soln_key];
-	  compute_allocations(soln);
-	  update_best(soln);// store state for restoration
-	  //reset_acv(); // reset state for next ACV execution
-	}
-      }
+      search_model_sets_dags();
 
       print_best();
       soln_key.first  =  bestModelSetIter->first;
@@ -822,33 +799,7 @@ void NonDGenACVSampling::generalized_acv_offline_pilot()
 
   // no need for "no_solve" logic in offline case
   precompute_allocations(); // metrics not dependent on DAG
-  for (activeModelSetIter  = modelDAGs.begin();
-       activeModelSetIter != modelDAGs.end(); ++activeModelSetIter) {
-    const UShortArray& approx_set = activeModelSetIter->first;
-    const UShortArraySet& dag_set = activeModelSetIter->second;
-    soln_key.first = approx_set;
-    for (activeDAGIter  = dag_set.begin();
-	 activeDAGIter != dag_set.end(); ++activeDAGIter) {
-      // sample set definitions are enabled by reversing the DAG direction:
-      const UShortArray& active_dag = *activeDAGIter;
-      soln_key.second  = active_dag;
-      if (outputLevel >= QUIET_OUTPUT) {
-	Cout << "Evaluating active DAG:\n";
-	print_dag(active_dag, approx_set);
-      }
-      generate_reverse_dag(approx_set, active_dag);
-      // Use default ordering in root list, prior to final eval ratios soln.
-      // Sufficient for finding best DAG, but not for approx_increments().
-      unroll_reverse_dag_from_root(numApprox, orderedRootList);
-      // compute the LF/HF evaluation ratios from shared samples and compute
-      // ratio of MC and ACV mean sq errors (which incorporates anticipated
-      // variance reduction from application of avg_eval_ratios).
-      MFSolutionData& soln = dagSolns[soln_key];
-      compute_allocations(soln);
-      update_best(soln); // store state for restoration
-      //reset_acv(); // reset state for next ACV execution
-    }
-  }
+  search_model_sets_dags();
   print_best();  restore_best();  ++mlmfIter;
 
   // -----------------------------------
@@ -927,33 +878,7 @@ void NonDGenACVSampling::generalized_acv_pilot_projection()
   bool no_solve = precompute_allocations(); // independent of DAG
   if (no_solve) no_solve_solution();
   else {
-    for (activeModelSetIter  = modelDAGs.begin();
-	 activeModelSetIter != modelDAGs.end(); ++activeModelSetIter) {
-      const UShortArray&  approx_set = activeModelSetIter->first;
-      const UShortArraySet& dag_set = activeModelSetIter->second;
-      soln_key.first = approx_set;
-      for (activeDAGIter  = dag_set.begin();
-	   activeDAGIter != dag_set.end(); ++activeDAGIter) {
-	// sample set definitions are enabled by reversing the DAG direction:
-	const UShortArray& active_dag = *activeDAGIter;
-	soln_key.second  = active_dag;
-	if (outputLevel >= QUIET_OUTPUT) {
-	  Cout << "Evaluating active DAG:\n";
-	  print_dag(active_dag, approx_set);
-	}
-	generate_reverse_dag(approx_set, active_dag);
-	// Use default ordering in root list, prior to final eval ratios soln.
-	// Sufficient for finding best DAG, but not for approx_increments().
-	unroll_reverse_dag_from_root(numApprox, orderedRootList);
-	// compute the LF/HF evaluation ratios from shared samples and compute
-	// ratio of MC and ACV mean sq errors (which incorporates anticipated
-	// variance reduction from application of avg_eval_ratios).
-	MFSolutionData& soln = dagSolns[soln_key];
-	compute_allocations(soln);
-	update_best(soln); // store state for restoration
-	//reset_acv(); // reset state for next ACV execution
-      }
-    }
+    search_model_sets_dags();
     print_best();  ++mlmfIter;
   }
   restore_best();
@@ -1237,6 +1162,140 @@ void NonDGenACVSampling::compute_allocations(MFSolutionData& soln)
 }
 
 
+/** Model subsets are visited in increasing order of the lower bound from
+    model_set_merit_lower_bound(), such that a good incumbent is found
+    early and the DAGs of any subset whose bound cannot improve on it are
+    skipped (at debug output, they are solved to verify the bound).  The
+    numerical solves share the optimizer instances and their static
+    callbacks, so they remain sequential. */
+void NonDGenACVSampling::search_model_sets_dags()
+{
+  typedef std::map<UShortArray, UShortArraySet>::const_iterator ModelSetIter;
+  std::vector<std::pair<Real, ModelSetIter> > ordered_sets;
+  ordered_sets.reserve(modelDAGs.size());
+  for (activeModelSetIter  = modelDAGs.begin();
+       activeModelSetIter != modelDAGs.end(); ++activeModelSetIter)
+    ordered_sets.push_back(std::make_pair(model_set_merit_lower_bound(),
+					  activeModelSetIter));
+  std::stable_sort(ordered_sets.begin(), ordered_sets.end(),
+    [](const std::pair<Real, ModelSetIter>& a,
+       const std::pair<Real, ModelSetIter>& b) { return a.first < b.first; });
+
+  std::pair<UShortArray, UShortArray> soln_key;
+  size_t i, num_sets = ordered_sets.size(), num_solved = 0, num_pruned = 0;
+  Real total_time = 0.;
+  for (i=0; i<num_sets; ++i) {
+    activeModelSetIter = ordered_sets[i].second;
+    const UShortArray& approx_set = activeModelSetIter->first;
+    const UShortArraySet& dag_set = activeModelSetIter->second;
+    Real merit_lower_bnd = ordered_sets[i].first;
+    bool prune = (merit_lower_bnd >= meritFnStar); // no DAG can become best
+    if (prune) {
+      if (outputLevel < DEBUG_OUTPUT)
+	{ num_pruned += dag_set.size();  continue; }
+      // debug output solves the pruned DAGs to verify the bound
+      Cout << "Verifying " << dag_set.size() << " DAGs with merit lower bound "
+	   << merit_lower_bnd << " >= best merit " << meritFnStar
+	   << " for approximation set:\n" << approx_set << std::endl;
+    }
+    soln_key.first = approx_set;
+    for (activeDAGIter  = dag_set.begin();
+	 activeDAGIter != dag_set.end(); ++activeDAGIter) {
+      // sample set definitions are enabled by reversing the DAG direction:
+      const UShortArray& active_dag = *activeDAGIter;
+      soln_key.second  = active_dag;
+      if (outputLevel >= QUIET_OUTPUT) {
+	Cout << "Evaluating active DAG:\n";
+	print_dag(active_dag, approx_set);
+      }
+      auto start = std::chrono::steady_clock::now();
+      generate_reverse_dag(approx_set, active_dag);
+      // Use default ordering in root list, prior to final eval ratios soln.
+      // Sufficient for finding best DAG, but not for approx_increments().
+      unroll_reverse_dag_from_root(numApprox, orderedRootList);
+      // compute the LF/HF evaluation ratios from shared samples and compute
+      // ratio of MC and ACV mean sq errors (which incorporates anticipated
+      // variance reduction from application of avg_eval_ratios).
+      MFSolutionData& soln = dagSolns[soln_key];
+      compute_allocations(soln);
+      if (prune && valid_variances(soln.estimator_variances()) &&
+	  nh_penalty_merit(soln) < merit_lower_bnd)
+	Cerr << "Warning: DAG merit " << nh_penalty_merit(soln) << " is below "
+	     << "its lower bound " << merit_lower_bnd << "." << std::endl;
+      update_best(soln); // store state for restoration
+      //reset_acv(); // reset state for next ACV execution
+      Real solve_time = std::chrono::duration<Real>(
+	std::chrono::steady_clock::now() - start).count();
+      total_time += solve_time;  ++num_solved;
+      if (outputLevel >= VERBOSE_OUTPUT)
+	Cout << "DAG allocation solve time = " << solve_time << " seconds\n";
+    }
+  }
+  activeModelSetIter = modelDAGs.end(); // as for a full sweep
+
+  if (outputLevel >= VERBOSE_OUTPUT)
+    Cout << "\nDAG search: " << num_solved << " allocation solves in "
+	 << total_time << " seconds; " << num_pruned << " DAGs skipped by "
+	 << "merit bound.\n";
+}
+
+
+/** For the budget-constrained formulations, the estimator variance of
+    any DAG over a model subset S is bounded below by that of the optimal
+    control variate, var_H (1 - R^2_{H|S}) / N_H, where R^2_{H|S} is the
+    squared multiple correlation of the truth with the approximations in S
+    and N_H is limited by the active budget.  Returns -DBL_MAX when no
+    bound applies. */
+Real NonDGenACVSampling::model_set_merit_lower_bound()
+{
+  // merit is the equivalent cost for the accuracy-constrained formulations
+  if (optSubProblemForm == N_MODEL_LINEAR_OBJECTIVE ||
+      optSubProblemForm == N_GROUP_LINEAR_OBJECTIVE ||
+      covLL.size() != numFunctions || covLH.size() != numFunctions)
+    return -DBL_MAX;
+
+  const UShortArray& approx_set = activeModelSetIter->first;
+  int i, j, num_approx = approx_set.size();
+  // allow for the constraint tolerance and penalty in nh_penalty_merit()
+  Real N_H_max = (active_budget() + 1.) * 1.001;
+  RealVector ocv_ratios(numFunctions, false), ocv_estvar(numFunctions, false);
+  for (size_t qoi=0; qoi<numFunctions; ++qoi) {
+    const RealSymMatrix& cov_LL_q = covLL[qoi];
+    const RealVector&    cov_LH_q = covLH[qoi];
+    Real var_H_q = varH[qoi];
+    if (var_H_q <= 0.) return -DBL_MAX;
+
+    RealSymMatrix cov_SS(num_approx, false);
+    RealMatrix cov_SH(num_approx, 1, false), x(num_approx, 1, false);
+    for (i=0; i<num_approx; ++i) {
+      cov_SH(i,0) = cov_LH_q[approx_set[i]];
+      for (j=0; j<=i; ++j)
+	cov_SS(i,j) = cov_SS(j,i) = cov_LL_q(approx_set[i], approx_set[j]);
+    }
+    // an ill-conditioned covariance could understate R^2 --> no bound
+    RealSpdSolver spd_solver;
+    spd_solver.setMatrix(Teuchos::rcp(&cov_SS, false));
+    spd_solver.setVectors(Teuchos::rcp(&x, false),
+			  Teuchos::rcp(&cov_SH, false));
+    Real rcond;
+    if (spd_solver.factor() ||
+	spd_solver.reciprocalConditionEstimate(rcond) ||
+	rcond < std::sqrt(DBL_EPSILON) || spd_solver.solve())
+      return -DBL_MAX;
+    Real R_sq = 0.;
+    for (i=0; i<num_approx; ++i)
+      R_sq += cov_LH_q[approx_set[i]] * x(i,0);
+    ocv_ratios[qoi] = std::max(1. - R_sq / var_H_q, 0.);
+    ocv_estvar[qoi] = var_H_q * ocv_ratios[qoi] / N_H_max;
+  }
+
+  Real metric_lb;  size_t metric_index;
+  MFSolutionData::update_estimator_variance_metric(estVarMetricType,
+    estVarMetricNormOrder, ocv_ratios, ocv_estvar, metric_lb, metric_index);
+  return (metric_lb > 0.) ? std::log(metric_lb) : -DBL_MAX;
+}
+
+
 void NonDGenACVSampling::
 analytic_initialization_from_mfmc(const UShortArray& approx_set,
 				  const RealMatrix& rho2_LH,
@@ -167,6 +167,11 @@ private:
 
   bool precompute_allocations();
   void compute_allocations(MFSolutionData& solution);
+  /// numerical solutions for the DAGs of each model subset, tracking the
+  /// best through update_best() and pruning subsets by merit bound
+  void search_model_sets_dags();
+  /// lower bound on the merit of any DAG over the active model subset
+  Real model_set_merit_lower_bound();
 
   void genacv_raw_moments(const IntRealMatrixMap& sum_L_covar,
 			  const IntRealVectorMap& sum_H_covar,
@@ -669,6 +669,14 @@ void NonDLHSSampling::post_input()
     statistics on the set of responses if statsFlag is set. */
 void NonDLHSSampling::core_run()
 {
+  if (columnar_statistics()) {
+    evaluate_columnar_samples(*iteratedModel);
+    return;
+  }
+  else if (columnarStats)
+    Cerr << "Warning: columnar_statistics is not supported for the requested "
+	 << "results; storing all\n         response samples.\n";
+
   bool log_resp_flag = (allDataFlag || statsFlag);
   bool log_best_flag = !numResponseFunctions; // DACE mode w/ opt or NLS
   evaluate_parameter_sets(*iteratedModel, log_resp_flag, log_best_flag);
@@ -678,6 +686,13 @@ void NonDLHSSampling::core_run()
   //store_evaluations(); 
 }
 
+bool NonDLHSSampling::columnar_statistics() const
+{
+  return NonDSampling::columnar_statistics() && numResponseFunctions &&
+    !pcaFlag && !vbdFlag && refineSamples.empty();
+}
+
+
 void NonDLHSSampling::store_evaluations(){
   int eval_index = 0; //qoiSamplesMatrix.numCols(); //old size
   qoiSamplesMatrix.reshape(numFunctions, numSamples);
@@ -96,6 +96,9 @@ public:
   /// print the final statistics
   void print_results(std::ostream& s, short results_state = FINAL_RESULTS) override;
 
+  /// also excludes PCA, VBD, and incremental (refinement) sampling
+  bool columnar_statistics() const override;
+
   //
   //- Heading: Member functions
   //
@@ -51,7 +51,10 @@ NonDLocalReliability(ProblemDescDB& problem_db, ParallelLibrary& parallel_lib, s
     probDescDB.get_bool("variables.uncertain.initial_point_flag")),
   npsolFlag(false), warmStartFlag(true), nipModeOverrideFlag(true),
   curvatureDataAvailable(false), kappaUpdated(false),
-  secondOrderIntType(HOHENRACK), curvatureThresh(1.e-10), warningBits(0)
+  secondOrderIntType(HOHENRACK), curvatureThresh(1.e-10),
+  concurrentMPPSearches(
+    probDescDB.get_sizet("method.nond.concurrent_mpp_searches")),
+  warningBits(0)
 {
   bool err_flag = false;
 
@@ -156,6 +159,22 @@ NonDLocalReliability(ProblemDescDB& problem_db, ParallelLibrary& parallel_lib, s
   if (err_flag)
     abort_handler(METHOD_ERROR);
 
+  // Concurrent MPP searches interleave the AMV/AMV+ iterations of different
+  // levels, such that the truth evaluations of each cycle can be scheduled
+  // together.  FORM/SORM searches iterate on the truth model within the
+  // optimizer and TANA/QMEA searches accumulate a multipoint history for
+  // each response function, so these remain sequential.
+  if (concurrentMPPSearches > 1) {
+    if (mppSearchType && mppSearchType <= SUBMETHOD_AMV_PLUS_U)
+      maxEvalConcurrency *= concurrentMPPSearches;
+    else {
+      Cerr << "\nWarning: concurrent_mpp_searches is only supported for "
+	   << "x/u_taylor_mean and x/u_taylor_mpp.\n         MPP searches "
+	   << "will be performed sequentially.\n";
+      concurrentMPPSearches = 1;
+    }
+  }
+
   // The model of the limit state in u-space (uSpaceModel) is constructed here
   // one time.  The RecastModel for the RIA/PMA formulations varies with the
   // level requests and is constructed for each level within mpp_search().
@@ -831,50 +850,18 @@ void NonDLocalReliability::mpp_search()
   // important to note that the MPP iteration is different for each response 
   // function, and it is not possible to combine the model evaluations for
   // multiple response functions.
-  size_t i;
-  const ShortArray& final_asv = finalStatistics.active_set_request_vector();
-  for (respFnCount=0; respFnCount<numFunctions; ++respFnCount) {
+  if (concurrentMPPSearches > 1) concurrent_mpp_search();
+  else for (respFnCount=0; respFnCount<numFunctions; ++respFnCount) {
 
-    if (finalMomentsType) {
-      // approximate response mean already computed
-      finalStatistics.function_value(momentStats(0,respFnCount), statCount);
-      // sensitivity of response mean
-      if (final_asv[statCount] & 2) {
-	RealVector fn_grad_mean_x(numContinuousVars, false);
-	for (i=0; i<numContinuousVars; i++)
-	  fn_grad_mean_x[i] = fnGradsMeanX(i,respFnCount);
-	// evaluate dg/ds at the variable means and store in finalStatistics
-	RealVector final_stat_grad;
-	dg_ds_eval(ranVarMeansX, fn_grad_mean_x, final_stat_grad);
-	finalStatistics.function_gradient(final_stat_grad, statCount);
-      }
-      ++statCount;
-
-      // approximate response std deviation or variance already computed
-      finalStatistics.function_value(momentStats(1,respFnCount), statCount);
-      // sensitivity of response std deviation
-      if (final_asv[statCount] & 2) {
-	// Differentiating the first-order second-moment expression leads to
-	// 2nd-order d^2g/dxds sensitivities which would be awkward to compute
-	// (nonstandard DVV containing active and inactive vars)
-	Cerr << "Error: response std deviation sensitivity not yet supported."
-	     << std::endl;
-	abort_handler(METHOD_ERROR);
-	// TO DO: back out from RIA/PMA equations (use closest level to mean?):
-	// RIA: dsigma/ds = (dmean/ds - sigma dbeta_cdf/ds) / beta_cdf
-	// PMA: dsigma/ds = (dmean/ds - dz/ds) / beta_cdf
-      }
-      ++statCount;
-    }
+    assign_moment_statistics();
 
     // The most general case is to allow a combination of response, probability,
     // reliability, and generalized reliability level specifications for each
     // response function.
-    size_t rl_len = requestedRespLevels[respFnCount].length(),
-           pl_len = requestedProbLevels[respFnCount].length(),
-           bl_len = requestedRelLevels[respFnCount].length(),
-           gl_len = requestedGenRelLevels[respFnCount].length(),
-           index, num_levels = rl_len + pl_len + bl_len + gl_len;
+    size_t num_levels = requestedRespLevels[respFnCount].length() +
+      requestedProbLevels[respFnCount].length() +
+      requestedRelLevels[respFnCount].length() +
+      requestedGenRelLevels[respFnCount].length();
 
     // Initialize (or warm-start for repeated reliability analyses) initialPtU,
     // mostProbPointX/U, computedRespLevel, fnGradX/U, and fnHessX/U.
@@ -885,57 +872,12 @@ void NonDLocalReliability::mpp_search()
     // Loop over response/probability/reliability levels
     for (levelCount=0; levelCount<num_levels; ++levelCount) {
 
-      // The rl_len response levels are performed first using the RIA
-      // formulation, followed by the pl_len probability levels and the
-      // bl_len reliability levels using the PMA formulation.
-      bool ria_flag = (levelCount < rl_len),
-	pma2_flag = ( integrationOrder == 2 && ( levelCount < rl_len + pl_len ||
-		      levelCount >= rl_len + pl_len + bl_len ) );
-      if (ria_flag) {
-        requestedTargetLevel = requestedRespLevels[respFnCount][levelCount];
-	Cout << "\n>>>>> Reliability Index Approach (RIA) for response level "
-	     << levelCount+1 << " = " << requestedTargetLevel << '\n';
-      }
-      else if (levelCount < rl_len + pl_len) { 
-	index  = levelCount - rl_len;
-	Real p = requestedProbLevels[respFnCount][index];
-	Cout << "\n>>>>> Performance Measure Approach (PMA) for probability "
-	     << "level " << index + 1 << " = " << p << '\n';
-	// gen beta target for 2nd-order PMA; beta target for 1st-order PMA:
-	requestedTargetLevel = reliability(p);
-
-	// CDF probability < 0.5  -->  CDF beta > 0  -->  minimize g
-	// CDF probability > 0.5  -->  CDF beta < 0  -->  maximize g
-	// CDF probability = 0.5  -->  CDF beta = 0  -->  compute g
-	// Note: "compute g" means that min/max is irrelevant since there is
-	// a single G(u) value when the radius beta collapses to the origin
-	Real p_cdf   = (cdfFlag) ? p : 1. - p;
-	pmaMaximizeG = (p_cdf > 0.5); // updated in update_pma_maximize()
-      }
-      else if (levelCount < rl_len + pl_len + bl_len) {
-	index = levelCount - rl_len - pl_len;
-	requestedTargetLevel = requestedRelLevels[respFnCount][index];
-	Cout << "\n>>>>> Performance Measure Approach (PMA) for reliability "
-	     << "level " << index + 1 << " = " << requestedTargetLevel << '\n';
-	Real beta_cdf = (cdfFlag) ?
-	  requestedTargetLevel : -requestedTargetLevel;
-	pmaMaximizeG = (beta_cdf < 0.);
-      }
-      else {
-	index = levelCount - rl_len - pl_len - bl_len;
-	requestedTargetLevel = requestedGenRelLevels[respFnCount][index];
-	Cout << "\n>>>>> Performance Measure Approach (PMA) for generalized "
-	     << "reliability level " << index + 1 << " = "
-	     << requestedTargetLevel << '\n';
-	Real gen_beta_cdf = (cdfFlag) ?
-	  requestedTargetLevel : -requestedTargetLevel;
-	pmaMaximizeG = (gen_beta_cdf < 0.); // updated in update_pma_maximize()
-      }
+      assign_level_target();
 
       // Assign cold/warm-start values for initialPtU, mostProbPointX/U,
       // computedRespLevel, fnGradX/U, and fnHessX/U.
       if (levelCount)
-	initialize_mpp_search_data();
+	initialize_mpp_search_data(levelCount-1);
 
 #ifdef DERIV_DEBUG
       // numerical verification of analytic Jacobian/Hessian routines
@@ -954,69 +896,11 @@ void NonDLocalReliability::mpp_search()
       approxConverged = false;
       while (!approxConverged) {
 
-	Sizet2DArray vars_map, primary_resp_map, secondary_resp_map;
-	BoolDequeArray nonlinear_resp_map(2);
-	std::shared_ptr<RecastModel> mpp_model_rep =
-	  std::static_pointer_cast<RecastModel>(mppModel);
-	if (ria_flag) { // RIA: g is in constraint
-	  primary_resp_map.resize(1);   // one objective, no contributors
-	  secondary_resp_map.resize(1); // one constraint, one contributor
-	  secondary_resp_map[0].resize(1);
-	  secondary_resp_map[0][0] = respFnCount;
-	  nonlinear_resp_map[1] = BoolDeque(1, false);
-	  mpp_model_rep->init_maps(vars_map, false, NULL, NULL,
-	    primary_resp_map, secondary_resp_map, nonlinear_resp_map,
-	    RIA_objective_eval, RIA_constraint_eval);
-	}
-	else { // PMA: g is in objective
-	  primary_resp_map.resize(1);   // one objective, one contributor
-	  primary_resp_map[0].resize(1);
-	  primary_resp_map[0][0] = respFnCount;
-	  secondary_resp_map.resize(1); // one constraint, no contributors
-	  nonlinear_resp_map[0] = BoolDeque(1, false);
-	  // If 2nd-order PMA with p-level or generalized beta-level, use
-	  // PMA2_set_mapping() & PMA2_constraint_eval().  For approx-based
-	  // 2nd-order PMA, we utilize curvature of the surrogate (if any)
-	  // to update beta* 
-	  if (pma2_flag)
-	    mpp_model_rep->init_maps(vars_map, false, NULL, PMA2_set_mapping,
-	      primary_resp_map, secondary_resp_map, nonlinear_resp_map,
-	      PMA_objective_eval, PMA2_constraint_eval);
-	  else
-	    mpp_model_rep->init_maps(vars_map, false, NULL, NULL,
-	      primary_resp_map, secondary_resp_map, nonlinear_resp_map,
-	      PMA_objective_eval, PMA_constraint_eval);	    
-	}
-	ModelUtils::continuous_variables(*mppModel, initialPtU);
-
-        // Execute MPP search and retrieve u-space results
-        Cout << "\n>>>>> Initiating search for most probable point (MPP)\n";
-	ParLevLIter pl_iter
-	  = methodPCIter->mi_parallel_level_iterator(miPLIndex);
-	mppOptimizer->run(pl_iter);
-        const Variables& vars_star = mppOptimizer->variables_results();
-        const Response&  resp_star = mppOptimizer->response_results();
-	const RealVector& fns_star = resp_star.function_values();
-        Cout << "\nResults of MPP optimization:\nInitial point (u-space) =\n"
-             << initialPtU << "Final point (u-space)   =\n"
-	     << vars_star.continuous_variables();
-	if (ria_flag)
-	  Cout << "RIA optimum             =\n                     "
-	       << std::setw(write_precision+7) << fns_star[0] << " [u'u]\n"
-	       << "                     " << std::setw(write_precision+7)
-	       << fns_star[1] << " [G(u) - z]\n";
-	else {
-	  Cout << "PMA optimum             =\n                     "
-	       << std::setw(write_precision+7) << fns_star[0] << " [";
-	  if (pmaMaximizeG) Cout << '-';
-	  Cout << "G(u)]\n                     " << std::setw(write_precision+7)
-	       << fns_star[1];
-	  if (pma2_flag) Cout << " [B* - bar-B*]\n";
-	  else           Cout << " [u'u - B^2]\n";
-	}
+	run_mpp_optimizer();
 
 	// Update MPP search data
-	update_mpp_search_data(vars_star, resp_star);
+	update_mpp_search_data(mppOptimizer->variables_results(),
+			       mppOptimizer->response_results());
 
       } // end AMV+ while loop
 
@@ -1040,6 +924,431 @@ void NonDLocalReliability::mpp_search()
 }
 
 
+void NonDLocalReliability::assign_moment_statistics()
+{
+  if (!finalMomentsType)
+    return;
+
+  const ShortArray& final_asv = finalStatistics.active_set_request_vector();
+
+  // approximate response mean already computed
+  finalStatistics.function_value(momentStats(0,respFnCount), statCount);
+  // sensitivity of response mean
+  if (final_asv[statCount] & 2) {
+    RealVector fn_grad_mean_x(numContinuousVars, false);
+    for (size_t i=0; i<numContinuousVars; i++)
+      fn_grad_mean_x[i] = fnGradsMeanX(i,respFnCount);
+    // evaluate dg/ds at the variable means and store in finalStatistics
+    RealVector final_stat_grad;
+    dg_ds_eval(ranVarMeansX, fn_grad_mean_x, final_stat_grad);
+    finalStatistics.function_gradient(final_stat_grad, statCount);
+  }
+  ++statCount;
+
+  // approximate response std deviation or variance already computed
+  finalStatistics.function_value(momentStats(1,respFnCount), statCount);
+  // sensitivity of response std deviation
+  if (final_asv[statCount] & 2) {
+    // Differentiating the first-order second-moment expression leads to
+    // 2nd-order d^2g/dxds sensitivities which would be awkward to compute
+    // (nonstandard DVV containing active and inactive vars)
+    Cerr << "Error: response std deviation sensitivity not yet supported."
+	 << std::endl;
+    abort_handler(METHOD_ERROR);
+    // TO DO: back out from RIA/PMA equations (use closest level to mean?):
+    // RIA: dsigma/ds = (dmean/ds - sigma dbeta_cdf/ds) / beta_cdf
+    // PMA: dsigma/ds = (dmean/ds - dz/ds) / beta_cdf
+  }
+  ++statCount;
+}
+
+
+void NonDLocalReliability::assign_level_target()
+{
+  // The rl_len response levels are performed first using the RIA
+  // formulation, followed by the pl_len probability levels and the
+  // bl_len reliability levels using the PMA formulation.
+  size_t rl_len = requestedRespLevels[respFnCount].length(),
+         pl_len = requestedProbLevels[respFnCount].length(),
+         bl_len = requestedRelLevels[respFnCount].length(), index;
+  if (levelCount < rl_len) {
+    requestedTargetLevel = requestedRespLevels[respFnCount][levelCount];
+    Cout << "\n>>>>> Reliability Index Approach (RIA) for response level "
+	 << levelCount+1 << " = " << requestedTargetLevel << '\n';
+  }
+  else if (levelCount < rl_len + pl_len) { 
+    index  = levelCount - rl_len;
+    Real p = requestedProbLevels[respFnCount][index];
+    Cout << "\n>>>>> Performance Measure Approach (PMA) for probability "
+	 << "level " << index + 1 << " = " << p << '\n';
+    // gen beta target for 2nd-order PMA; beta target for 1st-order PMA:
+    requestedTargetLevel = reliability(p);
+
+    // CDF probability < 0.5  -->  CDF beta > 0  -->  minimize g
+    // CDF probability > 0.5  -->  CDF beta < 0  -->  maximize g
+    // CDF probability = 0.5  -->  CDF beta = 0  -->  compute g
+    // Note: "compute g" means that min/max is irrelevant since there is
+    // a single G(u) value when the radius beta collapses to the origin
+    Real p_cdf   = (cdfFlag) ? p : 1. - p;
+    pmaMaximizeG = (p_cdf > 0.5); // updated in update_pma_maximize()
+  }
+  else if (levelCount < rl_len + pl_len + bl_len) {
+    index = levelCount - rl_len - pl_len;
+    requestedTargetLevel = requestedRelLevels[respFnCount][index];
+    Cout << "\n>>>>> Performance Measure Approach (PMA) for reliability "
+	 << "level " << index + 1 << " = " << requestedTargetLevel << '\n';
+    Real beta_cdf = (cdfFlag) ?
+      requestedTargetLevel : -requestedTargetLevel;
+    pmaMaximizeG = (beta_cdf < 0.);
+  }
+  else {
+    index = levelCount - rl_len - pl_len - bl_len;
+    requestedTargetLevel = requestedGenRelLevels[respFnCount][index];
+    Cout << "\n>>>>> Performance Measure Approach (PMA) for generalized "
+	 << "reliability level " << index + 1 << " = "
+	 << requestedTargetLevel << '\n';
+    Real gen_beta_cdf = (cdfFlag) ?
+      requestedTargetLevel : -requestedTargetLevel;
+    pmaMaximizeG = (gen_beta_cdf < 0.); // updated in update_pma_maximize()
+  }
+}
+
+
+void NonDLocalReliability::run_mpp_optimizer()
+{
+  size_t rl_len = requestedRespLevels[respFnCount].length(),
+         pl_len = requestedProbLevels[respFnCount].length(),
+         bl_len = requestedRelLevels[respFnCount].length();
+  bool ria_flag = (levelCount < rl_len),
+    pma2_flag = ( integrationOrder == 2 && ( levelCount < rl_len + pl_len ||
+		  levelCount >= rl_len + pl_len + bl_len ) );
+
+  Sizet2DArray vars_map, primary_resp_map, secondary_resp_map;
+  BoolDequeArray nonlinear_resp_map(2);
+  std::shared_ptr<RecastModel> mpp_model_rep =
+    std::static_pointer_cast<RecastModel>(mppModel);
+  if (ria_flag) { // RIA: g is in constraint
+    primary_resp_map.resize(1);   // one objective, no contributors
+    secondary_resp_map.resize(1); // one constraint, one contributor
+    secondary_resp_map[0].resize(1);
+    secondary_resp_map[0][0] = respFnCount;
+    nonlinear_resp_map[1] = BoolDeque(1, false);
+    mpp_model_rep->init_maps(vars_map, false, NULL, NULL,
+      primary_resp_map, secondary_resp_map, nonlinear_resp_map,
+      RIA_objective_eval, RIA_constraint_eval);
+  }
+  else { // PMA: g is in objective
+    primary_resp_map.resize(1);   // one objective, one contributor
+    primary_resp_map[0].resize(1);
+    primary_resp_map[0][0] = respFnCount;
+    secondary_resp_map.resize(1); // one constraint, no contributors
+    nonlinear_resp_map[0] = BoolDeque(1, false);
+    // If 2nd-order PMA with p-level or generalized beta-level, use
+    // PMA2_set_mapping() & PMA2_constraint_eval().  For approx-based
+    // 2nd-order PMA, we utilize curvature of the surrogate (if any)
+    // to update beta* 
+    if (pma2_flag)
+      mpp_model_rep->init_maps(vars_map, false, NULL, PMA2_set_mapping,
+	primary_resp_map, secondary_resp_map, nonlinear_resp_map,
+	PMA_objective_eval, PMA2_constraint_eval);
+    else
+      mpp_model_rep->init_maps(vars_map, false, NULL, NULL,
+	primary_resp_map, secondary_resp_map, nonlinear_resp_map,
+	PMA_objective_eval, PMA_constraint_eval);	    
+  }
+  ModelUtils::continuous_variables(*mppModel, initialPtU);
+
+  // Execute MPP search and retrieve u-space results
+  Cout << "\n>>>>> Initiating search for most probable point (MPP)\n";
+  ParLevLIter pl_iter = methodPCIter->mi_parallel_level_iterator(miPLIndex);
+  mppOptimizer->run(pl_iter);
+  const Variables& vars_star = mppOptimizer->variables_results();
+  const Response&  resp_star = mppOptimizer->response_results();
+  const RealVector& fns_star = resp_star.function_values();
+  Cout << "\nResults of MPP optimization:\nInitial point (u-space) =\n"
+       << initialPtU << "Final point (u-space)   =\n"
+       << vars_star.continuous_variables();
+  if (ria_flag)
+    Cout << "RIA optimum             =\n                     "
+	 << std::setw(write_precision+7) << fns_star[0] << " [u'u]\n"
+	 << "                     " << std::setw(write_precision+7)
+	 << fns_star[1] << " [G(u) - z]\n";
+  else {
+    Cout << "PMA optimum             =\n                     "
+	 << std::setw(write_precision+7) << fns_star[0] << " [";
+    if (pmaMaximizeG) Cout << '-';
+    Cout << "G(u)]\n                     " << std::setw(write_precision+7)
+	 << fns_star[1];
+    if (pma2_flag) Cout << " [B* - bar-B*]\n";
+    else           Cout << " [u'u - B^2]\n";
+  }
+}
+
+
+/** Each cycle optimizes the limit state surrogate of every search in
+    progress, then evaluates the truth model at all of the new MPP
+    estimates together (asynchronously when supported by iteratedModel).
+    Since the AMV/AMV+ searches for different levels of the same response
+    function share the surrogate of that function, the surrogate is
+    rebuilt from the expansion data of each search prior to its
+    optimization.  A level is launched when a search slot is free and
+    either a neighboring level has converged (warm start) or neither
+    neighboring level is in progress (cold start); levels adjacent to a
+    search in progress otherwise wait for its MPP. */
+void NonDLocalReliability::concurrent_mpp_search()
+{
+  // moment statistics precede the level statistics for each response fn
+  std::vector<SizetSet> pending_levels(numFunctions),
+    active_levels(numFunctions);
+  std::vector<std::map<size_t, MPPSearchState> >
+    converged_searches(numFunctions);
+  SizetArray level_stat_offsets(numFunctions);
+  size_t lev, num_levels, num_pending = 0;
+  for (respFnCount=0; respFnCount<numFunctions; ++respFnCount) {
+    assign_moment_statistics();
+    level_stat_offsets[respFnCount] = statCount;
+    num_levels = requestedRespLevels[respFnCount].length() +
+      requestedProbLevels[respFnCount].length() +
+      requestedRelLevels[respFnCount].length() +
+      requestedGenRelLevels[respFnCount].length();
+    for (lev=0; lev<num_levels; ++lev)
+      pending_levels[respFnCount].insert(lev);
+    statCount   += num_levels;
+    num_pending += num_levels;
+  }
+
+  // Hessian transformations require x-space gradients for nonlinear
+  // variable transformations
+  std::shared_ptr<RecastModel> pt_model_rep = std::static_pointer_cast
+    <RecastModel>((mppSearchType == SUBMETHOD_AMV_X ||
+		   mppSearchType == SUBMETHOD_AMV_PLUS_X) ?
+		  uSpaceModel : uSpaceModel->truth_model());
+  bool nonlinear_trans = pt_model_rep->nonlinear_variables_mapping(),
+    asynch_flag = iteratedModel->asynch_flag();
+
+  std::list<MPPSearchState> active_searches;
+  std::list<MPPSearchState>::iterator s_it;
+  size_t fn;
+  while (num_pending || !active_searches.empty()) {
+
+    // launch new searches into the free slots
+    while (active_searches.size() < concurrentMPPSearches &&
+	   select_mpp_search(pending_levels, active_levels, converged_searches,
+			     fn, lev)) {
+      pending_levels[fn].erase(lev);  --num_pending;
+      active_levels[fn].insert(lev);
+      active_searches.push_back(MPPSearchState());
+      launch_mpp_search(fn, lev, level_stat_offsets[fn] + lev,
+			converged_searches[fn], active_searches.back());
+    }
+
+    // optimize the limit state surrogate for each search in progress
+    for (s_it=active_searches.begin(); s_it!=active_searches.end(); ++s_it) {
+      restore_mpp_search(*s_it);
+      Cout << "\n>>>>> MPP search for response function " << respFnCount+1
+	   << ", level " << levelCount+1 << ", iteration " << approxIters+1
+	   << '\n';
+      SizetSet surr_fn_indices;
+      surr_fn_indices.insert(respFnCount);
+      uSpaceModel->surrogate_function_indices(surr_fn_indices);
+      if (mppSearchType <= SUBMETHOD_AMV_U)
+	assign_mean_data(); // AMV expands at the means for all levels
+      update_limit_state_surrogate();
+
+      run_mpp_optimizer();
+      short mode
+	= update_mpp_estimate(mppOptimizer->variables_results().
+			      continuous_variables());
+      store_mpp_search(*s_it);
+      copy_data(mppOptimizer->response_results().function_values(),
+		s_it->fnsStar);
+      s_it->truthMode = mode;
+    }
+
+    // evaluate the truth model at the new MPP estimates
+    uSpaceModel->component_parallel_mode(TRUTH_MODEL_MODE);
+    IntResponseMap truth_responses;
+    for (s_it=active_searches.begin(); s_it!=active_searches.end(); ++s_it) {
+      uSpaceModel->trans_U_to_X(s_it->mostProbPointU, s_it->mostProbPointX);
+      ModelUtils::continuous_variables(*iteratedModel, s_it->mostProbPointX);
+      short asv_val = s_it->truthMode;
+      if ( (asv_val & 4) && nonlinear_trans )
+	asv_val |= 2; // fnGradX needed to transform fnHessX to fnHessU
+      activeSet.request_values(0);
+      activeSet.request_value(asv_val, s_it->respFnCount);
+      if (asynch_flag)
+	iteratedModel->evaluate_nowait(activeSet);
+      else {
+	iteratedModel->evaluate(activeSet);
+	truth_responses[iteratedModel->evaluation_id()]
+	  = iteratedModel->current_response().copy();
+      }
+      s_it->truthEvalId = iteratedModel->evaluation_id();
+    }
+    if (asynch_flag)
+      truth_responses = iteratedModel->synchronize();
+
+    // update each search from its truth response; retire converged searches
+    s_it = active_searches.begin();
+    while (s_it != active_searches.end()) {
+      IntRespMCIter r_it = truth_responses.find(s_it->truthEvalId);
+      if (r_it == truth_responses.end()) {
+	Cerr << "Error: truth response for evaluation " << s_it->truthEvalId
+	     << " not found in NonDLocalReliability::concurrent_mpp_search()."
+	     << std::endl;
+	abort_handler(METHOD_ERROR);
+      }
+      restore_mpp_search(*s_it);
+      update_truth_data(s_it->truthMode, r_it->second);
+      // the limit state surrogate is rebuilt prior to the next optimization
+      if ( !approxConverged && integrationOrder == 2 &&
+	   levelCount >= requestedRespLevels[respFnCount].length() )
+	update_pma_maximize(mostProbPointU, fnGradU, fnHessU);
+      update_computed_reliability(s_it->fnsStar);
+
+      if (approxConverged) {
+	update_level_data();
+	store_mpp_search(*s_it);
+	active_levels[respFnCount].erase(levelCount);
+	converged_searches[respFnCount].insert(
+	  std::make_pair(levelCount, *s_it));
+	s_it = active_searches.erase(s_it);
+      }
+      else {
+	store_mpp_search(*s_it);
+	++s_it;
+      }
+    }
+  }
+}
+
+
+bool NonDLocalReliability::
+select_mpp_search(const std::vector<SizetSet>& pending_levels,
+		  const std::vector<SizetSet>& active_levels,
+		  const std::vector<std::map<size_t, MPPSearchState> >&
+		    converged_searches, size_t& fn, size_t& lev)
+{
+  SizetSet::const_iterator l_it;
+  // warm start from a converged neighboring level
+  for (fn=0; fn<numFunctions; ++fn) {
+    const std::map<size_t, MPPSearchState>& converged = converged_searches[fn];
+    for (l_it=pending_levels[fn].begin(); l_it!=pending_levels[fn].end();
+	 ++l_it) {
+      lev = *l_it;
+      if ( ( lev && converged.count(lev-1) ) || converged.count(lev+1) )
+	return true;
+    }
+  }
+  // cold start the first level of a response function, then any level
+  // whose neighboring levels are not in progress
+  for (fn=0; fn<numFunctions; ++fn)
+    if (pending_levels[fn].count(0) && !active_levels[fn].count(1))
+      { lev = 0; return true; }
+  for (fn=0; fn<numFunctions; ++fn) {
+    const SizetSet& active = active_levels[fn];
+    for (l_it=pending_levels[fn].begin(); l_it!=pending_levels[fn].end();
+	 ++l_it) {
+      lev = *l_it;
+      if ( !( lev && active.count(lev-1) ) && !active.count(lev+1) )
+	return true;
+    }
+  }
+  return false;
+}
+
+
+void NonDLocalReliability::
+launch_mpp_search(size_t fn, size_t lev, size_t stat_index,
+		  const std::map<size_t, MPPSearchState>& converged,
+		  MPPSearchState& search)
+{
+  // nearest converged level, preferring the preceding level on a tie
+  std::map<size_t, MPPSearchState>::const_iterator src_it = converged.end();
+  if (warmStartFlag && !converged.empty()) {
+    std::map<size_t, MPPSearchState>::const_iterator
+      next_it = converged.upper_bound(lev);
+    if (next_it == converged.begin())
+      src_it = next_it;
+    else {
+      src_it = next_it; --src_it;
+      if (next_it != converged.end() &&
+	  next_it->first - lev < lev - src_it->first)
+	src_it = next_it;
+    }
+    // start with the MPP, response data, and curvature of the source level
+    restore_mpp_search(src_it->second);
+  }
+
+  respFnCount = fn; levelCount = lev; statCount = stat_index;
+  assign_level_target();
+  if (src_it != converged.end())
+    initialize_mpp_search_data(src_it->first);
+  else {
+    curvatureDataAvailable = false; // no data (yet) for this search
+    if (lev == 0)
+      initialize_level_data();
+    else { // cold start: reset to mean inputs/outputs
+      assign_mean_data();
+      initialPtU = initialPtUSpec; // initialPtUSpec set in ctor
+    }
+  }
+  approxIters = 0;
+  approxConverged = false;
+  store_mpp_search(search);
+}
+
+
+void NonDLocalReliability::store_mpp_search(MPPSearchState& search) const
+{
+  search.respFnCount            = respFnCount;
+  search.levelCount             = levelCount;
+  search.statCount              = statCount;
+  search.requestedTargetLevel   = requestedTargetLevel;
+  search.pmaMaximizeG           = pmaMaximizeG;
+  search.approxIters            = approxIters;
+  search.approxConverged        = approxConverged;
+  search.curvatureDataAvailable = curvatureDataAvailable;
+  search.kappaUpdated           = kappaUpdated;
+  search.computedRespLevel      = computedRespLevel;
+  search.computedRelLevel       = computedRelLevel;
+  search.computedGenRelLevel    = computedGenRelLevel;
+  search.initialPtU             = initialPtU;
+  search.mostProbPointX         = mostProbPointX;
+  search.mostProbPointU         = mostProbPointU;
+  search.fnGradX                = fnGradX;
+  search.fnGradU                = fnGradU;
+  search.fnHessX                = fnHessX;
+  search.fnHessU                = fnHessU;
+  search.kappaU                 = kappaU;
+}
+
+
+void NonDLocalReliability::restore_mpp_search(const MPPSearchState& search)
+{
+  respFnCount            = search.respFnCount;
+  levelCount             = search.levelCount;
+  statCount              = search.statCount;
+  requestedTargetLevel   = search.requestedTargetLevel;
+  pmaMaximizeG           = search.pmaMaximizeG;
+  approxIters            = search.approxIters;
+  approxConverged        = search.approxConverged;
+  curvatureDataAvailable = search.curvatureDataAvailable;
+  kappaUpdated           = search.kappaUpdated;
+  computedRespLevel      = search.computedRespLevel;
+  computedRelLevel       = search.computedRelLevel;
+  computedGenRelLevel    = search.computedGenRelLevel;
+  initialPtU             = search.initialPtU;
+  mostProbPointX         = search.mostProbPointX;
+  mostProbPointU         = search.mostProbPointU;
+  fnGradX                = search.fnGradX;
+  fnGradU                = search.fnGradU;
+  fnHessX                = search.fnHessX;
+  fnHessU                = search.fnHessU;
+  kappaU                 = search.kappaU;
+}
+
+
 /** An initial first- or second-order Taylor-series approximation is
     required for MV/AMV/AMV+/TANA or for the case where momentStats
     (from MV) are required within finalStatistics for subIterator usage
@@ -1395,8 +1704,11 @@ void NonDLocalReliability::initialize_level_data()
 /** For a particular response function at a particular z/p/beta level,
     warm-start or reset the optimizer initial guess (initialPtU),
     expansion point (mostProbPointX/U), and associated response
-    data (computedRespLevel, fnGradX/U, and fnHessX/U). */
-void NonDLocalReliability::initialize_mpp_search_data()
+    data (computedRespLevel, fnGradX/U, and fnHessX/U).  The warm start
+    projects from the converged data of prev_level, which is the previous
+    level for sequential searches and the nearest converged level for
+    concurrent searches. */
+void NonDLocalReliability::initialize_mpp_search_data(size_t prev_level)
 {
   if (warmStartFlag) {
     // For subsequent levels (including an RIA to PMA switch), warm start by
@@ -1427,10 +1739,14 @@ void NonDLocalReliability::initialize_mpp_search_data()
       // NOTE 2: this projection could bypass the need for fnGradU with
       // knowledge of the Lagrange multipliers at the previous MPP
       // (u + lamba*grad_g = 0 or grad_g + lambda*u = 0).
+      // NOTE 3: a PMA previous level (concurrent searches) provides only
+      // its computed response level.
       Real norm_grad_u_sq = fnGradU.dot(fnGradU);
       if ( norm_grad_u_sq > 1.e-10 ) { // also handles NPSOL numerical case
-	Real alpha = (requestedTargetLevel - 
-          requestedRespLevels[respFnCount][levelCount-1])/norm_grad_u_sq;
+	Real prev_z = (prev_level < rl_len) ?
+	  requestedRespLevels[respFnCount][prev_level] :
+	  computedRespLevels[respFnCount][prev_level];
+	Real alpha = (requestedTargetLevel - prev_z)/norm_grad_u_sq;
 	for (size_t i=0; i<numContinuousVars; i++)
 	  initialPtU[i] = mostProbPointU[i] + alpha * fnGradU[i];
       }
@@ -1447,16 +1763,16 @@ void NonDLocalReliability::initialize_mpp_search_data()
       // closely in all cases since it is the g term that is linearized, not the
       // u'u term (which defines beta).  However, if the optimizer fails to
       // satisfy the PMA constraint, then using the computed level is preferred.
-      //Real prev_pl = (levelCount == rl_len)
-      //  ? computedProbLevels[respFnCount][levelCount-1]
-      //  : requestedProbLevels[respFnCount][levelCount-rl_len-1];
+      //Real prev_pl = (prev_level < rl_len)
+      //  ? computedProbLevels[respFnCount][prev_level]
+      //  : requestedProbLevels[respFnCount][prev_level-rl_len];
       size_t pl_len = requestedProbLevels[respFnCount].length(),
 	     bl_len = requestedRelLevels[respFnCount].length();
       Real prev_bl = ( integrationOrder == 2 &&
 		       ( levelCount <  rl_len + pl_len ||
 			 levelCount >= rl_len + pl_len + bl_len ) ) ?
-	computedGenRelLevels[respFnCount][levelCount-1] :
-	computedRelLevels[respFnCount][levelCount-1];
+	computedGenRelLevels[respFnCount][prev_level] :
+	computedRelLevels[respFnCount][prev_level];
       // Note: scaling is applied to mppU, so we want best est of new beta.
       // Don't allow excessive init pt scaling if secant Hessian updating.
       Real high_tol = 1.e+3,
@@ -1503,69 +1819,17 @@ update_mpp_search_data(const Variables& vars_star, const Response& resp_star)
   const RealVector&    mpp_u = vars_star.continuous_variables(); // view
   const RealVector& fns_star = resp_star.function_values();
 
-  // Update MPP arrays from optimization results
-  Real conv_metric;
-  switch (mppSearchType) {
-  case SUBMETHOD_AMV_PLUS_X:  case SUBMETHOD_TANA_X:  case SUBMETHOD_QMEA_X:
-  case SUBMETHOD_AMV_PLUS_U:  case SUBMETHOD_TANA_U:  case SUBMETHOD_QMEA_U: {
-    RealVector del_u(numContinuousVars, false);
-    for (size_t i=0; i<numContinuousVars; i++)
-      del_u[i] = mpp_u[i] - mostProbPointU[i];
-    conv_metric = del_u.normFrobenius();
-    break;
-  }
-  }
-  copy_data(mpp_u, mostProbPointU); // view -> copy
-
   // Set computedRespLevel to the current g(x) value by either performing
   // a validation function evaluation (AMV/AMV+) or retrieving data from
   // resp_star (FORM).  Also update approximations and convergence tols.
   switch (mppSearchType) {
-  case SUBMETHOD_AMV_X: case SUBMETHOD_AMV_U: {
-    approxConverged = true; // break out of while loop
-    truth_evaluation(1); // only update truth function value
+  case SUBMETHOD_AMV_X: case SUBMETHOD_AMV_U:
+    truth_evaluation(update_mpp_estimate(mpp_u));
     break;
-  }
   case SUBMETHOD_AMV_PLUS_X:  case SUBMETHOD_TANA_X:  case SUBMETHOD_QMEA_X:
   case SUBMETHOD_AMV_PLUS_U:  case SUBMETHOD_TANA_U:  case SUBMETHOD_QMEA_U: {
-    // Assess AMV+/TANA iteration convergence.  ||del_u|| is not a perfect
-    // metric since cycling between MPP estimates can occur.  Therefore,
-    // a maximum number of iterations is also enforced.
-    //conv_metric = std::fabs(fn_vals[respFnCount] - requestedRespLevel);
-    ++approxIters;
-    if (conv_metric < convergenceTol)
-      approxConverged = true;
-    else if (approxIters >= maxIterations) {
-      Cerr << "\nWarning: maximum number of limit state approximation cycles "
-	   << "exceeded.\n";
-      warningBits |= 1; // first warning in output summary
-      approxConverged = true;
-    }
-    // Update response data for local/multipoint MPP approximation
-    short mode = 1;
-    if (approxConverged) {
-      Cout << "\n>>>>> Approximate MPP iterations converged.  "
-	   << "Evaluating final response.\n";
-      // fnGradX/U needed for warm starting by projection, final_stat_grad,
-      // and/or 2nd-order integration.
-      const ShortArray& final_asv = finalStatistics.active_set_request_vector();
-      if ( warmStartFlag || ( final_asv[statCount] & 2 ) )
-	mode |= 2;
-      if (integrationOrder == 2)
-	mode |= 4;// RecastModel::transform_set() augments if nonlinear_vars_map
-    }
-    else { // not converged
-      Cout << "\n>>>>> Updating approximation for MPP iteration "
-	   << approxIters+1 << "\n";
-      mode |= 2;            // update AMV+/TANA approximation
-      if (taylorOrder == 2) // update AMV^2+ approximation
-	mode |= 4;// RecastModel::transform_set() augments if nonlinear_vars_map
-      if (warmStartFlag) // warm start initialPtU for next AMV+ iteration
-	initialPtU = mostProbPointU;
-    }
-
     // evaluate new expansion point
-    truth_evaluation(mode);
+    truth_evaluation(update_mpp_estimate(mpp_u));
 #ifdef MPP_CONVERGE_RATE
     Cout << "u'u = "  << mostProbPointU.dot(mostProbPointU)
 	 << " G(u) = " << computedRespLevel << '\n';
@@ -1583,6 +1847,7 @@ update_mpp_search_data(const Variables& vars_star, const Response& resp_star)
   case SUBMETHOD_NO_APPROX: { // FORM/SORM
 
     // direct optimization converges to MPP: no new approximation to compute
+    copy_data(mpp_u, mostProbPointU); // view -> copy
     approxConverged = true; // break out of while loop
     if (ria_flag) // RIA computed response = eq_con_star + response target
       computedRespLevel = fns_star[1] + requestedTargetLevel;
@@ -1663,7 +1928,81 @@ update_mpp_search_data(const Variables& vars_star, const Response& resp_star)
   }
 
   // set computedRelLevel using u'u from fns_star; must follow fnGradU update
-  if (ria_flag)
+  update_computed_reliability(fns_star);
+}
+
+
+/** Includes case-specific logic for the AMV/AMV+/TANA methods.  The
+    returned mode requests the truth data at the new MPP estimate:
+    values only for AMV, and the data for the next limit state
+    approximation or for the final statistics for AMV+/TANA. */
+short NonDLocalReliability::update_mpp_estimate(const RealVector& mpp_u)
+{
+  // Update MPP arrays from optimization results
+  Real conv_metric;
+  switch (mppSearchType) {
+  case SUBMETHOD_AMV_PLUS_X:  case SUBMETHOD_TANA_X:  case SUBMETHOD_QMEA_X:
+  case SUBMETHOD_AMV_PLUS_U:  case SUBMETHOD_TANA_U:  case SUBMETHOD_QMEA_U: {
+    RealVector del_u(numContinuousVars, false);
+    for (size_t i=0; i<numContinuousVars; i++)
+      del_u[i] = mpp_u[i] - mostProbPointU[i];
+    conv_metric = del_u.normFrobenius();
+    break;
+  }
+  }
+  copy_data(mpp_u, mostProbPointU); // view -> copy
+
+  short mode = 1;
+  switch (mppSearchType) {
+  case SUBMETHOD_AMV_X: case SUBMETHOD_AMV_U:
+    approxConverged = true; // break out of while loop
+    break;                  // only update truth function value
+  case SUBMETHOD_AMV_PLUS_X:  case SUBMETHOD_TANA_X:  case SUBMETHOD_QMEA_X:
+  case SUBMETHOD_AMV_PLUS_U:  case SUBMETHOD_TANA_U:  case SUBMETHOD_QMEA_U:
+    // Assess AMV+/TANA iteration convergence.  ||del_u|| is not a perfect
+    // metric since cycling between MPP estimates can occur.  Therefore,
+    // a maximum number of iterations is also enforced.
+    //conv_metric = std::fabs(fn_vals[respFnCount] - requestedRespLevel);
+    ++approxIters;
+    if (conv_metric < convergenceTol)
+      approxConverged = true;
+    else if (approxIters >= maxIterations) {
+      Cerr << "\nWarning: maximum number of limit state approximation cycles "
+	   << "exceeded.\n";
+      warningBits |= 1; // first warning in output summary
+      approxConverged = true;
+    }
+    // Update response data for local/multipoint MPP approximation
+    if (approxConverged) {
+      Cout << "\n>>>>> Approximate MPP iterations converged.  "
+	   << "Evaluating final response.\n";
+      // fnGradX/U needed for warm starting by projection, final_stat_grad,
+      // and/or 2nd-order integration.
+      const ShortArray& final_asv = finalStatistics.active_set_request_vector();
+      if ( warmStartFlag || ( final_asv[statCount] & 2 ) )
+	mode |= 2;
+      if (integrationOrder == 2)
+	mode |= 4;// RecastModel::transform_set() augments if nonlinear_vars_map
+    }
+    else { // not converged
+      Cout << "\n>>>>> Updating approximation for MPP iteration "
+	   << approxIters+1 << "\n";
+      mode |= 2;            // update AMV+/TANA approximation
+      if (taylorOrder == 2) // update AMV^2+ approximation
+	mode |= 4;// RecastModel::transform_set() augments if nonlinear_vars_map
+      if (warmStartFlag) // warm start initialPtU for next AMV+ iteration
+	initialPtU = mostProbPointU;
+    }
+    break;
+  }
+  return mode;
+}
+
+
+void NonDLocalReliability::
+update_computed_reliability(const RealVector& fns_star)
+{
+  if (levelCount < requestedRespLevels[respFnCount].length()) // RIA
     computedRelLevel = signed_norm(std::sqrt(fns_star[0]));
   else if (integrationOrder == 2) { // second-order PMA
     // no op: computed{Rel,GenRel}Level updated in PMA2_constraint_eval()
@@ -1897,6 +2236,35 @@ void NonDLocalReliability::truth_evaluation(short mode)
 }
 
 
+/** Counterpart to truth_evaluation() for evaluations of iteratedModel
+    at mostProbPointX that were scheduled directly in x-space, for which
+    the u-space data are obtained by transformation. */
+void NonDLocalReliability::
+update_truth_data(short mode, const Response& x_resp)
+{
+  if (mode & 1)
+    computedRespLevel = x_resp.function_value(respFnCount);
+  if (mode & 2) {
+    fnGradX = x_resp.function_gradient_copy(respFnCount);
+    uSpaceModel->trans_grad_X_to_U(fnGradX, fnGradU, mostProbPointX);
+  }
+  if (mode & 4) {
+    fnHessX = x_resp.function_hessian(respFnCount);
+    // a gradient augmenting the Hessian request for a nonlinear variable
+    // transformation is used here, but is not retained in fnGradX
+    if (x_resp.active_set_request_vector()[respFnCount] & 2) {
+      RealVector fn_grad_x = x_resp.function_gradient_copy(respFnCount);
+      uSpaceModel->trans_hess_X_to_U(fnHessX, fnHessU, mostProbPointX,
+				     fn_grad_x);
+    }
+    else
+      uSpaceModel->trans_hess_X_to_U(fnHessX, fnHessU, mostProbPointX,
+				     fnGradX);
+    curvatureDataAvailable = true; kappaUpdated = false;
+  }
+}
+
+
 /** This function recasts a G(u) response set (already transformed and
     approximated in other recursions) into an RIA objective function. */
 void NonDLocalReliability::
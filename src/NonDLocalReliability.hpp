@@ -73,6 +73,35 @@ public:
 
 private:
 
+  /// MPP search data for one response function and z/p/beta level,
+  /// held while other searches are advanced by concurrent_mpp_search()
+  struct MPPSearchState
+  {
+    int    respFnCount;             ///< response function index
+    size_t levelCount;              ///< z/p/beta level index
+    size_t statCount;               ///< finalStatistics index
+    Real   requestedTargetLevel;    ///< z/beta/beta* target
+    bool   pmaMaximizeG;            ///< PMA optimization sense
+    size_t approxIters;             ///< AMV+ iteration count
+    bool   approxConverged;         ///< AMV+ convergence status
+    bool   curvatureDataAvailable;  ///< fnHessU/mostProbPointU consistency
+    bool   kappaUpdated;            ///< kappaU consistency
+    Real   computedRespLevel;       ///< computed response level
+    Real   computedRelLevel;        ///< computed reliability level
+    Real   computedGenRelLevel;     ///< computed generalized reliability
+    RealVector    initialPtU;       ///< optimizer initial guess
+    RealVector    mostProbPointX;   ///< MPP estimate in x-space
+    RealVector    mostProbPointU;   ///< MPP estimate in u-space
+    RealVector    fnGradX;          ///< limit state gradient in x-space
+    RealVector    fnGradU;          ///< limit state gradient in u-space
+    RealSymMatrix fnHessX;          ///< limit state Hessian in x-space
+    RealSymMatrix fnHessU;          ///< limit state Hessian in u-space
+    RealVector    kappaU;           ///< principal curvatures
+    RealVector    fnsStar;          ///< RIA/PMA function values at optimum
+    short  truthMode;               ///< pending truth evaluation request
+    int    truthEvalId;             ///< pending truth evaluation id
+  };
+
   //
   //- Heading: Objective/constraint/set mappings passed to RecastModel
   //
@@ -143,6 +172,41 @@ private:
   /// employ a search for the most probable point (AMV, AMV+, FORM, SORM)
   void mpp_search();
 
+  /// perform the AMV/AMV+ MPP searches for all response functions and
+  /// levels with up to concurrentMPPSearches searches in progress, using
+  /// asynchronous truth evaluations
+  void concurrent_mpp_search();
+
+  /// select the next pending level for concurrent_mpp_search(), preferring
+  /// levels that can be warm started from a converged neighboring level
+  bool select_mpp_search(const std::vector<SizetSet>& pending_levels,
+			 const std::vector<SizetSet>& active_levels,
+			 const std::vector<std::map<size_t, MPPSearchState> >&
+			   converged_searches, size_t& fn, size_t& lev);
+
+  /// initialize the search data for a response function and level, warm
+  /// starting from the nearest converged level when available
+  void launch_mpp_search(size_t fn, size_t lev, size_t stat_index,
+			 const std::map<size_t, MPPSearchState>& converged,
+			 MPPSearchState& search);
+
+  /// copy the class-scope MPP search data into search
+  void store_mpp_search(MPPSearchState& search) const;
+  /// copy the MPP search data in search into class scope
+  void restore_mpp_search(const MPPSearchState& search);
+
+  /// assign the mean and standard deviation/variance statistics of the
+  /// current response function within finalStatistics
+  void assign_moment_statistics();
+
+  /// assign requestedTargetLevel and pmaMaximizeG for the current
+  /// response function and z/p/beta level
+  void assign_level_target();
+
+  /// configure the RIA/PMA formulation in mppModel for the current
+  /// response function and level and run the MPP optimizer from initialPtU
+  void run_mpp_optimizer();
+
   /// convenience function for initializing class scope arrays
   void initialize_class_data();
 
@@ -151,14 +215,24 @@ private:
   void initialize_level_data();
 
   /// convenience function for initializing/warm starting MPP search
-  /// data for each z/p/beta level for each response function
-  void initialize_mpp_search_data();
+  /// data for each z/p/beta level for each response function, using
+  /// the converged search data from prev_level
+  void initialize_mpp_search_data(size_t prev_level);
 
   /// convenience function for updating MPP search data for each
   /// z/p/beta level for each response function
   void update_mpp_search_data(const Variables& vars_star,
 			      const Response& resp_star);
 
+  /// update mostProbPointU and the convergence status of an
+  /// approximation-based MPP search; returns the truth evaluation request
+  /// for the new MPP estimate
+  short update_mpp_estimate(const RealVector& mpp_u);
+
+  /// update computedRelLevel from the RIA/PMA function values at the
+  /// optimum
+  void update_computed_reliability(const RealVector& fns_star);
+
   /// convenience function for updating z/p/beta level data and final
   /// statistics following MPP convergence
   void update_level_data();
@@ -192,6 +266,9 @@ private:
   /// perform an evaluation of the actual model and store value,grad,Hessian
   /// data in X,U spaces
   void truth_evaluation(short mode);
+  /// store value,grad,Hessian data in X,U spaces from an x-space
+  /// evaluation of the actual model at mostProbPointX
+  void update_truth_data(short mode, const Response& x_resp);
 
   //
   //- Heading: Utility routines
@@ -347,6 +424,9 @@ private:
   /// derivative level for NPSOL executions (1 = analytic grads of objective
   /// fn, 2 = analytic grads of constraints, 3 = analytic grads of both).
   int npsolDerivLevel;
+  /// maximum number of MPP searches (AMV/AMV+) in progress at one time
+  /// across response functions and levels
+  size_t concurrentMPPSearches;
 
   /// set of warnings accumulated during execution
   unsigned short warningBits;
@@ -46,6 +46,8 @@ NonDSampling::NonDSampling(ProblemDescDB& problem_db, ParallelLibrary& parallel_
   sampleType(probDescDB.get_ushort("method.sample_type")), samplesIncrement(0),
   stdRegressionCoeffs(probDescDB.get_bool("method.std_regression_coeffs")),
   toleranceIntervalsFlag(probDescDB.get_bool("method.tolerance_intervals")),
+  columnarStats(probDescDB.get_bool("method.columnar_statistics")),
+  quantileSketchSize(probDescDB.get_sizet("method.quantile_sketch")),
   statsFlag(true), allDataFlag(false), samplingVarsMode(ACTIVE),
   sampleRanksMode(IGNORE_RANKS),
   varyPattern(!probDescDB.get_bool("method.fixed_seed")), 
@@ -140,7 +142,7 @@ NonDSampling(unsigned short method_name, std::shared_ptr<Model> model,
   NonD(method_name, model), seedSpec(seed), randomSeed(seed),
   samplesSpec(samples), samplesRef(samples), numSamples(samples), rngName(rng),
   sampleType(sample_type), wilksFlag(false), samplesIncrement(0), stdRegressionCoeffs(false),
-  toleranceIntervalsFlag(false),
+  toleranceIntervalsFlag(false), columnarStats(false), quantileSketchSize(0),
   statsFlag(false), allDataFlag(true), samplingVarsMode(sampling_vars_mode),
   sampleRanksMode(IGNORE_RANKS), varyPattern(vary_pattern),
   backfillDuplicates(false), numLHSRuns(0),
@@ -177,7 +179,7 @@ NonDSampling(unsigned short sample_type, size_t samples, int seed,
   randomSeed(seed), samplesSpec(samples), samplesRef(samples),
   numSamples(samples), rngName(rng), sampleType(sample_type), wilksFlag(false),
   samplesIncrement(0), stdRegressionCoeffs(false),
-  toleranceIntervalsFlag(false),
+  toleranceIntervalsFlag(false), columnarStats(false), quantileSketchSize(0),
   statsFlag(false), allDataFlag(true),
   samplingVarsMode(ACTIVE_UNIFORM), sampleRanksMode(IGNORE_RANKS),
   varyPattern(true), backfillDuplicates(false), numLHSRuns(0),
@@ -206,7 +208,7 @@ NonDSampling(unsigned short sample_type, size_t samples, int seed,
   randomSeed(seed), samplesSpec(samples), samplesRef(samples),
   numSamples(samples), rngName(rng), sampleType(sample_type), wilksFlag(false),
   samplesIncrement(0), stdRegressionCoeffs(false),
-  toleranceIntervalsFlag(false),
+  toleranceIntervalsFlag(false), columnarStats(false), quantileSketchSize(0),
   statsFlag(false), allDataFlag(true),
   samplingVarsMode(ACTIVE), sampleRanksMode(IGNORE_RANKS), varyPattern(true),
   backfillDuplicates(false), numLHSRuns(0),
@@ -231,7 +233,7 @@ NonDSampling(std::shared_ptr<Model> model, const RealMatrix& sample_matrix):
   NonD(LIST_SAMPLING, model), seedSpec(0), randomSeed(0),
   samplesSpec(sample_matrix.numCols()), sampleType(SUBMETHOD_DEFAULT),
   wilksFlag(false), samplesIncrement(0), stdRegressionCoeffs(false),
-  toleranceIntervalsFlag(false),
+  toleranceIntervalsFlag(false), columnarStats(false), quantileSketchSize(0),
   statsFlag(true), allDataFlag(true),
   samplingVarsMode(ACTIVE), sampleRanksMode(IGNORE_RANKS),
   varyPattern(false), backfillDuplicates(false), numLHSRuns(0),
@@ -977,6 +979,81 @@ void NonDSampling::core_run()
 }
 
 
+/** Columnar samples support the moments, intervals, level mappings, and
+    correlations computed by compute_statistics() for top-level studies
+    on response functions; other results require allResponses. */
+bool NonDSampling::columnar_statistics() const
+{
+  if (!columnarStats || !statsFlag || allDataFlag || !compactMode ||
+      wilksFlag || stdRegressionCoeffs || toleranceIntervalsFlag)
+    return false;
+  // moment gradients require gradient samples
+  const ShortArray& asv = activeSet.request_vector();
+  for (size_t i=0; i<asv.size(); ++i)
+    if (asv[i] & 6)
+      return false;
+  return true;
+}
+
+
+/** The batch size is the larger of the model evaluation capacity and
+    1000.  Each batch is evaluated (asynchronously when supported), its
+    response function values are appended to sampleColumns and its
+    correlation statistics are accumulated, and its responses are then
+    released, so that memory does not grow with the number of samples
+    beyond the columns themselves (or not at all with quantile
+    sketches). */
+void NonDSampling::evaluate_columnar_samples(Model& model)
+{
+  size_t i, num_evals = allSamples.numCols(), batch_start, batch_size,
+    max_batch = std::max((size_t)model.evaluation_capacity(), (size_t)1000);
+  bool header_flag = (allHeaders.size() == num_evals),
+       asynch_flag = model.asynch_flag(), db_act = resultsDB.active();
+
+  allResponses.clear();
+  sampleColumns.initialize(numFunctions, quantileSketchSize);
+  sampleColumns.reserve(num_evals);
+  if (!subIteratorFlag)
+    nonDSampCorr.reset_accumulated_correlations();
+
+  IntResponseMap batch_resp;
+  for (batch_start=0; batch_start<num_evals; batch_start+=batch_size) {
+    batch_size = std::min(max_batch, num_evals - batch_start);
+    batch_resp.clear();
+    for (i=batch_start; i<batch_start+batch_size; ++i) {
+      // output the evaluation header (if present)
+      if (header_flag) Cout << allHeaders[i];
+      update_model_from_sample(model, allSamples[i]);
+      if (asynch_flag)
+	model.evaluate_nowait(activeSet);
+      else {
+	model.evaluate(activeSet);
+	log_response(model, batch_resp, i, true, false);
+      }
+      archive_model_variables(model, i);
+    }
+    if (asynch_flag) {
+      batch_resp = model.synchronize();
+      if (db_act) {
+	IntRespMCIter r_cit = batch_resp.begin();
+	for (i=batch_start; r_cit!=batch_resp.end(); ++i, ++r_cit)
+	  archive_model_response(r_cit->second, i);
+      }
+    }
+
+    sampleColumns.append(batch_resp);
+    if (!subIteratorFlag) {
+      RealMatrix batch_samples(Teuchos::View, allSamples[batch_start],
+			       allSamples.stride(), allSamples.numRows(),
+			       batch_size);
+      nonDSampCorr.accumulate_correlations(batch_samples, batch_resp);
+    }
+  }
+}
+
+
+/** An empty resp_samples selects the columnar samples accumulated by
+    evaluate_columnar_samples(). */
 void NonDSampling::
 compute_statistics(const RealMatrix&     vars_samples,
 		   const IntResponseMap& resp_samples)
@@ -1014,19 +1091,27 @@ compute_statistics(const RealMatrix&     vars_samples,
 		     ModelUtils::response_labels(*iteratedModel));
   }
 
+  bool columnar = (resp_samples.empty() && sampleColumns.num_samples());
   if (epistemicStats) { // Epistemic/mixed
-    compute_intervals(resp_samples); // compute min/max response intervals
+    // compute min/max response intervals
+    if (columnar) compute_intervals(sampleColumns);
+    else          compute_intervals(resp_samples);
   }
   else { // Aleatory
     // compute means and std deviations with confidence intervals
-    compute_moments(resp_samples);
+    if (columnar) compute_moments(sampleColumns);
+    else          compute_moments(resp_samples);
     // compute CDF/CCDF mappings of z to p/beta and p/beta to z
-    if (totalLevelRequests)
-      compute_level_mappings(resp_samples);
+    if (totalLevelRequests) {
+      if (columnar) compute_level_mappings(sampleColumns);
+      else          compute_level_mappings(resp_samples);
+    }
   }
 
   if (!subIteratorFlag) {
-    nonDSampCorr.compute_correlations(vars_samples, resp_samples);
+    // correlations of columnar samples were accumulated by batch
+    if (columnar) nonDSampCorr.compute_accumulated_correlations();
+    else nonDSampCorr.compute_correlations(vars_samples, resp_samples);
   }
 
   if (stdRegressionCoeffs) {
@@ -1089,6 +1174,32 @@ compute_intervals(RealRealPairArray& extreme_fns, const IntResponseMap& samples)
 }
 
 
+void NonDSampling::compute_intervals(const ColumnarSampleStore& samples)
+{
+  // For the samples array, calculate min/max response intervals
+  size_t i, num_obs = samples.num_samples(), num_samp;
+  const StringArray& resp_labels = ModelUtils::response_labels(*iteratedModel);
+
+  extremeValues.resize(numFunctions);
+  for (i=0; i<numFunctions; ++i) {
+    samples.extremes(i, extremeValues[i].first, extremeValues[i].second);
+    num_samp = samples.num_valid(i);
+    if (num_samp != num_obs)
+      Cerr << "Warning: sampling statistics for " << resp_labels[i] << " omit "
+	   << num_obs-num_samp << " failed evaluations out of " << num_obs
+	   << " samples.\n";
+  }
+
+  if (resultsDB.active()) {
+    MetaDataType md;
+    md["Row Labels"] = make_metadatavalue("Min", "Max");
+    md["Column Labels"] = make_metadatavalue(resp_labels);
+    resultsDB.insert(run_identifier(), resultsNames.extreme_values,
+		     extremeValues, md);
+  }
+}
+
+
 void NonDSampling::
 compute_moments(const IntResponseMap& samples, RealMatrix& moment_stats,
 		RealMatrix& moment_grads, RealMatrix& moment_conf_ints,
@@ -1156,6 +1267,75 @@ compute_moments(const IntResponseMap& samples, RealMatrix& moment_stats,
 }
 
 
+void NonDSampling::compute_moments(const ColumnarSampleStore& samples)
+{
+  // moment gradients require gradient samples, which are not stored
+  // (see columnar_statistics())
+  const StringArray& labels = ModelUtils::response_labels(*iteratedModel);
+  size_t i, num_obs = samples.num_samples(), num_qoi = samples.num_functions();
+  RealMatrix sums;
+  samples.central_sums(sums);
+
+  if (momentStats.empty()) momentStats.shapeUninitialized(4, num_qoi);
+  SizetArray sample_counts(num_qoi);
+  for (i=0; i<num_qoi; ++i) {
+    size_t& num_samp = sample_counts[i];
+    Real*  moments_i = momentStats[i];
+    num_samp = samples.num_valid(i);
+    if (num_samp != num_obs)
+      Cerr << "Warning: sampling statistics for " << labels[i] << " omit "
+	   << num_obs-num_samp << " failed evaluations out of " << num_obs
+	   << " samples.\n";
+
+    if (num_samp)
+      central_sums_to_moments(sums[i], finalMomentsType, moments_i);
+    else {
+      Cerr << "Warning: Number of samples for " << labels[i]
+	   << " must be nonzero for moment calculation in NonDSampling::"
+	   << "compute_moments().\n";
+      for (int j=0; j<4; ++j)
+	moments_i[j] = std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+  compute_moment_confidence_intervals(momentStats, momentCIs, sample_counts,
+				      finalMomentsType);
+  functionMomentsComputed = true;
+}
+
+
+/** sums holds the count, mean, and sums of the 2nd through 4th powers of
+    deviations from the mean.  The variance uses Bessel's correction and
+    the 3rd and 4th central moments the corrections used for unbiased
+    central moments in NonDEnsembleSampling (4th from Klemens 2009,
+    Appendix M), which require more than three samples. */
+void NonDSampling::
+central_sums_to_moments(const Real* sums, short moments_type, Real* moments)
+{
+  Real ns = sums[0], cm2 = (ns > 1.) ? sums[2] / (ns - 1.) : 0.,
+    cm3 = sums[3] / ns, cm4 = sums[4] / ns;
+  if (ns > 3.) {
+    Real nm1 = ns - 1., nm2 = ns - 2., n_sq = ns * ns;
+    cm3 *= n_sq / (nm1 * nm2);
+    cm4 = ( n_sq * ns * cm4 / nm1 - (6. * ns - 9.) * (n_sq - ns)
+	    / (n_sq - 2. * ns + 3) * cm2 * cm2 )
+        / ( (n_sq - 3. * ns + 3.) - (6. * ns - 9.) * (n_sq - ns)
+	    / (ns * (n_sq - 2. * ns + 3.)) );
+  }
+
+  moments[0] = sums[1];
+  if (moments_type == Pecos::CENTRAL_MOMENTS)
+    { moments[1] = cm2;  moments[2] = cm3;  moments[3] = cm4; }
+  else {
+    Real stdev = std::sqrt(cm2);
+    moments[1] = stdev;
+    if (cm2 > 0.)
+      { moments[2] = cm3 / (cm2 * stdev);  moments[3] = cm4 / (cm2*cm2) - 3.; }
+    else
+      moments[2] = moments[3] = 0.;
+  }
+}
+
+
 void NonDSampling::
 compute_moments(const RealVectorArray& fn_samples, SizetArray& sample_counts,
 		RealMatrix& moment_stats, short moments_type,
@@ -1580,9 +1760,26 @@ compute_wilks_beta(unsigned short order, int nsamples, Real alpha,
 }
 
 
-/** Computes CDF/CCDF based on sample binning.  A PDF is inferred from a
-    CDF/CCDF within compute_densities() after level computation. */
+/** Response samples are transferred to columnar storage, from which the
+    mappings are computed. */
 void NonDSampling::compute_level_mappings(const IntResponseMap& samples)
+{
+  ColumnarSampleStore sample_columns;
+  sample_columns.initialize(numFunctions);
+  sample_columns.reserve(samples.size());
+  sample_columns.append(samples);
+  compute_level_mappings(sample_columns);
+}
+
+
+/** Computes CDF/CCDF based on sample binning.  A PDF is inferred from a
+    CDF/CCDF within compute_densities() after level computation.
+
+    Sample values are binned for z -> p/beta* mappings and only the
+    order statistics bracketing each p/beta* level are selected for
+    p/beta* -> z mappings, without sorting full sample sets.  With
+    quantile sketches, both are approximate. */
+void NonDSampling::compute_level_mappings(const ColumnarSampleStore& samples)
 {
   // Size the output arrays here instead of in the ctor in order to support
   // alternate sampling ctors.
@@ -1592,10 +1789,8 @@ void NonDSampling::compute_level_mappings(const IntResponseMap& samples)
   // For the samples array, calculate the following statistics:
   // > CDF/CCDF mappings of response levels to probability/reliability levels
   // > CDF/CCDF mappings of probability/reliability levels to response levels
-  size_t i, j, k, num_obs = samples.size(), num_samp, bin_accumulator;
-  const StringArray& resp_labels = ModelUtils::response_labels(*iteratedModel);
-  std::multiset<Real> sorted_samples; // STL-based array for sorting
-  SizetArray bins; Real min, max, sample;
+  size_t i, j, k, num_samp, bin_accumulator;
+  SizetArray bins, ranks; RealArray z_bounds, cdf_incr_ids, lo_ids;
 
   // check if moments are required, and if so, compute them now
   if (momentStats.empty()) {
@@ -1620,7 +1815,6 @@ void NonDSampling::compute_level_mappings(const IntResponseMap& samples)
   }
 
   if (pdfOutput) extremeValues.resize(numFunctions);
-  IntRespMCIter s_it; std::multiset<Real>::iterator ss_it;
   const ShortArray& final_asv = finalStatistics.active_set_request_vector();
   bool extrapolated_mappings = false,
     central_mom = (finalMomentsType == Pecos::CENTRAL_MOMENTS);
@@ -1636,55 +1830,52 @@ void NonDSampling::compute_level_mappings(const IntResponseMap& samples)
            bl_len = requestedRelLevels[i].length(),
            gl_len = requestedGenRelLevels[i].length();
 
-    // ----------------------------------------------------------------------
-    // Preliminaries: define finite subset, sort (if needed), and bin samples
-    // ----------------------------------------------------------------------
-    num_samp = 0;
-    if (pl_len || gl_len) { // sort samples array for p/beta* -> z mappings
-      sorted_samples.clear();
-      for (s_it=samples.begin(); s_it!=samples.end(); ++s_it) {
-        sample = s_it->second.function_value(i);
-	if (std::isfinite(sample))
-	  { ++num_samp; sorted_samples.insert(sample); }
-      }
-      // sort in ascending order
-      if (pdfOutput)
-        { min = *sorted_samples.begin(); max = *(--sorted_samples.end()); }
-      // in case of rl_len mixed with pl_len/gl_len, bin using sorted array.
-      if (rl_len && respLevelTarget != RELIABILITIES) {
-	const RealVector& req_rl_i = requestedRespLevels[i];
-        bins.assign(rl_len+1, 0); ss_it = sorted_samples.begin();
-	for (j=0; j<rl_len; ++j)
-	  while (ss_it!=sorted_samples.end() && *ss_it <= req_rl_i[j])// p(g<=z)
-	    { ++bins[j]; ++ss_it; }
-	bins[rl_len] += std::distance(ss_it, sorted_samples.end());
-      }
-    }
-    else if (rl_len && respLevelTarget != RELIABILITIES) {
-      // in case of rl_len without pl_len/gl_len, bin from original sample set
-      const RealVector& req_rl_i = requestedRespLevels[i];
-      bins.assign(rl_len+1, 0); min = DBL_MAX; max = -DBL_MAX;
-      for (s_it=samples.begin(); s_it!=samples.end(); ++s_it) {
-	sample = s_it->second.function_value(i);
-	if (std::isfinite(sample)) {
-	  ++num_samp;
-	  if (pdfOutput) {
-	    if (sample < min) min = sample;
-	    if (sample > max) max = sample;
-	  }
-	  // 1st PDF bin from -inf to 1st resp lev; last PDF bin from last resp
-	  // lev to +inf.
-	  bool found = false;
-	  for (k=0; k<rl_len; ++k)
-	    if (sample <= req_rl_i[k]) // cumulative p(g<=z)
-	      { ++bins[k]; found = true; break; }
-	  if (!found)
-	    ++bins[rl_len];
+    // ---------------------------------------------------------------------
+    // Preliminaries: count finite samples, bin them, and select the order
+    // statistics needed for p/beta* -> z
+    // ---------------------------------------------------------------------
+    num_samp = samples.num_valid(i);
+    if (pdfOutput)
+      samples.extremes(i, extremeValues[i].first, extremeValues[i].second);
+    // 1st PDF bin from -inf to 1st resp lev; last PDF bin from last resp
+    // lev to +inf.
+    if (rl_len && respLevelTarget != RELIABILITIES)
+      samples.count_levels(i, requestedRespLevels[i], bins); // p(g<=z)
+    if (pl_len || gl_len) {
+      // since each sample has 1/N probability, p can be directly converted
+      // to an index within the sorted samples (id = p * N; index = id - 1)
+      // Note 1: duplicate samples are not aggregated (separate id increments).
+      // Note 2: since p_cdf(min_sample) = 1/N and p_cdf(max_sample) = 1, we
+      //   extrapolate to the left of min, but not to the right of max.
+      //   id < 1 indicates this extrapolation left of the min sample.
+      // Note 3: we exclude any extrapolated z from extremeValues; should we
+      //   omit any out-of-bounds resp levels within NonD::compute_densities()?
+      //   --> PDF estimation based only on z->p binning or p->z interpolation
+      //       within the sample bounds.
+      size_t pg_len = pl_len + gl_len;
+      cdf_incr_ids.resize(pg_len);  lo_ids.resize(pg_len);
+      ranks.resize(2*pg_len);
+      for (j=0; j<pg_len; ++j) {
+	Real p = (j<pl_len) ? requestedProbLevels[i][j] : Pecos::
+	  NormalRandomVariable::std_cdf(-requestedGenRelLevels[i][j-pl_len]);
+	Real p_cdf = (cdfFlag) ? p : 1. - p;
+	Real& cdf_incr_id = cdf_incr_ids[j];  Real& lo_id = lo_ids[j];
+	cdf_incr_id = p_cdf * (Real)num_samp;
+	if (cdf_incr_id < 1.) { // extrapolate left of min sample w/ 1st slope
+	  lo_id = 1.; extrapolated_mappings = true;
+	  Cerr << "Warning: extrapolation required for response " << i+1;
+	  if (j<pl_len) Cerr <<    " for probability level " << j+1 << ".\n";
+	  else Cerr << " for generalized reliability level " << j+1-pl_len
+		    << ".\n";
 	}
+	else // linear interpolation between closest neighbors in sequence
+	  lo_id = std::floor(cdf_incr_id);
+	// zero-based ranks of the neighbors
+	ranks[2*j]   = (size_t)lo_id - 1;
+	ranks[2*j+1] = (size_t)lo_id;
       }
+      samples.order_statistics(i, ranks, z_bounds);
     }
-    if (pdfOutput)
-      { extremeValues[i].first = min; extremeValues[i].second = max; }
 
     cntr += moment_offset;
     // ----------------
@@ -1745,34 +1936,9 @@ void NonDSampling::compute_level_mappings(const IntResponseMap& samples)
       }
     }
     for (j=0; j<pl_len+gl_len; j++, ++cntr) { // p/beta* -> z
-      Real p = (j<pl_len) ? requestedProbLevels[i][j] :	Pecos::
-	NormalRandomVariable::std_cdf(-requestedGenRelLevels[i][j-pl_len]);
-      Real p_cdf = (cdfFlag) ? p : 1. - p;
-      // since each sample has 1/N probability, p can be directly converted
-      // to an index within sorted_samples (id = p * N; index = id - 1)
-      // Note 1: duplicate samples are not aggregated (separate id increments).
-      // Note 2: since p_cdf(min_sample) = 1/N and p_cdf(max_sample) = 1, we
-      //   extrapolate to the left of min, but not to the right of max.
-      //   id < 1 indicates this extrapolation left of the min sample.
-      // Note 3: we exclude any extrapolated z from extremeValues; should we
-      //   omit any out-of-bounds resp levels within NonD::compute_densities()?
-      //   --> PDF estimation based only on z->p binning or p->z interpolation
-      //       within the sample bounds.
-      Real cdf_incr_id = p_cdf * (Real)num_samp, lo_id;
-      ss_it = sorted_samples.begin();
-      if (cdf_incr_id < 1.) { // extrapolate left of min sample using 1st slope
-	lo_id = 1.; extrapolated_mappings = true;
-	Cerr << "Warning: extrapolation required for response " << i+1;
-	if (j<pl_len) Cerr <<    " for probability level " << j+1       <<".\n";
-	else Cerr << " for generalized reliability level " << j+1-pl_len<<".\n";
-      }
-      else { // linear interpolation between closest neighbors in sequence
-        lo_id = std::floor(cdf_incr_id);
-	std::advance(ss_it, (size_t)lo_id - 1);
-      }
-      Real z, z_lo = *ss_it; ++ss_it;
-      if (ss_it == sorted_samples.end()) z = z_lo;
-      else          z = z_lo + (cdf_incr_id - lo_id) * (*ss_it - z_lo);
+      Real z, z_lo = z_bounds[2*j];
+      if ((size_t)lo_ids[j] >= num_samp) z = z_lo; // no upper neighbor
+      else z = z_lo + (cdf_incr_ids[j] - lo_ids[j]) * (z_bounds[2*j+1] - z_lo);
       if (j<pl_len) computedRespLevels[i][j] = z;
       else          computedRespLevels[i][j+bl_len] = z;
     }
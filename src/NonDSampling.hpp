@@ -15,6 +15,7 @@
 #include "DakotaNonD.hpp"
 #include "SamplerDriver.hpp"
 #include "SensAnalysisGlobal.hpp"
+#include "ColumnarSampleStore.hpp"
 #include "DataFitSurrModel.hpp"
 
 namespace Dakota {
@@ -111,6 +112,8 @@ public:
   /// called by compute_statistics() to calculate CDF/CCDF mappings of
   /// z to p/beta and of p/beta to z as well as PDFs
   void compute_level_mappings(const IntResponseMap& samples);
+  /// compute_level_mappings() from columnar samples
+  void compute_level_mappings(const ColumnarSampleStore& samples);
 
   /// prints the statistics computed in compute_statistics()
   void print_statistics(std::ostream& s) const;
@@ -284,6 +287,10 @@ protected:
   /// requests to activeSet used in evaluate_parameter_sets()
   virtual void active_set_mapping();
 
+  /// return true if statistics are to be computed from columnar samples
+  /// accumulated by evaluate_columnar_samples() rather than allResponses
+  virtual bool columnar_statistics() const;
+
   //
   //- Heading: Convenience member functions for derived classes
   //
@@ -291,6 +298,20 @@ protected:
   /// increments numLHSRuns, sets random seed, and initializes samplerDriver
   void initialize_sample_driver(bool write_message, size_t num_samples);
 
+  /// alternative to evaluate_parameter_sets() that evaluates allSamples
+  /// in batches, accumulating response function values in sampleColumns
+  /// in place of allResponses
+  void evaluate_columnar_samples(Model& model);
+
+  /// compute min/max intervals from columnar samples
+  void compute_intervals(const ColumnarSampleStore& samples);
+  /// compute moments and their confidence intervals from columnar samples
+  void compute_moments(const ColumnarSampleStore& samples);
+  /// convert the count, mean, and central sums of a set of samples to
+  /// unbiased central or standardized moments
+  static void central_sums_to_moments(const Real* sums, short moments_type,
+				      Real* moments);
+
   /// compute sampled subsets (all, active, uncertain) within all
   /// variables (acv/adiv/adrv) from samplingVarsMode and model
   void mode_counts(const Variables& vars, size_t& cv_start, size_t& num_cv,
@@ -351,6 +372,15 @@ protected:
   RealVector tiSampleSigmas;
   RealVector tiDstienSigmas;
 
+  /// flags accumulation of response samples in sampleColumns (in place of
+  /// allResponses) when the requested statistics allow it
+  bool columnarStats;
+  /// size of the per-function quantile sketches in sampleColumns, or zero
+  /// for exact statistics from stored samples
+  size_t quantileSketchSize;
+  /// columnar storage of response function samples
+  ColumnarSampleStore sampleColumns;
+
   bool statsFlag;   ///< flags computation/output of statistics
   bool allDataFlag; ///< flags update of allResponses
                     ///< (allVariables or allSamples already defined)
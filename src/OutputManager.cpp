@@ -7,6 +7,7 @@
     For more information, see the README file in the top Dakota directory.
     _______________________________________________________________________ */
 
+#include <filesystem>
 #include <memory>
 #include <utility>
 #include <boost/algorithm/string/predicate.hpp>
@@ -312,7 +313,8 @@ push_output_tag(const String& iterator_tag, const ProgramOptions& prog_opts,
   read_write_restart(force_rst_redirect, read_restart_flag, 
 		     prog_opts.read_restart_file() + file_tag,
 		     prog_opts.stop_restart_evals(),
-		     prog_opts.write_restart_file() + file_tag);
+		     prog_opts.write_restart_file() + file_tag,
+		     prog_opts.indexed_restart());
 }
 
 
@@ -664,6 +666,15 @@ void OutputManager::init_results_db()
     evaluation_store_db.set_database(hdf5_helper_ptr);
     evaluation_store_db.model_selection(modelEvalsSelection);
     evaluation_store_db.interface_selection(interfEvalsSelection);
+    // Optional tuning of evaluation storage: number of evaluations buffered
+    // per model/interface, dataset chunk size (bytes), deflate level (0-9)
+    const char* hdf5_opt;
+    if ((hdf5_opt = std::getenv("DAKOTA_HDF5_BUFFER_SIZE")))
+      evaluation_store_db.buffer_size(std::strtoul(hdf5_opt, 0, 10));
+    if ((hdf5_opt = std::getenv("DAKOTA_HDF5_CHUNK_SIZE")))
+      evaluation_store_db.chunk_size((int)std::strtol(hdf5_opt, 0, 10));
+    if ((hdf5_opt = std::getenv("DAKOTA_HDF5_COMPRESSION")))
+      evaluation_store_db.compression_level((int)std::strtol(hdf5_opt, 0, 10));
   #else
     Cerr << "WARNING: HDF5 results output was requested, but is not available in this build.\n";
   #endif
@@ -700,7 +711,8 @@ void OutputManager::read_write_restart(bool restart_requested,
 				       bool read_restart_flag,
 				       const String& read_restart_filename,
 				       size_t stop_restart_evals,
-				       const String& write_restart_filename)
+				       const String& write_restart_filename,
+				       bool indexed_restart)
 {
   // If no restart requested, push back a level that doesn't open
   // files so we can later pop it
@@ -720,6 +732,15 @@ void OutputManager::read_write_restart(bool restart_requested,
     return;
   }
 
+  // An indexed restart file is imported without echoing its records and
+  // is subsequently appended to rather than rewritten
+  if (read_restart_flag &&
+      IndexedRestart::is_indexed_restart(read_restart_filename)) {
+    read_write_indexed_restart(read_restart_filename, stop_restart_evals,
+			       write_restart_filename);
+    return;
+  }
+
   // Conditionally process the evaluations from the restart file
   PRPCache read_pairs;
   if (read_restart_flag) {
@@ -830,6 +851,8 @@ void OutputManager::read_write_restart(bool restart_requested,
   // writes must occur with a single output archive instance).  This
   // also improves behavior with stop_restart, as now only the desired
   // evals are rewritten, omitting any corrupt data at the end of file.
+  // (The indexed format, which serializes each record independently,
+  // restores append; see read_write_indexed_restart().)
 
   if (write_restart_filename == read_restart_filename)
     Cout << "Overwriting existing restart file '" << write_restart_filename 
@@ -841,8 +864,15 @@ void OutputManager::read_write_restart(bool restart_requested,
   try {
 
     // create a new restart destination
-    std::shared_ptr<RestartWriter>
-      rst_writer(new RestartWriter(write_restart_filename));
+    std::shared_ptr<RestartWriter> rst_writer;
+    if (indexed_restart) {
+      RestartVersion rst_version(DakotaBuildInfo::get_release_num(),
+				 DakotaBuildInfo::get_rev_number());
+      rst_writer.reset(new RestartWriter(std::unique_ptr<IndexedRestartWriter>(
+	new IndexedRestartWriter(write_restart_filename, rst_version))));
+    }
+    else
+      rst_writer.reset(new RestartWriter(write_restart_filename));
     restartDestinations.push_back(rst_writer);
 
     // Write any processed records from the old restart file to the new file.
@@ -894,6 +924,115 @@ void OutputManager::read_write_restart(bool restart_requested,
 }
 
 
+/** Records of an indexed restart file are decoded from a memory map
+    directly into data_pairs, without echoing them to Cout or staging
+    them in a temporary cache.  When the file is also the write target
+    and all of its records are retained, it is reopened in append mode
+    (discarding any torn trailing record) so that no records are copied.
+    Otherwise the retained records are copied byte-for-byte, without
+    re-encoding, to a new indexed file. */
+void OutputManager::
+read_write_indexed_restart(const String& read_restart_filename,
+			   size_t stop_restart_evals,
+			   const String& write_restart_filename)
+{
+  std::unique_ptr<IndexedRestartReader> reader;
+  size_t i, num_records, num_read;
+  try {
+
+    reader.reset(new IndexedRestartReader(read_restart_filename));
+    Cout << "Reading indexed restart file '" << read_restart_filename
+	 << "' containing: " << reader->restart_version();
+
+    num_records = num_read = reader->num_records();
+    if (!reader->clean_close())
+      Cout << "Warning: restart file '" << read_restart_filename
+	   << "' was not closed cleanly;\n  recovered " << num_records
+	   << " complete evaluations." << std::endl;
+    if (stop_restart_evals) { // cmd_line_handler rtns 0 if no setting
+      Cout << "Stopping restart file processing at "
+	   << stop_restart_evals << " evaluations." << std::endl;
+      num_read = std::min(num_read, stop_restart_evals);
+    }
+
+    for (i=0; i<num_read; ++i) {
+      ParamResponsePair current_pair;
+      try {
+	reader->read_record(i, current_pair);
+      }
+      catch(const boost::archive::archive_exception& e) {
+	Cerr << "\nError reading restart file '" << read_restart_filename
+	     << "'.\nYou may be able to recover the first " << i
+	     << " evaluations with -stop_restart " << i
+	     << ".\nDetails (boost::archive exception): "
+	     << e.what() << std::endl;
+	abort_handler(IO_ERROR);
+      }
+      // negate ids of restart evals in memory; see read_write_restart()
+      int restart_eval_id = current_pair.eval_id();
+      if (restart_eval_id > 0)
+	current_pair.eval_id(-restart_eval_id);
+      data_pairs.insert(current_pair);
+    }
+    Cout << "Restart file processing completed: " << num_read
+	 << " evaluations retrieved.\n";
+
+  }
+  catch (const boost::archive::archive_exception& e) {
+    // corrupt version header
+    Cerr << "\nError reading restart file '" << read_restart_filename
+	 << "' (corrupt header).\nDetails (Boost archive exception): "
+	 << e.what() << std::endl;
+    abort_handler(IO_ERROR);
+  }
+
+  try {
+
+    bool same_file = (write_restart_filename == read_restart_filename);
+    if (same_file && num_read == num_records)
+      Cout << "Appending to existing restart file '" << write_restart_filename
+	   << "'." << std::endl;
+    else {
+      if (same_file)
+	Cout << "Overwriting existing restart file '" << write_restart_filename
+	     << "'." << std::endl;
+      else
+	Cout << "Writing new restart file '" << write_restart_filename << "'."
+	     << std::endl;
+      // when truncating in place, stage the retained records in a
+      // temporary file so the mapped source remains intact
+      String copy_filename = (same_file) ?
+	write_restart_filename + ".tmp" : write_restart_filename;
+      {
+	RestartVersion rst_version(DakotaBuildInfo::get_release_num(),
+				   DakotaBuildInfo::get_rev_number());
+	IndexedRestartWriter copy_writer(copy_filename, rst_version);
+	for (i=0; i<num_read; ++i)
+	  copy_writer.append_serialized(reader->record_data(i),
+					reader->record_length(i),
+					reader->record_eval_id(i));
+      }
+      reader.reset();
+      if (same_file)
+	std::filesystem::rename(copy_filename, write_restart_filename);
+      reader.reset(new IndexedRestartReader(write_restart_filename));
+    }
+
+    std::shared_ptr<RestartWriter>
+      rst_writer(new RestartWriter(std::unique_ptr<IndexedRestartWriter>(
+	new IndexedRestartWriter(write_restart_filename, *reader))));
+    restartDestinations.push_back(rst_writer);
+    rst_writer->flush();
+
+  }
+  catch (const std::exception& e) {
+    Cerr << "\nError: could not write restart file '" << write_restart_filename
+	 << "'.\nDetails: " << e.what() << std::endl;
+    abort_handler(IO_ERROR);
+  }
+}
+
+
 OutputWriter::OutputWriter(std::ostream* output_stream)
 { outputStream = output_stream; }
 
@@ -1058,6 +1197,13 @@ RestartWriter::RestartWriter(const String& write_restart_filename,
 }
 
 
+RestartWriter::
+RestartWriter(std::unique_ptr<IndexedRestartWriter> indexed_writer):
+  restartOutputFilename(indexed_writer->filename()),
+  indexedWriter(std::move(indexed_writer))
+{  /* empty ctor */  }
+
+
 RestartWriter::RestartWriter(std::ostream& write_restart_ostream):
   restartOutputArchive(new boost::archive::binary_oarchive(write_restart_ostream))
 {
@@ -1073,7 +1219,9 @@ const String& RestartWriter::filename()
 
 void RestartWriter::append_prp(const ParamResponsePair& prp_in)
 { 
-  if (restartOutputArchive)  // equivalent to NULL check
+  if (indexedWriter)
+    indexedWriter->append_prp(prp_in);
+  else if (restartOutputArchive)  // equivalent to NULL check
     restartOutputArchive->operator&(prp_in);
   else {
     Cerr << "\nError: attempt to write to invalid restart file." << std::endl;
@@ -1082,7 +1230,12 @@ void RestartWriter::append_prp(const ParamResponsePair& prp_in)
 }
 
 void RestartWriter::flush()
-{ restartOutputFS.flush(); }
+{
+  if (indexedWriter)
+    indexedWriter->flush();
+  else
+    restartOutputFS.flush();
+}
 
 
 #ifdef Want_Heartbeat /*{*/
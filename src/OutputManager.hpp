@@ -17,6 +17,7 @@
 #include "dakota_tabular_io.hpp"
 #include "DakotaGraphics.hpp"
 #include "RestartVersion.hpp"
+#include "IndexedRestart.hpp"
 #include <memory>
 
 
@@ -132,6 +133,10 @@ public:
   /// alternate ctor taking a stream, helpful for testing; assumes
   /// client manages the output stream
   RestartWriter(std::ostream& write_restart_stream);
+
+  /// alternate ctor taking ownership of a writer for the indexed
+  /// restart format, to which all records are then directed
+  RestartWriter(std::unique_ptr<IndexedRestartWriter> indexed_writer);
   
   /// output filename for this writer
   const String& filename();
@@ -164,6 +169,9 @@ private:
   /// default ctor for oarchive and may not be initialized); 
   std::unique_ptr<boost::archive::binary_oarchive> restartOutputArchive;
 
+  /// writer for the indexed restart format, in lieu of restartOutputArchive
+  std::unique_ptr<IndexedRestartWriter> indexedWriter;
+
 };  // class RestartWriter
 
 
@@ -376,7 +384,14 @@ private:
   void read_write_restart(bool restart_requested, bool read_restart_flag,
 			  const String& read_restart_filename,
 			  size_t stop_restart_eval,
-			  const String& write_restart_filename);
+			  const String& write_restart_filename,
+			  bool indexed_restart);
+
+  /// import evaluations from an indexed restart file directly into
+  /// data_pairs, then append to it (or a new copy of it) in place
+  void read_write_indexed_restart(const String& read_restart_filename,
+				  size_t stop_restart_eval,
+				  const String& write_restart_filename);
 
   // -----
   // Data
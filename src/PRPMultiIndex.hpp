@@ -15,11 +15,15 @@
 #include "ParamResponsePair.hpp"
 
 #include <boost/multi_index_container.hpp>
+#include <boost/multi_index/composite_key.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/multi_index/ordered_index.hpp>
 
 #include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
 
 namespace bmi = boost::multi_index;
 
@@ -141,9 +145,30 @@ struct partial_prp_equality {
 };
 
 
+/// key extractor for the leading continuous variable of a PRPair
+
+/** Used by the nearby index of PRPMultiIndexCache to bound tolerance-based
+    lookups to a slab in the leading continuous variable.  Records without
+    continuous variables map to 0 and NaN maps to +inf in order to retain a
+    strict weak ordering. */
+struct leading_continuous_variable {
+  /// key type
+  typedef Real result_type;
+  /// access operator
+  Real operator()(const ParamResponsePair& prp) const
+  {
+    const RealVector& c_vars = prp.variables().all_continuous_variables();
+    if (c_vars.length() == 0) return 0.;
+    Real c0 = c_vars[0];
+    return (std::isnan(c0)) ? std::numeric_limits<Real>::infinity() : c0;
+  }
+};
+
+
 // tags
 struct ordered {};
 struct hashed  {};
+struct nearby_key {};
 //struct random  {};
 
 
@@ -164,7 +189,14 @@ typedef bmi::multi_index_container<Dakota::ParamResponsePair, bmi::indexed_by<
   // but distinct active set
   bmi::hashed_non_unique<bmi::tag<hashed>,
 			 bmi::identity<Dakota::ParamResponsePair>,
-                         partial_prp_hash, partial_prp_equality> > >
+                         partial_prp_hash, partial_prp_equality>,
+  // sorted by interfaceId and then leading continuous variable value, for
+  // sublinear candidate generation in tolerance-based (nearby) lookups
+  bmi::ordered_non_unique<bmi::tag<nearby_key>,
+    bmi::composite_key<Dakota::ParamResponsePair,
+		       bmi::const_mem_fun<Dakota::ParamResponsePair,
+		       const String&, &Dakota::ParamResponsePair::interface_id>,
+		       leading_continuous_variable> > > >
 PRPMultiIndexCache;
 
 typedef PRPMultiIndexCache PRPCache;
@@ -172,6 +204,7 @@ typedef PRPCache::index_iterator<ordered>::type       PRPCacheOIter;
 typedef PRPCache::index_const_iterator<ordered>::type PRPCacheOCIter;
 typedef PRPCache::index_iterator<hashed>::type        PRPCacheHIter;
 typedef PRPCache::index_const_iterator<hashed>::type  PRPCacheHCIter;
+typedef PRPCache::index_iterator<nearby_key>::type    PRPCacheNIter;
 typedef PRPCacheOIter  PRPCacheIter;  ///< default cache iterator <0>
 typedef PRPCacheOCIter PRPCacheCIter; ///< default cache const iterator <0>
 /// default cache const reverse iterator <0>
@@ -323,19 +356,61 @@ lookup_by_val(PRPMultiIndexCache& prp_cache, const String& search_interface_id,
 */
 
 
+/// find a ParamResponsePair within a PRPMultiIndexCache based on the
+/// interface id, tolerance-based equality of variables, and ActiveSet
+/// search data
+
+/** Candidates are restricted using the nearby index to the slab of
+    records with the same interface id whose leading continuous variable
+    satisfies the relative tolerance of nearby(); the full nearby() and
+    set_compare() tests are then applied to this subset.  Among multiple
+    matches, the first in ordered (evaluation id) sequence is returned,
+    consistent with a linear scan of the ordered index. */
 inline PRPCacheOIter
 lookup_by_nearby_val(PRPMultiIndexCache& prp_cache,
 		     const String& search_interface_id,
 		     const Variables& search_vars, const ActiveSet& search_set,
 		     Real tol)
 {
-  PRPCacheOIter cache_it;
-  for (cache_it=prp_cache.begin(); cache_it!=prp_cache.end(); ++cache_it)
-    if (cache_it->interface_id() == search_interface_id      && // exact
-	nearby(cache_it->variables(), search_vars, tol) && // tolerance
-	set_compare(*cache_it, search_set))                     // subset
-      return cache_it; // Duplication detected.
-  return prp_cache.end();
+  // Invert the relative test |1 - s/c| <= tol of nearby() for the range of
+  // cached values c given the search value s, widened by a few ulps to
+  // protect against roundoff (exact tests are applied below).  For tol >= 1,
+  // the range is unbounded and all records for this interface are scanned.
+  const RealVector& search_cv = search_vars.all_continuous_variables();
+  Real lower = -std::numeric_limits<Real>::infinity(),
+       upper =  std::numeric_limits<Real>::infinity();
+  if (search_cv.length() == 0)
+    lower = upper = 0.;
+  else if (tol < 1.) {
+    Real s = search_cv[0], widen = 4. * DBL_EPSILON;
+    if (std::abs(s) <= DBL_MIN)
+      { lower = -DBL_MIN; upper = DBL_MIN; }
+    else if (s > 0.) {
+      lower = s / (1. + tol) * (1. - widen);
+      upper = s / (1. - tol) * (1. + widen);
+    }
+    else if (s < 0.) {
+      lower = s / (1. - tol) * (1. + widen);
+      upper = s / (1. + tol) * (1. - widen);
+    }
+    // else NaN search value: scan all records for this interface
+  }
+
+  PRPCache::index<nearby_key>::type& nearby_index = prp_cache.get<nearby_key>();
+  PRPCacheNIter n_it
+    = nearby_index.lower_bound(boost::make_tuple(search_interface_id, lower)),
+    n_end
+    = nearby_index.upper_bound(boost::make_tuple(search_interface_id, upper));
+  PRPCacheOIter best_it = prp_cache.end();
+  for (; n_it != n_end; ++n_it)
+    if (nearby(n_it->variables(), search_vars, tol) && // tolerance
+	set_compare(*n_it, search_set)) {              // subset
+      PRPCacheOIter ord_it = prp_cache.project<ordered>(n_it);
+      if (best_it == prp_cache.end() ||
+	  ord_it->eval_interface_ids() < best_it->eval_interface_ids())
+	best_it = ord_it;
+    }
+  return best_it; // Duplication detected if != end()
 }
 
 
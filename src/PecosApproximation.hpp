@@ -289,6 +289,12 @@ protected:
   const Pecos::RealVector&    gradient(const Variables& vars) override;
   /// retrieve the approximate function Hessian for a given parameter vector
   const Pecos::RealSymMatrix& hessian(const Variables& vars) override;
+  /// retrieve the approximate function values for a batch of points
+  void batch_value(const Variables& vars, const RealMatrix& c_vars,
+		   RealVector& fn_vals) override;
+  /// retrieve the approximate function gradients for a batch of points
+  void batch_gradient(const Variables& vars, const RealMatrix& c_vars,
+		      RealMatrix& fn_grads) override;
 
   int min_coefficients() const override;
   //int num_constraints() const; // use default implementation
@@ -749,6 +755,36 @@ hessian(const Variables& vars)
 }
 
 
+// ignore discrete variables for now; points are passed to Pecos as views
+inline void PecosApproximation::
+batch_value(const Variables& vars, const RealMatrix& c_vars,
+	    RealVector& fn_vals)
+{
+  int p, num_pts = c_vars.numCols(), num_cv = c_vars.numRows();
+  fn_vals.sizeUninitialized(num_pts);
+  for (p=0; p<num_pts; ++p) {
+    RealVector x(Teuchos::View, const_cast<Real*>(c_vars[p]), num_cv);
+    fn_vals[p] = pecosBasisApprox.value(x);
+  }
+}
+
+
+// ignore discrete variables for now
+inline void PecosApproximation::
+batch_gradient(const Variables& vars, const RealMatrix& c_vars,
+	       RealMatrix& fn_grads)
+{
+  int p, num_pts = c_vars.numCols(), num_cv = c_vars.numRows();
+  fn_grads.shapeUninitialized(num_cv, num_pts);
+  for (p=0; p<num_pts; ++p) {
+    RealVector x(Teuchos::View, const_cast<Real*>(c_vars[p]), num_cv);
+    const RealVector& grad = polyApproxRep->gradient_basis_variables(x);
+    for (int i=0; i<num_cv; ++i)
+      fn_grads(i,p) = grad[i];
+  }
+}
+
+
 inline int PecosApproximation::min_coefficients() const
 { return pecosBasisApprox.min_coefficients(); }
 
@@ -0,0 +1,257 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "PersistentDriverPool.hpp"
+#include "dakota_global_defs.hpp"
+#include "WorkdirHelper.hpp"
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace Dakota {
+
+PersistentDriverPool::PersistentDriverPool(const StringArray& driver_and_args):
+  driverArgs(driver_and_args), numOutstanding(0), numRestarts(0)
+{
+  if (driverArgs.empty()) {
+    Cerr << "\nError: empty analysis driver for persistent driver pool."
+	 << std::endl;
+    abort_handler(-1);
+  }
+}
+
+
+PersistentDriverPool::~PersistentDriverPool()
+{
+  // end of file on the socket is the request to exit
+  for (auto& worker : workers)
+    if (worker.socketFd >= 0)
+      { close(worker.socketFd); worker.socketFd = -1; }
+
+  // allow up to 2 seconds for the workers to exit before terminating them
+  for (int i=0; i<200; ++i) {
+    bool running = false;
+    for (auto& worker : workers)
+      if (worker.pid > 0) {
+	int status;
+	if (waitpid(worker.pid, &status, WNOHANG) != 0) worker.pid = 0;
+	else                                             running = true;
+      }
+    if (!running)
+      break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  for (auto& worker : workers)
+    stop_worker(worker);
+}
+
+
+void PersistentDriverPool::submit(int eval_id, const String& request)
+{
+  String message(request);
+  message += '\n';
+  ++numOutstanding;
+
+  Worker* worker = &acquire_worker();
+  if (!send_message(*worker, message)) {
+    // the worker exited after its last reply; retry once on a new process
+    stop_worker(*worker);
+    worker = &acquire_worker();
+    if (!send_message(*worker, message)) {
+      stop_worker(*worker);
+      pendingFailures.insert(eval_id);
+      return;
+    }
+  }
+  worker->evalId = eval_id;
+}
+
+
+void PersistentDriverPool::
+wait_some(std::map<int, String>& replies, IntSet& failures, int timeout_ms)
+{
+  size_t found = pendingFailures.size();
+  failures.insert(pendingFailures.begin(), pendingFailures.end());
+  pendingFailures.clear();
+
+  std::vector<struct pollfd> poll_fds;
+  std::vector<size_t> worker_index;
+  do {
+    poll_fds.clear(); worker_index.clear();
+    for (size_t i=0; i<workers.size(); ++i)
+      if (workers[i].evalId >= 0) {
+	struct pollfd pfd = { workers[i].socketFd, POLLIN, 0 };
+	poll_fds.push_back(pfd); worker_index.push_back(i);
+      }
+    if (poll_fds.empty())
+      break;
+
+    // once something has completed, only collect other completions
+    int num_ready = poll(poll_fds.data(), poll_fds.size(),
+			 (found) ? 0 : timeout_ms);
+    if (num_ready < 0) {
+      if (errno == EINTR)
+	continue;
+      Cerr << "\nError: poll failure on persistent analysis drivers; "
+	   << std::strerror(errno) << std::endl;
+      abort_handler(-1);
+    }
+    for (size_t i=0; i<poll_fds.size(); ++i)
+      if (poll_fds[i].revents &&
+	  receive_reply(workers[worker_index[i]], replies, failures))
+	++found;
+  } while (!found && timeout_ms < 0);
+
+  numOutstanding -= found;
+}
+
+
+void PersistentDriverPool::start_worker(Worker& worker)
+{
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+    Cerr << "\nError: cannot create socket for persistent analysis driver; "
+	 << std::strerror(errno) << std::endl;
+    abort_handler(-1);
+  }
+  // neither end may leak into other workers; the child re-enables its end
+  fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+  fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+#ifdef SO_NOSIGPIPE
+  int no_sigpipe = 1;
+  setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe));
+#endif
+
+  // allocate the argument array and set the environment before fork
+  std::vector<const char*> av;
+  for (const auto& arg : driverArgs)
+    av.push_back(arg.c_str());
+  av.push_back(NULL);
+  WorkdirHelper::set_preferred_path();
+  WorkdirHelper::set_environment("DAKOTA_WORKER_FD", std::to_string(fds[1]),
+				 true);
+  Cout << std::flush;
+
+  // workers are started once rather than per evaluation, so fork (rather
+  // than vfork) is used unconditionally
+  pid_t pid = fork();
+  if (pid == -1) {
+    Cerr << "\nCould not fork persistent analysis driver; error code "
+	 << errno << " (" << std::strerror(errno) << ")" << std::endl;
+    abort_handler(-1);
+  }
+  if (pid == 0) { // child
+    fcntl(fds[1], F_SETFD, 0);
+    int status = execvp(av[0], (char*const*)av.data());
+    _exit(status);
+  }
+
+  unsetenv("DAKOTA_WORKER_FD");
+  close(fds[1]);
+  worker.pid = pid;
+  worker.socketFd = fds[0];
+  worker.evalId = -1;
+  worker.replyBuffer.clear();
+}
+
+
+void PersistentDriverPool::stop_worker(Worker& worker)
+{
+  if (worker.socketFd >= 0)
+    { close(worker.socketFd); worker.socketFd = -1; }
+  if (worker.pid > 0) {
+    // a worker that closed its socket but did not exit is terminated
+    int status;
+    if (waitpid(worker.pid, &status, WNOHANG) == 0) {
+      kill(worker.pid, SIGKILL);
+      waitpid(worker.pid, &status, 0);
+    }
+    worker.pid = 0;
+  }
+  worker.evalId = -1;
+  worker.replyBuffer.clear();
+}
+
+
+PersistentDriverPool::Worker& PersistentDriverPool::acquire_worker()
+{
+  for (auto& worker : workers)
+    if (worker.pid > 0 && worker.evalId < 0) {
+      // an idle worker has nothing to say: hangup or unsolicited output
+      // means that it exited or cannot be trusted with another request
+      struct pollfd pfd = { worker.socketFd, POLLIN, 0 };
+      if (poll(&pfd, 1, 0) == 0)
+	return worker;
+      stop_worker(worker);
+    }
+
+  for (auto& worker : workers)
+    if (worker.pid == 0)
+      { start_worker(worker); ++numRestarts; return worker; }
+
+  workers.push_back(Worker{0, -1, -1, String()});
+  start_worker(workers.back());
+  return workers.back();
+}
+
+
+bool PersistentDriverPool::send_message(Worker& worker, const String& message)
+{
+#ifdef MSG_NOSIGNAL
+  const int flags = MSG_NOSIGNAL; // EPIPE rather than SIGPIPE
+#else
+  const int flags = 0;
+#endif
+  size_t sent = 0;
+  while (sent < message.size()) {
+    ssize_t num_sent = send(worker.socketFd, message.data() + sent,
+			    message.size() - sent, flags);
+    if (num_sent < 0) {
+      if (errno == EINTR)
+	continue;
+      return false;
+    }
+    sent += num_sent;
+  }
+  return true;
+}
+
+
+bool PersistentDriverPool::
+receive_reply(Worker& worker, std::map<int, String>& replies, IntSet& failures)
+{
+  char buffer[4096];
+  ssize_t num_read = recv(worker.socketFd, buffer, sizeof(buffer), 0);
+  if (num_read < 0 && (errno == EINTR || errno == EAGAIN))
+    return false;
+  if (num_read <= 0) { // the worker exited or closed its socket
+    failures.insert(worker.evalId);
+    stop_worker(worker);
+    return true;
+  }
+
+  worker.replyBuffer.append(buffer, num_read);
+  size_t end_of_line = worker.replyBuffer.find('\n');
+  if (end_of_line == String::npos)
+    return false;
+  replies[worker.evalId] = worker.replyBuffer.substr(0, end_of_line);
+  worker.replyBuffer.clear();
+  worker.evalId = -1;
+  return true;
+}
+
+} // namespace Dakota
@@ -0,0 +1,148 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#ifndef PERSISTENT_DRIVER_POOL_H
+#define PERSISTENT_DRIVER_POOL_H
+
+#include "dakota_data_types.hpp"
+#include <map>
+#include <vector>
+#include <sys/types.h>
+
+namespace Dakota {
+
+/// Pool of long-lived analysis driver processes exchanging evaluations
+/// over sockets
+
+/** PersistentDriverPool launches an analysis driver once per worker
+    rather than once per evaluation.  Each worker is connected to Dakota
+    through a Unix domain socket pair whose descriptor is passed to the
+    driver in the DAKOTA_WORKER_FD environment variable.  Requests and
+    replies are single lines of text (newline-terminated); a worker
+    serves one request at a time and should exit when it reads end of
+    file.  Workers are started on demand, so the pool grows to the
+    number of concurrently submitted evaluations.  A worker that exits
+    or closes its socket is reaped, the evaluation it was serving is
+    reported as failed, and its slot is refilled with a new process when
+    the next evaluation is submitted.  Completed evaluations are
+    retrieved with wait_some() (modeled after MPI_Waitsome()) or
+    test_some() (modeled after MPI_Testsome()). */
+class PersistentDriverPool
+{
+public:
+
+  //
+  //- Heading: Constructors and destructor
+  //
+
+  /// constructor; driver_and_args is the tokenized driver command
+  PersistentDriverPool(const StringArray& driver_and_args);
+  /// destructor closes all sockets and reaps the workers
+  ~PersistentDriverPool();
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// send request (one line, without the terminating newline) for
+  /// evaluation eval_id to an idle worker, starting one if needed
+  void submit(int eval_id, const String& request);
+
+  /// block until at least one submitted evaluation completes or fails,
+  /// or timeout_ms milliseconds elapse (negative for no timeout); insert
+  /// replies by eval id into replies and evaluations whose worker
+  /// exited into failures
+  void wait_some(std::map<int, String>& replies, IntSet& failures,
+		 int timeout_ms = -1);
+  /// nonblocking version of wait_some()
+  void test_some(std::map<int, String>& replies, IntSet& failures);
+
+  /// number of submitted evaluations not yet returned through
+  /// wait_some() / test_some()
+  size_t num_outstanding() const;
+
+  /// number of worker slots (running or awaiting restart)
+  size_t num_workers() const;
+  /// number of workers started to replace one that exited
+  size_t num_restarts() const;
+
+private:
+
+  //
+  //- Heading: Convenience types
+  //
+
+  /// a worker process and the state of its connection
+  struct Worker {
+    /// process id, or 0 if the slot awaits a new process
+    pid_t pid;
+    /// Dakota's end of the socket pair
+    int socketFd;
+    /// evaluation being served, or -1 if idle
+    int evalId;
+    /// partial reply received so far
+    String replyBuffer;
+  };
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// launch a new driver process into worker
+  void start_worker(Worker& worker);
+  /// close the socket of a worker that exited (or must be abandoned)
+  /// and reap its process
+  void stop_worker(Worker& worker);
+  /// return an idle, live worker, starting or restarting one if needed
+  Worker& acquire_worker();
+  /// write all of message to the worker; returns false if the socket
+  /// is no longer connected
+  bool send_message(Worker& worker, const String& message);
+  /// read available data from a busy worker, recording a completed
+  /// reply or failure; returns true if the evaluation is finished
+  bool receive_reply(Worker& worker, std::map<int, String>& replies,
+		     IntSet& failures);
+
+  //
+  //- Heading: Data
+  //
+
+  /// driver program followed by its arguments
+  StringArray driverArgs;
+  /// worker slots; the pool grows to the evaluation concurrency
+  std::vector<Worker> workers;
+  /// evaluations that failed on submission, returned by the next
+  /// wait_some() / test_some()
+  IntSet pendingFailures;
+  /// submitted but not yet returned evaluations
+  size_t numOutstanding;
+  /// number of replacement workers started
+  size_t numRestarts;
+};
+
+
+inline void PersistentDriverPool::
+test_some(std::map<int, String>& replies, IntSet& failures)
+{ wait_some(replies, failures, 0); }
+
+
+inline size_t PersistentDriverPool::num_outstanding() const
+{ return numOutstanding; }
+
+
+inline size_t PersistentDriverPool::num_workers() const
+{ return workers.size(); }
+
+
+inline size_t PersistentDriverPool::num_restarts() const
+{ return numRestarts; }
+
+} // namespace Dakota
+
+#endif
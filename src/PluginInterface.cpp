@@ -79,20 +79,53 @@ void PluginInterface::derived_map(const Variables& vars, const ActiveSet& set,
   populate_response(plugin_response, response);
 }
 
+/** Batch evaluations are deferred to wait_local_evaluations().
+    Otherwise the plugin must report itself thread safe, in which case
+    each evaluation is executed on a pool of asynchLocalEvalConcurrency
+    worker threads. */
 void PluginInterface::derived_map_asynch(const ParamResponsePair& pair)
 {
-  // This interface only supports bulk synchronous batch evals for now
-  // TODO: Catch this at construct time
-  if (!batchEval) {
+  if (batchEval)
+    return; // batch is launched as a unit at synchronization time
+
+  // loading at first map to head off conflicting Python issues
+  load_plugin();
+  if (!pluginInterface->thread_safe()) {
     Cerr << "\nError: Plugin interfaces support single or batch evaluations, "
-	 << "but not\nasynchronous.\n";
+	 << "but asynchronous\nevaluations require a thread-safe plugin "
+	 << "(DakotaInterfaceAPI::thread_safe()).\n";
     abort_handler(INTERFACE_ERROR);
   }
+
+  if (!evalThreadPool) {
+    size_t num_threads = (asynchLocalEvalConcurrency > 0) ?
+      (size_t)asynchLocalEvalConcurrency : 0; // 0 = hardware concurrency
+    evalThreadPool.reset(new EvaluationThreadPool(num_threads));
+    if (outputLevel >= VERBOSE_OUTPUT)
+      Cout << "Plugin interface: launched " << evalThreadPool->num_threads()
+	   << " evaluation threads." << std::endl;
+  }
+
+  // form the request on the scheduling thread; only the plugin evaluation
+  // and the response population (private to this evaluation) are threaded
+  int fn_eval_id = pair.eval_id();
+  Response response(pair.response()); // shallow copy
+  DakotaPlugins::EvalRequest plugin_request =
+    form_eval_request(pair.variables(), pair.active_set(), fn_eval_id);
+  evalThreadPool->submit(fn_eval_id,
+    [this, response, plugin_request = std::move(plugin_request)]() mutable {
+      populate_response(pluginInterface->evaluate(plugin_request), response);
+    });
 }
 
 
 void PluginInterface::wait_local_evaluations(PRPQueue& prp_queue)
 {
+  if (!batchEval) {
+    process_thread_completions(prp_queue, BLOCK);
+    return;
+  }
+
   // loading at first map to head off conflicting Python issues
   load_plugin();
 
@@ -119,6 +152,46 @@ void PluginInterface::wait_local_evaluations(PRPQueue& prp_queue)
 }
 
 
+void PluginInterface::test_local_evaluations(PRPQueue& prp_queue)
+{
+  if (batchEval) wait_local_evaluations(prp_queue);
+  else           process_thread_completions(prp_queue, FALL_THROUGH);
+}
+
+
+void PluginInterface::
+process_thread_completions(PRPQueue& prp_queue, short block_flag)
+{
+  if (!evalThreadPool) {
+    Cerr << "\nError: asynchronous plugin evaluations not active in "
+	 << "PluginInterface::process_thread_completions().\n";
+    abort_handler(INTERFACE_ERROR);
+  }
+
+  std::map<int, std::exception_ptr> failures;
+  if (block_flag == BLOCK) evalThreadPool->wait_some(completionSet, failures);
+  else                     evalThreadPool->test_some(completionSet, failures);
+
+  // manage simulation failures on the scheduling thread, where
+  // manage_failure() may safely update the interface state
+  for (const auto& fail : failures) {
+    int fn_eval_id = fail.first;
+    PRPQueueIter queue_it = lookup_by_eval_id(prp_queue, fn_eval_id);
+    if (queue_it == prp_queue.end()) {
+      Cerr << "\nError: failure in queue lookup within PluginInterface::"
+	   << "process_thread_completions().\n";
+      abort_handler(INTERFACE_ERROR);
+    }
+    try { std::rethrow_exception(fail.second); }
+    catch (const FunctionEvalFailure& fneval_except) {
+      Response response(queue_it->response()); // shallow copy
+      manage_failure(queue_it->variables(), response.active_set(), response,
+		     fn_eval_id);
+    }
+  }
+}
+
+
 /** Load plugin if not already active */
 void PluginInterface::load_plugin()
 {
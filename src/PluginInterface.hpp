@@ -11,6 +11,7 @@
 #define DAKOTA_PLUGIN_INTERFACE_H
 
 #include "ApplicationInterface.hpp"
+#include "EvaluationThreadPool.hpp"
 #include "plugins/DakotaInterfaceAPI.hpp"
 
 #include <boost/shared_ptr.hpp> // blech
@@ -33,9 +34,13 @@ public:
   void derived_map_asynch(const ParamResponsePair& pair) override;
 
   /// For plugins, implements blocking bulk-synchronous evaluation of
-  /// batch (PRPQueue)
+  /// batch (PRPQueue) or blocking capture of threaded evaluations
   void wait_local_evaluations(PRPQueue& prp_queue) override;
 
+  /// nonblocking capture of threaded evaluations (batches are
+  /// evaluated as a unit through wait_local_evaluations())
+  void test_local_evaluations(PRPQueue& prp_queue) override;
+
 
 protected:
 
@@ -65,11 +70,19 @@ protected:
   /// potentially be executed concurrently via MPI)
   StringArray analysisDrivers;
 
+  /// pool of worker threads for asynchronous local evaluations with
+  /// thread-safe plugins (lazily constructed)
+  std::unique_ptr<EvaluationThreadPool> evalThreadPool;
+
 private:
 
   /// validate that the plugin exists on the filesystem
   void check_plugin_exists();
 
+  /// update completionSet from evalThreadPool; blocking if block_flag
+  /// is BLOCK
+  void process_thread_completions(PRPQueue& prp_queue, short block_flag);
+
 };
 
 }
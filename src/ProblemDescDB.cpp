@@ -218,13 +218,21 @@ void ProblemDescDB::enable_json_input(const String & json_file)
   if (ir_debug_logging_enabled())
     std::cerr << "ProblemDescDB::enable_json_input: starting for '" << json_file << "'" << std::endl;
 
-  const json study_json = load_json_from_file(json_file);
+  json study_json = load_json_from_file(json_file);
   log_top_level_json_shape(study_json, json_file);
 
-  enable_json_input(study_json);
+  enable_json_input(std::move(study_json));
 }
 
 void ProblemDescDB::enable_json_input(const nlohmann::json& study_json)
+{
+  enable_json_input(nlohmann::json(study_json));
+}
+
+/** The study JSON is retained (for broadcast and dumps) after it is
+    materialized; taking it by rvalue moves the document into place, so
+    large inputs are not deep-copied once more at startup. */
+void ProblemDescDB::enable_json_input(nlohmann::json&& study_json)
 {
   if (ir_debug_logging_enabled())
     log_top_level_json_shape(study_json, "<in-memory>");
@@ -240,23 +248,15 @@ void ProblemDescDB::enable_json_input(const nlohmann::json& study_json)
     throw;
   }
 
-  if (dbRep) {
-    dbRep->validatedStudyJson = study_json;
-    dbRep->irState = std::move(materialized);
-    if (dbRep->dataMethodList.empty())
-      dbRep->populate_skeleton_data_from_ir();
-  }
-  else {
-    validatedStudyJson = study_json;
-    irState = std::move(materialized);
-    if (dataMethodList.empty())
-      populate_skeleton_data_from_ir();
-  }
+  ProblemDescDB* db = dbRep ? dbRep.get() : this;
+  db->validatedStudyJson = std::move(study_json);
+  db->irState = std::move(materialized);
+  if (db->dataMethodList.empty())
+    db->populate_skeleton_data_from_ir();
 
   if (ir_debug_logging_enabled()) {
-    const ProblemDescDB* db = dbRep ? dbRep.get() : this;
     std::cerr << "ProblemDescDB::enable_json_input: materialized IR sizes"
-              << " environment=" << db->irState->environment.values().size()
+              << " environment=" << db->irState->environment.size()
               << " method=" << db->irState->method.size()
               << " model=" << db->irState->model.size()
               << " variables=" << db->irState->variables.size()
@@ -303,7 +303,7 @@ void ProblemDescDB::populate_skeleton_data_from_ir()
   if (db->irState->environment.contains("top_method_pointer"))
     db->environmentSpec.data_rep()->topMethodPointer =
       db->irState->environment.get<String>("top_method_pointer");
-  if (!db->irState->environment.values().empty())
+  if (!db->irState->environment.empty())
     db->environmentCntr = 1;
 
   db->dataMethodList.clear();
@@ -1231,6 +1231,37 @@ split_entry_name(const std::string& entry_name, const std::string& context_msg)
   return std::make_pair(block, entry);
 }
 
+/** Returns NULL when no IR is materialized or when the active store has
+    no value of type T for key, in which case callers use the Data*Rep
+    lookups.  Executes on the letter. */
+template <typename T>
+const T* ProblemDescDB::find_ir(irgen::IRKey key) const
+{
+  if constexpr (variant_contains_v<T, IRValue>) {
+    if (!irState)
+      return nullptr;
+
+    switch (ir_keys::block(key)) {
+    case irgen::BlockType::Environment: break;
+    case irgen::BlockType::Method:    if (methodDBLocked)    Locked_db(); break;
+    case irgen::BlockType::Model:     if (modelDBLocked)     Locked_db(); break;
+    case irgen::BlockType::Variables: if (variablesDBLocked) Locked_db(); break;
+    case irgen::BlockType::Interface: if (interfaceDBLocked) Locked_db(); break;
+    case irgen::BlockType::Responses: if (responsesDBLocked) Locked_db(); break;
+    }
+
+    try {
+      return ir_query::find<T>(*irState, key);
+    }
+    catch (const std::exception&) {
+      // no store for the active selection
+      return nullptr;
+    }
+  }
+  else
+    return nullptr;
+}
+
 template <typename T>
 const T& ProblemDescDB::
 get(const std::string& context_msg,
@@ -1246,6 +1277,13 @@ get(const std::string& context_msg,
   if (!db_rep)
     Null_rep(context_msg);
 
+  // Values are read from the IR when present; keys it does not (yet) cover
+  // fall through to legacy Data*Rep access.
+  irgen::IRKey key;
+  if (db_rep->irState && ir_keys::find(entry_name, key))
+    if (const auto* value = db_rep->find_ir<std::remove_const_t<T>>(key))
+      return *value;
+
   std::string block, entry;
   std::tie(block, entry) = split_entry_name(entry_name, context_msg);
 
@@ -1260,19 +1298,6 @@ get(const std::string& context_msg,
   else if (block == "responses" && db_rep->responsesDBLocked)
     Locked_db();
 
-  using QueryT = std::remove_const_t<T>;
-  if constexpr (variant_contains_v<QueryT, IRValue>) {
-    if (db_rep->irState) {
-      try {
-        return ir_query::get<QueryT>(*db_rep->irState, entry_name);
-      }
-      catch (const std::exception&) {
-        // Fall through to legacy Data*Rep access while the IR implementation
-        // is still being filled in incrementally.
-      }
-    }
-  }
-
   if (block == "environment") {
     auto it = env_map.find(entry);
     if (it != env_map.end())
@@ -1669,6 +1694,8 @@ const IntVector& ProblemDescDB::get_iv(const String& entry_name) const
     },
     { /* interface */ },
     { /* responses */
+      {"jacobian_sparsity.nonzero_functions", P_RES jacSparsityFns},
+      {"jacobian_sparsity.nonzero_variables", P_RES jacSparsityVars},
       {"lengths", P_RES fieldLengths},
       {"num_coordinates_per_field", P_RES numCoordsPerField}
     },
@@ -2364,6 +2391,7 @@ const Real& ProblemDescDB::get_real(const String& entry_name) const
     },
     { /* variables */ },
     { /* interface */
+      {"cache_memory_limit", P_INT evalCacheMemLimit},
       {"nearby_evaluation_cache_tolerance", P_INT nearbyEvalCacheTol}
     },
     { /* responses */ },
@@ -2456,6 +2484,7 @@ int ProblemDescDB::get_int(const String& entry_name) const
       {"asynch_local_analysis_concurrency", P_INT asynchLocalAnalysisConcurrency},
       {"asynch_local_evaluation_concurrency", P_INT asynchLocalEvalConcurrency},
       {"direct.processors_per_analysis", P_INT procsPerAnalysis},
+      {"evaluation_prefetch", P_INT evalPrefetch},
       {"evaluation_servers", P_INT evalServers},
       {"failure_capture.retry_limit", P_INT retryLimit},
       {"processors_per_evaluation", P_INT procsPerEval}
@@ -2698,6 +2727,7 @@ size_t ProblemDescDB::get_sizet(const String& entry_name) const
       {"nond.c3function_train.max_rank", P_MET maxRank},
       {"nond.c3function_train.start_rank", P_MET startRank},
       {"nond.collocation_points", P_MET collocationPoints},
+      {"nond.concurrent_mpp_searches", P_MET concurrentMPPSearches},
       {"nond.cross_validation.max_rank_candidates", P_MET maxCVRankCandidates},
       {"nond.expansion_samples", P_MET expansionSamples},
       {"nond.max_refinement_iterations", P_MET maxRefineIterations},
@@ -2705,7 +2735,8 @@ size_t ProblemDescDB::get_sizet(const String& entry_name) const
       {"nond.rcond_best_throttle", P_MET rCondBestThrottle},
       {"num_candidate_designs", P_MET numCandidateDesigns},
       {"num_candidates", P_MET numCandidates},
-      {"num_prediction_configs", P_MET numPredConfigs}
+      {"num_prediction_configs", P_MET numPredConfigs},
+      {"quantile_sketch", P_MET quantileSketchSize}
     },
     { /* model */
       {"c3function_train.collocation_points", P_MOD collocationPoints},
@@ -2805,6 +2836,7 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
       {"coliny.expansion", P_MET expansionFlag},
       {"coliny.randomize", P_MET randomizeOrderFlag},
       {"coliny.show_misc_options", P_MET showMiscOptions},
+      {"columnar_statistics", P_MET columnarStats},
       {"derivative_usage", P_MET methodUseDerivsFlag},
       {"export_surrogate", P_MET exportSurrogate},
       {"fixed_seed", P_MET fixedSeedFlag},
@@ -2813,6 +2845,7 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
       {"import_build_active_only", P_MET importBuildActive},
       {"import_points.active_only", P_MET importPtsActive},
       {"import_points.use_variable_labels", P_MET importPtsUseVariableLabels},
+      {"is_approx", P_MET modelEvidIS},
       {"laplace_approx", P_MET modelEvidLaplace},
       {"latinize", P_MET latinizeFlag},
       {"main_effects", P_MET mainEffectsFlag},
@@ -2907,14 +2940,17 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
       {"allow_existing_results", P_INT allowExistingResultsFlag},
       {"application.file_save", P_INT fileSaveFlag},
       {"application.file_tag", P_INT fileTagFlag},
+      {"application.persistent", P_INT persistentFlag},
       {"application.verbatim", P_INT verbatimFlag},
       {"asynch", P_INT asynchFlag},
       {"batch", P_INT batchEvalFlag},
+      {"dirRecycle", P_INT dirRecycle},
       {"dirSave", P_INT dirSave},
       {"dirTag", P_INT dirTag},
       {"evaluation_cache", P_INT evalCacheFlag},
       {"labeled_results", P_INT dakotaResultsFileLabeled},
       {"nearby_evaluation_cache", P_INT nearbyEvalCacheFlag},
+      {"python.columnar", P_INT columnarFlag},
       {"python.numpy", P_INT numpyFlag},
       {"restart_file", P_INT restartFileFlag},
       {"templateReplace", P_INT templateReplace},
@@ -2925,6 +2961,7 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
       {"central_hess", P_RES centralHess},
       {"ignore_bounds", P_RES ignoreBounds},
       {"interpolate", P_RES interpolateFlag},
+      {"jacobian_sparsity.detect", P_RES jacSparsityDetect},
       {"read_field_coordinates", P_RES readFieldCoords}
     },
     entry_name, dbRep);
@@ -2943,6 +2980,106 @@ void** ProblemDescDB::get_voidss(const String& entry_name) const
 }
 
 
+const RealVector& ProblemDescDB::get_rv(irgen::IRKey key) const
+{
+  if (!dbRep)
+    Null_rep("get_rv()");
+  if (const RealVector* value = dbRep->find_ir<RealVector>(key))
+    return *value;
+  return get_rv(String(ir_keys::full_name(key)));
+}
+
+
+const IntVector& ProblemDescDB::get_iv(irgen::IRKey key) const
+{
+  if (!dbRep)
+    Null_rep("get_iv()");
+  if (const IntVector* value = dbRep->find_ir<IntVector>(key))
+    return *value;
+  return get_iv(String(ir_keys::full_name(key)));
+}
+
+
+const StringArray& ProblemDescDB::get_sa(irgen::IRKey key) const
+{
+  if (!dbRep)
+    Null_rep("get_sa()");
+  if (const StringArray* value = dbRep->find_ir<StringArray>(key))
+    return *value;
+  return get_sa(String(ir_keys::full_name(key)));
+}
+
+
+const String& ProblemDescDB::get_string(irgen::IRKey key) const
+{
+  if (!dbRep)
+    Null_rep("get_string()");
+  if (const String* value = dbRep->find_ir<String>(key))
+    return *value;
+  return get_string(String(ir_keys::full_name(key)));
+}
+
+
+const Real& ProblemDescDB::get_real(irgen::IRKey key) const
+{
+  if (!dbRep)
+    Null_rep("get_real()");
+  if (const Real* value = dbRep->find_ir<Real>(key))
+    return *value;
+  return get_real(String(ir_keys::full_name(key)));
+}
+
+
+int ProblemDescDB::get_int(irgen::IRKey key) const
+{
+  if (!dbRep)
+    Null_rep("get_int()");
+  if (const int* value = dbRep->find_ir<int>(key))
+    return *value;
+  return get_int(String(ir_keys::full_name(key)));
+}
+
+
+short ProblemDescDB::get_short(irgen::IRKey key) const
+{
+  if (!dbRep)
+    Null_rep("get_short()");
+  if (const short* value = dbRep->find_ir<short>(key))
+    return *value;
+  return get_short(String(ir_keys::full_name(key)));
+}
+
+
+unsigned short ProblemDescDB::get_ushort(irgen::IRKey key) const
+{
+  if (!dbRep)
+    Null_rep("get_ushort()");
+  if (const unsigned short* value = dbRep->find_ir<unsigned short>(key))
+    return *value;
+  return get_ushort(String(ir_keys::full_name(key)));
+}
+
+
+size_t ProblemDescDB::get_sizet(irgen::IRKey key) const
+{
+  if (!dbRep)
+    Null_rep("get_sizet()");
+  if (const size_t* value = dbRep->find_ir<size_t>(key))
+    return *value;
+  return get_sizet(String(ir_keys::full_name(key)));
+}
+
+
+bool ProblemDescDB::get_bool(irgen::IRKey key) const
+{
+  if (!dbRep)
+    Null_rep("get_bool()");
+  if (const bool* value = dbRep->find_ir<bool>(key))
+    return *value;
+  return get_bool(String(ir_keys::full_name(key)));
+}
+
+
 void ProblemDescDB::set(const String& entry_name, const RealVector& rv)
 {
   RealVector& rep_rv = get_mutable<RealVector>
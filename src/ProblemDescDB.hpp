@@ -81,6 +81,8 @@ public:
   void enable_json_input(const String &);
   /// Enables validated JSON input from an in-memory study object
   void enable_json_input(const nlohmann::json&);
+  /// Enables validated JSON input, taking ownership of the study object
+  void enable_json_input(nlohmann::json&&);
   /// performs check_input, broadcast, and post_process, but for now,
   /// allowing separate invocation through the public API as well
   void check_and_broadcast(const UserModes& user_modes);
@@ -250,6 +252,33 @@ public:
   bool get_bool(const String& entry_name) const;
   /// for getting a void**, e.g., &dlLib
   void** get_voidss(const String& entry_name) const;
+
+  // Overloads taking an interned IR key (irgen::IRKey, generated from the
+  // IR contracts) read the materialized IR without parsing the entry name,
+  // for lookups in frequently constructed objects.  Without an IR value of
+  // the requested type they defer to the corresponding string lookup.
+
+  /// get a RealVector out of the database based on an interned IR key
+  const RealVector& get_rv(irgen::IRKey key) const;
+  /// get an IntVector out of the database based on an interned IR key
+  const IntVector& get_iv(irgen::IRKey key) const;
+  /// get a StringArray out of the database based on an interned IR key
+  const StringArray& get_sa(irgen::IRKey key) const;
+  /// get a String out of the database based on an interned IR key
+  const String& get_string(irgen::IRKey key) const;
+  /// get a Real out of the database based on an interned IR key
+  const Real& get_real(irgen::IRKey key) const;
+  /// get an int out of the database based on an interned IR key
+  int get_int(irgen::IRKey key) const;
+  /// get a short out of the database based on an interned IR key
+  short get_short(irgen::IRKey key) const;
+  /// get an unsigned short out of the database based on an interned IR key
+  unsigned short get_ushort(irgen::IRKey key) const;
+  /// get a size_t out of the database based on an interned IR key
+  size_t get_sizet(irgen::IRKey key) const;
+  /// get a bool out of the database based on an interned IR key
+  bool get_bool(irgen::IRKey key) const;
+
   /// write the full stored ProblemDescDB contents to a JSON file for debugging
   void write_json_dump(const String& output_path) const;
 
@@ -425,6 +454,11 @@ private:
 	 const std::string& entry_name,
 	 const std::shared_ptr<ProblemDescDB>& db_rep) const;
 
+  /// value of key in the active IR store if materialized and stored with
+  /// type T, otherwise NULL
+  template<typename T>
+  const T* find_ir(irgen::IRKey key) const;
+
   template<typename T>
   T& get_mutable(const std::string& context_msg,
 	 const std::map<std::string, T DataEnvironmentRep::*>& env_map,
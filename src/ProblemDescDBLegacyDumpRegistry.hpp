@@ -36,7 +36,7 @@ inline constexpr std::array<std::string_view, 28> k_environment_entries = {{
   "environment.tabular_graphics_data",
 }};
 
-inline constexpr std::array<std::string_view, 413> k_method_entries = {{
+inline constexpr std::array<std::string_view, 417> k_method_entries = {{
   "method.concurrent.parameter_sets",
   "method.jega.distance_vector",
   "method.jega.niche_vector",
@@ -370,6 +370,7 @@ inline constexpr std::array<std::string_view, 413> k_method_entries = {{
   "method.nond.c3function_train.kick_rank",
   "method.nond.c3function_train.max_rank",
   "method.nond.c3function_train.start_rank",
+  "method.nond.concurrent_mpp_searches",
   "method.nond.cross_validation.max_rank_candidates",
   "method.nond.max_refinement_iterations",
   "method.nond.max_solver_iterations",
@@ -377,6 +378,7 @@ inline constexpr std::array<std::string_view, 413> k_method_entries = {{
   "method.num_candidate_designs",
   "method.num_candidates",
   "method.num_prediction_configs",
+  "method.quantile_sketch",
   "method.backfill",
   "method.chain_diagnostics",
   "method.chain_diagnostics.confidence_intervals",
@@ -384,6 +386,7 @@ inline constexpr std::array<std::string_view, 413> k_method_entries = {{
   "method.coliny.expansion",
   "method.coliny.randomize",
   "method.coliny.show_misc_options",
+  "method.columnar_statistics",
   "method.derivative_usage",
   "method.export_surrogate",
   "method.fixed_seed",
@@ -392,6 +395,7 @@ inline constexpr std::array<std::string_view, 413> k_method_entries = {{
   "method.import_build_active_only",
   "method.import_points.active_only",
   "method.import_points.use_variable_labels",
+  "method.is_approx",
   "method.laplace_approx",
   "method.latinize",
   "method.main_effects",
@@ -890,7 +894,7 @@ inline constexpr std::array<std::string_view, 299> k_variables_entries = {{
   "variables.uncertain.initial_point_flag",
 }};
 
-inline constexpr std::array<std::string_view, 44> k_interface_entries = {{
+inline constexpr std::array<std::string_view, 49> k_interface_entries = {{
   "interface.failure_capture.recovery_fn_vals",
   "interface.application.analysis_drivers",
   "interface.copyFiles",
@@ -905,11 +909,13 @@ inline constexpr std::array<std::string_view, 44> k_interface_entries = {{
   "interface.id",
   "interface.plugin_library_path",
   "interface.workDir",
+  "interface.cache_memory_limit",
   "interface.nearby_evaluation_cache_tolerance",
   "interface.analysis_servers",
   "interface.asynch_local_analysis_concurrency",
   "interface.asynch_local_evaluation_concurrency",
   "interface.direct.processors_per_analysis",
+  "interface.evaluation_prefetch",
   "interface.evaluation_servers",
   "interface.failure_capture.retry_limit",
   "interface.processors_per_evaluation",
@@ -923,21 +929,24 @@ inline constexpr std::array<std::string_view, 44> k_interface_entries = {{
   "interface.allow_existing_results",
   "interface.application.file_save",
   "interface.application.file_tag",
+  "interface.application.persistent",
   "interface.application.verbatim",
   "interface.asynch",
   "interface.batch",
+  "interface.dirRecycle",
   "interface.dirSave",
   "interface.dirTag",
   "interface.evaluation_cache",
   "interface.labeled_results",
   "interface.nearby_evaluation_cache",
+  "interface.python.columnar",
   "interface.python.numpy",
   "interface.restart_file",
   "interface.templateReplace",
   "interface.useWorkdir",
 }};
 
-inline constexpr std::array<std::string_view, 57> k_responses_entries = {{
+inline constexpr std::array<std::string_view, 60> k_responses_entries = {{
   "responses.fd_gradient_step_size",
   "responses.fd_hessian_step_size",
   "responses.nonlinear_equality_scales",
@@ -948,6 +957,8 @@ inline constexpr std::array<std::string_view, 57> k_responses_entries = {{
   "responses.primary_response_fn_scales",
   "responses.primary_response_fn_weights",
   "responses.simulation_variance",
+  "responses.jacobian_sparsity.nonzero_functions",
+  "responses.jacobian_sparsity.nonzero_variables",
   "responses.lengths",
   "responses.num_coordinates_per_field",
   "responses.gradients.mixed.id_analytic",
@@ -994,6 +1005,7 @@ inline constexpr std::array<std::string_view, 57> k_responses_entries = {{
   "responses.central_hess",
   "responses.ignore_bounds",
   "responses.interpolate",
+  "responses.jacobian_sparsity.detect",
   "responses.read_field_coordinates",
 }};
 
@@ -1394,6 +1406,7 @@ bool try_emit_method_entry(const DataMethodRep& rep, std::string_view full_key,
   if (full_key == "method.nond.c3function_train.kick_rank") { emit(rep.kickRank); return true; }
   if (full_key == "method.nond.c3function_train.max_rank") { emit(rep.maxRank); return true; }
   if (full_key == "method.nond.c3function_train.start_rank") { emit(rep.startRank); return true; }
+  if (full_key == "method.nond.concurrent_mpp_searches") { emit(rep.concurrentMPPSearches); return true; }
   if (full_key == "method.nond.cross_validation.max_rank_candidates") { emit(rep.maxCVRankCandidates); return true; }
   if (full_key == "method.nond.max_refinement_iterations") { emit(rep.maxRefineIterations); return true; }
   if (full_key == "method.nond.max_solver_iterations") { emit(rep.maxSolverIterations); return true; }
@@ -1401,6 +1414,7 @@ bool try_emit_method_entry(const DataMethodRep& rep, std::string_view full_key,
   if (full_key == "method.num_candidate_designs") { emit(rep.numCandidateDesigns); return true; }
   if (full_key == "method.num_candidates") { emit(rep.numCandidates); return true; }
   if (full_key == "method.num_prediction_configs") { emit(rep.numPredConfigs); return true; }
+  if (full_key == "method.quantile_sketch") { emit(rep.quantileSketchSize); return true; }
   if (full_key == "method.backfill") { emit(rep.backfillFlag); return true; }
   if (full_key == "method.chain_diagnostics") { emit(rep.chainDiagnostics); return true; }
   if (full_key == "method.chain_diagnostics.confidence_intervals") { emit(rep.chainDiagnosticsCI); return true; }
@@ -1408,6 +1422,7 @@ bool try_emit_method_entry(const DataMethodRep& rep, std::string_view full_key,
   if (full_key == "method.coliny.expansion") { emit(rep.expansionFlag); return true; }
   if (full_key == "method.coliny.randomize") { emit(rep.randomizeOrderFlag); return true; }
   if (full_key == "method.coliny.show_misc_options") { emit(rep.showMiscOptions); return true; }
+  if (full_key == "method.columnar_statistics") { emit(rep.columnarStats); return true; }
   if (full_key == "method.derivative_usage") { emit(rep.methodUseDerivsFlag); return true; }
   if (full_key == "method.export_surrogate") { emit(rep.exportSurrogate); return true; }
   if (full_key == "method.fixed_seed") { emit(rep.fixedSeedFlag); return true; }
@@ -1416,6 +1431,7 @@ bool try_emit_method_entry(const DataMethodRep& rep, std::string_view full_key,
   if (full_key == "method.import_build_active_only") { emit(rep.importBuildActive); return true; }
   if (full_key == "method.import_points.active_only") { emit(rep.importPtsActive); return true; }
   if (full_key == "method.import_points.use_variable_labels") { emit(rep.importPtsUseVariableLabels); return true; }
+  if (full_key == "method.is_approx") { emit(rep.modelEvidIS); return true; }
   if (full_key == "method.laplace_approx") { emit(rep.modelEvidLaplace); return true; }
   if (full_key == "method.latinize") { emit(rep.latinizeFlag); return true; }
   if (full_key == "method.main_effects") { emit(rep.mainEffectsFlag); return true; }
@@ -2017,11 +2033,13 @@ bool try_emit_interface_entry(const DataInterfaceRep& rep, std::string_view full
   if (full_key == "interface.id") { emit(rep.idInterface); return true; }
   if (full_key == "interface.plugin_library_path") { emit(rep.pluginLibraryPath); return true; }
   if (full_key == "interface.workDir") { emit(rep.workDir); return true; }
+  if (full_key == "interface.cache_memory_limit") { emit(rep.evalCacheMemLimit); return true; }
   if (full_key == "interface.nearby_evaluation_cache_tolerance") { emit(rep.nearbyEvalCacheTol); return true; }
   if (full_key == "interface.analysis_servers") { emit(rep.analysisServers); return true; }
   if (full_key == "interface.asynch_local_analysis_concurrency") { emit(rep.asynchLocalAnalysisConcurrency); return true; }
   if (full_key == "interface.asynch_local_evaluation_concurrency") { emit(rep.asynchLocalEvalConcurrency); return true; }
   if (full_key == "interface.direct.processors_per_analysis") { emit(rep.procsPerAnalysis); return true; }
+  if (full_key == "interface.evaluation_prefetch") { emit(rep.evalPrefetch); return true; }
   if (full_key == "interface.evaluation_servers") { emit(rep.evalServers); return true; }
   if (full_key == "interface.failure_capture.retry_limit") { emit(rep.retryLimit); return true; }
   if (full_key == "interface.processors_per_evaluation") { emit(rep.procsPerEval); return true; }
@@ -2035,14 +2053,17 @@ bool try_emit_interface_entry(const DataInterfaceRep& rep, std::string_view full
   if (full_key == "interface.allow_existing_results") { emit(rep.allowExistingResultsFlag); return true; }
   if (full_key == "interface.application.file_save") { emit(rep.fileSaveFlag); return true; }
   if (full_key == "interface.application.file_tag") { emit(rep.fileTagFlag); return true; }
+  if (full_key == "interface.application.persistent") { emit(rep.persistentFlag); return true; }
   if (full_key == "interface.application.verbatim") { emit(rep.verbatimFlag); return true; }
   if (full_key == "interface.asynch") { emit(rep.asynchFlag); return true; }
   if (full_key == "interface.batch") { emit(rep.batchEvalFlag); return true; }
+  if (full_key == "interface.dirRecycle") { emit(rep.dirRecycle); return true; }
   if (full_key == "interface.dirSave") { emit(rep.dirSave); return true; }
   if (full_key == "interface.dirTag") { emit(rep.dirTag); return true; }
   if (full_key == "interface.evaluation_cache") { emit(rep.evalCacheFlag); return true; }
   if (full_key == "interface.labeled_results") { emit(rep.dakotaResultsFileLabeled); return true; }
   if (full_key == "interface.nearby_evaluation_cache") { emit(rep.nearbyEvalCacheFlag); return true; }
+  if (full_key == "interface.python.columnar") { emit(rep.columnarFlag); return true; }
   if (full_key == "interface.python.numpy") { emit(rep.numpyFlag); return true; }
   if (full_key == "interface.restart_file") { emit(rep.restartFileFlag); return true; }
   if (full_key == "interface.templateReplace") { emit(rep.templateReplace); return true; }
@@ -2063,6 +2084,8 @@ bool try_emit_responses_entry(const DataResponsesRep& rep, std::string_view full
   if (full_key == "responses.primary_response_fn_scales") { emit(rep.primaryRespFnScales); return true; }
   if (full_key == "responses.primary_response_fn_weights") { emit(rep.primaryRespFnWeights); return true; }
   if (full_key == "responses.simulation_variance") { emit(rep.simVariance); return true; }
+  if (full_key == "responses.jacobian_sparsity.nonzero_functions") { emit(rep.jacSparsityFns); return true; }
+  if (full_key == "responses.jacobian_sparsity.nonzero_variables") { emit(rep.jacSparsityVars); return true; }
   if (full_key == "responses.lengths") { emit(rep.fieldLengths); return true; }
   if (full_key == "responses.num_coordinates_per_field") { emit(rep.numCoordsPerField); return true; }
   if (full_key == "responses.gradients.mixed.id_analytic") { emit(rep.idAnalyticGrads); return true; }
@@ -2109,6 +2132,7 @@ bool try_emit_responses_entry(const DataResponsesRep& rep, std::string_view full
   if (full_key == "responses.central_hess") { emit(rep.centralHess); return true; }
   if (full_key == "responses.ignore_bounds") { emit(rep.ignoreBounds); return true; }
   if (full_key == "responses.interpolate") { emit(rep.interpolateFlag); return true; }
+  if (full_key == "responses.jacobian_sparsity.detect") { emit(rep.jacSparsityDetect); return true; }
   if (full_key == "responses.read_field_coordinates") { emit(rep.readFieldCoords); return true; }
   return false;
 }
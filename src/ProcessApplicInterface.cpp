@@ -13,6 +13,7 @@
 #include "ProblemDescDB.hpp"
 #include "ParallelLibrary.hpp"
 #include "WorkdirHelper.hpp"
+#include "WorkdirPool.hpp"
 #include "ParametersFileWriter.hpp"
 #include "ResultsFileReader.hpp"
 #include <algorithm>
@@ -127,6 +128,7 @@ ProcessApplicInterface(const ProblemDescDB& problem_db, ParallelLibrary& paralle
   workDirName(problem_db.get_string("interface.workDir")),
   dirTag(problem_db.get_bool("interface.dirTag")),
   dirSave(problem_db.get_bool("interface.dirSave")),
+  dirRecycle(problem_db.get_bool("interface.dirRecycle")),
   linkFiles(problem_db.get_sa("interface.linkFiles")),
   copyFiles(problem_db.get_sa("interface.copyFiles")),
   templateReplace(problem_db.get_bool("interface.templateReplace"))
@@ -150,6 +152,28 @@ ProcessApplicInterface(const ProblemDescDB& problem_db, ParallelLibrary& paralle
   if (num_programs > 1 && !analysisComponents.empty())
     multipleParamsFiles = true;
 
+  // Recycled directories are named by slot rather than by evaluation and
+  // are reset between evaluations, so they can be neither tagged nor saved
+  if (useWorkdir && dirRecycle) {
+    if (dirSave) {
+      Cout << "\nWarning: work_directory recycle is incompatible with "
+	   << "directory_save;\n         disabling recycle." << std::endl;
+      dirRecycle = false;
+    }
+    else {
+      if (dirTag) {
+	Cout << "\nWarning: work_directory recycle tags directories by "
+	     << "slot; ignoring\n         directory_tag." << std::endl;
+	dirTag = false;
+      }
+      std::filesystem::path base_name = workDirName.empty() ?
+	( WorkdirHelper::system_tmp_path() /
+	  WorkdirHelper::system_tmp_file("dakota_work") ) :
+	std::filesystem::path(workDirName);
+      workdirPool.reset(new WorkdirPool(base_name, copyFiles, linkFiles));
+    }
+  }
+
   // RATIONALE: While a user might truly want concurrent evaluations
   // with non-unique work_directory and/or parameters/results files,
   // it could too easily lead to errors or surprising results.
@@ -171,7 +195,7 @@ ProcessApplicInterface(const ProblemDescDB& problem_db, ParallelLibrary& paralle
 			 asynchLocalEvalConcSpec > serializeThreshold);
   if (require_unique) {
     if (useWorkdir) {
-      if (!dirTag && !workDirName.empty()) {
+      if (!dirTag && !workdirPool && !workDirName.empty()) {
 	Cout << "\nWarning: Concurrent local evaluations with named " 
 	     << "work_directory require\n         directory_tag; "
 	     << "enabling directory_tag." << std::endl;
@@ -374,7 +398,12 @@ void ProcessApplicInterface::define_filenames(const String& eval_id_tag)
 
     // establish the workdir name first, since parameters files might go in it
     bool wd_created = false;
-    if (useWorkdir) {
+    if (workdirPool) {
+      // a slot not used by other evaluations, reset to the template
+      curWorkdir = workdirPool->acquire();
+      wd_created = true;
+    }
+    else if (useWorkdir) {
       // curWorkdir is used by Fork/SysCall arg_adjust
       curWorkdir = std::filesystem::path(get_workdir_name().string());
       // TODO: Create with 0700 mask?
@@ -517,6 +546,10 @@ write_parameters_files(const Variables& vars,    const ActiveSet& set,
     WorkdirHelper::recursive_remove(pfile_path, FILEOP_WARN);
     const std::filesystem::path& rfile_path = (map_iter->second).get<1>();
     WorkdirHelper::recursive_remove(rfile_path, FILEOP_WARN);
+    // the replacement may run in a different recycled directory
+    const std::filesystem::path& wd_path = (map_iter->second).get<2>();
+    if (workdirPool && wd_path != createdDir)
+      workdirPool->release(wd_path);
     // replace file names in map, avoiding 2nd lookup
     map_iter->second = file_names;
   }
@@ -872,7 +905,12 @@ file_and_workdir_cleanup(const std::filesystem::path &params_path,
     remove_params_results_files(params_path, results_path);
 
   // Now that files are handled, conditionally remove the work directory
-  if (removing_workdir) {
+  if (removing_workdir && workdirPool) {
+    if (outputLevel > NORMAL_OUTPUT)
+      Cout << "Recycling work_directory " << workdir_path << std::endl;
+    workdirPool->release(workdir_path);
+  }
+  else if (removing_workdir) {
     if (outputLevel > NORMAL_OUTPUT)
       Cout << "Removing work_directory " << workdir_path << std::endl;
     WorkdirHelper::recursive_remove(workdir_path, FILEOP_ERROR);
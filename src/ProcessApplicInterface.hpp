@@ -24,6 +24,7 @@ namespace Dakota {
 
 class ParametersFileWriter;
 class ResultsFileReader;
+class WorkdirPool;
 
 /// Substitute parameters and results file names into driver strings
 String substitute_params_and_results(const String &driver, const String &params, const String &results);
@@ -215,6 +216,10 @@ protected:
   bool dirTag;
   /// whether dir_save was specified
   bool dirSave;
+  /// whether to reuse work directories across evaluations
+  bool dirRecycle;
+  /// reusable work directories when dirRecycle
+  std::unique_ptr<WorkdirPool> workdirPool;
   /// active working directory for this evaluation; valid only from
   /// define_filenames to create_evaluation_process
   std::filesystem::path curWorkdir;
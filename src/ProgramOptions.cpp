@@ -29,6 +29,7 @@ namespace Dakota {
 ProgramOptions::ProgramOptions():
   worldRank(0),
   echoInput(true), preprocInput(false), stopRestartEvals(0),
+  indexedRestart(false),
   helpFlag(false), versionFlag(false), checkFlag(false), 
   stdinInput(false)
 {
@@ -40,6 +41,7 @@ ProgramOptions::ProgramOptions():
 ProgramOptions::ProgramOptions(int world_rank):
   worldRank(world_rank),
   echoInput(true), preprocInput(false), stopRestartEvals(0),
+  indexedRestart(false),
   helpFlag(false), versionFlag(false), checkFlag(false), 
   stdinInput(false)
 {
@@ -51,6 +53,7 @@ ProgramOptions::ProgramOptions(int world_rank):
 ProgramOptions::ProgramOptions(int argc, char* argv[], int world_rank):
   worldRank(world_rank),
   echoInput(true), preprocInput(false), stopRestartEvals(0),
+  indexedRestart(false),
   helpFlag(false), versionFlag(false), checkFlag(false), stdinInput(false)
 {
   // environment settings are overridden by command line options
@@ -107,6 +110,8 @@ ProgramOptions::ProgramOptions(int argc, char* argv[], int world_rank):
   if (clh.retrieve("write_restart"))
     writeRestartFile = clh.retrieve("write_restart");
   stopRestartEvals = clh.read_restart_evals();
+  if (clh.retrieve("indexed_restart"))
+    indexedRestart = true;
 
   manage_run_modes(clh);
 
@@ -183,6 +188,9 @@ size_t ProgramOptions::stop_restart_evals() const
 String ProgramOptions::write_restart_file() const
 { return writeRestartFile.empty() ? "dakota.rst" : writeRestartFile; }
 
+bool ProgramOptions::indexed_restart() const
+{ return indexedRestart; }
+
 
 bool ProgramOptions::help() const
 { return helpFlag; }
@@ -301,6 +309,9 @@ void ProgramOptions::stop_restart_evals(size_t stop_rst)
 void ProgramOptions::write_restart_file(const String& write_rst)
 { writeRestartFile = write_rst; }
 
+void ProgramOptions::indexed_restart(bool indexed_rst)
+{ indexedRestart = indexed_rst; }
+
 
 void ProgramOptions::help(bool help_flag)
 { helpFlag = help_flag; }
@@ -420,7 +431,8 @@ void ProgramOptions::read(MPIUnpackBuffer& s)
   // core files and options
   s >> inputFile >> jsonFile >> inputString >> echoInput >> parserOptions 
     >> outputFile >> errorFile >> dumpIrFile
-    >> readRestartFile >> stopRestartEvals >> writeRestartFile;
+    >> readRestartFile >> stopRestartEvals >> writeRestartFile
+    >> indexedRestart;
   s >> json_input_cbor;
   // run mode controls
   s >> helpFlag >> versionFlag >> checkFlag >> userModes;
@@ -437,7 +449,8 @@ void ProgramOptions::write(MPIPackBuffer& s) const
   // core files and options
   s << inputFile << jsonFile << inputString << echoInput << parserOptions 
     << outputFile << errorFile << dumpIrFile
-    << readRestartFile << stopRestartEvals << writeRestartFile;
+    << readRestartFile << stopRestartEvals << writeRestartFile
+    << indexedRestart;
   s << json_input_cbor;
   // run mode controls
   s << helpFlag << versionFlag << checkFlag << userModes;
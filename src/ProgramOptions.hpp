@@ -93,6 +93,8 @@ public:
   size_t stop_restart_evals() const;
   /// write retart (user-provided or default) file base name (no tag)
   String write_restart_file() const;
+  /// whether to write the restart file in the indexed, appendable format
+  bool indexed_restart() const;
 
   /// is help mode active?
   bool help() const;
@@ -157,6 +159,8 @@ public:
   void stop_restart_evals(size_t stop_rst);
   /// set base file name for restart file to write
   void write_restart_file(const String& write_rst);
+  /// set true to write the restart file in the indexed format
+  void indexed_restart(bool indexed_rst);
 
   /// set true to print help information and exit
   void help(bool help_flag);
@@ -252,6 +256,7 @@ private:
   String readRestartFile;    ///< e.g., "dakota.old.rst"
   size_t stopRestartEvals;   ///< eval number at which to stop restart read
   String writeRestartFile;   ///< e.g., "dakota.new.rst"
+  bool indexedRestart;       ///< whether to write an indexed restart file
   String dumpIrFile;         ///< path for JSON dump of parsed IR/problem DB
   String versionQuery;     /// argument passed to "version"
 
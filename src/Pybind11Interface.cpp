@@ -23,6 +23,7 @@ namespace Dakota {
 Pybind11Interface::Pybind11Interface(const ProblemDescDB& problem_db, ParallelLibrary& parallel_lib)
   : DirectApplicInterface(problem_db, parallel_lib),
     userNumpyFlag(problem_db.get_bool("interface.python.numpy")),
+    columnarFlag(problem_db.get_bool("interface.python.columnar")),
     ownPython(false),
     py11Active(false)
 {
@@ -61,6 +62,19 @@ Pybind11Interface::Pybind11Interface(const ProblemDescDB& problem_db, ParallelLi
     abort_handler(-1);
 #endif
   }
+  if (columnarFlag) {
+#ifndef DAKOTA_PYTHON_NUMPY
+    Cerr << "\nError: Direct Python interface 'columnar' option requested, "
+	 << "but Dakota was not built with numpy support enabled."
+         << std::endl;
+    abort_handler(-1);
+#endif
+    if (!batchEval) {
+      Cerr << "\nError: interface > python > columnar requires the batch "
+	   << "option" << std::endl;
+      abort_handler(INTERFACE_ERROR);
+    }
+  }
 
   // prepend sys.path (env PYTHONPATH) with empty string to find module in pwd
   // This assumes any directory changing in the driver is reversed
@@ -129,6 +143,15 @@ void Pybind11Interface::wait_local_evaluations(PRPQueue& prp_queue)
   ++batchIdCntr;
   
   initialize_driver(analysisDrivers[0]);
+
+  if (columnarFlag) {
+    // the user's python function is called with a single dict holding
+    // the whole batch, one array row per eval
+    py::dict py_response = py11CallBack(batch_params_to_dict(prp_queue));
+    unpack_python_batch_response(py_response, prp_queue);
+    return;
+  }
+
   // in this case the user's python function is to be called with
   // list<dict>, one list entry per eval
 
@@ -250,6 +273,212 @@ py::dict Pybind11Interface::pack_kwargs() const
 }
 
 
+py::dict Pybind11Interface::batch_params_to_dict(const PRPQueue& prp_queue)
+{
+  // counts, labels, and analysis components are common to the batch and
+  // are sent once, from the first eval
+  const ParamResponsePair& first_prp = *prp_queue.begin();
+  set_local_data(first_prp.variables(), first_prp.active_set(),
+		 first_prp.response());
+
+  typedef std::vector<py::ssize_t> ShapeT;
+  const py::ssize_t num_evals = prp_queue.size();
+  const size_t num_derivs = directFnDVV.size();
+  py::array_t<double> cv(ShapeT{ num_evals, (py::ssize_t)numACV });
+  py::array_t<int>    div(ShapeT{ num_evals, (py::ssize_t)numADIV });
+  py::array_t<double> drv(ShapeT{ num_evals, (py::ssize_t)numADRV });
+  py::array_t<int>    asv(ShapeT{ num_evals, (py::ssize_t)numFns });
+  py::array_t<size_t> dvv(ShapeT{ num_evals, (py::ssize_t)num_derivs });
+  py::list dsv, eval_ids;
+
+  // fill the arrays in place, one row per eval
+  auto cv_rows  = cv.mutable_unchecked<2>();
+  auto div_rows = div.mutable_unchecked<2>();
+  auto drv_rows = drv.mutable_unchecked<2>();
+  auto asv_rows = asv.mutable_unchecked<2>();
+  auto dvv_rows = dvv.mutable_unchecked<2>();
+  py::ssize_t i = 0;
+  size_t j;
+  for (const auto& prp : prp_queue) {
+    const Variables& vars = prp.variables();
+    const RealVector& acv  = vars.all_continuous_variables();
+    const IntVector&  adiv = vars.all_discrete_int_variables();
+    const RealVector& adrv = vars.all_discrete_real_variables();
+    for (j=0; j<numACV; ++j)  cv_rows(i, j)  = acv[j];
+    for (j=0; j<numADIV; ++j) div_rows(i, j) = adiv[j];
+    for (j=0; j<numADRV; ++j) drv_rows(i, j) = adrv[j];
+    dsv.append(PythonUtils::copy_array_to_pybind11<py::list,
+	       StringMultiArrayConstView,String>(
+		 vars.all_discrete_string_variables()));
+
+    const ActiveSet& set = prp.active_set();
+    const ShortArray& req_vec = set.request_vector();
+    const SizetArray& deriv_vec = set.derivative_vector();
+    if (deriv_vec.size() != num_derivs) {
+      Cerr << "\nError: interface > python > columnar requires the same "
+	   << "derivative variables for all evaluations in a batch."
+	   << std::endl;
+      abort_handler(INTERFACE_ERROR);
+    }
+    for (j=0; j<numFns; ++j)     asv_rows(i, j) = req_vec[j];
+    for (j=0; j<num_derivs; ++j) dvv_rows(i, j) = deriv_vec[j];
+
+    currEvalId = prp.eval_id();
+    eval_ids.append(eval_id_string());
+    ++i;
+  }
+
+  py::list  all_var_labels   = PythonUtils::copy_array_to_pybind11<py::list,StringArray,String>(xAllLabels);
+  py::list  cv_labels        = PythonUtils::copy_array_to_pybind11<py::list,StringMultiArray,String>(xCLabels);
+  py::list  div_labels       = PythonUtils::copy_array_to_pybind11<py::list,StringMultiArray,String>(xDILabels);
+  py::list  dsv_labels       = PythonUtils::copy_array_to_pybind11<py::list,StringMultiArray,String>(xDSLabels);
+  py::list  drv_labels       = PythonUtils::copy_array_to_pybind11<py::list,StringMultiArray,String>(xDRLabels);
+  py::list an_comps          = (analysisComponents.size() > 0)
+                               ?  PythonUtils::copy_array_to_pybind11<py::list,StringArray,String>(analysisComponents[analysisDriverIndex])
+                               :  py::list();
+  py::list fn_labels         = PythonUtils::copy_array_to_pybind11<py::list,StringArray,String>(fnLabels);
+  py::list md_labels         = PythonUtils::copy_array_to_pybind11<py::list,StringArray,String>(metaDataLabels);
+
+  py::dict kwargs = py::dict(
+      "evaluations"_a           = num_evals,
+      "variables"_a             = numVars,
+      "functions"_a             = numFns,
+      "metadata"_a              = metaData.size(),
+      "variable_labels"_a       = all_var_labels,
+      "function_labels"_a       = fn_labels,
+      "metadata_labels"_a       = md_labels,
+      "cv"_a                    = cv,
+      "cv_labels"_a             = cv_labels,
+      "div"_a                   = div,
+      "div_labels"_a            = div_labels,
+      "dsv"_a                   = dsv,
+      "dsv_labels"_a            = dsv_labels,
+      "drv"_a                   = drv,
+      "drv_labels"_a            = drv_labels,
+      "asv"_a                   = asv,
+      "dvv"_a                   = dvv,
+      "analysis_components"_a   = an_comps,
+      "eval_ids"_a              = eval_ids);
+
+  return kwargs;
+}
+
+
+namespace {
+
+/// C-ordered array of doubles, converting the Python data if needed
+typedef py::array_t<double, py::array::c_style | py::array::forcecast>
+  PyBatchArray;
+
+/// extract the array stored under key in a columnar batch response and
+/// check that it has the expected shape
+PyBatchArray batch_response_array(const py::dict& py_response,
+				  const char* key,
+				  const std::vector<py::ssize_t>& shape)
+{
+  std::string err_prefix("Pybind11 Direct Interface [\"");
+  err_prefix += key; err_prefix += "\"]: ";
+  if (!py_response.contains(key))
+    throw(std::runtime_error("Pybind11 Direct Interface: required key [\""
+			     + std::string(key) + "\"] absent in dict "
+			     "returned to Dakota"));
+  py::object py_values = py_response[key];
+  PyBatchArray values = PyBatchArray::ensure(py_values);
+  if (!values)
+    throw(std::runtime_error(err_prefix + "not convertible to a numeric "
+			     "array"));
+  bool shape_ok = (values.ndim() == (py::ssize_t)shape.size());
+  for (size_t d=0; shape_ok && d<shape.size(); ++d)
+    shape_ok = (values.shape(d) == shape[d]);
+  if (!shape_ok) {
+    std::string expected("(");
+    for (size_t d=0; d<shape.size(); ++d)
+      expected += ((d) ? ", " : "") + std::to_string(shape[d]);
+    throw(std::runtime_error(err_prefix + "incorrect shape; expected "
+			     "(# evaluations, ...) = " + expected + ")"));
+  }
+  return values;
+}
+
+} // anonymous namespace
+
+
+void Pybind11Interface::
+unpack_python_batch_response(const py::dict& py_response, PRPQueue& prp_queue)
+{
+  const py::ssize_t num_evals = prp_queue.size(),
+    num_fns = numFns, num_derivs = directFnDVV.size(),
+    num_md = metaData.size();
+
+  bool expect_fns = false, expect_grads = false, expect_hessians = false;
+  for (const auto& prp : prp_queue) {
+    const ShortArray& req_vec = prp.active_set().request_vector();
+    expect_fns      |= expect_derivative(req_vec, 1);
+    expect_grads    |= expect_derivative(req_vec, 2);
+    expect_hessians |= expect_derivative(req_vec, 4);
+  }
+
+  // validate all of the arrays before updating any response
+  PyBatchArray fns, grads, hessians, md;
+  if (expect_fns)
+    fns = batch_response_array(py_response, "fns", { num_evals, num_fns });
+  if (expect_grads)
+    grads = batch_response_array(py_response, "fnGrads",
+				 { num_evals, num_fns, num_derivs });
+  if (expect_hessians)
+    hessians = batch_response_array(py_response, "fnHessians",
+      { num_evals, num_fns, num_derivs, num_derivs });
+  if (num_md)
+    md = batch_response_array(py_response, "metadata", { num_evals, num_md });
+
+  RealVector fn_values(num_fns);
+  RealMatrix gradients;
+  RealSymMatrixArray fn_hessians;
+  RealArray metadata(num_md);
+  if (expect_grads)
+    gradients.shapeUninitialized(num_derivs, num_fns);
+  if (expect_hessians) {
+    fn_hessians.resize(num_fns);
+    for (auto& hess : fn_hessians)
+      hess.shapeUninitialized(num_derivs);
+  }
+
+  py::ssize_t e = 0, i, j, k;
+  for (auto& prp : prp_queue) {
+    if (expect_fns) {
+      auto fn_rows = fns.unchecked<2>();
+      for (i=0; i<num_fns; ++i)
+	fn_values[i] = fn_rows(e, i);
+    }
+    if (expect_grads) {
+      auto grad_rows = grads.unchecked<3>();
+      for (i=0; i<num_fns; ++i)
+	for (j=0; j<num_derivs; ++j)
+	  gradients[i][j] = grad_rows(e, i, j);
+    }
+    if (expect_hessians) {
+      auto hess_rows = hessians.unchecked<4>();
+      for (i=0; i<num_fns; ++i)
+	for (j=0; j<num_derivs; ++j)
+	  for (k=0; k<=j; ++k)
+	    fn_hessians[i](j, k) = hess_rows(e, i, j, k);
+    }
+    if (num_md) {
+      auto md_rows = md.unchecked<2>();
+      for (i=0; i<num_md; ++i)
+	metadata[i] = md_rows(e, i);
+    }
+
+    // shallow copy technically violates const-ness
+    Response resp = prp.response();
+    resp.update(fn_values, gradients, fn_hessians, prp.active_set());
+    resp.metadata(metadata);
+    completionSet.insert(prp.eval_id());
+    ++e;
+  }
+}
+
+
 void Pybind11Interface::unpack_python_response
 (const ShortArray& asv, const size_t num_derivs,
  const pybind11::dict& py_response, RealVector& fn_values,
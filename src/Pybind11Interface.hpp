@@ -66,6 +66,9 @@ class Pybind11Interface: public DirectApplicInterface
 
     /// whether the user requested numpy data structures in the input file
     bool userNumpyFlag;
+    /// whether the user requested the columnar batch protocol, in which
+    /// a batch is exchanged as a single dictionary of numpy arrays
+    bool columnarFlag;
     /// true if this class created the interpreter instance
     bool ownPython;
     /// callback function for analysis driver
@@ -82,6 +85,15 @@ class Pybind11Interface: public DirectApplicInterface
     template<typename T>
     py::dict pack_kwargs() const;
 
+    /// Translate a batch of Dakota parameters into a single Python
+    /// dictionary of 2-D numpy arrays with one row per evaluation
+    py::dict batch_params_to_dict(const PRPQueue& prp_queue);
+
+    /// populate the responses of a batch from a Python dictionary of
+    /// numpy arrays with a leading evaluation dimension
+    void unpack_python_batch_response(const py::dict& py_response,
+				      PRPQueue& prp_queue);
+
     /// populate values, gradients, Hessians from Python to Dakota
     void unpack_python_response
     (const ShortArray& asv, const size_t num_derivs,
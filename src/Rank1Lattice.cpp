@@ -19,6 +19,7 @@
 
 #include "ProblemDescDB.hpp"
 
+#include <cmath>
 #include <boost/random/uniform_01.hpp>
 
 namespace Dakota {
@@ -92,12 +93,13 @@ ordering(ordering)
   if ( ordering == RANK_1_LATTICE_NATURAL_ORDERING )
   {
     reorder = &Rank1Lattice::reorder_natural;
-    scale = 1 / Real(1 << mMax);
+    scale = 1 / Real(UInt64(1) << mMax);
   }
   else if ( ordering == RANK_1_LATTICE_RADICAL_INVERSE_ORDERING )
   {
     reorder = &Rank1Lattice::reorder_radical_inverse;
-    scale = 1 / Real(4294967296L); // 1 / 2^32
+    /// 64-bit reversal; the first 2^32 points match the 32-bit reversal
+    scale = std::ldexp(1., -64); // 1 / 2^64
   }
   else
   {
@@ -424,34 +426,41 @@ void Rank1Lattice::random_shift(
 /// This function will store the points in-place in the matrix `points`
 /// Each column of `points` contains a `dimension`-dimensional point
 /// where `dimension` is equal to the number of rows of `points`
+/// NOTE: each point is computed directly from its index, so any range of
+/// points (or disjoint blocks of it, see `get_points_parallel`) can be
+/// generated at a cost independent of `nMin`
 void Rank1Lattice::unsafe_get_points(
   const size_t nMin,
   const size_t nMax, 
   RealMatrix& points
 )
 {
-  for ( UInt32 k = nMin; k < nMax; ++k ) /// Loop over all points
+  int dimension = points.numRows();
+  const UInt32* z = generatingVector.values();
+  const Real* shift = randomShift.values();
+  for ( UInt64 k = nMin; k < nMax; ++k ) /// Loop over all points
   {
     Real phik = (this->*reorder)(k) * scale; /// phi(k)
-    for ( int j = 0; j < points.numRows(); ++j ) /// Loop over all dimensions
+    Real* point = points[k - nMin];
+    for ( int j = 0; j < dimension; ++j ) /// Loop over all dimensions
     {
-      Real point = phik * generatingVector[j] + randomShift[j];
-      points[k - nMin][j] = point - std::floor(point); /// Map to [0, 1)
+      Real shifted = phik * z[j] + shift[j];
+      point[j] = shifted - std::floor(shifted); /// Map to [0, 1)
     }
   }
 }
 
 /// Position of the `k`th lattice point in RANK_1_LATTICE_NATURAL_ORDERING
-inline UInt32 Rank1Lattice::reorder_natural(
-  UInt32 k
+inline UInt64 Rank1Lattice::reorder_natural(
+  UInt64 k
 )
 {
   return k;
 }
 
 /// Position of the `k`th lattice point in RANK_1_LATTICE_RADICAL_INVERSE_ORDERING
-inline UInt32 Rank1Lattice::reorder_radical_inverse(
-  UInt32 k
+inline UInt64 Rank1Lattice::reorder_radical_inverse(
+  UInt64 k
 )
 {
   return bitreverse(k);
@@ -123,17 +123,17 @@ private:
   ) override;
 
   /// Position of the `k`th lattice point in RANK_1_LATTICE_NATURAL_ORDERING
-  inline UInt32 reorder_natural(
-    UInt32 k
+  inline UInt64 reorder_natural(
+    UInt64 k
   );
 
   /// Position of the `k`th lattice point in RANK_1_LATTICE_RADICAL_INVERSE_ORDERING
-  inline UInt32 reorder_radical_inverse(
-    UInt32 k
+  inline UInt64 reorder_radical_inverse(
+    UInt64 k
   );
 
   /// Function pointer to the chosen order of the points
-  UInt32 (Rank1Lattice::*reorder)(UInt32);
+  UInt64 (Rank1Lattice::*reorder)(UInt64);
 
 };
 
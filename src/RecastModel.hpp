@@ -363,6 +363,10 @@ public:
 				  bool normalized = false) override;
   /// retrieve the approximation variances from the subModel
   const RealVector& approximation_variances(const Variables& vars) override;
+  /// retrieve the approximation variances at a set of points from the
+  /// subModel
+  void approximation_variances(const Variables& vars, const RealMatrix& c_vars,
+			       RealMatrix& fn_vars) override;
   /// retrieve the approximation data from the subModel
   const Pecos::SurrogateData& approximation_data(size_t fn_index) override;
 
@@ -1026,6 +1030,12 @@ approximation_variances(const Variables& vars)
 { return subModel->approximation_variances(vars); }
 
 
+inline void RecastModel::
+approximation_variances(const Variables& vars, const RealMatrix& c_vars,
+			RealMatrix& fn_vars)
+{ subModel->approximation_variances(vars, c_vars, fn_vars); }
+
+
 inline const Pecos::SurrogateData& RecastModel::
 approximation_data(size_t fn_index)
 { return subModel->approximation_data(fn_index); }
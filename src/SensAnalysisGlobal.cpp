@@ -13,7 +13,11 @@
 #include "dakota_linear_algebra.hpp"
 #include "dakota_data_util.hpp"
 #include "dakota_stat_util.hpp"
+#include "dakota_thread_util.hpp"
 #include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <thread>
 #include <boost/iterator/counting_iterator.hpp>
 #include "DataMethod.hpp" 
 
@@ -24,6 +28,19 @@ namespace Dakota {
 RealArray SensAnalysisGlobal::rawData = RealArray();
 
 
+/** Rows are ranked in parallel when there are enough samples to
+    amortize the threads; DAKOTA_CORRELATION_THREADS overrides the
+    default of one thread per core (see worker_threads()), up to one per
+    row. */
+static size_t rank_threads(size_t num_rows, size_t num_cols)
+{
+  const size_t min_thread_values = 65536;
+  size_t num_threads = worker_threads("DAKOTA_CORRELATION_THREADS",
+				      num_rows * num_cols / min_thread_values + 1);
+  return std::max((size_t)1, std::min(num_threads, num_rows));
+}
+
+
 bool SensAnalysisGlobal::rank_sort(const int& x, const int& y)
 { return rawData[x]<rawData[y]; }
 
@@ -83,8 +100,8 @@ valid_sample_matrix(const RealMatrix&     vars_samples,
   IntRespMCIter it = resp_samples.begin();
   for (int j=0, s_cntr=0; j<num_obs; ++j, ++it)
     if (is_valid_sample[j]) {
-      for (int i=0; i<numVars; ++i)
-        valid_data(i, s_cntr) = vars_samples(i, j);
+      std::copy(vars_samples[j], vars_samples[j] + numVars,
+		valid_data[s_cntr]);
       // get a view of the last numFns rows of the samples col
       RealVector td_col_resp(Teuchos::View, valid_data[s_cntr] + numVars, 
                              (int)numFns);
@@ -93,34 +110,59 @@ valid_sample_matrix(const RealMatrix&     vars_samples,
     }
 }
 
-/** When converting values to ranks, uses the average ranks of any tied values */
+/** When converting values to ranks, uses the average ranks of any
+    tied values.  Factors (rows) are ranked independently, so blocks of
+    rows are distributed over threads. */
 void SensAnalysisGlobal::values_to_ranks(RealMatrix& valid_data)
 {
   int num_corr = valid_data.numRows(), num_valid_samples = valid_data.numCols();
-  // for each var/resp
-  for (int i=0; i<num_corr; ++i) {
-    // create a multimap from value to array index (so it is sorted by value and
-    // the ranks are given by the map order); don't need a stable sort as we are
-    // replacing the tied values by their average rank
-    RealIntMultiMap vals_inds;
-    for (int j=0; j<num_valid_samples; ++j)
-      vals_inds.insert(std::make_pair(valid_data(i,j), j));
+  size_t num_threads = rank_threads(num_corr, num_valid_samples);
+  if (num_threads == 1) {
+    rows_to_ranks(valid_data, 0, num_corr);
+    return;
+  }
+
+  std::vector<std::thread> workers;
+  workers.reserve(num_threads);
+  for (size_t t=0; t<num_threads; ++t)
+    workers.emplace_back(rows_to_ranks, std::ref(valid_data),
+			 int(num_corr * t / num_threads),
+			 int(num_corr * (t+1) / num_threads));
+  for (std::thread& w : workers)
+    w.join();
+}
 
-    // iterate for each unique value and find tied values
-    RealIntMultiMap::const_iterator vi_it = vals_inds.begin();
-    RealIntMultiMap::const_iterator vi_end = vals_inds.end();
-    for (int rank=0; vi_it != vi_end; ) {
+
+/** Each row is gathered into a contiguous buffer and its sample indices
+    are sorted by value; runs of tied values in the sorted order then
+    receive their average rank. */
+void SensAnalysisGlobal::
+rows_to_ranks(RealMatrix& valid_data, int first_row, int last_row)
+{
+  int num_valid_samples = valid_data.numCols();
+  RealArray values(num_valid_samples);
+  IntArray order(num_valid_samples);
+  for (int i=first_row; i<last_row; ++i) {
+    for (int j=0; j<num_valid_samples; ++j)
+      values[j] = valid_data(i,j);
+    // don't need a stable sort as we are replacing the tied values by
+    // their average rank
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+	      [&values](int x, int y) { return values[x] < values[y]; });
+
+    for (int rank=0; rank<num_valid_samples; ) {
       // find a range of tied values
-      double value = vi_it->first;
-      std::pair<RealIntMultiMap::const_iterator, RealIntMultiMap::const_iterator>
-	tied_range = vals_inds.equal_range(value); 
-      int num_ties = std::distance(tied_range.first, tied_range.second);
+      double value = values[order[rank]];
+      int num_ties = 1;
+      while (rank + num_ties < num_valid_samples &&
+	     values[order[rank + num_ties]] == value)
+	++num_ties;
       double avg_rank = (rank + rank+num_ties-1) / 2.0;
       // all tied values get assigned the average rank
-      for ( ; tied_range.first != tied_range.second; ++tied_range.first)
-	valid_data(i, tied_range.first->second) = avg_rank;
+      for (int k=rank; k<rank+num_ties; ++k)
+	valid_data(i, order[k]) = avg_rank;
       // increment to the next unequal value
-      vi_it = tied_range.second;
       rank += num_ties;
     }
   }
@@ -151,37 +193,12 @@ compute_correlations(const VariablesArray& vars_samples,
   // determine which samples have valid responses
   BoolDeque is_valid_sample(num_obs);
   int num_valid_samples = find_valid_samples(resp_samples, is_valid_sample);
-  
-  // The following calls regenerate and destroy the valid_data matrix
-  // to save memory
-
-  // create a matrix containing only the valid sample data
-  RealMatrix valid_data(num_corr, num_valid_samples);
-
-  // calculate simple rank correlation coeff
-  valid_sample_matrix(vars_samples, resp_samples, dss_vals, is_valid_sample, 
-                      valid_data);
-  simple_corr(valid_data, num_corr, simpleCorr);
-
-  // calculate partial correlation coeff
-  valid_sample_matrix(vars_samples, resp_samples, dss_vals, is_valid_sample, 
-                      valid_data);
-  partial_corr(valid_data, numVars, simpleCorr, partialCorr, numericalIssuesRaw);
-
-  // calculate simple rank correlation coeff
-  valid_sample_matrix(vars_samples, resp_samples, dss_vals, is_valid_sample, 
-                      valid_data);
-  values_to_ranks(valid_data);
-  simple_corr(valid_data, num_corr, simpleRankCorr);
-
-  // calculate partial rank correlation coeff
-  valid_sample_matrix(vars_samples, resp_samples, dss_vals, is_valid_sample, 
-                      valid_data);
-  values_to_ranks(valid_data);
-  partial_corr(valid_data, numVars, simpleRankCorr, partialRankCorr, 
-               numericalIssuesRank);
 
-  corrComputed = true;
+  compute_valid_correlations(num_corr, num_valid_samples,
+    [&](RealMatrix& valid_data) {
+      valid_sample_matrix(vars_samples, resp_samples, dss_vals,
+			  is_valid_sample, valid_data);
+    });
 }
 
 void SensAnalysisGlobal::check_num_samples( const size_t n_var_samples,
@@ -227,34 +244,172 @@ compute_correlations(const RealMatrix&     vars_samples,
   BoolDeque is_valid_sample(num_obs);
   int num_valid_samples = find_valid_samples(resp_samples, is_valid_sample);
 
-  // The following calls regenerate and destroy the valid_data matrix
-  // to save memory
+  compute_valid_correlations(num_corr, num_valid_samples,
+    [&](RealMatrix& valid_data) {
+      valid_sample_matrix(vars_samples, resp_samples, is_valid_sample,
+			  valid_data);
+    });
+}
+
 
+/** The valid_data matrix is regenerated and destroyed by the following
+    calls to save memory.  Partial correlations are normally obtained
+    from the simple correlation matrices, so the sample data are only
+    regenerated for the SVD-based partial_corr() when that fails. */
+void SensAnalysisGlobal::
+compute_valid_correlations(int num_corr, int num_valid_samples,
+  const std::function<void(RealMatrix&)>& fill_valid_data)
+{
   // create a matrix containing only the valid sample data
   RealMatrix valid_data(num_corr, num_valid_samples);
 
-  // calculate simple rank correlation coeff
-  valid_sample_matrix(vars_samples, resp_samples, is_valid_sample, valid_data);
+  // calculate simple correlation coeff
+  fill_valid_data(valid_data);
   simple_corr(valid_data, num_corr, simpleCorr);
 
   // calculate partial correlation coeff
-  valid_sample_matrix(vars_samples, resp_samples, is_valid_sample, valid_data);
-  partial_corr(valid_data, numVars, simpleCorr, partialCorr, numericalIssuesRaw);
+  if (!partial_corr_from_simple(simpleCorr, numVars, partialCorr,
+				numericalIssuesRaw)) {
+    fill_valid_data(valid_data);
+    partial_corr(valid_data, numVars, simpleCorr, partialCorr,
+		 numericalIssuesRaw);
+  }
 
   // calculate simple rank correlation coeff
-  valid_sample_matrix(vars_samples, resp_samples, is_valid_sample, valid_data);
+  fill_valid_data(valid_data);
   values_to_ranks(valid_data);
   simple_corr(valid_data, num_corr, simpleRankCorr);
 
   // calculate partial rank correlation coeff
-  valid_sample_matrix(vars_samples, resp_samples, is_valid_sample, valid_data);
-  values_to_ranks(valid_data);
-  partial_corr(valid_data, numVars, simpleRankCorr, partialRankCorr, 
-               numericalIssuesRank);
+  if (!partial_corr_from_simple(simpleRankCorr, numVars, partialRankCorr,
+				numericalIssuesRank)) {
+    fill_valid_data(valid_data);
+    values_to_ranks(valid_data);
+    partial_corr(valid_data, numVars, simpleRankCorr, partialRankCorr,
+		 numericalIssuesRank);
+  }
+
+  corrComputed = true;
+}
+
+
+/** Samples (columns of vars_samples) with valid responses update the
+    running count, means, and co-moment matrix using the pairwise update
+    of Chan et al., so that chunks may be processed in any order.  The
+    co-moments of the chunk are formed by one matrix product of its
+    centered samples. */
+void SensAnalysisGlobal::
+accumulate_correlations(const RealMatrix&     vars_samples,
+                        const IntResponseMap& resp_samples)
+{
+  size_t num_obs = vars_samples.numCols();
+  check_num_samples( num_obs, resp_samples.size(), "accumulate_correlations");
+
+  int num_vars = vars_samples.numRows(),
+    num_fns = resp_samples.begin()->second.num_functions();
+  if (!accumSamples && !accumMeans.length()) {
+    numVars = num_vars;
+    numFns  = num_fns;
+  }
+  else if (num_vars != numVars || num_fns != numFns) {
+    Cerr << "Error: Inconsistent numbers of variables or responses in "
+	 << "SensAnalysisGlobal::accumulate_correlations()." << std::endl;
+    abort_handler(-1);
+  }
+  int num_corr = numVars + numFns;
+
+  BoolDeque is_valid_sample(num_obs);
+  int num_valid_samples = find_valid_samples(resp_samples, is_valid_sample);
+  if (!accumMeans.length()) {
+    accumMeans.size(num_corr);
+    accumCoMoments.shape(num_corr, num_corr);
+  }
+  if (!num_valid_samples)
+    return;
+
+  RealMatrix chunk_data(num_corr, num_valid_samples);
+  valid_sample_matrix(vars_samples, resp_samples, is_valid_sample, chunk_data);
+
+  // chunk means, accumulated by columns
+  RealVector chunk_means(num_corr);
+  for (int j=0; j<num_valid_samples; ++j)
+    for (int i=0; i<num_corr; ++i)
+      chunk_means[i] += chunk_data(i,j);
+  for (int i=0; i<num_corr; ++i)
+    chunk_means[i] /= (Real)num_valid_samples;
+  for (int j=0; j<num_valid_samples; ++j)
+    for (int i=0; i<num_corr; ++i)
+      chunk_data(i,j) -= chunk_means[i];
+
+  // merge: M = M_a + M_b + delta delta' n_a n_b / n
+  Real n_a = accumSamples, n_b = num_valid_samples, n = n_a + n_b;
+  RealVector delta(num_corr, false);
+  for (int i=0; i<num_corr; ++i)
+    delta[i] = chunk_means[i] - accumMeans[i];
+  accumCoMoments.multiply(Teuchos::NO_TRANS, Teuchos::TRANS, 1.0,
+			  chunk_data, chunk_data, 1.0);
+  Real w = n_a * n_b / n;
+  for (int j=0; j<num_corr; ++j)
+    for (int i=0; i<num_corr; ++i)
+      accumCoMoments(i,j) += w * delta[i] * delta[j];
+  for (int i=0; i<num_corr; ++i)
+    accumMeans[i] += delta[i] * n_b / n;
+  accumSamples += num_valid_samples;
+}
+
+
+/** Simple correlations follow from the co-moments and partial
+    correlations from the simple correlation matrix, as for the
+    in-memory computation.  Rank correlations need the ranks of all
+    samples, so they are not available in streaming mode and are left
+    empty (and are not printed or archived). */
+void SensAnalysisGlobal::compute_accumulated_correlations()
+{
+  if (!accumMeans.length()) {
+    Cerr << "Error: no samples accumulated prior to SensAnalysisGlobal::"
+	 << "compute_accumulated_correlations()." << std::endl;
+    abort_handler(-1);
+  }
+
+  int num_corr = numVars + numFns;
+  simpleCorr.shape(num_corr, num_corr);
+  if (accumSamples <= 1)
+    simpleCorr.putScalar(std::numeric_limits<double>::quiet_NaN());
+  else
+    for (int j=0; j<num_corr; ++j) {
+      for (int i=0; i<num_corr; ++i)
+	simpleCorr(i,j) = accumCoMoments(i,j) /
+	  std::sqrt(accumCoMoments(i,i) * accumCoMoments(j,j));
+      // set finite diagonal values to 1.0
+      if (std::isfinite(simpleCorr(j,j)))
+	simpleCorr(j,j) = 1.0;
+      for (int i=0; i<num_corr; ++i)
+	if (i != j)
+	  correl_adjust(simpleCorr(i,j));
+    }
+
+  // without the samples, there is no SVD fallback
+  if (!partial_corr_from_simple(simpleCorr, numVars, partialCorr,
+				numericalIssuesRaw)) {
+    partialCorr.shape(numVars, numFns);
+    partialCorr.putScalar(std::numeric_limits<double>::quiet_NaN());
+    numericalIssuesRaw = true;
+  }
 
+  simpleRankCorr.shape(0, 0);
+  partialRankCorr.shape(0, 0);
+  numericalIssuesRank = false;
   corrComputed = true;
 }
 
+
+void SensAnalysisGlobal::reset_accumulated_correlations()
+{
+  accumSamples = 0;
+  accumMeans.sizeUninitialized(0);
+  accumCoMoments.shapeUninitialized(0, 0);
+}
+
 /** Calculates simple correlation coefficients from a matrix of data
     (oriented factors x observations):
      - num_corr is number of rows of total data 
@@ -269,16 +424,18 @@ simple_corr(RealMatrix& total_data, const int& num_in, RealMatrix& corr_matrix)
 
   center_matrix_rows(total_data);
 
-  for (int i=0; i<num_corr; i++) {
-    // calculate sum of squares for each factor (row)
-    Real row_sumsq = 0.0;
-    for (int j=0; j<num_obs; j++)
-      row_sumsq += total_data(i,j)*total_data(i,j);
-    row_sumsq = std::sqrt(row_sumsq);
-    // normalize the rows with the sumsquare term
-    for (int j=0; j<num_obs; j++)
-      total_data(i,j) /= row_sumsq;
-  }
+  // calculate sum of squares for each factor (row), sweeping the
+  // column-major data by columns
+  RealVector row_sumsq(num_corr);
+  for (int j=0; j<num_obs; j++)
+    for (int i=0; i<num_corr; i++)
+      row_sumsq[i] += total_data(i,j)*total_data(i,j);
+  for (int i=0; i<num_corr; i++)
+    row_sumsq[i] = std::sqrt(row_sumsq[i]);
+  // normalize the rows with the sumsquare term
+  for (int j=0; j<num_obs; j++)
+    for (int i=0; i<num_corr; i++)
+      total_data(i,j) /= row_sumsq[i];
 
   // calculate matrix of simple correlation coefficients
   if (num_corr == num_in) {
@@ -462,6 +619,73 @@ partial_corr(RealMatrix& total_data, const int num_in,
       correl_adjust(corr_matrix(i,j));
 }
 
+/** With A = inv(C_VV) for the input block of the correlation matrix
+    and B = A C_VR, the partial correlation of input i and output k,
+    controlling for the other inputs, is B(i,k) / sqrt(s_k A(i,i) +
+    B(i,k)^2), where s_k = 1 - C_Vk' B(:,k) is the Schur complement of
+    C_VV in the correlation matrix of the inputs and output k.  This
+    matches partial_corr() when C_VV is well conditioned; otherwise
+    false is returned so that partial_corr() can apply its truncated
+    SVD to the samples. */
+bool SensAnalysisGlobal::
+partial_corr_from_simple(const RealMatrix& simple_corr_mat, const int num_in,
+                         RealMatrix& corr_matrix, bool& numerical_issues)
+{
+  int num_corr = simple_corr_mat.numRows(), num_out = num_corr - num_in;
+  if (simple_corr_mat.numCols() != num_corr || num_in < 1 || num_out < 1 ||
+      has_nan_or_inf(simple_corr_mat))
+    return false;
+
+  corr_matrix.reshape(num_in, num_out);
+  numerical_issues = false;
+
+  // For a single input factor, partial = simple (no controlling factors)
+  if (num_in == 1) {
+    for (int k=0; k<num_out; ++k)
+      corr_matrix(0, k) = simple_corr_mat(0, k+1);
+    return true;
+  }
+
+  // populate both triangles, so the stored one is set
+  RealSymMatrix corr_inv(num_in);
+  for (int j=0; j<num_in; ++j)
+    for (int i=0; i<num_in; ++i)
+      corr_inv(i,j) = simple_corr_mat(i,j);
+  RealMatrix corr_in_out(Teuchos::View, simple_corr_mat, num_in, num_out,
+			 0, num_in);
+
+  // unit diagonal, so no equilibration is needed
+  RealSpdSolver spd_solver;
+  spd_solver.setMatrix(Teuchos::rcp(&corr_inv, false));
+  Real rcond;
+  if (spd_solver.factor() ||
+      spd_solver.reciprocalConditionEstimate(rcond) ||
+      rcond < std::sqrt(std::numeric_limits<Real>::epsilon()) ||
+      spd_solver.invert())
+    return false;
+
+  RealMatrix inv_corr_in_out(num_in, num_out);
+  inv_corr_in_out.multiply(Teuchos::LEFT_SIDE, 1.0, corr_inv, corr_in_out,
+			   0.0);
+  for (int k=0; k<num_out; ++k) {
+    Real schur = 1.0;
+    for (int i=0; i<num_in; ++i)
+      schur -= corr_in_out(i,k) * inv_corr_in_out(i,k);
+    for (int i=0; i<num_in; ++i) {
+      Real b_ik = inv_corr_in_out(i,k);
+      corr_matrix(i,k) = b_ik / std::sqrt(schur * corr_inv(i,i) + b_ik * b_ik);
+    }
+  }
+  if (has_nan_or_inf(corr_matrix))
+    return false;
+
+  // snap all finite values to [-1.0, 1.0]
+  for (int i=0; i<num_in; ++i)
+    for (int j=0; j<num_out; ++j)
+      correl_adjust(corr_matrix(i,j));
+  return true;
+}
+
 // Return true if any correlation coefficient is NaN or Inf, false otherwise
 bool SensAnalysisGlobal::has_nan_or_inf(const RealMatrix &corr) const {
   int num_rows = corr.numRows(), num_cols = corr.numCols();
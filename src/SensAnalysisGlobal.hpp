@@ -16,6 +16,9 @@
 #include "DakotaResponse.hpp"
 #include "dakota_global_defs.hpp"
 #include "dakota_results_types.hpp"
+
+#include <functional>
+
 namespace Dakota {
 
 class ResultsManager;
@@ -54,6 +57,20 @@ public:
   void compute_correlations(const RealMatrix&     vars_samples,
                             const IntResponseMap& resp_samples);
 
+  /// streaming alternative to compute_correlations(): accumulates the
+  /// sample count, means, and co-moments of one chunk of samples so
+  /// that the full sample matrix need not be held
+  void accumulate_correlations(const RealMatrix&     vars_samples,
+                               const IntResponseMap& resp_samples);
+
+  /// computes simple and partial correlations from the statistics
+  /// accumulated by accumulate_correlations(); rank correlations
+  /// require all samples and are not computed
+  void compute_accumulated_correlations();
+
+  /// discard statistics accumulated by accumulate_correlations()
+  void reset_accumulated_correlations();
+
   /// save correlations to database
   void archive_correlations(const StrStrSizet& run_identifier,  
                             ResultsManager& iterator_results,
@@ -72,6 +89,11 @@ public:
   /// has been invoked
   bool correlations_computed() const;
 
+  /// simple (raw or rank) correlations among all inputs and outputs
+  const RealMatrix& simple_correlations(bool rank = false) const;
+  /// partial (raw or rank) correlations between inputs and outputs
+  const RealMatrix& partial_correlations(bool rank = false) const;
+
   /// prints the correlations computed in compute_correlations()
   void print_correlations(std::ostream& s, const StringArray& var_labels,
 			  const StringArray& resp_labels) const;
@@ -148,9 +170,19 @@ private:
                            const BoolDeque is_valid_sample,
                            RealMatrix& valid_samples);
 
+  /// computes the four correlation matrices from num_valid_samples
+  /// valid samples of num_corr factors; fill_valid_data (re)populates
+  /// the valid sample matrix when needed
+  void compute_valid_correlations(int num_corr, int num_valid_samples,
+    const std::function<void(RealMatrix&)>& fill_valid_data);
+
   /// replace sample values with their ranks, in-place
   void values_to_ranks(RealMatrix& valid_data);
 
+  /// replace the values of rows [first_row, last_row) with their ranks
+  static void rows_to_ranks(RealMatrix& valid_data, int first_row,
+                            int last_row);
+
   /// sort algorithm to compute ranks for rank correlations
   static bool rank_sort(const int& x, const int& y);
 
@@ -164,6 +196,13 @@ private:
   void partial_corr(RealMatrix& total_data, const int num_in, 
                     const RealMatrix& simple_corr_mat,
                     RealMatrix& corr_matrix, bool& numerical_issues);
+  /// computes partial correlations from the all-to-all simple
+  /// correlation matrix using one factorization of its input block;
+  /// returns false (leaving corr_matrix unset) when that block is not
+  /// safely positive definite, in which case partial_corr() applies
+  bool partial_corr_from_simple(const RealMatrix& simple_corr_mat,
+                                const int num_in, RealMatrix& corr_matrix,
+                                bool& numerical_issues);
 
   /// Return true if there are any NaN or Inf entries in the matrix
   bool has_nan_or_inf(const RealMatrix &corr) const;
@@ -283,6 +322,13 @@ private:
   /// flag indicatng whether correlations have been computed
   bool corrComputed;
 
+  /// number of samples accumulated by accumulate_correlations()
+  size_t accumSamples;
+  /// running means of the accumulated factors (inputs, then outputs)
+  RealVector accumMeans;
+  /// running sums of products of deviations from accumMeans
+  RealMatrix accumCoMoments;
+
 protected:
 
   /// compute binned sobol indices from valid samples (having screened out samples with non-numeric response)
@@ -331,7 +377,8 @@ protected:
 };
 
 
-inline SensAnalysisGlobal::SensAnalysisGlobal(): corrComputed(false)
+inline SensAnalysisGlobal::SensAnalysisGlobal():
+  corrComputed(false), accumSamples(0)
 { }
 
 
@@ -342,6 +389,16 @@ inline SensAnalysisGlobal::~SensAnalysisGlobal()
 inline bool SensAnalysisGlobal::correlations_computed() const
 { return corrComputed; }
 
+
+inline const RealMatrix& SensAnalysisGlobal::
+simple_correlations(bool rank) const
+{ return (rank) ? simpleRankCorr : simpleCorr; }
+
+
+inline const RealMatrix& SensAnalysisGlobal::
+partial_correlations(bool rank) const
+{ return (rank) ? partialRankCorr : partialCorr; }
+
 } // namespace Dakota
 
 #endif
@@ -598,6 +598,82 @@ RealArray SurfpackApproximation::map_eval_vars(const Variables& vars)
 }
 
 
+Real2DArray SurfpackApproximation::
+map_eval_vars(const Variables& vars, const RealMatrix& c_vars)
+{
+  int p, num_pts = c_vars.numCols(), num_cv = c_vars.numRows();
+  Real2DArray eval_pts(num_pts);
+  Variables pt_vars = vars.copy();
+  for (p=0; p<num_pts; ++p) {
+    RealVector c_vars_p(Teuchos::View, const_cast<Real*>(c_vars[p]), num_cv);
+    pt_vars.continuous_variables(c_vars_p);
+    eval_pts[p] = map_eval_vars(pt_vars);
+  }
+  return eval_pts;
+}
+
+
+/** SurfpackModel evaluates one point at a time; the batch versions map
+    all points up front and call the model directly. */
+void SurfpackApproximation::
+batch_value(const Variables& vars, const RealMatrix& c_vars,
+	    RealVector& fn_vals)
+{
+  if (!spModel) {
+    Cerr << "Error: surface is null in SurfpackApproximation::batch_value()"
+	 << std::endl;
+    abort_handler(-1);
+  }
+
+  Real2DArray eval_pts = map_eval_vars(vars, c_vars);
+  size_t p, num_pts = eval_pts.size();
+  fn_vals.sizeUninitialized(num_pts);
+  for (p=0; p<num_pts; ++p)
+    fn_vals[p] = (*spModel)(eval_pts[p]);
+}
+
+
+void SurfpackApproximation::
+batch_gradient(const Variables& vars, const RealMatrix& c_vars,
+	       RealMatrix& fn_grads)
+{
+  Real2DArray eval_pts = map_eval_vars(vars, c_vars);
+  size_t p, i, num_pts = eval_pts.size(), num_cv = c_vars.numRows();
+  fn_grads.shapeUninitialized(num_cv, num_pts);
+  try {
+    for (p=0; p<num_pts; ++p) {
+      VecDbl local_grad = spModel->gradient(eval_pts[p]);
+      for (i=0; i<num_cv; ++i)
+	fn_grads(i,p) = local_grad[i];
+    }
+  }
+  catch (...) {
+    Cerr << "Error: gradient() not available for this approximation type."
+	 << std::endl;
+    abort_handler(-1);
+  }
+}
+
+
+void SurfpackApproximation::
+batch_prediction_variance(const Variables& vars, const RealMatrix& c_vars,
+			  RealVector& fn_vars)
+{
+  Real2DArray eval_pts = map_eval_vars(vars, c_vars);
+  size_t p, num_pts = eval_pts.size();
+  fn_vars.sizeUninitialized(num_pts);
+  try {
+    for (p=0; p<num_pts; ++p)
+      fn_vars[p] = spModel->variance(eval_pts[p]);
+  }
+  catch (...) {
+    Cerr << "Error: prediction_variance() not available for this "
+	 << "approximation type." << std::endl;
+    abort_handler(-1);
+  }
+}
+
+
 Real SurfpackApproximation::value(const RealVector& c_vars)
 {
     //static int times_called = 0;
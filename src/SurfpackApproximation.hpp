@@ -110,6 +110,18 @@ protected:
   /// (KrigingModel only)
   Real prediction_variance(const RealVector& c_vars) override;
 
+  /// Return the values of the Surfpack surface for a batch of points
+  void batch_value(const Variables& vars, const RealMatrix& c_vars,
+		   RealVector& fn_vals) override;
+  /// retrieve the approximate function gradients for a batch of points
+  void batch_gradient(const Variables& vars, const RealMatrix& c_vars,
+		      RealMatrix& fn_grads) override;
+  /// retrieve the variances of the predicted values for a batch of points
+  /// (KrigingModel only)
+  void batch_prediction_variance(const Variables& vars,
+				 const RealMatrix& c_vars,
+				 RealVector& fn_vars) override;
+
   /// check if the diagnostics are available (true for the Surfpack types)
   bool diagnostics_available() override;
   /// retrieve a single diagnostic metric for the diagnostic type specified
@@ -157,6 +169,9 @@ private:
 
   /// extract active or all view as vector, mapping if needed for import
   RealArray map_eval_vars(const Variables& vars);
+  /// extract the active or all view for each point in the columns of
+  /// c_vars, other variables taken from vars
+  Real2DArray map_eval_vars(const Variables& vars, const RealMatrix& c_vars);
 
   //
   //- Heading: Data
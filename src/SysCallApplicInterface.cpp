@@ -118,6 +118,33 @@ pid_t SysCallApplicInterface::create_evaluation_process(bool block_flag)
 /** Check for completion of active asynch jobs (tracked with sysCallSet).
     Make one pass through sysCallSet & complete all jobs that have returned. */
 void SysCallApplicInterface::test_local_evaluation_sequence(PRPQueue& prp_queue)
+{
+  watch_results_directories();
+  test_results_files(prp_queue);
+
+  // reduce processor load from DAKOTA testing if jobs are not finishing,
+  // returning as soon as a results file is written when it can be watched
+  if (completionSet.empty()) // no jobs completed in pass through entire set
+    completionNotifier.wait(1);
+}
+
+
+bool SysCallApplicInterface::watch_results_directories()
+{
+  std::set<std::filesystem::path> results_dirs;
+  std::error_code ec;
+  for (int fn_eval_id : sysCallSet) {
+    std::filesystem::path results_file
+      = std::filesystem::absolute(fileNameMap[fn_eval_id].get<1>(), ec);
+    if (ec)
+      return false;
+    results_dirs.insert(results_file.parent_path());
+  }
+  return completionNotifier.watch_directories(results_dirs);
+}
+
+
+void SysCallApplicInterface::test_results_files(PRPQueue& prp_queue)
 {
   // Convenience function for common code between wait and nowait case.
 
@@ -205,10 +232,6 @@ void SysCallApplicInterface::test_local_evaluation_sequence(PRPQueue& prp_queue)
     }
   }
 
-  // reduce processor load from DAKOTA testing if jobs are not finishing
-  if (completionSet.empty()) { // no jobs completed in pass through entire set
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
-  }
   // remove completed jobs from sysCallSet
   for (ISCIter it = completionSet.begin(); it != completionSet.end(); ++it)
     sysCallSet.erase(*it);
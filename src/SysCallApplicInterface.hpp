@@ -11,6 +11,7 @@
 #define SYS_CALL_APPLIC_INTERFACE_H
 
 #include "ProcessApplicInterface.hpp"
+#include "CompletionNotifier.hpp"
 
 
 namespace Dakota {
@@ -64,6 +65,12 @@ private:
   /// detect completion of a function evaluation through existence of
   /// the necessary results file(s); return true if results files found
   bool system_call_file_test(const std::filesystem::path& root_file);
+  /// make one pass through sysCallSet, completing all jobs whose results
+  /// files are available
+  void test_results_files(PRPQueue& prp_queue);
+  /// watch the directories of the results files for the active jobs;
+  /// returns true if all are watched
+  bool watch_results_directories();
 
   /// spawn a complete function evaluation
   void spawn_evaluation_to_shell(bool block_flag);
@@ -84,6 +91,10 @@ private:
     
   /// map linking function evaluation id's to number of response read failures
   IntShortMap failCountMap; 
+
+  /// event-driven detection of results files, replacing sleeps between
+  /// passes through sysCallSet where supported
+  CompletionNotifier completionNotifier;
 };
 
 
@@ -100,8 +111,15 @@ inline SysCallApplicInterface::~SysCallApplicInterface()
 inline void SysCallApplicInterface::
 wait_local_evaluation_sequence(PRPQueue& prp_queue)
 {
-  while (completionSet.empty()) // complete at least one job
-    test_local_evaluation_sequence(prp_queue);
+  // watch before testing so that files written in between are not missed
+  bool watched = watch_results_directories();
+  test_results_files(prp_queue);
+  while (completionSet.empty()) { // complete at least one job
+    // block until a results file is written (the timeout is only a
+    // safeguard) or, if the directories cannot be watched, poll
+    completionNotifier.wait(watched ? 100 : 1);
+    test_results_files(prp_queue);
+  }
 }
 
 
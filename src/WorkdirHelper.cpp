@@ -26,7 +26,13 @@
 
 #else
   #include <unistd.h>
+  #include <fcntl.h>
   #include <sys/param.h>             // for MAXPATHLEN
+  #include <sys/stat.h>
+  #ifdef HAVE_LINUX_FS_H
+  #include <linux/fs.h>              // for FICLONE
+  #include <sys/ioctl.h>
+  #endif
   #define DAK_PATH_ENV_NAME "PATH"
   #define DAK_PATH_SEP ':'
   #define DAK_SLASH '/'
@@ -748,6 +754,15 @@ void WorkdirHelper::copy_items(const StringArray& source_items,
 }
 
 
+void WorkdirHelper::clone_items(const StringArray& source_items,
+				const std::filesystem::path& dest_dir,
+				bool overwrite)
+{
+  file_op_function file_op = &WorkdirHelper::recursive_clone;
+  file_op_items(file_op, source_items, dest_dir, false);
+}
+
+
 // no longer being used...
 void WorkdirHelper::prepend_path_items(const StringArray& source_items)
 {
@@ -817,6 +832,18 @@ bool WorkdirHelper::link(const std::filesystem::path& src_path, const std::files
 /// (may need to reconsider)
 bool WorkdirHelper::recursive_copy(const std::filesystem::path& src_path, 
 				   const std::filesystem::path& dest_dir, bool overwrite)
+{ return copy_tree(src_path, dest_dir, overwrite, false); }
+
+
+bool WorkdirHelper::recursive_clone(const std::filesystem::path& src_path,
+				    const std::filesystem::path& dest_dir,
+				    bool overwrite)
+{ return copy_tree(src_path, dest_dir, overwrite, true); }
+
+
+bool WorkdirHelper::copy_tree(const std::filesystem::path& src_path,
+			      const std::filesystem::path& dest_dir,
+			      bool overwrite, bool link_read_only)
 {
   try {
     // precondition: dest exists and is a dir
@@ -835,7 +862,10 @@ bool WorkdirHelper::recursive_copy(const std::filesystem::path& src_path,
     if (!std::filesystem::exists(dest_path)) {
 
       // non-recursive copy of file or directory or symlink into dest
-      std::filesystem::copy(src_path, dest_path);
+      if (std::filesystem::is_regular_file(src_path))
+	clone_file(src_path, dest_path, link_read_only);
+      else
+	std::filesystem::copy(src_path, dest_path);
       //std::filesystem::create_directory(dest_path);
       //std::filesystem::copy_directory(src_path, dest_path);
 
@@ -844,7 +874,7 @@ bool WorkdirHelper::recursive_copy(const std::filesystem::path& src_path,
         std::filesystem::directory_iterator dir_end;
 	for ( ; dir_it != dir_end; ++dir_it) {
           std::filesystem::path src_item(dir_it->path());
-	  recursive_copy(src_item, dest_path, overwrite);
+	  copy_tree(src_item, dest_path, overwrite, link_read_only);
 	}
       }
     }
@@ -859,6 +889,52 @@ bool WorkdirHelper::recursive_copy(const std::filesystem::path& src_path,
 }
 
 
+void WorkdirHelper::clone_file(const std::filesystem::path& src_path,
+			       const std::filesystem::path& dest_path,
+			       bool link_read_only)
+{
+  // a hard link to a file that no one may write reads like a copy
+  // (permissions are copied too) but costs no space or time; it is
+  // limited to recycled directories, whose staged items are checked
+  // after each evaluation, since an analysis may still change the
+  // permissions or replace the contents through the shared inode
+  std::filesystem::perms any_write = std::filesystem::perms::owner_write |
+    std::filesystem::perms::group_write | std::filesystem::perms::others_write;
+  std::filesystem::perms src_perms
+    = std::filesystem::status(src_path).permissions();
+  std::error_code ec;
+  if (link_read_only &&
+      (src_perms & any_write) == std::filesystem::perms::none) {
+    std::filesystem::create_hard_link(src_path, dest_path, ec);
+    if (!ec)
+      return; // else, e.g., different file systems: copy
+  }
+
+#if defined(HAVE_LINUX_FS_H) && defined(FICLONE)
+  // copy-on-write clone on file systems supporting reflinks (Btrfs, XFS,
+  // ...); blocks are only duplicated when either file is modified
+  int src_fd = open(src_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (src_fd >= 0) {
+    int dest_fd = open(dest_path.c_str(), O_WRONLY | O_CREAT | O_EXCL |
+		       O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (dest_fd >= 0) {
+      bool cloned = (ioctl(dest_fd, FICLONE, src_fd) == 0);
+      close(dest_fd);
+      if (cloned) {
+	close(src_fd);
+	std::filesystem::permissions(dest_path, src_perms, ec);
+	return;
+      }
+      std::filesystem::remove(dest_path, ec);
+    }
+    close(src_fd);
+  }
+#endif
+
+  std::filesystem::copy_file(src_path, dest_path);
+}
+
+
 /// prepend the env path with source path if it's a directory or
 /// directory symlink
 bool WorkdirHelper::prepend_path_item(const std::filesystem::path& src_path, 
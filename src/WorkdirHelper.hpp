@@ -195,6 +195,13 @@ public:
 			 const std::filesystem::path& dest_dir,
 			 bool overwrite);
 
+  /// copy_items for a recycled work directory, whose staged items are
+  /// checked after each evaluation: files that no one may write are
+  /// hard linked rather than copied
+  static void clone_items(const StringArray& source_items,
+			  const std::filesystem::path& dest_dir,
+			  bool overwrite);
+
   /// prepend any directories (including wildcards) found in
   /// source_items to the preferred environment path; this will update
   /// cached preferred path and PATH
@@ -225,6 +232,26 @@ public:
   /// dest_dir/src_path.filename()
   static bool recursive_copy(const std::filesystem::path& src_path, 
 			     const std::filesystem::path& dest_dir, bool overwrite);
+
+  /// recursive_copy that hard links files no one may write
+  static bool recursive_clone(const std::filesystem::path& src_path,
+			      const std::filesystem::path& dest_dir,
+			      bool overwrite);
+
+  /// kernel of recursive_copy and recursive_clone: recursive copy of
+  /// src_path into dest_dir, optionally hard linking files no one may
+  /// write
+  static bool copy_tree(const std::filesystem::path& src_path,
+			const std::filesystem::path& dest_dir,
+			bool overwrite, bool link_read_only);
+
+  /// copy regular file src_path to (non-existent) dest_path, sharing
+  /// storage where that cannot change results: if link_read_only, a
+  /// hard link if no one may write the file, else a copy-on-write clone
+  /// (reflink) where the file system supports it, else a full copy
+  static void clone_file(const std::filesystem::path& src_path,
+			 const std::filesystem::path& dest_path,
+			 bool link_read_only);
  
   /// prepend the preferred env path with source path if it's a
   /// directory; this will update cached preferred path and manipulate
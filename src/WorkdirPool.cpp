@@ -0,0 +1,242 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "WorkdirPool.hpp"
+#include "dakota_global_defs.hpp"
+#include "WorkdirHelper.hpp"
+#include <algorithm>
+#include <set>
+
+namespace Dakota {
+
+WorkdirPool::
+WorkdirPool(const std::filesystem::path& base_name,
+	    const StringArray& copy_files, const StringArray& link_files):
+  baseName(base_name.is_absolute() ? base_name :
+	   WorkdirHelper::rel_to_abs(base_name)),
+  copyFiles(copy_files), linkFiles(link_files), slotCounter(0),
+  shutdownFlag(false)
+{ }
+
+
+WorkdirPool::~WorkdirPool()
+{
+  if (cleanupThread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(poolMutex);
+      shutdownFlag = true;
+    }
+    cleanupCondition.notify_one();
+    cleanupThread.join();
+  }
+  for (const auto& slot : slots)
+    WorkdirHelper::recursive_remove(slot->dir, FILEOP_SILENT);
+}
+
+
+std::filesystem::path WorkdirPool::acquire()
+{
+  Slot* slot = NULL;
+  bool new_slot = false;
+  std::vector<std::unique_ptr<Slot> > failed_slots;
+  {
+    std::unique_lock<std::mutex> lock(poolMutex);
+    while (!slot) {
+      bool cleaning = false;
+      for (auto s_it = slots.begin(); s_it != slots.end(); ) {
+	if ((*s_it)->state == SLOT_FAILED) {
+	  failed_slots.push_back(std::move(*s_it));
+	  s_it = slots.erase(s_it);
+	  continue;
+	}
+	if ((*s_it)->state == SLOT_READY && !slot)
+	  slot = s_it->get();
+	else if ((*s_it)->state == SLOT_CLEANING)
+	  cleaning = true;
+	++s_it;
+      }
+      // prefer waiting on a reset, which is cheaper than staging a new
+      // directory, to keep the pool at the evaluation concurrency
+      if (!slot && !cleaning) {
+	slots.push_back(std::unique_ptr<Slot>(new Slot));
+	slot = slots.back().get();
+	slot->dir = WorkdirHelper::concat_path(baseName,
+	  ".slot" + std::to_string(++slotCounter));
+	new_slot = true;
+      }
+      if (!slot)
+	readyCondition.wait(lock);
+    }
+    slot->state = SLOT_IN_USE;
+  }
+
+  for (const auto& failed : failed_slots) {
+    Cout << "\nWarning: could not reset work_directory " << failed->dir
+	 << "; replacing it." << std::endl;
+    WorkdirHelper::recursive_remove(failed->dir, FILEOP_WARN);
+  }
+
+  // a stale directory left by an earlier run is not trusted
+  if (new_slot)
+    WorkdirHelper::create_directory(slot->dir, DIR_CLEAN);
+  stage(*slot);
+  return slot->dir;
+}
+
+
+void WorkdirPool::release(const std::filesystem::path& dir)
+{
+  {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    auto s_it = std::find_if(slots.begin(), slots.end(),
+      [&dir](const std::unique_ptr<Slot>& s) { return s->dir == dir; });
+    if (s_it == slots.end() || (*s_it)->state != SLOT_IN_USE)
+      return;
+    (*s_it)->state = SLOT_CLEANING;
+    cleanupQueue.push_back(s_it->get());
+    if (!cleanupThread.joinable())
+      cleanupThread = std::thread(&WorkdirPool::cleanup_loop, this);
+  }
+  cleanupCondition.notify_one();
+}
+
+
+bool WorkdirPool::contains(const std::filesystem::path& dir) const
+{
+  std::lock_guard<std::mutex> lock(poolMutex);
+  return std::any_of(slots.begin(), slots.end(),
+    [&dir](const std::unique_ptr<Slot>& s) { return s->dir == dir; });
+}
+
+
+size_t WorkdirPool::num_slots() const
+{
+  std::lock_guard<std::mutex> lock(poolMutex);
+  return slots.size();
+}
+
+
+void WorkdirPool::stage(Slot& slot)
+{
+  // with overwrite disabled, only the items removed by clean() (or all
+  // items for a new directory) are copied or linked
+  WorkdirHelper::clone_items(copyFiles, slot.dir, false);
+  WorkdirHelper::link_items(linkFiles, slot.dir, false);
+
+  slot.manifest.clear();
+  std::error_code ec;
+  for (std::filesystem::recursive_directory_iterator
+	 e_it(slot.dir, ec), e_end; !ec && e_it != e_end; e_it.increment(ec)) {
+    EntryState state;
+    if (entry_state(e_it->path(), state))
+      slot.manifest[e_it->path().lexically_relative(slot.dir)] = state;
+  }
+  if (ec) {
+    Cerr << "\nError: could not list work_directory " << slot.dir << "; "
+	 << ec.message() << std::endl;
+    abort_handler(-1);
+  }
+}
+
+
+bool WorkdirPool::entry_state(const std::filesystem::path& entry,
+			      EntryState& state)
+{
+  std::error_code ec;
+  std::filesystem::file_status status = std::filesystem::symlink_status(entry, ec);
+  if (ec)
+    return false;
+  state.type = status.type();
+  state.size = 0;
+  state.writeTime = std::filesystem::file_time_type();
+  state.linkTarget.clear();
+  if (state.type == std::filesystem::file_type::regular) {
+    state.size = std::filesystem::file_size(entry, ec);
+    if (!ec)
+      state.writeTime = std::filesystem::last_write_time(entry, ec);
+  }
+  else if (state.type == std::filesystem::file_type::symlink)
+    state.linkTarget = std::filesystem::read_symlink(entry, ec);
+  // directory sizes and times change with their contents, which are
+  // compared entry by entry instead
+  return !ec;
+}
+
+
+bool WorkdirPool::clean(Slot& slot)
+{
+  // top-level names of template items to remove (and later re-stage)
+  // and of other items created by the evaluation
+  std::set<std::filesystem::path> remove_items;
+  size_t num_unchanged = 0;
+  std::error_code ec;
+  for (std::filesystem::recursive_directory_iterator
+	 e_it(slot.dir, ec), e_end; !ec && e_it != e_end; e_it.increment(ec)) {
+    std::filesystem::path rel_path = e_it->path().lexically_relative(slot.dir);
+    std::filesystem::path top_item = *rel_path.begin();
+    if (remove_items.count(top_item)) {
+      e_it.disable_recursion_pending();
+      continue;
+    }
+    auto m_it = slot.manifest.find(rel_path);
+    EntryState state;
+    if (m_it != slot.manifest.end() && entry_state(e_it->path(), state) &&
+	state.type == m_it->second.type && state.size == m_it->second.size &&
+	state.writeTime == m_it->second.writeTime &&
+	state.linkTarget == m_it->second.linkTarget)
+      ++num_unchanged;
+    else {
+      // new or modified: the whole top-level item goes
+      remove_items.insert(top_item);
+      e_it.disable_recursion_pending();
+    }
+  }
+  if (ec)
+    return false;
+
+  // template entries that were deleted by the evaluation
+  if (num_unchanged < slot.manifest.size())
+    for (const auto& rel_state : slot.manifest) {
+      std::filesystem::path top_item = *rel_state.first.begin();
+      if (!remove_items.count(top_item) &&
+	  !std::filesystem::exists(std::filesystem::symlink_status(
+	    slot.dir / rel_state.first, ec)))
+	remove_items.insert(top_item);
+    }
+
+  for (const auto& top_item : remove_items) {
+    std::filesystem::remove_all(slot.dir / top_item, ec);
+    if (ec)
+      return false;
+  }
+  return true;
+}
+
+
+void WorkdirPool::cleanup_loop()
+{
+  std::unique_lock<std::mutex> lock(poolMutex);
+  for (;;) {
+    cleanupCondition.wait(lock,
+      [this]() { return shutdownFlag || !cleanupQueue.empty(); });
+    if (shutdownFlag)
+      return;
+    Slot* slot = cleanupQueue.front();
+    cleanupQueue.pop_front();
+
+    lock.unlock();
+    bool cleaned = clean(*slot);
+    lock.lock();
+
+    slot->state = (cleaned) ? SLOT_READY : SLOT_FAILED;
+    readyCondition.notify_all();
+  }
+}
+
+} // namespace Dakota
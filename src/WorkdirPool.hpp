@@ -0,0 +1,142 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#ifndef WORKDIR_POOL_H
+#define WORKDIR_POOL_H
+
+#include "dakota_data_types.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Dakota {
+
+/// Pool of work directories reused across evaluations
+
+/** WorkdirPool hands out one work directory per concurrently running
+    evaluation (named base_name.slot1, base_name.slot2, ...) and returns
+    it to its initial state, rather than removing it, when the evaluation
+    is released.  After a directory is populated with the template
+    copy_files and link_files, the type, size, and modification time of
+    every entry is recorded.  On release, a background thread removes
+    any entry not in this record and any top-level template item with
+    an entry that was changed or deleted.  The next acquire() restores
+    the removed template items, so only modified parts of the template
+    are staged again.  Slot directories are absolute, since the process
+    working directory changes while analyses are launched; template items
+    are only staged by acquire(), which runs in the startup directory. */
+class WorkdirPool
+{
+public:
+
+  //
+  //- Heading: Constructors and destructor
+  //
+
+  /// constructor; base_name is the directory name before slot tagging
+  WorkdirPool(const std::filesystem::path& base_name,
+	      const StringArray& copy_files, const StringArray& link_files);
+  /// destructor waits for pending cleanups and removes all directories
+  ~WorkdirPool();
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// return a populated directory not in use by another evaluation
+  std::filesystem::path acquire();
+  /// return dir (from acquire()) to the pool; it is cleaned in the
+  /// background
+  void release(const std::filesystem::path& dir);
+  /// whether dir was handed out by this pool
+  bool contains(const std::filesystem::path& dir) const;
+
+  /// number of directories currently in the pool
+  size_t num_slots() const;
+
+private:
+
+  //
+  //- Heading: Convenience types
+  //
+
+  /// recorded state of a directory entry after staging
+  struct EntryState {
+    std::filesystem::file_type type;
+    std::uintmax_t size;
+    std::filesystem::file_time_type writeTime;
+    std::filesystem::path linkTarget;
+  };
+
+  /// availability of a pooled directory
+  enum SlotState { SLOT_READY, SLOT_IN_USE, SLOT_CLEANING, SLOT_FAILED };
+
+  /// a pooled directory
+  struct Slot {
+    std::filesystem::path dir;
+    SlotState state;
+    /// template entries by path relative to dir
+    std::map<std::filesystem::path, EntryState> manifest;
+  };
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// copy and link any missing template items into slot and record the
+  /// resulting entries (scheduling thread)
+  void stage(Slot& slot);
+  /// remove all but the unmodified template entries (cleanup thread);
+  /// returns false on a file system error
+  static bool clean(Slot& slot);
+  /// record the type, size, modification time, or link target of entry
+  static bool entry_state(const std::filesystem::path& entry,
+			  EntryState& state);
+  /// cleanup thread main loop
+  void cleanup_loop();
+
+  //
+  //- Heading: Data
+  //
+
+  /// absolute directory name before slot tagging
+  std::filesystem::path baseName;
+  /// template items copied into each directory
+  StringArray copyFiles;
+  /// template items linked into each directory
+  StringArray linkFiles;
+  /// number of directories created, used in their names
+  size_t slotCounter;
+
+  /// pooled directories (stable addresses for the cleanup thread)
+  std::vector<std::unique_ptr<Slot>> slots;
+  /// slots awaiting cleanup
+  std::deque<Slot*> cleanupQueue;
+  /// signals cleanup thread shutdown
+  bool shutdownFlag;
+
+  /// protects slot states, cleanupQueue, and shutdownFlag
+  mutable std::mutex poolMutex;
+  /// notifies the cleanup thread of queued slots or shutdown
+  std::condition_variable cleanupCondition;
+  /// notifies acquire() of completed cleanups
+  std::condition_variable readyCondition;
+  /// background thread performing removals; started on first release()
+  std::thread cleanupThread;
+};
+
+} // namespace Dakota
+
+#endif
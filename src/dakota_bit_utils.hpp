@@ -38,6 +38,13 @@ inline unsigned count_consecutive_trailing_zero_bits(UInt32 v)
   return c;
 }
 
+/// Count consecutive trailing zero bits of unsigned 64 bit integer
+inline unsigned count_consecutive_trailing_zero_bits(UInt64 v)
+{
+  return UInt32(v) ? count_consecutive_trailing_zero_bits(UInt32(v))
+    : 32 + count_consecutive_trailing_zero_bits(UInt32(v >> 32));
+}
+
 /// Reverse bits of unsigned 32 bit integer
 inline UInt32 bitreverse(UInt32 k)
 {
@@ -78,7 +85,7 @@ inline UInt64 binary2gray(UInt64 v)
 }
 
 /// Check if given integer is a power of 2
-inline bool ispow2(unsigned v)
+inline bool ispow2(UInt64 v)
 {
   return v && !(v & (v - 1));
 }
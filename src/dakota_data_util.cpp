@@ -330,15 +330,17 @@ void reorder_matrix_columns_from_index_vector( const RealMatrix& mat,
 void center_matrix_rows( RealMatrix & mat )
 {
   int num_row = mat.numRows(), num_col = mat.numCols();
-  for (int i=0; i<num_row; i++) {
-    // normalize each row (input/output factor) by its mean across observations
-    Real row_mean = 0.0;
-    for (int j=0; j<num_col; j++)
-      row_mean += mat(i,j);
-    row_mean /= (Real)num_col;
-    for (int j=0; j<num_col; j++)
-      mat(i,j) -= row_mean;
-  }
+  // normalize each row (input/output factor) by its mean across
+  // observations; sweep the column-major data by columns
+  RealVector row_means(num_row);
+  for (int j=0; j<num_col; j++)
+    for (int i=0; i<num_row; i++)
+      row_means[i] += mat(i,j);
+  for (int i=0; i<num_row; i++)
+    row_means[i] /= (Real)num_col;
+  for (int j=0; j<num_col; j++)
+    for (int i=0; i<num_row; i++)
+      mat(i,j) -= row_means[i];
 }
 
 //----------------------------------------------------------------
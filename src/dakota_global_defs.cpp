@@ -100,6 +100,8 @@ void abort_handler(int code)
   // Clean up
   Cout << std::flush; // flush cout or ofstream redirection
   Cerr << std::flush; // flush cerr or ofstream redirection
+  try { evaluation_store_db.flush(); } // write buffered evaluations
+  catch (const std::exception&) { }     // (already aborting)
   iterator_results_db.close(); // flush output files/databases 
 
   if (Dak_pddb) {
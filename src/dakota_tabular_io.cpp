@@ -12,6 +12,19 @@
 #include "DakotaVariables.hpp"
 #include "DakotaResponse.hpp"
 #include "ParamResponsePair.hpp"
+#include "dakota_thread_util.hpp"
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace Dakota {
 
@@ -601,6 +614,727 @@ validate_header(std::ifstream& data_stream,
 }
 
 
+//
+//- Utilities for mapped tabular read
+//
+// The mapped readers parse the data rows of a tabular file directly from
+// a memory-mapped view of the file into their destination storage,
+// splitting the rows into chunks that are parsed concurrently for large
+// files.  They only accept well-formed data: on any irregularity (a wrong
+// column count, a field that operator>> would not read in the same way,
+// etc.) they return false and the caller falls back to the stream-based
+// reader, which then reports the problem as it always has.
+
+namespace {
+
+/// Data rows of a tabular file, memory-mapped where supported and split
+/// into chunks that end at line boundaries
+class MappedTabularData
+{
+public:
+
+  /// map the named file and split the data that follow the current
+  /// position of input_stream (e.g., after a header) into chunks
+  MappedTabularData(const std::string& input_filename,
+		    std::istream& input_stream);
+  /// destructor unmaps the file
+  ~MappedTabularData();
+
+  /// whether the mapped readers are enabled and the data are available
+  bool good() const;
+  /// number of chunks to be parsed
+  size_t num_chunks() const;
+  /// start of chunk i
+  const char* chunk_begin(size_t i) const;
+  /// end of chunk i
+  const char* chunk_end(size_t i) const;
+
+private:
+
+  /// copy constructor is disallowed due to mapped file
+  MappedTabularData(const MappedTabularData&);
+  /// assignment is disallowed due to mapped file
+  const MappedTabularData& operator=(const MappedTabularData&);
+
+  /// map the file into memory (or read it into fileBuffer as a fallback)
+  bool map_file(const std::string& input_filename);
+
+  /// start of the mapped (or buffered) file contents
+  const char* fileData;
+  /// length of the file contents
+  size_t fileLength;
+  /// whether fileData refers to a memory map
+  bool mappedFlag;
+  /// fallback storage when memory mapping is unavailable
+  std::vector<char> fileBuffer;
+  /// chunk i spans [chunkBounds[i], chunkBounds[i+1]); empty if not good()
+  std::vector<const char*> chunkBounds;
+};
+
+
+inline bool MappedTabularData::good() const
+{ return !chunkBounds.empty(); }
+
+inline size_t MappedTabularData::num_chunks() const
+{ return chunkBounds.empty() ? 0 : chunkBounds.size() - 1; }
+
+inline const char* MappedTabularData::chunk_begin(size_t i) const
+{ return chunkBounds[i]; }
+
+inline const char* MappedTabularData::chunk_end(size_t i) const
+{ return chunkBounds[i+1]; }
+
+
+/** The number of chunks defaults to one per 4 MB of data, up to one
+    per core (see worker_threads()).  DAKOTA_TABULAR_READ_THREADS
+    overrides the default; setting it to 0 selects the stream-based
+    readers. */
+size_t mapped_read_chunks(size_t num_bytes)
+{
+  const size_t min_chunk_bytes = 4194304;
+  return worker_threads("DAKOTA_TABULAR_READ_THREADS",
+			num_bytes / min_chunk_bytes + 1);
+}
+
+
+MappedTabularData::
+MappedTabularData(const std::string& input_filename,
+		  std::istream& input_stream):
+  fileData(NULL), fileLength(0), mappedFlag(false)
+{
+  if (!mapped_read_chunks(0))
+    return; // disabled
+
+  // tellg() would set failbit on a stream at EOF, e.g., following a
+  // header-only file
+  if (!input_stream.good())
+    return;
+  std::streamoff data_start = input_stream.tellg();
+  if (data_start < 0 || !map_file(input_filename) ||
+      (size_t)data_start > fileLength)
+    return;
+
+  const char* first = fileData + data_start;
+  const char* last  = fileData + fileLength;
+  size_t i, num_bytes = last - first,
+    num_chunks = std::max((size_t)1, mapped_read_chunks(num_bytes));
+
+  // advance each nominal boundary to the start of the next line
+  chunkBounds.push_back(first);
+  for (i=1; i<num_chunks; ++i) {
+    const char* pos = std::max(first + num_bytes * i / num_chunks,
+			       chunkBounds.back());
+    const char* eol
+      = static_cast<const char*>(std::memchr(pos, '\n', last - pos));
+    pos = (eol) ? eol + 1 : last;
+    if (pos > chunkBounds.back() && pos < last)
+      chunkBounds.push_back(pos);
+  }
+  chunkBounds.push_back(last);
+}
+
+
+MappedTabularData::~MappedTabularData()
+{
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (mappedFlag)
+    munmap(const_cast<char*>(fileData), fileLength);
+#endif
+}
+
+
+bool MappedTabularData::map_file(const std::string& input_filename)
+{
+#if !defined(_WIN32) && !defined(_WIN64)
+  int fd = open(input_filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    return false;
+  }
+  fileLength = file_stat.st_size;
+  if (fileLength) {
+    void* addr = mmap(NULL, fileLength, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED) {
+      fileData = static_cast<const char*>(addr);
+      mappedFlag = true;
+      madvise(addr, fileLength, MADV_SEQUENTIAL);
+    }
+  }
+  close(fd);
+  if (mappedFlag)
+    return true;
+#endif
+
+  // fall back to reading the whole file
+  std::ifstream ifs(input_filename, std::ios::binary | std::ios::ate);
+  if (!ifs.good())
+    return false;
+  fileLength = ifs.tellg();
+  ifs.seekg(0);
+  fileBuffer.resize(fileLength);
+  if (fileLength)
+    ifs.read(fileBuffer.data(), fileLength);
+  fileData = fileBuffer.data();
+  return ifs.good();
+}
+
+
+/// whitespace as classified by the "C" locale
+inline bool is_tabular_space(char c)
+{ return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+
+/// invoke chunk_fn(i) for each chunk of data, concurrently if more than one
+template <typename ChunkFn>
+void run_chunks(const MappedTabularData& data, ChunkFn chunk_fn)
+{
+  size_t i, num_chunks = data.num_chunks();
+  std::vector<std::thread> workers;
+  for (i=1; i<num_chunks; ++i)
+    workers.emplace_back(chunk_fn, i);
+  if (num_chunks)
+    chunk_fn(0);
+  for (auto& worker : workers)
+    worker.join();
+}
+
+
+/** Succeeds only if the whole field is consumed as a Real, rejecting
+    the spellings of inf and nan (as well as anything else) that
+    operator>> would not read. */
+bool parse_real(const char* first, const char* last, Real& val)
+{
+  const char* pos = first;
+  if (pos != last && (*pos == '+' || *pos == '-'))
+    ++pos;
+  if (pos == last || !(std::isdigit((unsigned char)*pos) || *pos == '.'))
+    return false;
+  if (*first == '+') // not accepted by from_chars
+    ++first;
+#if defined(__cpp_lib_to_chars)
+  std::from_chars_result result = std::from_chars(first, last, val);
+  return result.ec == std::errc() && result.ptr == last;
+#else
+  if (std::find_if(first, last, [](char c){ return c == 'x' || c == 'X'; })
+      != last)
+    return false; // hex floats
+  std::string field(first, last);
+  char* field_end;
+  val = std::strtod(field.c_str(), &field_end);
+  return field_end == field.c_str() + field.size();
+#endif
+}
+
+
+/// Succeeds only if the whole field is consumed as an integer
+template <typename IntType>
+bool parse_integer(const char* first, const char* last, IntType& val)
+{
+  if (last - first > 1 && *first == '+' && *(first+1) != '-')
+    ++first;
+  std::from_chars_result result = std::from_chars(first, last, val);
+  return result.ec == std::errc() && result.ptr == last;
+}
+
+
+/// count the fields in each chunk, returning the total and the index of
+/// the first field of each chunk in offsets
+size_t field_offsets(const MappedTabularData& data, SizetArray& offsets)
+{
+  size_t i, num_chunks = data.num_chunks();
+  SizetArray counts(num_chunks, 0);
+  run_chunks(data, [&](size_t c) {
+    size_t count = 0;
+    bool in_field = false;
+    for (const char* pos=data.chunk_begin(c); pos!=data.chunk_end(c); ++pos) {
+      bool field_char = !is_tabular_space(*pos);
+      if (field_char && !in_field)
+	++count;
+      in_field = field_char;
+    }
+    counts[c] = count;
+  });
+
+  offsets.resize(num_chunks);
+  size_t total = 0;
+  for (i=0; i<num_chunks; ++i)
+    { offsets[i] = total; total += counts[i]; }
+  return total;
+}
+
+
+/** Invokes field_fn(index, first, last) for each whitespace-separated
+    field with overall index less than max_fields; returns false if any
+    invocation does. */
+template <typename FieldFn>
+bool parse_fields(const MappedTabularData& data, const SizetArray& offsets,
+		  size_t max_fields, FieldFn field_fn)
+{
+  std::vector<char> chunk_ok(data.num_chunks(), 1);
+  run_chunks(data, [&](size_t c) {
+    size_t index = offsets[c];
+    const char *pos = data.chunk_begin(c), *last = data.chunk_end(c);
+    while (index < max_fields) {
+      while (pos != last && is_tabular_space(*pos))
+	++pos;
+      if (pos == last)
+	break;
+      const char* field = pos;
+      while (pos != last && !is_tabular_space(*pos))
+	++pos;
+      if (!field_fn(index++, field, pos))
+	{ chunk_ok[c] = 0; return; }
+    }
+  });
+  return std::find(chunk_ok.begin(), chunk_ok.end(), 0) == chunk_ok.end();
+}
+
+
+/// count the lines containing data in each chunk, returning the total
+/// and the index of the first row of each chunk in offsets
+size_t row_offsets(const MappedTabularData& data, SizetArray& offsets)
+{
+  size_t i, num_chunks = data.num_chunks();
+  SizetArray counts(num_chunks, 0);
+  run_chunks(data, [&](size_t c) {
+    size_t count = 0;
+    bool has_data = false;
+    for (const char* pos=data.chunk_begin(c); pos!=data.chunk_end(c); ++pos) {
+      if (*pos == '\n') {
+	if (has_data) ++count;
+	has_data = false;
+      }
+      else if (!is_tabular_space(*pos))
+	has_data = true;
+    }
+    if (has_data) // last line lacks a newline
+      ++count;
+    counts[c] = count;
+  });
+
+  offsets.resize(num_chunks);
+  size_t total = 0;
+  for (i=0; i<num_chunks; ++i)
+    { offsets[i] = total; total += counts[i]; }
+  return total;
+}
+
+
+/** Invokes row_fn(row, fields) for each line containing data, where
+    field j of the row spans [fields[2*j], fields[2*j+1]).  Returns false
+    if a line does not contain num_fields fields or if any invocation
+    of row_fn does. */
+template <typename RowFn>
+bool parse_rows(const MappedTabularData& data, const SizetArray& offsets,
+		size_t num_fields, RowFn row_fn)
+{
+  std::vector<char> chunk_ok(data.num_chunks(), 1);
+  run_chunks(data, [&](size_t c) {
+    std::vector<const char*> fields(2*num_fields);
+    size_t row = offsets[c];
+    const char *pos = data.chunk_begin(c), *last = data.chunk_end(c);
+    while (pos != last) {
+      size_t num_read = 0;
+      while (true) {
+	while (pos != last && *pos != '\n' && is_tabular_space(*pos))
+	  ++pos;
+	if (pos == last || *pos == '\n')
+	  break;
+	const char* field = pos;
+	while (pos != last && !is_tabular_space(*pos))
+	  ++pos;
+	if (num_read < num_fields)
+	  { fields[2*num_read] = field; fields[2*num_read+1] = pos; }
+	++num_read;
+      }
+      if (pos != last)
+	++pos; // newline
+      if (!num_read)
+	continue;
+      if (num_read != num_fields || !row_fn(row++, fields.data()))
+	{ chunk_ok[c] = 0; return; }
+    }
+  });
+  return std::find(chunk_ok.begin(), chunk_ok.end(), 0) == chunk_ok.end();
+}
+
+
+/// Types of variable into which a tabular field is read
+enum { CONTINUOUS_FIELD, DISCRETE_INT_FIELD, DISCRETE_STRING_FIELD,
+       DISCRETE_REAL_FIELD };
+
+/// Type and index (within all or active variables of that type) of the
+/// variable into which a tabular field is read
+typedef std::pair<short, size_t> FieldTarget;
+
+/** Determines the variable targeted by each variable field of a file
+    row (in file order, following any leading columns), as
+    Variables::read_tabular() would read it after reordering by
+    var_inds.  The map is established by reading a row of field
+    positions into a copy of vars, rather than by replicating the
+    ordering logic of the Variables letters.  Returns false if the
+    targets cannot be identified uniquely. */
+bool map_var_fields(const Variables& vars, bool active_only,
+		    const std::vector<size_t>& var_inds,
+		    std::vector<FieldTarget>& field_targets)
+{
+  Variables probe_vars = vars.copy();
+  size_t i, j, num_vars = active_only ? vars.total_active() : vars.tv();
+  std::ostringstream position_oss;
+  for (j=0; j<num_vars; ++j)
+    position_oss << j << ' ';
+  std::istringstream position_iss(position_oss.str());
+  try {
+    probe_vars.read_tabular(position_iss, (active_only ? ACTIVE_VARS : ALL_VARS));
+  }
+  catch (const TabularDataTruncated&) {
+    return false;
+  }
+
+  // targets of the variables in read (input spec) order
+  std::vector<FieldTarget> read_targets(num_vars, FieldTarget(-1, 0));
+  size_t num_mapped = 0;
+  auto map_position = [&](Real position, short type, size_t index) {
+    if (position < 0. || position >= (Real)num_vars ||
+	position != std::floor(position))
+      return false;
+    FieldTarget& target = read_targets[(size_t)position];
+    if (target.first >= 0)
+      return false;
+    target = FieldTarget(type, index);
+    ++num_mapped;
+    return true;
+  };
+
+  const RealVector& c_vars  = active_only ?
+    probe_vars.continuous_variables() : probe_vars.all_continuous_variables();
+  const IntVector&  di_vars = active_only ?
+    probe_vars.discrete_int_variables() :
+    probe_vars.all_discrete_int_variables();
+  StringMultiArrayConstView ds_vars = active_only ?
+    probe_vars.discrete_string_variables() :
+    probe_vars.all_discrete_string_variables();
+  const RealVector& dr_vars = active_only ?
+    probe_vars.discrete_real_variables() :
+    probe_vars.all_discrete_real_variables();
+  for (i=0; i<c_vars.length(); ++i)
+    if (!map_position(c_vars[i], CONTINUOUS_FIELD, i))
+      return false;
+  for (i=0; i<di_vars.length(); ++i)
+    if (!map_position(di_vars[i], DISCRETE_INT_FIELD, i))
+      return false;
+  for (i=0; i<ds_vars.size(); ++i) {
+    size_t position;
+    const String& ds_var = ds_vars[i];
+    if (!parse_integer(ds_var.data(), ds_var.data() + ds_var.size(), position)
+	|| !map_position((Real)position, DISCRETE_STRING_FIELD, i))
+      return false;
+  }
+  for (i=0; i<dr_vars.length(); ++i)
+    if (!map_position(dr_vars[i], DISCRETE_REAL_FIELD, i))
+      return false;
+  if (num_mapped != num_vars)
+    return false;
+
+  // reorder_row() reads file field var_inds[j] as the jth variable
+  field_targets.resize(num_vars);
+  for (j=0; j<num_vars; ++j)
+    field_targets[(var_inds.empty()) ? j : var_inds[j]] = read_targets[j];
+  return true;
+}
+
+
+/// Mapped read for the RealMatrix reader with specified num_rows x
+/// num_cols; sets extra_data if data remain
+bool mapped_read_matrix(const MappedTabularData& data,
+			RealMatrix& input_matrix, size_t num_rows,
+			size_t num_cols, unsigned short tabular_format,
+			bool& extra_data)
+{
+  // experiment data would never have an interface ID
+  size_t num_lead = (tabular_format & TABULAR_EVAL_ID) ? 1 : 0,
+    record_len = num_lead + num_cols, num_read = num_rows * record_len;
+  if (!record_len)
+    return false;
+
+  SizetArray offsets;
+  size_t num_fields = field_offsets(data, offsets);
+  if (num_fields < num_read)
+    return false;
+
+  input_matrix.shapeUninitialized(num_rows, num_cols);
+  Real* matrix_vals = input_matrix.values();
+  bool parsed = parse_fields(data, offsets, num_read,
+    [&](size_t index, const char* first, const char* last) {
+      size_t row = index / record_len, col = index % record_len;
+      if (col < num_lead) {
+	size_t discard_row_label;
+	return parse_integer(first, last, discard_row_label);
+      }
+      return parse_real(first, last,
+			matrix_vals[(col - num_lead) * num_rows + row]);
+    });
+
+  extra_data = (num_fields > num_read);
+  return parsed;
+}
+
+
+/// Mapped read for the RealMatrix reader with record_len rows and a
+/// column per record in the file
+bool mapped_read_records(const MappedTabularData& data,
+			 RealMatrix& input_matrix, size_t record_len,
+			 unsigned short tabular_format)
+{
+  size_t num_lead = 0;
+  if (tabular_format & TABULAR_EVAL_ID) ++num_lead;
+  if (tabular_format & TABULAR_IFACE_ID) ++num_lead;
+  size_t num_cols = num_lead + record_len;
+  if (!record_len)
+    return false;
+
+  SizetArray offsets;
+  size_t num_fields = field_offsets(data, offsets);
+  if (num_fields % num_cols)
+    return false; // truncated record
+  size_t num_records = num_fields / num_cols;
+
+  // column-major: each record is a contiguous column
+  if (num_records) input_matrix.shapeUninitialized(record_len, num_records);
+  else             input_matrix.shape(0, 0);
+  Real* matrix_vals = input_matrix.values();
+  return parse_fields(data, offsets, num_fields,
+    [&](size_t index, const char* first, const char* last) {
+      size_t record = index / num_cols, col = index % num_cols;
+      if (col < num_lead) {
+	// eval ID is discarded; interface ID may be any string
+	int eval_id;
+	return (col == 0 && (tabular_format & TABULAR_EVAL_ID)) ?
+	  parse_integer(first, last, eval_id) : true;
+      }
+      return parse_real(first, last,
+			matrix_vals[record * record_len + col - num_lead]);
+    });
+}
+
+
+/// Mapped read for the mixed variables and responses RealMatrix reader;
+/// variables are stored as [ continuous, discrete int, discrete real ]
+bool mapped_read_vars_resp(const MappedTabularData& data,
+			   const Variables& vars, size_t num_fns,
+			   RealMatrix& vars_matrix, RealMatrix& resp_matrix,
+			   unsigned short tabular_format, bool active_only,
+			   const std::vector<size_t>& var_inds)
+{
+  std::vector<FieldTarget> field_targets;
+  if (!map_var_fields(vars, active_only, var_inds, field_targets))
+    return false;
+
+  size_t num_lead = 0;
+  if (tabular_format & TABULAR_EVAL_ID) ++num_lead;
+  if (tabular_format & TABULAR_IFACE_ID) ++num_lead;
+  size_t j, num_vars = field_targets.size(),
+    num_cols = num_lead + num_vars + num_fns,
+    num_cv  = active_only ? vars.cv()  : vars.acv(),
+    num_div = active_only ? vars.div() : vars.adiv();
+
+  // column of vars_matrix into which each variable field is stored
+  SizetArray var_cols(num_vars);
+  for (j=0; j<num_vars; ++j) {
+    const FieldTarget& target = field_targets[j];
+    switch (target.first) {
+    case CONTINUOUS_FIELD:
+      var_cols[j] = target.second;                    break;
+    case DISCRETE_INT_FIELD:
+      var_cols[j] = num_cv + target.second;           break;
+    case DISCRETE_REAL_FIELD:
+      var_cols[j] = num_cv + num_div + target.second; break;
+    default: // string variables are not supported
+      return false;
+    }
+  }
+
+  SizetArray offsets;
+  size_t num_rows = row_offsets(data, offsets);
+  if (num_rows) {
+    vars_matrix.shape(num_rows, num_vars);
+    resp_matrix.shapeUninitialized(num_rows, num_fns);
+  }
+  else
+    { vars_matrix.shape(0, 0); resp_matrix.shape(0, 0); }
+  Real *vars_vals = vars_matrix.values(), *resp_vals = resp_matrix.values();
+
+  return parse_rows(data, offsets, num_cols,
+    [&](size_t row, const char* const* fields) {
+      int eval_id; // discarded; interface ID may be any string
+      if ( (tabular_format & TABULAR_EVAL_ID) &&
+	   !parse_integer(fields[0], fields[1], eval_id) )
+	return false;
+      const char* const* var_fields = fields + 2*num_lead;
+      for (size_t j=0; j<num_vars; ++j) {
+	Real& var_val = vars_vals[var_cols[j] * num_rows + row];
+	if (field_targets[j].first == DISCRETE_INT_FIELD) {
+	  int di_val;
+	  if (!parse_integer(var_fields[2*j], var_fields[2*j+1], di_val))
+	    return false;
+	  var_val = di_val;
+	}
+	else if (!parse_real(var_fields[2*j], var_fields[2*j+1], var_val))
+	  return false;
+      }
+      const char* const* fn_fields = var_fields + 2*num_vars;
+      for (size_t fi=0; fi<num_fns; ++fi)
+	if (!parse_real(fn_fields[2*fi], fn_fields[2*fi+1],
+			resp_vals[fi * num_rows + row]))
+	  return false;
+      return true;
+    });
+}
+
+
+/** Mapped read for the PRPList reader.  Fields are parsed concurrently
+    into staging arrays; the Variables and Response of each row are then
+    populated in order, since each pair takes a deep copy. */
+bool mapped_read_prp(const MappedTabularData& data, Variables& vars,
+		     Response& resp, PRPList& input_prp,
+		     unsigned short tabular_format, bool verbose,
+		     bool active_only, const std::vector<size_t>& var_inds)
+{
+  std::vector<FieldTarget> field_targets;
+  if (!map_var_fields(vars, active_only, var_inds, field_targets))
+    return false;
+
+  bool eval_id_col  = (tabular_format & TABULAR_EVAL_ID),
+       iface_id_col = (tabular_format & TABULAR_IFACE_ID);
+  size_t num_lead = 0;
+  if (eval_id_col)  ++num_lead;
+  if (iface_id_col) ++num_lead;
+  size_t j, num_vars = field_targets.size(), num_fns = resp.num_functions(),
+    num_cols = num_lead + num_vars + num_fns;
+
+  // staging index of each variable field: numeric fields are staged as
+  // Reals (with the function values), string fields as field extents
+  size_t num_numeric = num_fns, num_strings = (iface_id_col) ? 1 : 0;
+  SizetArray staging_inds(num_vars);
+  for (j=0; j<num_vars; ++j)
+    staging_inds[j] = (field_targets[j].first == DISCRETE_STRING_FIELD) ?
+      num_strings++ : num_numeric++;
+
+  SizetArray offsets;
+  size_t num_rows = row_offsets(data, offsets);
+  RealArray numeric_vals(num_rows * num_numeric);
+  std::vector<const char*> string_vals(2 * num_rows * num_strings);
+  IntArray eval_ids((eval_id_col) ? num_rows : 0);
+
+  bool parsed = parse_rows(data, offsets, num_cols,
+    [&](size_t row, const char* const* fields) {
+      if (eval_id_col && !parse_integer(fields[0], fields[1], eval_ids[row]))
+	return false;
+      Real* row_numeric = &numeric_vals[row * num_numeric];
+      const char** row_strings = &string_vals[2 * row * num_strings];
+      if (iface_id_col) {
+	size_t iface_field = (eval_id_col) ? 1 : 0;
+	row_strings[0] = fields[2*iface_field];
+	row_strings[1] = fields[2*iface_field+1];
+      }
+      const char* const* var_fields = fields + 2*num_lead;
+      for (size_t j=0; j<num_vars; ++j) {
+	const char *first = var_fields[2*j], *last = var_fields[2*j+1];
+	size_t s_index = staging_inds[j];
+	switch (field_targets[j].first) {
+	case DISCRETE_STRING_FIELD:
+	  row_strings[2*s_index] = first; row_strings[2*s_index+1] = last;
+	  break;
+	case DISCRETE_INT_FIELD: {
+	  int di_val;
+	  if (!parse_integer(first, last, di_val))
+	    return false;
+	  row_numeric[s_index] = di_val;
+	  break;
+	}
+	default:
+	  if (!parse_real(first, last, row_numeric[s_index]))
+	    return false;
+	  break;
+	}
+      }
+      // Response::read_tabular() converts with atof(), which never fails
+      const char* const* fn_fields = var_fields + 2*num_vars;
+      for (size_t fi=0; fi<num_fns; ++fi)
+	if (!parse_real(fn_fields[2*fi], fn_fields[2*fi+1], row_numeric[fi]))
+	  row_numeric[fi] = std::atof(
+	    std::string(fn_fields[2*fi], fn_fields[2*fi+1]).c_str());
+      return true;
+    });
+  if (!parsed)
+    return false;
+
+  int eval_id = 0;  // number the evals starting from 1 if not contained in file
+  String iface_id("NO_ID");
+  for (size_t row=0; row<num_rows; ++row) {
+    const Real* row_numeric = &numeric_vals[row * num_numeric];
+    const char* const* row_strings = &string_vals[2 * row * num_strings];
+    if (eval_id_col)
+      eval_id = eval_ids[row];
+    else
+      ++eval_id;
+    if (iface_id_col) {
+      iface_id.assign(row_strings[0], row_strings[1]);
+      // (Dakota 6.1 used EMPTY for missing ID)
+      if (iface_id == "EMPTY")
+	iface_id = "NO_ID";
+    }
+
+    for (j=0; j<num_vars; ++j) {
+      size_t s_index = staging_inds[j], v_index = field_targets[j].second;
+      switch (field_targets[j].first) {
+      case CONTINUOUS_FIELD:
+	if (active_only) vars.continuous_variable(row_numeric[s_index], v_index);
+	else vars.all_continuous_variable(row_numeric[s_index], v_index);
+	break;
+      case DISCRETE_INT_FIELD:
+	if (active_only)
+	  vars.discrete_int_variable((int)row_numeric[s_index], v_index);
+	else
+	  vars.all_discrete_int_variable((int)row_numeric[s_index], v_index);
+	break;
+      case DISCRETE_STRING_FIELD: {
+	String ds_val(row_strings[2*s_index], row_strings[2*s_index+1]);
+	if (active_only) vars.discrete_string_variable(ds_val, v_index);
+	else             vars.all_discrete_string_variable(ds_val, v_index);
+	break;
+      }
+      case DISCRETE_REAL_FIELD:
+	if (active_only)
+	  vars.discrete_real_variable(row_numeric[s_index], v_index);
+	else
+	  vars.all_discrete_real_variable(row_numeric[s_index], v_index);
+	break;
+      }
+    }
+    for (size_t fi=0; fi<num_fns; ++fi)
+      resp.function_value(row_numeric[fi], fi);
+
+    if (verbose) {
+      Cout << "Variables read:\n" << vars;
+      if (!iface_id.empty())
+	Cout << "\nInterface identifier = " << iface_id << '\n';
+      Cout << "\nResponse read:\n" << resp;
+    }
+
+    // append deep copy of vars,resp as PRP
+    input_prp.push_back(ParamResponsePair(vars, iface_id, resp, eval_id));
+  }
+
+  return true;
+}
+
+} // anonymous namespace
+
+
 void read_data_tabular(const std::string& input_filename, 
 		       const std::string& context_message,
 		       RealVector& input_vector, size_t num_entries,
@@ -682,6 +1416,15 @@ void read_data_tabular(const std::string& input_filename,
     size_t num_vars = active_only ? vars.total_active() : vars.tv();
     size_t num_cols = num_lead + num_vars + num_fns;;
 
+    MappedTabularData mapped_data(input_filename, input_stream);
+    if (mapped_data.good() &&
+	mapped_read_vars_resp(mapped_data, vars, num_fns, vars_matrix,
+			      resp_matrix, tabular_format, active_only,
+			      var_inds)) {
+      close_file(input_stream, input_filename, context_message);
+      return;
+    }
+
     input_stream >> std::ws;
     while (input_stream.good() && !input_stream.eof()) {
 
@@ -875,6 +1618,15 @@ void read_data_tabular(const std::string& input_filename,
   if (tabular_format & TABULAR_IFACE_ID) ++num_lead;
   size_t num_vars = active_only ? vars.total_active() : vars.tv();
   size_t num_cols = num_lead + num_vars + resp.num_functions();;
+
+  MappedTabularData mapped_data(input_filename, data_stream);
+  if (mapped_data.good() &&
+      mapped_read_prp(mapped_data, vars, resp, input_prp, tabular_format,
+		      verbose, active_only, var_inds)) {
+    close_file(data_stream, input_filename, context_message);
+    return;
+  }
+
   // shouldn't need both good and eof checks
   data_stream >> std::ws;
   while (data_stream.good() && !data_stream.eof()) {
@@ -952,6 +1704,18 @@ void read_data_tabular(const std::string& input_filename,
 
   read_header_tabular(input_stream, tabular_format);
 
+  MappedTabularData mapped_data(input_filename, input_stream);
+  bool extra_data = false;
+  if (mapped_data.good() &&
+      mapped_read_matrix(mapped_data, input_matrix, num_rows, num_cols,
+			 tabular_format, extra_data)) {
+    if (extra_data)
+      print_unexpected_data(Cout, input_filename, context_message,
+			    tabular_format);
+    close_file(input_stream, input_filename, context_message);
+    return;
+  }
+
   input_matrix.shapeUninitialized(num_rows, num_cols);	
   for (size_t row_ind = 0; row_ind < num_rows; ++row_ind) {
     try {
@@ -992,6 +1756,18 @@ void read_data_tabular(const std::string& input_filename,
 
     read_header_tabular(input_stream, tabular_format);
 
+    MappedTabularData mapped_data(input_filename, input_stream);
+    if (mapped_data.good() &&
+	mapped_read_records(mapped_data, input_matrix, record_len,
+			    tabular_format)) {
+      if (verbose)
+	for (int i=0; i<input_matrix.numCols(); ++i)
+	  Cout << "read:\n"
+	       << RealVector(Teuchos::View, input_matrix[i], record_len);
+      close_file(input_stream, input_filename, context_message);
+      return;
+    }
+
     input_stream >> std::ws;
     while (input_stream.good() && !input_stream.eof()) {
 
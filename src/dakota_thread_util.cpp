@@ -0,0 +1,53 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+// Shared-memory threading utilities
+
+#include "dakota_thread_util.hpp"
+#include "MPIManager.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+
+namespace Dakota {
+
+/** Queries MPI_COMM_WORLD directly, so that it may be called from any
+    context, including before MPI is initialized (in which case the run
+    is treated as serial). */
+bool multiple_mpi_ranks()
+{
+#ifdef DAKOTA_HAVE_MPI
+  int initialized = 0, world_size = 1;
+  MPI_Initialized(&initialized);
+  if (initialized)
+    MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+  return (world_size > 1);
+#else
+  return false;
+#endif // DAKOTA_HAVE_MPI
+}
+
+
+/** The environment variable env_var, when set, overrides the default
+    and is returned as is, including 0.  Otherwise the default is one
+    thread per core, up to max_default, except in a parallel MPI run,
+    where the ranks may already occupy every core and the default is a
+    single thread. */
+size_t worker_threads(const char* env_var, size_t max_default)
+{
+  const char* env_threads = (env_var) ? std::getenv(env_var) : NULL;
+  if (env_threads)
+    return std::strtoul(env_threads, NULL, 10);
+  if (multiple_mpi_ranks())
+    return 1;
+  return std::max((size_t)1, std::min(max_default,
+    (size_t)std::max(1u, std::thread::hardware_concurrency())));
+}
+
+} // namespace Dakota
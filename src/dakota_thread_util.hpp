@@ -0,0 +1,29 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#ifndef DAKOTA_THREAD_UTIL_H
+#define DAKOTA_THREAD_UTIL_H
+
+#include <cstddef>
+#include <limits>
+
+// Shared-memory threading utilities
+
+namespace Dakota {
+
+/// true in a parallel MPI run with more than one rank
+bool multiple_mpi_ranks();
+
+/// number of worker threads for a shared-memory parallel loop
+size_t worker_threads(const char* env_var,
+		      size_t max_default = std::numeric_limits<size_t>::max());
+
+} // namespace Dakota
+
+#endif // DAKOTA_THREAD_UTIL_H
@@ -870,6 +870,73 @@ def render_table_types_hpp() -> str:
     return "\n".join(lines)
 
 
+def _key_ident(block: str, local: str) -> str:
+    return block + "_" + re.sub(r"[^A-Za-z0-9_]", "_", local)
+
+
+def render_keys_hpp(contracts_by_block: Dict[str, Dict[str, KeyContract]]) -> str:
+    idents = []  # type: List[str]
+    names = []  # type: List[str]
+    offsets = [0]  # type: List[int]
+    seen = {}  # type: Dict[str, str]
+    for block in BLOCKS:
+        for local in sorted(contracts_by_block[block].keys()):
+            ident = _key_ident(block, local)
+            full = f"{block}.{local}"
+            if ident in seen:
+                raise ValueError(f"IR keys '{seen[ident]}' and '{full}' map to the same identifier '{ident}'")
+            seen[ident] = full
+            idents.append(ident)
+            names.append(full)
+        offsets.append(len(idents))
+
+    lines = []  # type: List[str]
+    lines.append("// Auto-generated by update_pdb_keys/generate_ir_tables.py")
+    lines.append("#pragma once")
+    lines.append("")
+    lines.append("#include <cstddef>")
+    lines.append("#include <cstdint>")
+    lines.append("#include <string_view>")
+    lines.append("")
+    lines.append("namespace dakota::irgen {")
+    lines.append("")
+    lines.append("// Keys of each block are contiguous and sorted by local key; blocks follow")
+    lines.append("// BlockType order.")
+    lines.append("enum class IRKey : std::uint32_t {")
+    for ident in idents:
+        lines.append(f"  {ident},")
+    lines.append("};")
+    lines.append("")
+    lines.append(f"inline constexpr std::size_t kNumIRKeys = {len(idents)};")
+    lines.append("")
+    lines.append("// First key of each block, followed by kNumIRKeys.")
+    lines.append(
+        "inline constexpr std::uint32_t kIRKeyBlockOffsets["
+        + str(len(offsets))
+        + "] = {"
+        + ", ".join(str(o) for o in offsets)
+        + "};"
+    )
+    lines.append("")
+    lines.append("// Full (block-qualified) key names in IRKey order.")
+    lines.append("inline constexpr std::string_view kIRKeyNames[kNumIRKeys] = {")
+    for full in names:
+        lines.append(f"  {_cpp_str(full)},")
+    lines.append("};")
+    lines.append("")
+    lines.append("} // namespace dakota::irgen")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def _write_if_changed(path: Path, text: str) -> None:
+    if path.exists() and path.read_text(encoding="utf-8") == text:
+        print(f"Unchanged; keeping existing: {path}")
+        return
+    path.write_text(text, encoding="utf-8")
+    print(f"Wrote: {path}")
+
+
 def _extract_type_signature(header_text: str) -> str:
     for ln in header_text.splitlines():
         if ln.startswith("// type-signature: "):
@@ -1056,6 +1123,9 @@ def main() -> int:
     if should_write_types_header:
         types_header_path.write_text(new_types_header, encoding="utf-8")
         print(f"Wrote: {types_header_path}")
+    # the key IDs are compiled into every IR client; keep the header (and its
+    # timestamp) when the key set is unchanged
+    _write_if_changed(out_dir / "generated_ir_keys.hpp", render_keys_hpp(merged))
     (out_dir / "generated_ir_registry.cpp").write_text(render_registry_cpp(), encoding="utf-8")
     print(f"Wrote: {out_dir / 'generated_ir_registry.cpp'}")
 
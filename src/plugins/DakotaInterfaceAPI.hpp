@@ -103,6 +103,10 @@ public:
 
   virtual void finalize() {};
 
+  /// whether evaluate(EvalRequest) may be called concurrently from
+  /// multiple threads; enables asynchronous local evaluations
+  virtual bool thread_safe() { return false; }
+
 protected:
 
   void resize_response_arrays(
@@ -20,6 +20,9 @@ public:
   DakotaPlugins::EvalResponse evaluate(
       DakotaPlugins::EvalRequest const& request) override;
 
+  /// stateless mapping, so concurrent evaluations are safe
+  bool thread_safe() override { return true; }
+
 private:
   void evaluate_functions(size_t const idx,
       DakotaPlugins::EvalRequest const& request,
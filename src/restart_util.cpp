@@ -18,6 +18,10 @@
 #include "ParamResponsePair.hpp"
 #include "PRPMultiIndex.hpp"
 #include "RestartVersion.hpp"
+#include "IndexedRestart.hpp"
+#include "OutputManager.hpp"
+#include "DakotaBuildInfo.hpp"
+#include <functional>
 #ifdef HAVE_PDB_H
 #include <pdb.h>
 #endif
@@ -46,6 +50,13 @@ void read_neutral(StringArray pos_args);
 void repair_restart(StringArray pos_args, String identifier_type);
 /// concatenate multiple restart files
 void concatenate_restart(StringArray pos_args);
+/// convert a restart file to the indexed or legacy format
+void convert_restart(StringArray pos_args, bool to_indexed);
+
+/// read each record of a legacy or indexed restart file, passing it to
+/// process_record; returns the number of records read
+size_t read_restart_records(const String& read_restart_filename,
+  const std::function<void(ParamResponsePair&)>& process_record);
 
 } // namespace Dakota
 
@@ -54,7 +65,8 @@ void concatenate_restart(StringArray pos_args);
 
 /** Parse command line inputs and invoke the appropriate utility
     function (print_restart(), print_restart_tabular(),
-    read_neutral(), repair_restart(), or concatenate_restart()). */
+    read_neutral(), repair_restart(), concatenate_restart(), or
+    convert_restart()). */
 
 int main(int argc, char* argv[])
 {
@@ -165,6 +177,10 @@ int main(int argc, char* argv[])
     repair_restart(pos_args, "by_id");
   else if (util_command == "cat")
     concatenate_restart(pos_args);
+  else if (util_command == "to_indexed")
+    convert_restart(pos_args, true);
+  else if (util_command == "to_legacy")
+    convert_restart(pos_args, false);
   else {
     Cerr << "Error: command '" << util_command << "' not supported." << endl;
     print_usage(Cerr);
@@ -189,11 +205,87 @@ void print_usage(std::ostream& s)
     << "    dakota_restart_util to_tabular <restart_file> <text_file> [--custom_annotated [header] [eval_id] [interface_id]] [--output_precision <int>]\n"
     << "    dakota_restart_util remove <double> <old_restart_file> <new_restart_file>\n"
     << "    dakota_restart_util remove_ids <int_1> ... <int_n> <old_restart_file> <new_restart_file>\n"
-    << "    dakota_restart_util cat <restart_file_1> ... <restart_file_n> <new_restart_file>" 
+    << "    dakota_restart_util cat <restart_file_1> ... <restart_file_n> <new_restart_file>\n"
+    << "    dakota_restart_util to_indexed <restart_file> <new_restart_file>\n"
+    << "    dakota_restart_util to_legacy <restart_file> <new_restart_file>"
     << endl;
 }
 
 
+/** Dispatches on the file signature, so that each utility command
+    accepts both the legacy (single Boost archive) and the indexed
+    restart formats. */
+size_t read_restart_records(const String& read_restart_filename,
+  const std::function<void(ParamResponsePair&)>& process_record)
+{
+  size_t cntr = 0;
+
+  if (IndexedRestart::is_indexed_restart(read_restart_filename)) {
+    IndexedRestartReader reader(read_restart_filename);
+    cout << "Reading indexed restart file '" << read_restart_filename
+	 << "' containing: " << reader.restart_version();
+    if (!reader.clean_close())
+      cout << "Warning: restart file '" << read_restart_filename
+	   << "' was not closed cleanly;\n  recovered " << reader.num_records()
+	   << " complete evaluations." << std::endl;
+    for ( ; cntr<reader.num_records(); ++cntr) {
+      ParamResponsePair current_pair;
+      try {
+	reader.read_record(cntr, current_pair);
+      }
+      catch(const boost::archive::archive_exception& e) {
+	Cerr << "\nError reading restart file '" << read_restart_filename
+	     << "'.\nDetails (boost::archive exception):      "
+	     << e.what() << std::endl;
+	abort_handler(IO_ERROR);
+      }
+      process_record(current_pair);
+    }
+    return cntr;
+  }
+
+  RestartVersion rst_ver =
+    RestartVersion::check_restart_version(read_restart_filename);
+
+  std::ifstream restart_input_fs(read_restart_filename.c_str(),
+				 std::ios::binary);
+  if (!restart_input_fs.good()) {
+    Cerr << "\nError: could not open restart file '"
+	 << read_restart_filename << "' for reading."<< std::endl;
+    exit(-1);
+  }
+  boost::archive::binary_iarchive restart_input_archive(restart_input_fs);
+
+  // re-read the full, correct version info from the new stream
+  if (RestartVersion::restartFirstVersionNumber <= rst_ver.restartVersion)
+    restart_input_archive & rst_ver;
+
+  restart_input_fs.peek();  // peek to force EOF if no records in restart file
+  while (restart_input_fs.good() && !restart_input_fs.eof()) {
+
+    ParamResponsePair current_pair;
+    try {
+      restart_input_archive & current_pair;
+    }
+    catch(const boost::archive::archive_exception& e) {
+      // No current way a user can recover from this with remove_ids
+      Cerr << "\nError reading restart file '" << read_restart_filename
+	   << "'.\nDetails (boost::archive exception):      "
+	   << e.what() << std::endl;
+      abort_handler(IO_ERROR);
+    }
+    // serialization functions no longer throw strings
+
+    process_record(current_pair);
+    ++cntr;
+
+    // peek to force EOF if the last restart record was read
+    restart_input_fs.peek();
+  }
+  return cntr;
+}
+
+
 /** \b Usage: "dakota_restart_util print dakota.rst"\n
               "dakota_restart_util to_neutral dakota.rst dakota.neu"
 
@@ -222,22 +314,6 @@ void print_restart(StringArray pos_args, String print_dest)
 
   try {
 
-    RestartVersion rst_ver =
-      RestartVersion::check_restart_version(read_restart_filename);
-
-    std::ifstream restart_input_fs(read_restart_filename.c_str(),
-				   std::ios::binary);
-    if (!restart_input_fs.good()) {
-      Cerr << "\nError: could not open restart file '"
-	   << read_restart_filename << "' for reading."<< std::endl;
-      exit(-1);
-    }
-    boost::archive::binary_iarchive restart_input_archive(restart_input_fs);
-
-    // re-read the full, correct version info from the new stream
-    if (RestartVersion::restartFirstVersionNumber <= rst_ver.restartVersion)
-      restart_input_archive & rst_ver;
-
     cout << "Reading restart file '" << read_restart_filename << "'."
 	 << std::endl;
 
@@ -251,35 +327,18 @@ void print_restart(StringArray pos_args, String print_dest)
     write_precision = 16;
 
     int cntr = 0;
-    restart_input_fs.peek();  // peek to force EOF if no records in restart file
-    while (restart_input_fs.good() && !restart_input_fs.eof()) {
-
-      ParamResponsePair current_pair;
-      try { 
-	restart_input_archive & current_pair; 
-      }
-      catch(const boost::archive::archive_exception& e) {
-	// No current way a user can recover from this with remove_ids
-	Cerr << "\nError reading restart file '" << read_restart_filename
-	     << "'.\nDetails (boost::archive exception):      "
-	     << e.what() << std::endl;
-	abort_handler(-1);
-      }
-      // serialization functions no longer throw strings
-
-      cntr++;
-      if (print_dest == "stdout")
-	cout << "------------------------------------------\nRestart record "
-	     << setw(4) << cntr << "  (evaluation id " << setw(4)
-	     << current_pair.eval_id()
-	     << "):\n------------------------------------------\n"
-	     << current_pair;
-      else if (print_dest == "neutral_file")
-	current_pair.write_annotated(neutral_file_stream);
-
-      // peek to force EOF if the last restart record was read
-      restart_input_fs.peek();
-    }
+    read_restart_records(read_restart_filename,
+      [&](ParamResponsePair& current_pair) {
+	cntr++;
+	if (print_dest == "stdout")
+	  cout << "------------------------------------------\nRestart record "
+	       << setw(4) << cntr << "  (evaluation id " << setw(4)
+	       << current_pair.eval_id()
+	       << "):\n------------------------------------------\n"
+	       << current_pair;
+	else if (print_dest == "neutral_file")
+	  current_pair.write_annotated(neutral_file_stream);
+      });
     if (print_dest == "neutral_file")
       neutral_file_stream.close();
     cout << "Restart file processing completed: " << cntr
@@ -313,42 +372,10 @@ void print_restart_pdb(StringArray pos_args, String print_dest)
     exit(-1);
   }
 
-  RestartVersion rst_ver =
-    RestartVersion::check_restart_version(pos_args[0]);
-
-  std::ifstream restart_input_fs(pos_args[0].c_str(), std::ios::binary);
-  if (!restart_input_fs.good()) {
-    Cerr << "Error: failed to open restart file " << pos_args[0] << endl;
-    exit(-1);
-  }
-  boost::archive::binary_iarchive restart_input_archive(restart_input_fs);
-
-  // re-read the full, correct version info from the new stream
-  if (RestartVersion::restartFirstVersionNumber <= rst_ver.restartVersion)
-    restart_input_archive & rst_ver;
-
   size_t i, j, num_evals = 0;
   PRPCache read_pairs;
-  restart_input_fs.peek();  // peek to force EOF if no records in restart file
-  while (restart_input_fs.good() && !restart_input_fs.eof()) {
-
-    ParamResponsePair current_pair;
-    try {
-      restart_input_archive & current_pair;
-    }
-    catch(const boost::archive::archive_exception& e) {
-      Cerr << "\nError reading restart file (boost::archive exception):\n" 
-	   << e.what() << std::endl;
-      abort_handler(-1);
-    }
-    // serialization functions no longer throw strings
-
-    read_pairs.insert(current_pair);
-    ++num_evals;
-
-    // peek to force EOF if the last restart record was read
-    restart_input_fs.peek();
-  }
+  num_evals = read_restart_records(pos_args[0],
+    [&](ParamResponsePair& current_pair) { read_pairs.insert(current_pair); });
 
   PRPCacheCIter prp_iter = read_pairs.begin();
   StringMultiArrayConstView cv_labels
@@ -476,22 +503,6 @@ void print_restart_tabular(StringArray pos_args, String print_dest,
 
   try {
 
-    RestartVersion rst_ver =
-      RestartVersion::check_restart_version(read_restart_filename);
-
-    std::ifstream restart_input_fs(read_restart_filename.c_str(),
-				   std::ios::binary);
-    if (!restart_input_fs.good()) {
-      Cerr << "\nError: could not open restart file '"
-	   << read_restart_filename << "' for reading."<< std::endl;
-      exit(-1);
-    }
-    boost::archive::binary_iarchive restart_input_archive(restart_input_fs);
-
-    // re-read the full, correct version info from the new stream
-    if (RestartVersion::restartFirstVersionNumber <= rst_ver.restartVersion)
-      restart_input_archive & rst_ver;
-
     cout << "Reading restart file '" << read_restart_filename << "'."
 	 << std::endl;
 
@@ -513,54 +524,37 @@ void print_restart_tabular(StringArray pos_args, String print_dest,
     int wp_save = write_precision;  // later restore since this is global data
     write_precision = tabular_precision;
 
-    restart_input_fs.peek();  // peek to force EOF if no records in restart file
-    while (restart_input_fs.good() && !restart_input_fs.eof()) {
-
-      ParamResponsePair current_pair;
-      try {
-	restart_input_archive & current_pair;
-      }
-      catch(const boost::archive::archive_exception& e) {
-	// No current way a user can recover from this with remove_ids
-	Cerr << "\nError reading restart file '" << read_restart_filename
-	     << "'.\nDetails (boost::archive exception):      "
-	     << e.what() << std::endl;
-	abort_handler(-1);
-      }
-      // serialization functions no longer throw strings
-
-      // The number of variables or responses may differ across
-      // different interfaces.  Output the header when needed due to
-      // label or length changes.
-      const String& new_interf = current_pair.interface_id();
-      if (num_evals == 0  || new_interf != curr_interf) {
-	curr_interf = new_interf;
-	const Variables& curr_vars = current_pair.variables();
-	if (curr_vars.all_continuous_variable_labels() != curr_acv_labels ||
-	    curr_vars.all_discrete_int_variable_labels() != curr_adiv_labels ||
-	    curr_vars.all_discrete_string_variable_labels() != curr_adsv_labels ||
-	    curr_vars.all_discrete_real_variable_labels() != curr_adrv_labels ||
-	    current_pair.response().function_labels() != curr_resp_labels) {
-	  // update the current copy of the labels, sizing first
-	  curr_acv_labels.resize(boost::extents[curr_vars.acv()]);
-	  curr_acv_labels = curr_vars.all_continuous_variable_labels();
-	  curr_adiv_labels.resize(boost::extents[curr_vars.adiv()]);
-	  curr_adiv_labels = curr_vars.all_discrete_int_variable_labels();
-	  curr_adsv_labels.resize(boost::extents[curr_vars.adsv()]);
-	  curr_adsv_labels = curr_vars.all_discrete_string_variable_labels();
-	  curr_adrv_labels.resize(boost::extents[curr_vars.adrv()]);
-	  curr_adrv_labels = curr_vars.all_discrete_real_variable_labels();
-	  curr_resp_labels = current_pair.response().function_labels();
-	  // write the new header
-	  current_pair.write_tabular_labels(tabular_text, tabular_format);
+    read_restart_records(read_restart_filename,
+      [&](ParamResponsePair& current_pair) {
+	// The number of variables or responses may differ across
+	// different interfaces.  Output the header when needed due to
+	// label or length changes.
+	const String& new_interf = current_pair.interface_id();
+	if (num_evals == 0  || new_interf != curr_interf) {
+	  curr_interf = new_interf;
+	  const Variables& curr_vars = current_pair.variables();
+	  if (curr_vars.all_continuous_variable_labels() != curr_acv_labels ||
+	      curr_vars.all_discrete_int_variable_labels() != curr_adiv_labels ||
+	      curr_vars.all_discrete_string_variable_labels() != curr_adsv_labels ||
+	      curr_vars.all_discrete_real_variable_labels() != curr_adrv_labels ||
+	      current_pair.response().function_labels() != curr_resp_labels) {
+	    // update the current copy of the labels, sizing first
+	    curr_acv_labels.resize(boost::extents[curr_vars.acv()]);
+	    curr_acv_labels = curr_vars.all_continuous_variable_labels();
+	    curr_adiv_labels.resize(boost::extents[curr_vars.adiv()]);
+	    curr_adiv_labels = curr_vars.all_discrete_int_variable_labels();
+	    curr_adsv_labels.resize(boost::extents[curr_vars.adsv()]);
+	    curr_adsv_labels = curr_vars.all_discrete_string_variable_labels();
+	    curr_adrv_labels.resize(boost::extents[curr_vars.adrv()]);
+	    curr_adrv_labels = curr_vars.all_discrete_real_variable_labels();
+	    curr_resp_labels = current_pair.response().function_labels();
+	    // write the new header
+	    current_pair.write_tabular_labels(tabular_text, tabular_format);
+	  }
 	}
-      }
-      current_pair.write_tabular(tabular_text, tabular_format);  // also writes IDs
-      ++num_evals;
-
-      // peek to force EOF if the last restart record was read
-      restart_input_fs.peek();
-    }
+	current_pair.write_tabular(tabular_text, tabular_format);  // also writes IDs
+	++num_evals;
+      });
 
     cout << "Restart file processing completed: " << num_evals
 	 << " evaluations tabulated.\n";
@@ -713,22 +707,6 @@ void repair_restart(StringArray pos_args, String identifier_type)
 
   try {
 
-    RestartVersion rst_ver =
-      RestartVersion::check_restart_version(read_restart_filename);
-
-    std::ifstream restart_input_fs(read_restart_filename.c_str(),
-				   std::ios::binary);
-    if (!restart_input_fs.good()) {
-      Cerr << "\nError: could not open restart file '"
-	   << read_restart_filename << "' for reading."<< std::endl;
-      abort_handler(IO_ERROR);
-    }
-    boost::archive::binary_iarchive restart_input_archive(restart_input_fs);
-
-    // re-read the full, correct version info from the new stream
-    if (RestartVersion::restartFirstVersionNumber <= rst_ver.restartVersion)
-      restart_input_archive & rst_ver;
-
     std::ofstream restart_output_fs(write_restart_filename.c_str(),
 				    std::ios::binary);
     if (!restart_output_fs.good()) {
@@ -741,47 +719,32 @@ void repair_restart(StringArray pos_args, String identifier_type)
     cout << "Writing new restart file " << write_restart_filename << '\n';
 
     int cntr = 0, good_cntr = 0;
-    restart_input_fs.peek();  // peek to force EOF if no records in restart file
-    while (restart_input_fs.good() && !restart_input_fs.eof()) {
-
-      ParamResponsePair current_pair;
-      try {
-	restart_input_archive & current_pair;
-      }
-      catch(const boost::archive::archive_exception& e) {
-	Cerr << "\nError reading restart file '" << read_restart_filename
-	     << "'.\nDetails (boost::archive exception):      "
-	     << e.what() << std::endl;
-	abort_handler(IO_ERROR);
-      }
-
-      cntr++;
+    read_restart_records(read_restart_filename,
+      [&](ParamResponsePair& current_pair) {
+	cntr++;
 
-      // detect if current_pair is to be removed
-      bool bad_flag = false;
-      if (by_value) {
-	const Response& resp      = current_pair.response();
-	const RealVector& fn_vals = resp.function_values();
-	const ShortArray& asv     = resp.active_set_request_vector();
-	for (size_t j=0; j<fn_vals.length(); ++j) {
-	  if ((asv[j] & 1) && fn_vals[j] == remove_val) {
-	    bad_flag = true;
-	    break;
+	// detect if current_pair is to be removed
+	bool bad_flag = false;
+	if (by_value) {
+	  const Response& resp      = current_pair.response();
+	  const RealVector& fn_vals = resp.function_values();
+	  const ShortArray& asv     = resp.active_set_request_vector();
+	  for (size_t j=0; j<fn_vals.length(); ++j) {
+	    if ((asv[j] & 1) && fn_vals[j] == remove_val) {
+	      bad_flag = true;
+	      break;
+	    }
 	  }
 	}
-      }
-      else if (contains(bad_ids, current_pair.eval_id()))
-	bad_flag = true;
+	else if (contains(bad_ids, current_pair.eval_id()))
+	  bad_flag = true;
 
-      // if current_pair is bad, omit it from the new restart file
-      if (!bad_flag) {
-	restart_output_archive & current_pair;
-	good_cntr++;
-      }
-
-      // peek to force EOF if the last restart record was read
-      restart_input_fs.peek();
-    }
+	// if current_pair is bad, omit it from the new restart file
+	if (!bad_flag) {
+	  restart_output_archive & current_pair;
+	  good_cntr++;
+	}
+      });
     cout << "Restart repair completed: " << cntr << " evaluations retrieved"
 	 << ", " << cntr-good_cntr << " removed, " << good_cntr << " saved.\n";
     restart_output_fs.close();
@@ -830,42 +793,9 @@ void concatenate_restart(StringArray pos_args)
 
     for(const String& rst_file : pos_args) {
 
-      RestartVersion rst_ver =
-	RestartVersion::check_restart_version(rst_file);
-
-      std::ifstream restart_input_fs(rst_file.c_str(), std::ios::binary);
-      if (!restart_input_fs.good()) {
-	Cerr << "\nError: could not open restart file '"
-	     << rst_file << "' for reading."<< std::endl;
-	exit(-1);
-      }
-      boost::archive::binary_iarchive restart_input_archive(restart_input_fs);
-
-      // re-read the full, correct version info from the new stream
-      if (RestartVersion::restartFirstVersionNumber <= rst_ver.restartVersion)
-	restart_input_archive & rst_ver;
-
-      int cntr = 0;
-      restart_input_fs.peek();  // peek to force EOF if no records in restart file
-      while (restart_input_fs.good() && !restart_input_fs.eof()) {
-
-	ParamResponsePair current_pair;
-	try {
-	  restart_input_archive & current_pair;
-	}
-	catch(const boost::archive::archive_exception& e) {
-	  Cerr << "\nError reading restart file '" << rst_file
-	       << "'.\nDetails (boost::archive exception):      "
-	       << e.what() << std::endl;
-	  abort_handler(-1);
-	}
-	// serialization functions no longer throw strings
-	restart_output_archive & current_pair;
-	cntr++;
- 
-	// peek to force EOF if the last restart record was read
-	restart_input_fs.peek();
-      }
+      size_t cntr = read_restart_records(rst_file,
+	[&](ParamResponsePair& current_pair)
+	{ restart_output_archive & current_pair; });
 
       cout << rst_file << " processing completed: " << cntr
 	   << " evaluations retrieved.\n";
@@ -888,4 +818,63 @@ void concatenate_restart(StringArray pos_args)
 
 }
 
+
+/** \b Usage: "dakota_restart_util to_indexed dakota.rst dakota.irst"\n
+              "dakota_restart_util to_legacy dakota.irst dakota.rst"
+
+    Converts a restart file (in either format) to the indexed format,
+    which Dakota appends to in place on restart, or to the legacy
+    single-archive format read by earlier Dakota versions. */
+void convert_restart(StringArray pos_args, bool to_indexed)
+{
+  if (pos_args.size() != 2) {
+    Cerr << "Usage: dakota_restart_util "
+	 << ((to_indexed) ? "to_indexed" : "to_legacy")
+	 << " <restart_file> <new_restart_file>." << endl;
+    exit(-1);
+  }
+
+  const String& read_restart_filename  = pos_args[0];
+  const String& write_restart_filename = pos_args[1];
+  if (read_restart_filename == write_restart_filename) {
+    Cerr << "Error: old and new restart filenames must differ." << endl;
+    exit(-1);
+  }
+
+  try {
+
+    RestartVersion rst_version(DakotaBuildInfo::get_release_num(),
+			       DakotaBuildInfo::get_rev_number());
+    std::unique_ptr<RestartWriter> rst_writer;
+    if (to_indexed)
+      rst_writer.reset(new RestartWriter(std::unique_ptr<IndexedRestartWriter>(
+	new IndexedRestartWriter(write_restart_filename, rst_version))));
+    else
+      rst_writer.reset(new RestartWriter(write_restart_filename, rst_version));
+
+    cout << "Writing new " << ((to_indexed) ? "indexed" : "legacy")
+	 << " restart file " << write_restart_filename << '\n';
+
+    size_t cntr = read_restart_records(read_restart_filename,
+      [&](ParamResponsePair& current_pair)
+      { rst_writer->append_prp(current_pair); });
+    rst_writer->flush();
+
+    cout << "Restart conversion completed: " << cntr
+	 << " evaluations converted.\n";
+
+  }
+  catch (const boost::archive::archive_exception& e) {
+    Cerr << "\nError converting restart file '" << read_restart_filename
+	 << "'.\nDetails (Boost archive exception): "
+	 << e.what() << std::endl;
+    abort_handler(IO_ERROR);
+  }
+  catch (const std::exception& e) {
+    Cerr << "Unknown error converting '" << read_restart_filename
+	 << "'.\nDetails: " << e.what() << '\n';
+    abort_handler(IO_ERROR);
+  }
+}
+
 } // namespace Dakota
@@ -12,19 +12,27 @@
 #include "util_math_tools.hpp"
 #include "util_metrics.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <sstream>
+#include <thread>
+
 namespace dakota {
 namespace surrogates {
 
-Surrogate::Surrogate() : numQOI(0) {}
+Surrogate::Surrogate() : numQOI(0), consoleStream(&std::cout) {}
 
 Surrogate::Surrogate(const ParameterList& param_list) {
   numQOI = 0;
+  consoleStream = &std::cout;
   silence_unused_args(param_list);
 }
 
 Surrogate::Surrogate(const MatrixXd& samples, const MatrixXd& response,
                      const ParameterList& param_list) {
   numQOI = 0;
+  consoleStream = &std::cout;
   silence_unused_args(samples, response, param_list);
 }
 
@@ -84,6 +92,10 @@ void Surrogate::get_options(ParameterList& options) { options = configOptions; }
 
 void Surrogate::print_options() { std::cout << configOptions << "\n"; }
 
+void Surrogate::console_stream(std::ostream& console) {
+  consoleStream = &console;
+}
+
 std::shared_ptr<Surrogate> Surrogate::load(const std::string& infile,
                                            const bool binary) {
   std::shared_ptr<Surrogate> surr_in;
@@ -107,23 +119,23 @@ VectorXd Surrogate::evaluate_metrics(const StringArray& mnames,
   return metrics;
 }
 
+bool Surrogate::leave_one_out_values(const MatrixXd& samples,
+                                     const MatrixXd& response,
+                                     VectorXd& loo_values) {
+  silence_unused_args(samples, response, loo_values);
+  return false;
+}
+
 VectorXd Surrogate::cross_validate(const MatrixXd& samples,
                                    const MatrixXd& response,
                                    const StringArray& mnames,
-                                   const int num_folds, const int seed) {
+                                   const int num_folds, const int seed,
+                                   const int num_threads) {
   const int num_metrics = mnames.size();
   VectorXd cv_results = VectorXd::Zero(num_metrics);
-  VectorXd metrics_values(num_metrics);
 
   const int num_samples = samples.rows();
-  const int num_features = samples.cols();
   std::vector<VectorXi> cv_folds;
-  VectorXi fold_indices;
-  MatrixXd train_samples, train_response;
-  MatrixXd val_samples, val_response;
-
-  int num_train_samples, num_val_samples;
-  int samples_index, train_index;
 
   util::create_cv_folds(num_folds, num_samples, cv_folds, seed);
 
@@ -134,43 +146,117 @@ VectorXd Surrogate::cross_validate(const MatrixXd& samples,
   // int verbosity_level = cv_surrogate_options.get<int>("verbosity");
   int verbosity_level = configOptions.get<int>("verbosity");
 
-  for (int i = 0; i < num_folds; i++) {
-    if (verbosity_level > 0) {
-      std::cout << "\nCross-validation fold " << i + 1 << "/" << num_folds
-                << "\n\n";
+  /* leave-one-out: a single build if the surrogate has a closed form */
+  VectorXd loo_values;
+  if (num_folds == num_samples &&
+      cv_surrogate->leave_one_out_values(samples, response, loo_values)) {
+    VectorXd loo_value(1), loo_response(1);
+    for (int i = 0; i < num_samples; i++) {
+      loo_value(0) = loo_values(i);
+      loo_response(0) = response(i, 0);
+      for (int m = 0; m < num_metrics; m++)
+        cv_results(m) +=
+            util::compute_metric(loo_value, loo_response, mnames[m]);
     }
-    /* validation samples */
-    fold_indices = cv_folds[i];
-    num_val_samples = fold_indices.size();
-    val_samples.resize(num_val_samples, num_features);
-    val_response.resize(num_val_samples, 1);
-    for (int j = 0; j < num_val_samples; j++) {
-      samples_index = fold_indices(j);
-      val_samples.row(j) = samples.row(samples_index);
-      val_response(j, 0) = response(samples_index, 0);
+    cv_results /= double(num_folds);
+    return cv_results;
+  }
+
+  /* Gather the samples in fold order once, so the validation rows of each
+     fold are a contiguous block and the training rows (in the original fold
+     order) are the blocks before and after it. */
+  MatrixXd fold_samples(num_samples, samples.cols());
+  MatrixXd fold_response(num_samples, 1);
+  std::vector<int> fold_offsets(num_folds + 1, 0);
+  for (int k = 0, row = 0; k < num_folds; k++) {
+    for (int j = 0; j < cv_folds[k].size(); j++, row++) {
+      fold_samples.row(row) = samples.row(cv_folds[k](j));
+      fold_response(row, 0) = response(cv_folds[k](j), 0);
     }
+    fold_offsets[k + 1] = row;
+  }
 
-    /* training samples */
-    num_train_samples = num_samples - num_val_samples;
-    train_samples.resize(num_train_samples, num_features);
-    train_response.resize(num_train_samples, 1);
-    train_index = 0;
-    for (int k = 0; k < num_folds; k++) {
-      if (k != i) {
-        fold_indices = cv_folds[k];
-        for (int j = 0; j < fold_indices.size(); j++) {
-          samples_index = fold_indices(j);
-          train_samples.row(train_index) = samples.row(samples_index);
-          train_response(train_index, 0) = response(samples_index, 0);
-          train_index++;
-        }
+  int num_fold_threads = 1;
+  if (cv_surrogate->concurrent_builds_supported()) {
+    num_fold_threads = (num_threads > 0)
+        ? num_threads
+        : std::max(1u, std::thread::hardware_concurrency());
+    num_fold_threads = std::min(num_fold_threads, num_folds);
+  }
+
+  /* one independent clone per thread; threaded surrogates are limited to a
+     single thread each to avoid oversubscription */
+  std::vector<std::shared_ptr<Surrogate>> fold_surrogates(num_fold_threads);
+  fold_surrogates[0] = cv_surrogate;
+  for (int t = 1; t < num_fold_threads; t++)
+    fold_surrogates[t] = this->clone();
+  if (num_fold_threads > 1) {
+    for (auto& fold_surrogate : fold_surrogates) {
+      ParameterList fold_options;
+      fold_surrogate->get_options(fold_options);
+      if (fold_options.isParameter("num threads")) {
+        fold_options.set("num threads", 1);
+        fold_surrogate->set_options(fold_options);
       }
     }
+  }
 
-    cv_surrogate->build(train_samples, train_response);
-    metrics_values =
-        cv_surrogate->evaluate_metrics(mnames, val_samples, val_response);
-    cv_results += metrics_values;
+  /* the console output of concurrent folds is collected per fold and
+     emitted after the join, in fold order */
+  std::vector<std::ostringstream> fold_logs(num_fold_threads > 1 ? num_folds
+                                                                 : 0);
+  std::vector<VectorXd> fold_metrics(num_folds);
+  std::vector<std::exception_ptr> fold_failures(num_folds);
+  std::atomic<int> next_fold(0);
+  auto run_folds = [&](Surrogate& fold_surrogate) {
+    MatrixXd train_samples, train_response, val_samples, val_response;
+    for (int i = next_fold++; i < num_folds; i = next_fold++) {
+      std::ostream& fold_console =
+          fold_logs.empty() ? *consoleStream : fold_logs[i];
+      fold_surrogate.console_stream(fold_console);
+      if (verbosity_level > 0) {
+        fold_console << "\nCross-validation fold " << i + 1 << "/"
+                     << num_folds << "\n\n";
+      }
+      try {
+        const int val_begin = fold_offsets[i];
+        const int num_val_samples = fold_offsets[i + 1] - val_begin;
+        const int num_after = num_samples - fold_offsets[i + 1];
+
+        /* validation samples */
+        val_samples = fold_samples.middleRows(val_begin, num_val_samples);
+        val_response = fold_response.middleRows(val_begin, num_val_samples);
+
+        /* training samples */
+        train_samples.resize(num_samples - num_val_samples, samples.cols());
+        train_response.resize(num_samples - num_val_samples, 1);
+        train_samples.topRows(val_begin) = fold_samples.topRows(val_begin);
+        train_samples.bottomRows(num_after) =
+            fold_samples.bottomRows(num_after);
+        train_response.topRows(val_begin) = fold_response.topRows(val_begin);
+        train_response.bottomRows(num_after) =
+            fold_response.bottomRows(num_after);
+
+        fold_surrogate.build(train_samples, train_response);
+        fold_metrics[i] =
+            fold_surrogate.evaluate_metrics(mnames, val_samples, val_response);
+      } catch (...) {
+        fold_failures[i] = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> fold_threads;
+  for (int t = 1; t < num_fold_threads; t++)
+    fold_threads.emplace_back(run_folds, std::ref(*fold_surrogates[t]));
+  run_folds(*fold_surrogates[0]);
+  for (auto& fold_thread : fold_threads) fold_thread.join();
+
+  /* accumulate in fold order so the result is independent of threading */
+  for (int i = 0; i < num_folds; i++) {
+    if (!fold_logs.empty()) *consoleStream << fold_logs[i].str();
+    if (fold_failures[i]) std::rethrow_exception(fold_failures[i]);
+    cv_results += fold_metrics[i];
   }
 
   cv_results /= double(num_folds);
@@ -25,6 +25,7 @@
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
 #include <fstream>
+#include <iostream>
 #include <locale>
 
 namespace dakota {
@@ -163,6 +164,13 @@ class Surrogate {
   /// Print the Surrogate's configOptions.
   void print_options();
 
+  /**
+   *  \brief Set the stream for the console output of build() (std::cout by
+   *  default).
+   *  \param[in] console Output stream, which must outlive its use.
+   */
+  void console_stream(std::ostream& console);
+
   /// Initialize the Surrogate's defaultConfigOptions.
   virtual void default_options() = 0;
 
@@ -208,10 +216,24 @@ class Surrogate {
   VectorXd evaluate_metrics(const StringArray& mnames, const MatrixXd& points,
                             const MatrixXd& ref_values);
 
-  /// Perform K-folds cross-validation (within surrogates)
+  /**
+   * \brief Perform K-folds cross-validation (within surrogates). Folds
+   * are fit concurrently on independent clones when the surrogate supports
+   * concurrent builds, and leave-one-out (num_folds = num_samples) uses
+   * leave_one_out_values() when available.
+   * \param[in] samples Matrix of build samples - (num_samples by
+   * num_features).
+   * \param[in] response Matrix of build responses - (num_samples by 1).
+   * \param[in] mnames Names of the metrics to compute.
+   * \param[in] num_folds Number of folds.
+   * \param[in] seed Seed for the random assignment of samples to folds.
+   * \param[in] num_threads Number of folds fit concurrently (0 for one per
+   * hardware thread).
+   * \returns Metric values averaged over the folds.
+   */
   VectorXd cross_validate(const MatrixXd& samples, const MatrixXd& response,
                           const StringArray& mnames, const int num_folds = 5,
-                          const int seed = 20);
+                          const int seed = 20, const int num_threads = 0);
 
  protected:
   /// Number of samples in the Surrogate's build samples.
@@ -232,11 +254,32 @@ class Surrogate {
   /// Key/value options to configure the surrogate - will override
   /// defaultConfigOptions.
   ParameterList configOptions;
+  /// Stream for the console output of build(); cross_validate() redirects
+  /// it to collect the output of folds built concurrently
+  std::ostream* consoleStream;
 
   // BMA: Could instead use virtual copy constructor idiom
   /// clone derived Surrogate class for use in cross-validation
   virtual std::shared_ptr<Surrogate> clone() const = 0;
 
+  /**
+   * \brief Build on all samples and compute the leave-one-out prediction
+   * for each sample without refitting, for surrogates with a closed form.
+   * \param[in] samples Matrix of build samples - (num_samples by
+   * num_features).
+   * \param[in] response Matrix of build responses - (num_samples by 1).
+   * \param[out] loo_values Prediction at each sample from the surrogate
+   * built without that sample - (num_samples).
+   * \returns False if no closed form is available (the default).
+   */
+  virtual bool leave_one_out_values(const MatrixXd& samples,
+                                    const MatrixXd& response,
+                                    VectorXd& loo_values);
+
+  /// Whether independent instances may be built concurrently, e.g., for
+  /// the folds of cross_validate()
+  virtual bool concurrent_builds_supported() const { return true; }
+
  private:
   /// Allow serializers access to private class data
   friend class boost::serialization::access;
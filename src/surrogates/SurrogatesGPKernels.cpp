@@ -9,9 +9,45 @@
 
 #include "SurrogatesGPKernels.hpp"
 
+#include <algorithm>
+
 namespace dakota {
 namespace surrogates {
 
+namespace {
+
+/// Number of points per edge of the tiles used for matrix-free Gram
+/// evaluations; a tile of scaled distances stays resident in L1/L2 cache.
+const int gram_tile_size = 128;
+
+/// Divide each feature of points by its length scale exp(theta_{k+1}) so
+/// that squared distances between scaled points are Dbar2 entries.
+MatrixXd scale_by_length(const MatrixXd& points, const VectorXd& theta_values) {
+  const int num_features = points.cols();
+  MatrixXd scaled(points.rows(), num_features);
+  for (int k = 0; k < num_features; k++)
+    scaled.col(k) = points.col(k) * exp(-theta_values(k + 1));
+  return scaled;
+}
+
+/// Fill the rows [row_begin, row_begin + num_rows) of dbar2 with the
+/// scaled squared distances between those rows of points_a and the point
+/// stored in column j of points_b_trans.
+void tile_column_dists2(const MatrixXd& points_a,
+                        const MatrixXd& points_b_trans, int row_begin,
+                        int num_rows, int j, Eigen::ArrayXd& dbar2) {
+  const int num_features = points_a.cols();
+  dbar2 = (points_a.col(0).segment(row_begin, num_rows).array() -
+           points_b_trans(0, j))
+              .square();
+  for (int k = 1; k < num_features; k++)
+    dbar2 += (points_a.col(k).segment(row_begin, num_rows).array() -
+              points_b_trans(k, j))
+                 .square();
+}
+
+}  // namespace
+
 Kernel::Kernel() {}
 Kernel::~Kernel() {}
 
@@ -57,6 +93,18 @@ MatrixXd SquaredExponentialKernel::compute_second_deriv_pred_gram(
   return second_deriv_pred_gram;
 }
 
+void SquaredExponentialKernel::evaluate_radial(const Eigen::ArrayXd& dbar2,
+                                               Eigen::ArrayXd& values) const {
+  values = (-0.5 * dbar2).exp();
+}
+
+void SquaredExponentialKernel::evaluate_radial_derivs(
+    const Eigen::ArrayXd& dbar2, Eigen::ArrayXd& values,
+    Eigen::ArrayXd& deriv_factors) const {
+  values = (-0.5 * dbar2).exp();
+  deriv_factors = values;
+}
+
 Matern32Kernel::Matern32Kernel() {}
 Matern32Kernel::~Matern32Kernel() {}
 
@@ -109,6 +157,21 @@ MatrixXd Matern32Kernel::compute_second_deriv_pred_gram(
   return second_deriv_pred_gram;
 }
 
+void Matern32Kernel::evaluate_radial(const Eigen::ArrayXd& dbar2,
+                                     Eigen::ArrayXd& values) const {
+  const Eigen::ArrayXd r = sqrt3 * dbar2.sqrt();
+  values = (1.0 + r) * (-r).exp();
+}
+
+void Matern32Kernel::evaluate_radial_derivs(
+    const Eigen::ArrayXd& dbar2, Eigen::ArrayXd& values,
+    Eigen::ArrayXd& deriv_factors) const {
+  const Eigen::ArrayXd r = sqrt3 * dbar2.sqrt();
+  deriv_factors = (-r).exp();
+  values = (1.0 + r) * deriv_factors;
+  deriv_factors *= 3.0;
+}
+
 Matern52Kernel::Matern52Kernel() {}
 Matern52Kernel::~Matern52Kernel() {}
 
@@ -188,6 +251,21 @@ MatrixXd Matern52Kernel::compute_second_deriv_pred_gram(
   return second_deriv_pred_gram;
 }
 
+void Matern52Kernel::evaluate_radial(const Eigen::ArrayXd& dbar2,
+                                     Eigen::ArrayXd& values) const {
+  const Eigen::ArrayXd r = sqrt5 * dbar2.sqrt();
+  values = (1.0 + r + r.square() / 3.0) * (-r).exp();
+}
+
+void Matern52Kernel::evaluate_radial_derivs(
+    const Eigen::ArrayXd& dbar2, Eigen::ArrayXd& values,
+    Eigen::ArrayXd& deriv_factors) const {
+  const Eigen::ArrayXd r = sqrt5 * dbar2.sqrt();
+  const Eigen::ArrayXd exp_r = (-r).exp();
+  values = (1.0 + r + r.square() / 3.0) * exp_r;
+  deriv_factors = 5.0 / 3.0 * (1.0 + r) * exp_r;
+}
+
 std::vector<MatrixXd> compute_cw_dists_squared(
     const std::vector<MatrixXd>& cw_dists) {
   const int num_variables = cw_dists.size();
@@ -198,6 +276,95 @@ std::vector<MatrixXd> compute_cw_dists_squared(
   return D2;
 }
 
+void Kernel::compute_gram_tiled(const MatrixXd& points_a,
+                                const MatrixXd& points_b,
+                                const VectorXd& theta_values, MatrixXd& gram) {
+  const int num_a = points_a.rows();
+  const int num_b = points_b.rows();
+  const double sig2 = exp(2.0 * theta_values(0));
+  const MatrixXd scaled_a = scale_by_length(points_a, theta_values);
+  const MatrixXd scaled_b_trans =
+      scale_by_length(points_b, theta_values).transpose();
+  gram.resize(num_a, num_b);
+
+  Eigen::ArrayXd dbar2, values;
+  for (int i0 = 0; i0 < num_a; i0 += gram_tile_size) {
+    const int ni = std::min(gram_tile_size, num_a - i0);
+    for (int j = 0; j < num_b; j++) {
+      tile_column_dists2(scaled_a, scaled_b_trans, i0, ni, j, dbar2);
+      evaluate_radial(dbar2, values);
+      gram.col(j).segment(i0, ni) = sig2 * values.matrix();
+    }
+  }
+}
+
+void Kernel::compute_gram_tiled(const MatrixXd& points,
+                                const VectorXd& theta_values, MatrixXd& gram) {
+  const int num_points = points.rows();
+  const double sig2 = exp(2.0 * theta_values(0));
+  const MatrixXd scaled = scale_by_length(points, theta_values);
+  const MatrixXd scaled_trans = scaled.transpose();
+  gram.resize(num_points, num_points);
+
+  Eigen::ArrayXd dbar2, values;
+  for (int j0 = 0; j0 < num_points; j0 += gram_tile_size) {
+    const int nj = std::min(gram_tile_size, num_points - j0);
+    for (int i0 = j0; i0 < num_points; i0 += gram_tile_size) {
+      const int ni = std::min(gram_tile_size, num_points - i0);
+      for (int j = j0; j < j0 + nj; j++) {
+        tile_column_dists2(scaled, scaled_trans, i0, ni, j, dbar2);
+        evaluate_radial(dbar2, values);
+        gram.col(j).segment(i0, ni) = sig2 * values.matrix();
+      }
+      /* mirror the off-diagonal tile into the upper triangle */
+      if (i0 != j0)
+        gram.block(j0, i0, nj, ni) = gram.block(i0, j0, ni, nj).transpose();
+    }
+  }
+}
+
+void Kernel::contract_gram_derivs_tiled(const MatrixXd& points,
+                                        const VectorXd& theta_values,
+                                        const MatrixXd& weights,
+                                        VectorXd& contractions) {
+  const int num_points = points.rows();
+  const int num_features = points.cols();
+  const double sig2 = exp(2.0 * theta_values(0));
+  const MatrixXd scaled = scale_by_length(points, theta_values);
+  const MatrixXd scaled_trans = scaled.transpose();
+  contractions.setZero(num_features + 1);
+
+  /* component-wise scaled squared distances for one column of a tile */
+  MatrixXd tile_dists2(gram_tile_size, num_features);
+  Eigen::ArrayXd dbar2, values, deriv_factors, weighted_factors;
+  double gram_sum = 0.0;
+  VectorXd length_sums = VectorXd::Zero(num_features);
+  for (int j0 = 0; j0 < num_points; j0 += gram_tile_size) {
+    const int nj = std::min(gram_tile_size, num_points - j0);
+    for (int i0 = j0; i0 < num_points; i0 += gram_tile_size) {
+      const int ni = std::min(gram_tile_size, num_points - i0);
+      /* off-diagonal tiles stand in for their transposes as well */
+      const double tile_factor = (i0 == j0) ? 1.0 : 2.0;
+      for (int j = j0; j < j0 + nj; j++) {
+        for (int k = 0; k < num_features; k++)
+          tile_dists2.col(k).head(ni) =
+              (scaled.col(k).segment(i0, ni).array() - scaled_trans(k, j))
+                  .square()
+                  .matrix();
+        dbar2 = tile_dists2.topRows(ni).rowwise().sum().array();
+        evaluate_radial_derivs(dbar2, values, deriv_factors);
+        const auto w = weights.col(j).segment(i0, ni).array();
+        gram_sum += tile_factor * (values * w).sum();
+        weighted_factors = tile_factor * deriv_factors * w;
+        length_sums.noalias() +=
+            tile_dists2.topRows(ni).transpose() * weighted_factors.matrix();
+      }
+    }
+  }
+  contractions(0) = 2.0 * sig2 * gram_sum;
+  contractions.tail(num_features) = sig2 * length_sums;
+}
+
 void Kernel::compute_Dbar(const std::vector<MatrixXd>& dists2,
                           const VectorXd& theta_values, bool take_sqrt) {
   const int num_rows = dists2[0].rows();
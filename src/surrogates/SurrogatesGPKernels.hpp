@@ -83,7 +83,67 @@ class Kernel {
       const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
       const VectorXd& theta_values, const int index_i, const int index_j) = 0;
 
+  /**
+   *  \brief Compute a Gram matrix directly from two sets of points. The
+   *  matrix is assembled in cache-blocked tiles, fusing the distance and
+   *  kernel evaluations, so no component-wise distance matrices are formed.
+   *  \param[in] points_a Scaled points for the rows - (num_a by num_features).
+   *  \param[in] points_b Scaled points for the columns -
+   *  (num_b by num_features).
+   *  \param[in] theta_values Vector of hyperparameters.
+   *  \param[inout] gram Gram matrix - (num_a by num_b).
+   */
+  void compute_gram_tiled(const MatrixXd& points_a, const MatrixXd& points_b,
+                          const VectorXd& theta_values, MatrixXd& gram);
+
+  /**
+   *  \brief Compute the symmetric Gram matrix of a set of points in
+   *  cache-blocked tiles. Only the lower triangle of tiles is evaluated.
+   *  \param[in] points Scaled points - (num_points by num_features).
+   *  \param[in] theta_values Vector of hyperparameters.
+   *  \param[inout] gram Gram matrix - (num_points by num_points).
+   */
+  void compute_gram_tiled(const MatrixXd& points, const VectorXd& theta_values,
+                          MatrixXd& gram);
+
+  /**
+   *  \brief Contract the derivatives of the Gram matrix w.r.t. the kernel
+   *  hyperparameters with a symmetric weight matrix. The derivatives are
+   *  evaluated tile by tile and never stored, i.e. sum_ij dK_ij/dtheta_k
+   *  weights_ij is computed for each hyperparameter k.
+   *  \param[in] points Scaled points - (num_points by num_features).
+   *  \param[in] theta_values Vector of hyperparameters.
+   *  \param[in] weights Symmetric weight matrix -
+   *  (num_points by num_points).
+   *  \param[inout] contractions Contracted derivatives - (num_features + 1).
+   */
+  void contract_gram_derivs_tiled(const MatrixXd& points,
+                                  const VectorXd& theta_values,
+                                  const MatrixXd& weights,
+                                  VectorXd& contractions);
+
  protected:
+  /**
+   *  \brief Evaluate the unit-variance kernel as a function of the scaled
+   *  squared distance Dbar2.
+   *  \param[in] dbar2 Array of scaled squared distances.
+   *  \param[out] values Kernel values without the sigma^2 factor.
+   */
+  virtual void evaluate_radial(const Eigen::ArrayXd& dbar2,
+                               Eigen::ArrayXd& values) const = 0;
+
+  /**
+   *  \brief Evaluate the unit-variance kernel and the factors g such that
+   *  the derivative of the Gram matrix w.r.t. a length-scale hyperparameter
+   *  theta_k is sigma^2 g d_k^2 exp(-2 theta_k).
+   *  \param[in] dbar2 Array of scaled squared distances.
+   *  \param[out] values Kernel values without the sigma^2 factor.
+   *  \param[out] deriv_factors Length-scale derivative factors g.
+   */
+  virtual void evaluate_radial_derivs(const Eigen::ArrayXd& dbar2,
+                                      Eigen::ArrayXd& values,
+                                      Eigen::ArrayXd& deriv_factors) const = 0;
+
   /**
    *  \brief Compute the ``Dbar'' matrices of scaled distances
    *  \param[in] cw_dists2 Vector of component-wise squared distance matrices.
@@ -120,6 +180,14 @@ class SquaredExponentialKernel : public Kernel {
       const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
       const VectorXd& theta_values, const int index_i,
       const int index_j) override;
+
+ protected:
+  void evaluate_radial(const Eigen::ArrayXd& dbar2,
+                       Eigen::ArrayXd& values) const override;
+
+  void evaluate_radial_derivs(const Eigen::ArrayXd& dbar2,
+                              Eigen::ArrayXd& values,
+                              Eigen::ArrayXd& deriv_factors) const override;
 };
 
 /// Stationary kernel with C^1 smooth realizations.
@@ -146,6 +214,14 @@ class Matern32Kernel : public Kernel {
       const VectorXd& theta_values, const int index_i,
       const int index_j) override;
 
+ protected:
+  void evaluate_radial(const Eigen::ArrayXd& dbar2,
+                       Eigen::ArrayXd& values) const override;
+
+  void evaluate_radial_derivs(const Eigen::ArrayXd& dbar2,
+                              Eigen::ArrayXd& values,
+                              Eigen::ArrayXd& deriv_factors) const override;
+
  private:
   const double sqrt3 = sqrt(3.);
 };
@@ -174,6 +250,14 @@ class Matern52Kernel : public Kernel {
       const VectorXd& theta_values, const int index_i,
       const int index_j) override;
 
+ protected:
+  void evaluate_radial(const Eigen::ArrayXd& dbar2,
+                       Eigen::ArrayXd& values) const override;
+
+  void evaluate_radial_derivs(const Eigen::ArrayXd& dbar2,
+                              Eigen::ArrayXd& values,
+                              Eigen::ArrayXd& deriv_factors) const override;
+
  private:
   const double sqrt5 = sqrt(5.);
 };
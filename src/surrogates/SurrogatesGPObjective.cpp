@@ -12,7 +12,7 @@
 namespace dakota {
 namespace surrogates {
 
-GP_Objective::GP_Objective(GaussianProcess& gp_model) : gp(gp_model) {
+GP_Objective::GP_Objective(const GaussianProcess& gp_model) : gp(gp_model) {
   nopt = gp.get_num_opt_variables();
   grad_old.resize(nopt);
   pold.resize(nopt);
@@ -28,8 +28,9 @@ double GP_Objective::value(const ROL::Vector<double>& p, double& tol) {
   const auto& x = as_VectorXd(p);
   double obj_val;
   VectorXd grad(nopt);
-  gp.set_opt_params(x);
-  gp.negative_marginal_log_likelihood(false, pdiff(x), obj_val, grad);
+  gp.set_opt_params(x, workspace);
+  gp.negative_marginal_log_likelihood(false, pdiff(x), obj_val, grad,
+                                      workspace);
   return obj_val;
 }
 
@@ -41,8 +42,9 @@ void GP_Objective::gradient(ROL::Vector<double>& g,
   auto& gvec = as_VectorXd(g);
   
   double obj_val;
-  gp.set_opt_params(x);
-  gp.negative_marginal_log_likelihood(true, pdiff(x), obj_val, gvec);
+  gp.set_opt_params(x, workspace);
+  gp.negative_marginal_log_likelihood(true, pdiff(x), obj_val, gvec,
+                                      workspace);
 }
 
 bool GP_Objective::pdiff(const Eigen::VectorXd& pnew) {
@@ -34,7 +34,7 @@ class GP_Objective : public ROL::Objective<double> {
    *  \param[in] gp_model Reference to the GaussianProcess surrogate.
    *
    */
-  GP_Objective(GaussianProcess& gp_model);
+  GP_Objective(const GaussianProcess& gp_model);
   ~GP_Objective() override;
 
   // ------------------------------------------------------------
@@ -58,6 +58,13 @@ class GP_Objective : public ROL::Objective<double> {
   void gradient(ROL::Vector<double>& g, const ROL::Vector<double>& p,
                 double& tol) override;
 
+  /**
+   *  \brief Get the workspace holding the most recently evaluated
+   *  hyperparameters and Gram matrix data.
+   *
+   */
+  GaussianProcess::MLEWorkspace& get_workspace() { return workspace; }
+
  private:
   // ------------------------------------------------------------
   // Private utility functions
@@ -74,7 +81,10 @@ class GP_Objective : public ROL::Objective<double> {
   // Private member variables
 
   /// Reference to the GaussianProcess surrogate.
-  GaussianProcess& gp;
+  const GaussianProcess& gp;
+  /// Private hyperparameters and scratch data, so that several objectives
+  /// for the same GaussianProcess can be evaluated concurrently.
+  GaussianProcess::MLEWorkspace workspace;
   /// Number of optimization variables.
   int nopt;
   /// Previously computed value of the objective function.
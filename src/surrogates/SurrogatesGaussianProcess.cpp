@@ -14,6 +14,11 @@
 #include "Teuchos_oblackholestream.hpp"
 #include "util_math_tools.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
 namespace dakota {
 namespace surrogates {
 
@@ -68,10 +73,10 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
 
   if (verbosity > 0) {
     if (verbosity == 1) {
-      std::cout << "\nBuilding GaussianProcess\n\n";
+      *consoleStream << "\nBuilding GaussianProcess\n\n";
     } else if (verbosity == 2) {
-      std::cout << "\nBuilding GaussianProcess with configuration options\n"
-                << configOptions << "\n";
+      *consoleStream << "\nBuilding GaussianProcess with configuration "
+                     << "options\n" << configOptions << "\n";
     } else
       throw(std::runtime_error(
           "Invalid verbosity int for GaussianProcess surrogate"));
@@ -111,14 +116,22 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
                                  configOptions.get<std::string>("scaler name")),
                              samples));
   dataScaler.scale_samples(samples, scaledBuildPoints);
-  compute_build_dists();
+  matrixFree = use_matrix_free();
+  if (matrixFree) {
+    /* distances and Gram derivatives are evaluated on the fly */
+    cwiseDists2.clear();
+    if (verbosity > 0)
+      *consoleStream << "Using matrix-free Gram matrix evaluations\n";
+  } else
+    compute_build_dists();
 
   MatrixXd beta_bounds;
   estimateTrend = configOptions.sublist("Trend").get<bool>("estimate trend");
   if (estimateTrend) {
     polyRegression = std::make_shared<PolynomialRegression>(
-        scaledBuildPoints, targetValues,
         configOptions.sublist("Trend").sublist("Options"));
+    polyRegression->console_stream(*consoleStream);
+    polyRegression->build(scaledBuildPoints, targetValues);
     numPolyTerms = polyRegression->get_num_terms();
     polyRegression->compute_basis_matrix(scaledBuildPoints, basisMatrix);
     beta_bounds = MatrixXd::Ones(numPolyTerms, 2);
@@ -131,12 +144,10 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
   bestThetaValues.resize(numVariables + 1);
   betaValues.resize(numPolyTerms);
   bestBetaValues.resize(numPolyTerms);
-  /* set the size of the GramMatrix and its derivatives */
+  /* set the size of the GramMatrix */
   GramMatrix.resize(numSamples, numSamples);
-  GramMatrixDerivs.resize(numVariables + 1);
-  for (int k = 0; k < numVariables + 1; k++) {
-    GramMatrixDerivs[k].resize(numSamples, numSamples);
-  }
+  /* workspaces (re)acquire their kernel and Gram storage on first use */
+  mleWorkspace = MLEWorkspace();
 
   /* DTS: if the nugget is being estimated, should the fixed value be set to
    * zero? */
@@ -150,13 +161,12 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
                            num_restarts, configOptions.get<int>("gp seed"),
                            initial_guesses);
 
-  ROL::Ptr<std::ostream> outStream;
-  Teuchos::oblackholestream bhs;
-  outStream = ROL::makePtrFromRef(bhs);
-
-  /* Uncomment if you'd like to print ROL's output to screen.
-   * Useful for debugging */
-  // outStream = ROL::makePtrFromRef(std::cout);
+  /* Uncomment the std::cout stream below if you'd like to print ROL's
+   * output to screen. Useful for debugging (with "num threads" = 1) */
+  // auto make_out_stream = []() { return ROL::makePtrFromRef(std::cout); };
+  auto make_out_stream = []() {
+    return ROL::makePtr<Teuchos::oblackholestream>();
+  };
 
   /* No more reading in rol_params from an xml file
    * Set defaults in here instead */
@@ -170,8 +180,6 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
       Teuchos::rcp(new ParameterList("GP_MLE_Optimization"));
   setup_default_optimization_params(gp_mle_rol_params);
 
-//  auto obj = std::make_shared<GP_Objective>(*this);
-  auto obj_ptr = ROL::makePtr<GP_Objective>(*this); auto& obj = *obj_ptr;
   int dim = numVariables + 1 + numPolyTerms + numNuggetTerms;
 
   auto make_ROLVectorXd = []( auto&&... args ) {
@@ -179,13 +187,9 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
   };
 
   /* set up parameter vectors and bounds */
-  auto x_ptr  = make_ROLVectorXd(dim,true); auto& x  = *x_ptr;
   auto lo_ptr = make_ROLVectorXd(dim,true); auto& lo = *lo_ptr;
   auto hi_ptr = make_ROLVectorXd(dim,true); auto& hi = *hi_ptr;
 
-  auto bounds_ptr = ROL::makePtr<ROL::Bounds<double>>(lo_ptr,hi_ptr);
-  auto& bounds = *bounds_ptr;
-
   constexpr int LO{0}, HI{1};
 
   for( int bnd : {LO,HI} ) {
@@ -206,48 +210,86 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
     }
   }
 
-//  std::vector<std::string> output;
-
   objectiveFunctionHistory.resize(num_restarts);
   objectiveGradientHistory.resize(num_restarts, dim);
   thetaHistory.resize(num_restarts, dim);
 
-  double final_obj_value;
-  VectorXd final_obj_gradient(dim);
-
-  auto prob_ptr = ROL::makePtr<ROL::Problem<double>>(obj_ptr,x_ptr);
-  prob_ptr->addBoundConstraint(bounds_ptr);
-
-  ROL::Solver<double> rol_solver(prob_ptr,*gp_mle_rol_params); 
-
+  /* Each restart gets a private objective (with its own MLEWorkspace),
+   * problem, solver, parameter list and output stream. These are created
+   * here, serially, since ROL and Teuchos reference counting is not
+   * guaranteed to be thread-safe; only the solves run concurrently. */
+  std::vector<ROL::Ptr<GP_Objective>> restart_objs(num_restarts);
+  std::vector<ROL::Ptr<ROLVectorXd>> restart_xs(num_restarts);
+  std::vector<ROL::Ptr<ROL::Solver<double>>> restart_solvers(num_restarts);
+  std::vector<ROL::Ptr<std::ostream>> restart_streams(num_restarts);
+  std::vector<ParameterList> restart_rol_params(num_restarts,
+                                                *gp_mle_rol_params);
   for (int i = 0; i < num_restarts; i++) {
-    x = initial_guesses.row(i);
-    rol_solver.solve(*outStream,ROL::nullPtr,true);
-    thetaValues = x.head(numVariables + 1);
-    if (estimateTrend) {
-      for (int j = 0; j < numPolyTerms; ++j) {
-        betaValues(j) = x(numVariables + 1 + j);
+    restart_objs[i] = ROL::makePtr<GP_Objective>(*this);
+    restart_xs[i] = make_ROLVectorXd(dim,true);
+    *restart_xs[i] = initial_guesses.row(i);
+    /* ROL::Bounds keeps scratch vectors, so it is not shared either */
+    auto restart_lo = make_ROLVectorXd(dim); restart_lo->set(lo);
+    auto restart_hi = make_ROLVectorXd(dim); restart_hi->set(hi);
+    auto bounds_ptr =
+        ROL::makePtr<ROL::Bounds<double>>(restart_lo,restart_hi);
+    auto prob_ptr =
+        ROL::makePtr<ROL::Problem<double>>(restart_objs[i],restart_xs[i]);
+    prob_ptr->addBoundConstraint(bounds_ptr);
+    restart_solvers[i] =
+        ROL::makePtr<ROL::Solver<double>>(prob_ptr,restart_rol_params[i]);
+    restart_streams[i] = make_out_stream();
+  }
+
+  std::vector<double> final_obj_values(num_restarts);
+  std::vector<VectorXd> final_obj_gradients(num_restarts, VectorXd(dim));
+  std::vector<std::exception_ptr> restart_failures(num_restarts);
+
+  /* restarts are claimed dynamically since their iteration counts vary */
+  std::atomic<int> next_restart(0);
+  auto solve_restarts = [&]() {
+    for (int i = next_restart++; i < num_restarts; i = next_restart++) {
+      try {
+        restart_solvers[i]->solve(*restart_streams[i],ROL::nullPtr,true);
+        /* get the final objective function value and gradient */
+        auto& workspace = restart_objs[i]->get_workspace();
+        set_opt_params(as_VectorXd(*restart_xs[i]), workspace);
+        negative_marginal_log_likelihood(true, true, final_obj_values[i],
+                                         final_obj_gradients[i], workspace);
+        /* only num_threads restarts hold Gram storage at a time */
+        workspace.release_matrices();
+      }
+      catch (...) {
+        restart_failures[i] = std::current_exception();
       }
     }
-    if (estimateNugget) {
-      estimatedNuggetValue = x(numVariables + 1 + numPolyTerms);
-    }
-    /* get the final objective function value and gradient */
-    negative_marginal_log_likelihood(true, true, final_obj_value,
-                                     final_obj_gradient);
-    if (final_obj_value < bestObjFunValue) {
-      bestObjFunValue = final_obj_value;
-      bestThetaValues = thetaValues;
-      if (estimateTrend) bestBetaValues = betaValues;
-      if (estimateNugget) bestEstimatedNuggetValue = estimatedNuggetValue;
+  };
+
+  const int num_threads = num_mle_threads(num_restarts);
+  std::vector<std::thread> mle_threads;
+  for (int t = 1; t < num_threads; t++)
+    mle_threads.emplace_back(solve_restarts);
+  solve_restarts();
+  for (auto& mle_thread : mle_threads)
+    mle_thread.join();
+
+  /* reduce in restart order, so the result is independent of the number
+     of threads (ties go to the earliest restart, as in a serial solve) */
+  for (int i = 0; i < num_restarts; i++) {
+    if (restart_failures[i])
+      std::rethrow_exception(restart_failures[i]);
+    const auto& x = as_VectorXd(*restart_xs[i]);
+    const auto& workspace = restart_objs[i]->get_workspace();
+    if (final_obj_values[i] < bestObjFunValue) {
+      bestObjFunValue = final_obj_values[i];
+      bestThetaValues = workspace.thetaValues;
+      if (estimateTrend) bestBetaValues = workspace.betaValues;
+      if (estimateNugget)
+        bestEstimatedNuggetValue = workspace.estimatedNuggetValue;
     }
-    objectiveFunctionHistory(i) = final_obj_value;
-    objectiveGradientHistory.row(i) = final_obj_gradient;
-    thetaHistory.row(i).head(numVariables + 1) = thetaValues;
-    if (estimateTrend)
-      thetaHistory.row(i).segment(numVariables + 1, numPolyTerms) = betaValues;
-    if (estimateNugget) thetaHistory.row(i).tail(1)(0) = estimatedNuggetValue;
-    rol_solver.reset();
+    objectiveFunctionHistory(i) = final_obj_values[i];
+    objectiveGradientHistory.row(i) = final_obj_gradients[i];
+    thetaHistory.row(i) = x;
   }
 
   thetaValues = bestThetaValues;
@@ -259,7 +301,7 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
   if (estimateNugget) estimatedNuggetValue = bestEstimatedNuggetValue;
 
   /* compute and store best Cholesky factorization */
-  compute_gram(cwiseDists2, true, false, GramMatrix);
+  compute_build_gram();
   CholFact.compute(GramMatrix);
   hasBestCholFact = true;
 
@@ -288,16 +330,15 @@ VectorXd GaussianProcess::value(const MatrixXd& eval_points) {
 
   /* scale the eval_points (prediction points) */
   const MatrixXd& scaled_pred_points = dataScaler.scale_samples(eval_points);
-  compute_pred_dists(scaled_pred_points);
 
   /* compute the Gram matrix and its Cholesky factorization */
   if (!hasBestCholFact) {
-    compute_gram(cwiseDists2, true, false, GramMatrix);
+    compute_build_gram();
     CholFact.compute(GramMatrix);
   }
 
   VectorXd resid, chol_solve_resid;
-  compute_gram(cwiseMixedDists2, false, false, predMixedGramMatrix);
+  compute_pred_mixed_gram(scaled_pred_points, false);
 
   if (estimateTrend) {
     resid = targetValues - basisMatrix * betaValues;
@@ -331,16 +372,15 @@ MatrixXd GaussianProcess::gradient(const MatrixXd& eval_points) {
   /* scale the eval_points (prediction points) */
   MatrixXd scaled_pred_pts;
   dataScaler.scale_samples(eval_points, scaled_pred_pts);
-  compute_pred_dists(scaled_pred_pts);
 
   /* compute the Gram matrix and its Cholesky factorization */
   if (!hasBestCholFact) {
-    compute_gram(cwiseDists2, true, false, GramMatrix);
+    compute_build_gram();
     CholFact.compute(GramMatrix);
   }
 
   MatrixXd chol_solve_resid, first_deriv_pred_gram, grad_components, resid;
-  compute_gram(cwiseMixedDists2, false, false, predMixedGramMatrix);
+  compute_pred_mixed_gram(scaled_pred_pts, true);
   resid = targetValues;
   if (estimateTrend) resid -= basisMatrix * betaValues;
   chol_solve_resid = CholFact.solve(resid);
@@ -373,16 +413,15 @@ MatrixXd GaussianProcess::hessian(const MatrixXd& eval_point) {
   /* scale the eval_point (prediction points) */
   MatrixXd scaled_pred_point;
   dataScaler.scale_samples(eval_point, scaled_pred_point);
-  compute_pred_dists(scaled_pred_point);
 
   /* compute the Gram matrix and its Cholesky factorization */
   if (!hasBestCholFact) {
-    compute_gram(cwiseDists2, true, false, GramMatrix);
+    compute_build_gram();
     CholFact.compute(GramMatrix);
   }
 
   MatrixXd chol_solve_resid, second_deriv_pred_gram, resid;
-  compute_gram(cwiseMixedDists2, false, false, predMixedGramMatrix);
+  compute_pred_mixed_gram(scaled_pred_point, true);
   resid = targetValues;
   if (estimateTrend) resid -= basisMatrix * betaValues;
   chol_solve_resid = CholFact.solve(resid);
@@ -421,17 +460,16 @@ MatrixXd GaussianProcess::covariance(const MatrixXd& eval_points,
   predCovariance.resize(num_eval_points, num_eval_points);
   /* scale the eval_points (prediction points) */
   const MatrixXd& scaled_pred_points = dataScaler.scale_samples(eval_points);
-  compute_pred_dists(scaled_pred_points);
 
   /* compute the Gram matrix and its Cholesky factorization */
   if (!hasBestCholFact) {
-    compute_gram(cwiseDists2, true, false, GramMatrix);
+    compute_build_gram();
     CholFact.compute(GramMatrix);
   }
 
   VectorXd resid;
   MatrixXd chol_solve_pred_mat;
-  compute_gram(cwiseMixedDists2, false, false, predMixedGramMatrix);
+  compute_pred_mixed_gram(scaled_pred_points, false);
 
   if (estimateTrend)
     resid = targetValues - basisMatrix * betaValues;
@@ -440,7 +478,12 @@ MatrixXd GaussianProcess::covariance(const MatrixXd& eval_points,
 
   chol_solve_pred_mat = CholFact.solve(predMixedGramMatrix.transpose());
 
-  compute_gram(cwisePredDists2, true, false, predGramMatrix);
+  if (matrixFree) {
+    kernel->compute_gram_tiled(scaled_pred_points, thetaValues,
+                               predGramMatrix);
+    add_nugget_terms(estimatedNuggetValue, predGramMatrix);
+  } else
+    compute_gram(cwisePredDists2, true, predGramMatrix);
   predCovariance = predGramMatrix - predMixedGramMatrix * chol_solve_pred_mat;
 
   if (estimateTrend) {
@@ -471,40 +514,84 @@ VectorXd GaussianProcess::variance(const MatrixXd& eval_points, const int qoi) {
   return variance;
 }
 
+bool GaussianProcess::leave_one_out_values(const MatrixXd& samples,
+                                           const MatrixXd& response,
+                                           VectorXd& loo_values) {
+  configOptions.validateParametersAndSetDefaults(defaultConfigOptions);
+  if (!configOptions.get<bool>("closed-form leave-one-out")) return false;
+
+  build(samples, response);
+
+  VectorXd resid = targetValues.col(0);
+  if (estimateTrend) resid -= basisMatrix * betaValues;
+  const VectorXd chol_solve_resid = CholFact.solve(resid);
+  const VectorXd inv_gram_diag = CholFact.solve(eyeMatrix).diagonal();
+
+  /* leave-one-out means in the (standardized) response space */
+  loo_values =
+      targetValues.col(0) - chol_solve_resid.cwiseQuotient(inv_gram_diag);
+  loo_values = responseScaleFactor * loo_values.array() + responseOffset;
+  return true;
+}
+
 void GaussianProcess::negative_marginal_log_likelihood(bool compute_grad,
                                                        bool form_gram,
                                                        double& obj_value,
                                                        VectorXd& obj_gradient) {
+  /* the member hyperparameters define the objective */
+  mleWorkspace.thetaValues = thetaValues;
+  if (estimateTrend) mleWorkspace.betaValues = betaValues;
+  if (estimateNugget) mleWorkspace.estimatedNuggetValue = estimatedNuggetValue;
+  if (!mleWorkspace.kernel) mleWorkspace.kernel = kernel_factory(kernel_type);
+  negative_marginal_log_likelihood(compute_grad, form_gram, obj_value,
+                                   obj_gradient, mleWorkspace);
+}
+
+void GaussianProcess::negative_marginal_log_likelihood(
+    bool compute_grad, bool form_gram, double& obj_value,
+    VectorXd& obj_gradient, MLEWorkspace& workspace) const {
+  auto& chol_fact = workspace.CholFact;
+  auto& trend_target_resid = workspace.trendTargetResidual;
+  auto& gram_resid_soln = workspace.GramResidualSolution;
   if (form_gram) {
-    compute_gram(cwiseDists2, true, true, GramMatrix);
-    CholFact.compute(GramMatrix);
-    trendTargetResidual = targetValues;
-    if (estimateTrend) trendTargetResidual -= basisMatrix * betaValues;
-    GramResidualSolution = CholFact.solve(trendTargetResidual);
+    compute_build_gram(true, workspace);
+    chol_fact.compute(workspace.GramMatrix);
+    trend_target_resid = targetValues;
+    if (estimateTrend)
+      trend_target_resid -= basisMatrix * workspace.betaValues;
+    gram_resid_soln = chol_fact.solve(trend_target_resid);
   }
 
   obj_value =
-      0.5 * log(CholFact.vectorD().array()).matrix().sum() +
-      0.5 * (trendTargetResidual.transpose() * GramResidualSolution)(0, 0) +
+      0.5 * log(chol_fact.vectorD().array()).matrix().sum() +
+      0.5 * (trend_target_resid.transpose() * gram_resid_soln)(0, 0) +
       static_cast<double>(numSamples) / 2.0 * log(2.0 * PI);
 
   if (compute_grad) {
     /* DTS: This Cholesky solve is much more expensive than the factorization!
      */
-    MatrixXd Q =
-        -0.5 * (GramResidualSolution * GramResidualSolution.transpose() -
-                CholFact.solve(eyeMatrix));
+    MatrixXd Q = -0.5 * (gram_resid_soln * gram_resid_soln.transpose() -
+                         chol_fact.solve(eyeMatrix));
     if (estimateTrend) {
       obj_gradient.segment(numVariables + 1, numPolyTerms) =
-          -basisMatrix.transpose() * GramResidualSolution;
+          -basisMatrix.transpose() * gram_resid_soln;
     }
 
-    for (int k = 0; k < numVariables + 1; k++)
-      obj_gradient(k) = (GramMatrixDerivs[k].cwiseProduct(Q)).sum();
+    if (matrixFree) {
+      VectorXd gram_deriv_contractions;
+      workspace.kernel->contract_gram_derivs_tiled(
+          scaledBuildPoints, workspace.thetaValues, Q,
+          gram_deriv_contractions);
+      obj_gradient.head(numVariables + 1) = gram_deriv_contractions;
+    } else {
+      for (int k = 0; k < numVariables + 1; k++)
+        obj_gradient(k) =
+            (workspace.GramMatrixDerivs[k].cwiseProduct(Q)).sum();
+    }
 
     if (estimateNugget) {
       obj_gradient(numVariables + 1 + numPolyTerms) =
-          2.0 * exp(2.0 * estimatedNuggetValue) * Q.trace();
+          2.0 * exp(2.0 * workspace.estimatedNuggetValue) * Q.trace();
     }
   }
 }
@@ -540,7 +627,7 @@ void GaussianProcess::setup_hyperparameter_bounds(VectorXd& sigma_bounds,
   }
 }
 
-int GaussianProcess::get_num_opt_variables() {
+int GaussianProcess::get_num_opt_variables() const {
   return numVariables + 1 + numPolyTerms + numNuggetTerms;
 }
 
@@ -560,6 +647,17 @@ int GaussianProcess::get_num_variables() const { return numVariables; }
   }
 }
 
+void GaussianProcess::set_opt_params(const VectorXd& opt_params,
+                                     MLEWorkspace& workspace) const {
+  workspace.thetaValues = opt_params.head(numVariables + 1);
+  if (estimateTrend)
+    workspace.betaValues = opt_params.segment(numVariables + 1, numPolyTerms);
+  if (estimateNugget)
+    workspace.estimatedNuggetValue =
+        opt_params(numVariables + 1 + numPolyTerms);
+  if (!workspace.kernel) workspace.kernel = kernel_factory(kernel_type);
+}
+
 void GaussianProcess::default_options() {
   // Scalar values for bound used by default. Advanced users can specify
   // ansiotropic legnth-scale bounds with an Eigen matrix in C++ or
@@ -611,6 +709,24 @@ void GaussianProcess::default_options() {
                            "random seed for initial iterate generation");
   defaultConfigOptions.set("standardize response", true,
                            "Make the response zero mean and unit variance");
+  /* Matrix-free Gram evaluations trade O(num_features * num_samples^2)
+     storage for recomputation of the kernel during the MLE. The mode is
+     also used whenever the stored distances and Gram derivatives would
+     exceed the memory threshold (in MB). */
+  defaultConfigOptions.set("matrix free", false,
+                           "evaluate Gram matrices from the points in tiles");
+  defaultConfigOptions.set("matrix free memory threshold", 4096.0,
+                           "stored distance memory (MB) above which the "
+                           "matrix-free mode is used");
+  /* Restarts are solved concurrently; the workspaces of the concurrent
+     restarts are also kept within the memory threshold above. */
+  defaultConfigOptions.set("num threads", 0,
+                           "threads for concurrent restarts (0 for one per "
+                           "hardware thread)");
+  /* Leave-one-out cross-validation from the inverse Gram matrix of the
+     full build, rather than re-estimating hyperparameters for each fold */
+  defaultConfigOptions.set("closed-form leave-one-out", false,
+                           "closed-form leave-one-out cross-validation");
   /* Verbosity levels
      2 - maximum level: print out config options and building notification
      1 - minimum level: print out building notification
@@ -651,20 +767,23 @@ void GaussianProcess::compute_build_dists() {
   }
 }
 
-void GaussianProcess::compute_pred_dists(const MatrixXd& scaled_pred_pts) {
+void GaussianProcess::compute_pred_dists(const MatrixXd& scaled_pred_pts,
+                                         bool compute_pred_pred) {
   const int num_pred_pts = scaled_pred_pts.rows();
   cwiseMixedDists.resize(numVariables);
   cwiseMixedDists2.resize(numVariables);
-  cwisePredDists2.resize(numVariables);
+  cwisePredDists2.resize(compute_pred_pred ? numVariables : 0);
 
   for (int k = 0; k < numVariables; k++) {
     cwiseMixedDists[k].resize(num_pred_pts, numSamples);
-    cwisePredDists2[k].resize(num_pred_pts, num_pred_pts);
+    if (compute_pred_pred)
+      cwisePredDists2[k].resize(num_pred_pts, num_pred_pts);
     for (int i = 0; i < num_pred_pts; i++) {
       for (int j = 0; j < numSamples; j++) {
         cwiseMixedDists[k](i, j) =
             scaled_pred_pts(i, k) - scaledBuildPoints(j, k);
       }
+      if (!compute_pred_pred) continue;
       for (int j = i; j < num_pred_pts; j++) {
         cwisePredDists2[k](i, j) =
             pow(scaled_pred_pts(i, k) - scaled_pred_pts(j, k), 2);
@@ -676,23 +795,86 @@ void GaussianProcess::compute_pred_dists(const MatrixXd& scaled_pred_pts) {
 }
 
 void GaussianProcess::compute_gram(const std::vector<MatrixXd>& dists2,
-                                   bool add_nugget, bool compute_derivs,
-                                   MatrixXd& gram) {
+                                   bool add_nugget, MatrixXd& gram) {
   const int num_rows = dists2[0].rows();
   const int num_cols = dists2[0].cols();
   gram.resize(num_rows, num_cols);
   kernel->compute_gram(dists2, thetaValues, gram);
 
-  if (compute_derivs)
-    kernel->compute_gram_derivs(gram, dists2, thetaValues, GramMatrixDerivs);
+  if (add_nugget) add_nugget_terms(estimatedNuggetValue, gram);
+}
+
+void GaussianProcess::add_nugget_terms(double estimated_nugget,
+                                       MatrixXd& gram) const {
+  /* add in the fixed nugget */
+  gram.diagonal().array() += fixedNuggetValue;
+  /* add in the estimated nugget */
+  if (estimateNugget) gram.diagonal().array() += exp(2.0 * estimated_nugget);
+}
+
+bool GaussianProcess::use_matrix_free() const {
+  if (configOptions.get<bool>("matrix free")) return true;
+  /* cwiseDists2 and the Gram derivatives of one MLE workspace hold
+     2 * num_features + 1 matrices */
+  const double stored_mb = (2.0 * numVariables + 1.0) * numSamples *
+                           numSamples * sizeof(double) / (1024.0 * 1024.0);
+  return stored_mb > configOptions.get<double>("matrix free memory threshold");
+}
+
+void GaussianProcess::compute_build_gram() {
+  if (matrixFree) {
+    kernel->compute_gram_tiled(scaledBuildPoints, thetaValues, GramMatrix);
+    add_nugget_terms(estimatedNuggetValue, GramMatrix);
+  } else
+    compute_gram(cwiseDists2, true, GramMatrix);
+}
 
-  if (add_nugget) {
-    /* add in the fixed nugget */
-    gram.diagonal().array() += fixedNuggetValue;
-    /* add in the estimated nugget */
-    if (estimateNugget)
-      gram.diagonal().array() += exp(2.0 * estimatedNuggetValue);
+void GaussianProcess::compute_build_gram(bool compute_derivs,
+                                         MLEWorkspace& workspace) const {
+  auto& gram = workspace.GramMatrix;
+  if (matrixFree)
+    workspace.kernel->compute_gram_tiled(scaledBuildPoints,
+                                         workspace.thetaValues, gram);
+  else {
+    gram.resize(numSamples, numSamples);
+    workspace.kernel->compute_gram(cwiseDists2, workspace.thetaValues, gram);
+    if (compute_derivs) {
+      workspace.GramMatrixDerivs.resize(numVariables + 1);
+      workspace.kernel->compute_gram_derivs(gram, cwiseDists2,
+                                            workspace.thetaValues,
+                                            workspace.GramMatrixDerivs);
+    }
   }
+  add_nugget_terms(workspace.estimatedNuggetValue, gram);
+}
+
+int GaussianProcess::num_mle_threads(int num_restarts) const {
+  int num_threads = configOptions.get<int>("num threads");
+  if (num_threads <= 0)
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  /* each concurrent restart holds a Gram matrix, its factorization, the
+     gradient weights and, unless matrix-free, the Gram derivatives */
+  const double workspace_mb = ((matrixFree ? 0.0 : numVariables + 1.0) + 4.0) *
+                              numSamples * numSamples * sizeof(double) /
+                              (1024.0 * 1024.0);
+  const double memory_threads =
+      configOptions.get<double>("matrix free memory threshold") / workspace_mb;
+  if (memory_threads < num_threads)
+    num_threads = static_cast<int>(memory_threads);
+  return std::max(1, std::min(num_threads, num_restarts));
+}
+
+void GaussianProcess::compute_pred_mixed_gram(const MatrixXd& scaled_pred_pts,
+                                              bool need_mixed_dists) {
+  if (matrixFree && !need_mixed_dists) {
+    kernel->compute_gram_tiled(scaled_pred_pts, scaledBuildPoints, thetaValues,
+                               predMixedGramMatrix);
+    return;
+  }
+  /* prediction-prediction distances are only needed for the covariance
+     when the distances are stored */
+  compute_pred_dists(scaled_pred_pts, !matrixFree);
+  compute_gram(cwiseMixedDists2, false, predMixedGramMatrix);
 }
 
 void GaussianProcess::generate_initial_guesses(
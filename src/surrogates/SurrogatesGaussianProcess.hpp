@@ -18,6 +18,7 @@
 
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/vector.hpp>
+#include <boost/serialization/version.hpp>
 
 namespace dakota {
 
@@ -40,14 +41,57 @@ namespace surrogates {
  *  marginal log-likelihood function. ROL's implementation of
  *  L-BFGS-B is used to solve the optimization problem, and the
  *  algorithm may be run from multiple random initial guesses
- *  to increase the chance of finding the global minimum.
+ *  to increase the chance of finding the global minimum. The
+ *  restarts are independent and are solved concurrently, each
+ *  with a private MLEWorkspace; the best restart is selected in
+ *  restart order so the result does not depend on the number of
+ *  threads.
  *
  *  Once the GP is constructed its mean, variance,
  *  and covariance matrix can be computed for a set of prediction
  *  points. Gradients and Hessians are available.
+ *
+ *  By default the component-wise squared distances between the
+ *  build points and the derivatives of the Gram matrix are stored,
+ *  requiring O(num_features * num_samples^2) memory. In the matrix-free
+ *  mode the Gram matrix and the hyperparameter gradient are instead
+ *  evaluated directly from the build points in cache-blocked tiles,
+ *  reducing the storage to O(num_samples^2).
  */
 class GaussianProcess : public Surrogate {
  public:
+  /// Hyperparameters and Gram matrix scratch data for one maximum
+  /// likelihood optimization, so that restarts can run concurrently.
+  struct MLEWorkspace {
+    /// Vector of log-space hyperparameters.
+    VectorXd thetaValues;
+    /// Vector of polynomial coefficients.
+    VectorXd betaValues;
+    /// Estimated nugget term.
+    double estimatedNuggetValue = 0.0;
+    /// Private kernel, since kernels hold scratch matrices.
+    std::shared_ptr<Kernel> kernel;
+    /// Gram matrix for the build points.
+    MatrixXd GramMatrix;
+    /// Derivatives of the Gram matrix w.r.t. the hyperparameters.
+    std::vector<MatrixXd> GramMatrixDerivs;
+    /// Pivoted Cholesky factorization.
+    Eigen::LDLT<MatrixXd> CholFact;
+    /// Difference between target values and trend predictions.
+    VectorXd trendTargetResidual;
+    /// Cholesky solve for Gram matrix with trendTargetResidual rhs.
+    VectorXd GramResidualSolution;
+
+    /// Free the Gram matrix storage, keeping the hyperparameters.
+    void release_matrices() {
+      GramMatrix.resize(0, 0);
+      GramMatrixDerivs.clear();
+      CholFact = Eigen::LDLT<MatrixXd>();
+      trendTargetResidual.resize(0);
+      GramResidualSolution.resize(0);
+    }
+  };
+
   /* Constructors and destructors */
 
   /// Constructor that uses defaultConfigOptions and does not build.
@@ -184,6 +228,21 @@ class GaussianProcess : public Surrogate {
                                         double& obj_value,
                                         VectorXd& obj_gradient);
 
+  /**
+   *  \brief Evaluate the negative marginal loglikelihood and its
+   *  gradient for the hyperparameters in a workspace. Concurrent calls
+   *  with distinct workspaces are safe.
+   *  \param[in] compute_grad Flag for computation of gradient.
+   *  \param[in] compute_gram Flag for various Gram matrix calculations.
+   *  \param[out] obj_value Value of the objection function.
+   *  \param[out] obj_gradient Gradient of the objective function.
+   *  \param[inout] workspace Hyperparameters and scratch data.
+   */
+  void negative_marginal_log_likelihood(bool compute_grad, bool compute_gram,
+                                        double& obj_value,
+                                        VectorXd& obj_gradient,
+                                        MLEWorkspace& workspace) const;
+
   /**
    *  \brief Initialize the hyperparameter bounds for MLE from
    *  values in configOptions.
@@ -204,7 +263,7 @@ class GaussianProcess : public Surrogate {
    *  \returns Number of total optimization variables (hyperparameters + trend
    * coefficients + nugget)
    */
-  int get_num_opt_variables();
+  int get_num_opt_variables() const;
 
   /**
    *  \brief Get the dimension of the feature space.
@@ -240,10 +299,33 @@ class GaussianProcess : public Surrogate {
    */
   void set_opt_params(const VectorXd& opt_params);
 
+  /**
+   *  \brief Update the optimization parameters in a workspace.
+   *  \param[in] opt_params Vector of optimization parameter values.
+   *  \param[inout] workspace Workspace holding the parameters.
+   */
+  void set_opt_params(const VectorXd& opt_params,
+                      MLEWorkspace& workspace) const;
+
   std::shared_ptr<Surrogate> clone() const override {
     return std::make_shared<GaussianProcess>(configOptions);
   }
 
+  /**
+   * \brief Build on all samples and, if the "closed-form leave-one-out"
+   * option is set, compute the leave-one-out predictions from the inverse
+   * Gram matrix, y_i - [K^{-1} r]_i / [K^{-1}]_ii, with the hyperparameters
+   * (and trend coefficients) of the full build held fixed.
+   * \param[in] samples Matrix of build samples - (num_samples by
+   * num_features).
+   * \param[in] response Matrix of build responses - (num_samples by 1).
+   * \param[out] loo_values Leave-one-out predictions - (num_samples).
+   * \returns False if the option is not set, in which case each fold
+   * re-estimates the hyperparameters.
+   */
+  bool leave_one_out_values(const MatrixXd& samples, const MatrixXd& response,
+                            VectorXd& loo_values) override;
+
  private:
   /* Private utility functions */
 
@@ -257,20 +339,66 @@ class GaussianProcess : public Surrogate {
    *  \brief Compute distances between build and prediction points. This
    * includes build-prediction and prediction-prediction distance matrices.
    *  \param[in] scaled_pred_pts Matrix of scaled prediction points.
+   *  \param[in] compute_pred_pred Bool for whether or not to compute the
+   *  prediction-prediction distance matrices.
+   */
+  void compute_pred_dists(const MatrixXd& scaled_pred_pts,
+                          bool compute_pred_pred = true);
+
+  /**
+   *  \brief Decide whether to use the matrix-free mode from the
+   *  configOptions and the memory required for the stored distances.
+   *  \returns Bool for the matrix-free mode.
+   */
+  bool use_matrix_free() const;
+
+  /// Compute the Gram matrix for the build points, including nugget
+  /// terms, from the stored distances or matrix-free.
+  void compute_build_gram();
+
+  /**
+   *  \brief Compute the Gram matrix for the build points, including
+   *  nugget terms, for the hyperparameters in a workspace.
+   *  \param[in] compute_derivs Bool for whether or not to compute the
+   *  stored derivatives of the Gram matrix (ignored when matrix-free).
+   *  \param[inout] workspace Hyperparameters and Gram matrix storage.
+   */
+  void compute_build_gram(bool compute_derivs, MLEWorkspace& workspace) const;
+
+  /**
+   *  \brief Number of threads for the concurrent MLE restarts, limited by
+   *  the number of restarts and the memory threshold for workspaces.
+   *  \param[in] num_restarts Number of restarts.
+   *  \returns Number of threads.
+   */
+  int num_mle_threads(int num_restarts) const;
+
+  /**
+   *  \brief Compute the Gram matrix between prediction and build points.
+   *  \param[in] scaled_pred_pts Matrix of scaled prediction points.
+   *  \param[in] need_mixed_dists Bool for whether the component-wise
+   *  prediction-build distances are needed, e.g. for derivatives.
+   */
+  void compute_pred_mixed_gram(const MatrixXd& scaled_pred_pts,
+                               bool need_mixed_dists);
+
+  /**
+   *  \brief Add the fixed and estimated nugget terms to the diagonal
+   *  of a Gram matrix.
+   *  \param[in] estimated_nugget Log-space estimated nugget value.
+   *  \param[inout] gram Gram matrix.
    */
-  void compute_pred_dists(const MatrixXd& scaled_pred_pts);
+  void add_nugget_terms(double estimated_nugget, MatrixXd& gram) const;
 
   /**
    *  \brief Compute a Gram matrix given a vector of squared distances and
-   *  optionally compute its derivatives and/or adds nugget terms.
+   *  optionally adds nugget terms.
    *  \param[in] dists2 Vector of squared distance matrices.
    *  \param[in] add_nugget Bool for whether or add nugget terms.
-   *  \param[in] compute_derivs Bool for whether or not to compute the
-   *  derivatives of the Gram matrix.
    *  \param[out] gram Gram matrix.
    */
   void compute_gram(const std::vector<MatrixXd>& dists2, bool add_nugget,
-                    bool compute_derivs, MatrixXd& gram);
+                    MatrixXd& gram);
 
   /**
    *  \brief Randomly generate initial guesses for the optimization routine.
@@ -343,14 +471,9 @@ class GaussianProcess : public Surrogate {
   /// Gram matrix for the build points
   MatrixXd GramMatrix;
 
-  /// Difference between target values and trend predictions.
-  VectorXd trendTargetResidual;
-
-  /// Cholesky solve for Gram matrix with trendTargetResidual rhs.
-  VectorXd GramResidualSolution;
-
-  /// Derivatives of the Gram matrix w.r.t. the hyperparameters.
-  std::vector<MatrixXd> GramMatrixDerivs;
+  /// MLE workspace for the member hyperparameters, used by the
+  /// workspace-free negative_marginal_log_likelihood().
+  MLEWorkspace mleWorkspace;
 
   /// Squared component-wise distances between points in the surrogate dataset.
   std::vector<MatrixXd> cwiseDists2;
@@ -364,6 +487,10 @@ class GaussianProcess : public Surrogate {
   /// Component-wise distances between prediction points.
   std::vector<MatrixXd> cwisePredDists2;
 
+  /// Bool for the matrix-free mode, in which cwiseDists2, cwisePredDists2
+  /// and the Gram matrix derivatives are not stored.
+  bool matrixFree = false;
+
   /// Pivoted Cholesky factorization.
   Eigen::LDLT<MatrixXd> CholFact;
 
@@ -426,8 +553,6 @@ class GaussianProcess : public Surrogate {
 
 template <class Archive>
 void GaussianProcess::serialize(Archive& archive, const unsigned int version) {
-  silence_unused_args(version);
-
   archive& boost::serialization::base_object<Surrogate>(*this);
 
   // BMA: Initial cut is aggressive, serializing most members
@@ -449,6 +574,12 @@ void GaussianProcess::serialize(Archive& archive, const unsigned int version) {
   if (Archive::is_loading::value) {
     kernel = kernel_factory(kernel_type);
   }
+  // version 1 adds the matrix-free mode; earlier models store the
+  // component-wise distances and so were built without it
+  if (version > 0)
+    archive& matrixFree;
+  else if (Archive::is_loading::value)
+    matrixFree = false;
   // BMA TODO: leaving this as shared_ptr pending discussion as it seems natural
   // BMA NOTE: If serializing through shared_ptr, wouldn't have to
   // trap the nullptr case here...
@@ -469,5 +600,6 @@ void GaussianProcess::serialize(Archive& archive, const unsigned int version) {
 }  // namespace dakota
 
 BOOST_CLASS_EXPORT_KEY(dakota::surrogates::GaussianProcess)
+BOOST_CLASS_VERSION(dakota::surrogates::GaussianProcess, 1)
 
 #endif  // include guard
@@ -86,10 +86,10 @@ void PolynomialRegression::build(const MatrixXd& samples,
 
   if (verbosity > 0) {
     if (verbosity == 1) {
-      std::cout << "\nBuilding Polynomial\n\n";
+      *consoleStream << "\nBuilding Polynomial\n\n";
     } else if (verbosity == 2) {
-      std::cout << "\nBuilding Polynomial with configuration options\n"
-                << configOptions << "\n";
+      *consoleStream << "\nBuilding Polynomial with configuration options\n"
+                     << configOptions << "\n";
     } else
       throw(
           std::runtime_error("Invalid verbosity int for Polynomial surrogate"));
@@ -165,6 +165,39 @@ VectorXd PolynomialRegression::value(const MatrixXd& eval_points) {
   return approx_values;
 }
 
+bool PolynomialRegression::leave_one_out_values(const MatrixXd& samples,
+                                                const MatrixXd& response,
+                                                VectorXd& loo_values) {
+  /* the sparse solvers do not compute a least-squares projection */
+  configOptions.validateParametersAndSetDefaults(defaultConfigOptions);
+  SOLVER_TYPE solver_type = util::LinearSolverBase::solver_type(
+      configOptions.get<std::string>("regression solver type"));
+  if (solver_type != SOLVER_TYPE::SVD_LEAST_SQ_REGRESSION &&
+      solver_type != SOLVER_TYPE::QR_LEAST_SQ_REGRESSION)
+    return false;
+
+  build(samples, response);
+
+  /* The fit is the least-squares projection onto the span of the basis and
+     the intercept (the data scalings are affine in each column), so the
+     leverages are the squared row norms of an orthonormal basis for
+     [1, basis]. */
+  MatrixXd basis_matrix, design_matrix(numSamples, numTerms + 1);
+  compute_basis_matrix(samples, basis_matrix);
+  design_matrix << VectorXd::Ones(numSamples), basis_matrix;
+  Eigen::ColPivHouseholderQR<MatrixXd> qr(design_matrix);
+  const int rank = qr.rank();
+  const MatrixXd q_thin =
+      qr.householderQ() * MatrixXd::Identity(numSamples, rank);
+  const VectorXd leverages = q_thin.rowwise().squaredNorm();
+  if (leverages.maxCoeff() > 1.0 - 1.0e-8) return false;
+
+  const VectorXd residuals = response.col(0) - value(samples);
+  loo_values = response.col(0) -
+               residuals.cwiseQuotient((1.0 - leverages.array()).matrix());
+  return true;
+}
+
 void PolynomialRegression::default_options() {
   defaultConfigOptions.set("reduced basis", false, "Use reduced basis");
   defaultConfigOptions.set("max degree", 1, "Maximum polynomial order");
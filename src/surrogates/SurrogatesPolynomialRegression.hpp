@@ -149,6 +149,20 @@ class PolynomialRegression : public Surrogate {
     return std::make_shared<PolynomialRegression>(configOptions);
   }
 
+  /**
+   * \brief Build on all samples and compute the leave-one-out predictions
+   * from the leverages h_ii of the least-squares hat matrix, using the
+   * exact identity e_(-i) = e_i / (1 - h_ii).
+   * \param[in] samples Matrix of build samples - (num_samples by
+   * num_features).
+   * \param[in] response Matrix of build responses - (num_samples by 1).
+   * \param[out] loo_values Leave-one-out predictions - (num_samples).
+   * \returns False for the sparse regression solvers, or if a sample has
+   * unit leverage, i.e., the fit without it is not unique.
+   */
+  bool leave_one_out_values(const MatrixXd& samples, const MatrixXd& response,
+                            VectorXd& loo_values) override;
+
  private:
   /// Construct and populate the defaultConfigOptions.
   void default_options() override;
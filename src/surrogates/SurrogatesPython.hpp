@@ -113,6 +113,9 @@ class Python : public Surrogate {
     return std::make_shared<Python>(moduleAndClassName);
   }
 
+  /// Python callbacks require the interpreter lock, so builds are serial
+  bool concurrent_builds_supported() const override { return false; }
+
  private:
 
   // --------------- Python Setup --------------------
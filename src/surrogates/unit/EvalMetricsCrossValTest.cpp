@@ -13,6 +13,7 @@
 #include "SurrogatesPolynomialRegression.hpp"
 
 #include <gtest/gtest.h>
+#include <sstream>
 
 using namespace dakota;
 using namespace dakota::util;
@@ -163,6 +164,95 @@ TEST(EvalMetricsCrossValTest_tests, test_surrogates_cross_validate) {
 #endif
 }
 
+TEST(EvalMetricsCrossValTest_tests, test_surrogates_cross_validate_fast_paths) {
+  /* True function = 0.4*x**2 + x, plus noise */
+  VectorXd build_pts(14);
+  VectorXd target(14);
+
+  build_pts << 0.37454012, 0.95071431, 0.73199394, 0.59865848, 0.15601864,
+      0.15599452, 0.05808361, 0.86617615, 0.60111501, 0.70807258, 0.02058449,
+      0.96990985, 0.83244264, 0.21233911;
+
+  target << 0.38431047, 1.26568441, 0.97051622, 0.55068725, -0.00673642,
+      0.10949948, -0.04185002, 1.19770533, 0.65484831, 0.76738892, 0.16731886,
+      1.32362227, 1.11637976, 0.08789945;
+
+  const int num_samples = build_pts.size();
+  StringArray metrics_names = {"mean_squared", "mean_abs"};
+
+  ParameterList quad_poly_pl("Quadratic Test Parameters");
+  quad_poly_pl.set("max degree", 2);
+  PolynomialRegression quad_poly(quad_poly_pl);
+
+  /* Concurrent folds match serial folds exactly, and their console output
+     is emitted in fold order */
+  std::ostringstream serial_console, threaded_console;
+  quad_poly.console_stream(serial_console);
+  VectorXd serial_cv =
+      quad_poly.cross_validate(build_pts, target, metrics_names, 4, 33, 1);
+  quad_poly.console_stream(threaded_console);
+  VectorXd threaded_cv =
+      quad_poly.cross_validate(build_pts, target, metrics_names, 4, 33, 3);
+  quad_poly.console_stream(std::cout);
+  EXPECT_EQ(serial_cv, threaded_cv);
+  EXPECT_FALSE(serial_console.str().empty());
+  EXPECT_EQ(serial_console.str(), threaded_console.str());
+
+  /* Leave-one-out via the hat matrix matches refitting without each sample */
+  VectorXd loo_cv = quad_poly.cross_validate(build_pts, target, metrics_names,
+                                             num_samples, 33);
+
+  VectorXd refit_cv = VectorXd::Zero(metrics_names.size());
+  PolynomialRegression refit_poly(quad_poly_pl);
+  MatrixXd train_pts(num_samples - 1, 1), train_target(num_samples - 1, 1);
+  MatrixXd val_pt(1, 1), val_target(1, 1);
+  for (int i = 0; i < num_samples; i++) {
+    for (int j = 0, k = 0; j < num_samples; j++) {
+      if (j == i) continue;
+      train_pts(k, 0) = build_pts(j);
+      train_target(k++, 0) = target(j);
+    }
+    val_pt(0, 0) = build_pts(i);
+    val_target(0, 0) = target(i);
+    refit_poly.build(train_pts, train_target);
+    refit_cv += refit_poly.evaluate_metrics(metrics_names, val_pt, val_target);
+  }
+  refit_cv /= double(num_samples);
+
+  std::cout << "\nquadratic polynomial leave-one-out scores: "
+            << loo_cv.transpose() << "\n";
+  EXPECT_TRUE(((loo_cv - refit_cv).norm() < 1.0e-10));
+
+#ifdef HAVE_ROL
+  /* Closed-form GP leave-one-out matches refitting on each fold when the
+     hyperparameters are pinned by the bounds and there is no trend or
+     response standardization to re-estimate */
+  ParameterList gp_opts;
+  gp_opts.set("scaler name", "none");
+  gp_opts.set("standardize response", false);
+  gp_opts.set("num restarts", 2);
+  gp_opts.sublist("Sigma Bounds").set("lower bound", 1.0);
+  gp_opts.sublist("Sigma Bounds").set("upper bound", 1.0 + 1.0e-12);
+  gp_opts.sublist("Length-scale Bounds").set("lower bound", 0.3);
+  gp_opts.sublist("Length-scale Bounds").set("upper bound", 0.3 + 1.0e-12);
+  gp_opts.sublist("Nugget").set("fixed nugget", 1.0e-8);
+  gp_opts.set("closed-form leave-one-out", true);
+  GaussianProcess gp_cv(gp_opts);
+
+  VectorXd gp_loo_cv = gp_cv.cross_validate(build_pts, target, metrics_names,
+                                            num_samples, 33);
+
+  gp_opts.set("closed-form leave-one-out", false);
+  GaussianProcess gp_refit_cv(gp_opts);
+  VectorXd gp_refit_loo_cv = gp_refit_cv.cross_validate(
+      build_pts, target, metrics_names, num_samples, 33);
+
+  std::cout << "\nGaussian process leave-one-out scores: "
+            << gp_loo_cv.transpose() << "\n\n";
+  EXPECT_TRUE(((gp_loo_cv - gp_refit_loo_cv).norm() < 1.0e-6));
+#endif
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -872,6 +872,99 @@ TEST(GaussianProcessTest_tests, test_surrogates_matern_52_gp) {
   }
 }
 
+TEST(GaussianProcessTest_tests, test_surrogates_matrix_free_gp) {
+  MatrixXd samples, eval_pts, length_scale_bounds;
+  VectorXd response, sigma_bounds;
+
+  /* build and eval data */
+  get_2D_gp_test_data(samples, response, eval_pts);
+  get_gp_hyperparameter_bounds(2, sigma_bounds, length_scale_bounds);
+
+  /* relative tolerance for floating point comparisons */
+  const double rel_float_tol = 1.0e-4;
+
+  /* the matrix-free mode only reorders the floating point operations, so
+     both modes should reach the same optimum for each kernel */
+  for (const std::string kernel_type :
+       {"squared exponential", "Matern 3/2", "Matern 5/2"}) {
+    ParameterList param_list =
+        get_gp_config_options(sigma_bounds, length_scale_bounds);
+    param_list.set("kernel type", kernel_type);
+    param_list.set("num restarts", 5);
+    param_list.sublist("Trend").set("estimate trend", true);
+
+    MatrixXd cov_stored, cov_free, grad_stored, grad_free;
+    VectorXd mean_stored, mean_free, std_dev_stored, std_dev_free;
+
+    GaussianProcess gp_stored(param_list);
+    gp_stored.build(samples, response);
+    get_gp_test_arrays(gp_stored, eval_pts, mean_stored, std_dev_stored,
+                       cov_stored);
+    grad_stored = gp_stored.gradient(eval_pts);
+
+    param_list.set("matrix free", true);
+    GaussianProcess gp_free(param_list);
+    gp_free.build(samples, response);
+    get_gp_test_arrays(gp_free, eval_pts, mean_free, std_dev_free, cov_free);
+    grad_free = gp_free.gradient(eval_pts);
+
+    EXPECT_TRUE(relative_allclose(gp_free.get_objective_function_history(),
+                                  gp_stored.get_objective_function_history(),
+                                  rel_float_tol));
+    EXPECT_TRUE(relative_allclose(mean_free, mean_stored, rel_float_tol));
+    EXPECT_TRUE(
+        relative_allclose(std_dev_free, std_dev_stored, 100 * rel_float_tol));
+    EXPECT_TRUE(relative_allclose(cov_free, cov_stored, 100 * rel_float_tol));
+    EXPECT_TRUE(relative_allclose(grad_free, grad_stored, rel_float_tol));
+  }
+
+  /* a memory threshold below the stored distance footprint selects the
+     matrix-free mode automatically */
+  ParameterList param_list =
+      get_gp_config_options(sigma_bounds, length_scale_bounds);
+  param_list.set("num restarts", 5);
+  VectorXd mean_stored, mean_auto;
+  GaussianProcess gp_stored(param_list);
+  gp_stored.build(samples, response);
+  mean_stored = gp_stored.value(eval_pts);
+
+  param_list.set("matrix free memory threshold", 0.0);
+  GaussianProcess gp_auto(param_list);
+  gp_auto.build(samples, response);
+  mean_auto = gp_auto.value(eval_pts);
+  EXPECT_TRUE(relative_allclose(mean_auto, mean_stored, rel_float_tol));
+}
+
+TEST(GaussianProcessTest_tests, test_surrogates_gp_concurrent_restarts) {
+  MatrixXd samples, eval_pts, length_scale_bounds;
+  VectorXd response, sigma_bounds;
+
+  /* build and eval data */
+  get_2D_gp_test_data(samples, response, eval_pts);
+  get_gp_hyperparameter_bounds(2, sigma_bounds, length_scale_bounds);
+
+  ParameterList param_list =
+      get_gp_config_options(sigma_bounds, length_scale_bounds);
+  param_list.set("num restarts", 8);
+  param_list.sublist("Trend").set("estimate trend", true);
+
+  /* restarts are independent and reduced in order, so the results must
+     be identical for any number of threads */
+  param_list.set("num threads", 1);
+  GaussianProcess gp_serial(param_list);
+  gp_serial.build(samples, response);
+
+  param_list.set("num threads", 4);
+  GaussianProcess gp_threaded(param_list);
+  gp_threaded.build(samples, response);
+
+  EXPECT_TRUE((gp_threaded.get_objective_function_history() ==
+               gp_serial.get_objective_function_history()));
+  EXPECT_TRUE(
+      (gp_threaded.get_theta_history() == gp_serial.get_theta_history()));
+  EXPECT_TRUE((gp_threaded.value(eval_pts) == gp_serial.value(eval_pts)));
+}
+
 #ifndef DISABLE_YAML_SURROGATES_CONFIG
 TEST(GaussianProcessTest_tests, test_surrogates_gp_read_from_parameterlist) {
   std::string test_parameterlist_file =
@@ -0,0 +1,242 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+#include "DirectApplicInterface.hpp"
+#include "DakotaResponse.hpp"
+#include "DakotaVariables.hpp"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace Dakota;
+
+namespace Dakota {
+  extern PRPCache data_pairs;
+}
+
+namespace {
+
+  // one observation y of the model f(x) = x with error variance sigma^2,
+  // and a uniform prior on [-1, 1]
+  const Real obs_y = 0.3, obs_var = 0.04;
+  // inverse gamma hyperprior on the error multiplier
+  const Real hyper_alpha = 4., hyper_beta = 3.;
+
+  /// standard normal cumulative distribution function
+  Real std_normal_cdf(Real z)
+  { return 0.5 * std::erfc(-z / std::sqrt(2.)); }
+
+  /// evidence for the prior on x, given error multiplier s
+  Real evidence_given_multiplier(Real s)
+  {
+    Real sigma = std::sqrt(s * obs_var);
+    return 0.5 * (std_normal_cdf(( 1. - obs_y) / sigma) -
+		  std_normal_cdf((-1. - obs_y) / sigma));
+  }
+
+  /// exact log evidence, integrating over the error multiplier by the
+  /// trapezoid rule in log(s) if it is calibrated
+  Real exact_log_evidence(bool calibrate_multiplier)
+  {
+    if (!calibrate_multiplier)
+      return std::log(evidence_given_multiplier(1.));
+
+    const int num_pts = 20000;
+    const Real log_s_min = std::log(1.e-6), log_s_max = std::log(1.e6),
+      h = (log_s_max - log_s_min) / num_pts;
+    Real evidence = 0.;
+    for (int k=0; k<=num_pts; ++k) {
+      Real log_s = log_s_min + k * h, s = std::exp(log_s),
+	log_ig = hyper_alpha * std::log(hyper_beta) - std::lgamma(hyper_alpha)
+	  - (hyper_alpha + 1.) * log_s - hyper_beta / s,
+	// ds = s dlog(s)
+	term = std::exp(log_ig + log_s) * evidence_given_multiplier(s);
+      evidence += (k == 0 || k == num_pts) ? 0.5 * term : term;
+    }
+    return std::log(evidence * h);
+  }
+
+  /// Library-mode direct interface for f(x) = x, whose derived_map()
+  /// is thread safe so that it supports asynchronous local evaluations
+  class LinearInterface: public DirectApplicInterface
+  {
+  public:
+
+    LinearInterface(const ProblemDescDB& problem_db,
+		    ParallelLibrary& parallel_lib):
+      DirectApplicInterface(problem_db, parallel_lib)
+    { }
+
+    ~LinearInterface() override { }
+
+    void derived_map(const Variables& vars, const ActiveSet& set,
+		     Response& response, int fn_eval_id) override
+    {
+      if (set.request_vector()[0] & 1)
+	response.function_value(vars.continuous_variable(0), 0);
+    }
+
+  protected:
+
+    bool thread_safe_evaluations() const override { return true; }
+  };
+
+  /// redirects std::cout, to which Cout refers, for the lifetime of
+  /// this object
+  class CoutCapture
+  {
+  public:
+    CoutCapture(): coutBuf(std::cout.rdbuf(captured.rdbuf())) { }
+    ~CoutCapture() { std::cout.rdbuf(coutBuf); }
+    std::string str() const { return captured.str(); }
+  private:
+    std::ostringstream captured;
+    std::streambuf* coutBuf;
+  };
+
+
+  /// Dakota input: DREAM calibration of f(x) = x followed by the
+  /// requested model evidence estimate
+  std::string evidence_input(const std::string& evidence_spec,
+			     bool calibrate_multiplier, bool asynch,
+			     const std::string& data_file)
+  {
+    std::string input =
+      "method \n"
+      "  bayes_calibration dream \n"
+      "    chain_samples 3000 \n"
+      "    seed 4937 \n"
+      "    model_evidence " + evidence_spec + " \n"
+      "      evidence_samples 20000 \n";
+    if (calibrate_multiplier)
+      input +=
+	"    calibrate_error_multipliers one \n"
+	"      hyperprior_parameters \n"
+	"        alphas 4. \n"
+	"        betas 3. \n";
+    input +=
+      "variables \n"
+      "  uniform_uncertain 1 \n"
+      "    lower_bounds -1. \n"
+      "    upper_bounds  1. \n"
+      "interface \n"
+      "  direct \n"
+      "    analysis_driver 'linear_model' \n";
+    if (asynch)
+      input +=
+	"  asynchronous \n"
+	"    evaluation_concurrency 4 \n";
+    input +=
+      "responses \n"
+      "  calibration_terms 1 \n"
+      "  calibration_data_file '" + data_file + "' \n"
+      "    freeform \n"
+      "    num_experiments 1 \n"
+      "    variance_type 'scalar' \n"
+      "  no_gradients \n"
+      "  no_hessians \n";
+    return input;
+  }
+
+  /// Run the calibration and return the log evidence printed for label,
+  /// e.g., "Monte Carlo"
+  void run_log_evidence(const std::string& evidence_spec,
+			bool calibrate_multiplier, bool asynch,
+			const std::string& label, Real& log_evidence)
+  {
+    std::string data_file("bayes_evidence_test.dat");
+    {
+      std::ofstream data(data_file);
+      data << obs_y << ' ' << obs_var << '\n';
+    }
+
+    std::shared_ptr<LibraryEnvironment> p_env(Opt_TPL_Test::create_env(
+      evidence_input(evidence_spec, calibrate_multiplier, asynch, data_file)));
+    ProblemDescDB& problem_db = p_env->problem_description_db();
+    ParallelLibrary& parallel_lib = p_env->parallel_library();
+    std::shared_ptr<Interface> linear_iface
+      = std::make_shared<LinearInterface>(problem_db, parallel_lib);
+    ASSERT_TRUE(p_env->plugin_interface("", "direct", "linear_model",
+					linear_iface));
+    if (parallel_lib.mpirun_flag())
+      FAIL(); // This test only works for serial builds
+
+    // the evidence estimates are reported on Cout
+    std::string output_str;
+    {
+      CoutCapture capture;
+      p_env->execute();
+      output_str = capture.str();
+    }
+    std::filesystem::remove(data_file);
+    data_pairs.clear();
+
+    ModelList models = p_env->filtered_model_list("simulation", "", "");
+    ASSERT_FALSE(models.empty());
+    EXPECT_EQ(asynch, models.front()->asynch_flag());
+
+    std::string key = "Log model evidence (" + label + ") = ", line;
+    std::istringstream output(output_str);
+    bool found = false;
+    while (std::getline(output, line))
+      if (line.compare(0, key.size(), key) == 0)
+	{ log_evidence = std::stod(line.substr(key.size())); found = true; }
+    ASSERT_TRUE(found) << "no \"" << key << "\" in output";
+  }
+
+}
+
+
+TEST(bayes_evidence_tests, test_mc_evidence)
+{
+  Real log_evidence;
+  run_log_evidence("mc_approx", false, false, "Monte Carlo", log_evidence);
+  EXPECT_NEAR(exact_log_evidence(false), log_evidence, 0.05);
+}
+
+
+TEST(bayes_evidence_tests, test_mc_evidence_asynch)
+{
+  Real log_evidence;
+  run_log_evidence("mc_approx", false, true, "Monte Carlo", log_evidence);
+  EXPECT_NEAR(exact_log_evidence(false), log_evidence, 0.05);
+}
+
+
+TEST(bayes_evidence_tests, test_is_evidence)
+{
+  Real log_evidence;
+  run_log_evidence("is_approx", false, false, "importance sampling",
+		   log_evidence);
+  EXPECT_NEAR(exact_log_evidence(false), log_evidence, 0.03);
+}
+
+
+TEST(bayes_evidence_tests, test_mc_evidence_hyperparameter)
+{
+  Real log_evidence;
+  run_log_evidence("mc_approx", true, true, "Monte Carlo", log_evidence);
+  EXPECT_NEAR(exact_log_evidence(true), log_evidence, 0.05);
+}
+
+
+TEST(bayes_evidence_tests, test_is_evidence_hyperparameter)
+{
+  Real log_evidence;
+  run_log_evidence("is_approx", true, false, "importance sampling",
+		   log_evidence);
+  EXPECT_NEAR(exact_log_evidence(true), log_evidence, 0.03);
+}
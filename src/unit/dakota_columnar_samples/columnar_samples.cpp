@@ -0,0 +1,236 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "ColumnarSampleStore.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <set>
+
+using namespace Dakota;
+
+namespace {
+
+constexpr unsigned TEST_RNG_SEED = 20240817u;
+
+/// Append num_samples samples of two functions to each of the stores: a
+/// standard normal with every 100th sample failed (NaN) and its
+/// exponential; the normal samples are returned
+RealArray fill_stores(size_t num_samples, ColumnarSampleStore& stored,
+		      ColumnarSampleStore& sketched)
+{
+  std::mt19937 rng(TEST_RNG_SEED);
+  std::normal_distribution<Real> normal;
+  RealArray values;
+  RealVector fn_vals(2);
+  for (size_t s=0; s<num_samples; ++s) {
+    Real z = normal(rng);
+    values.push_back(z);
+    fn_vals[0] = (s % 100 == 0) ? std::numeric_limits<Real>::quiet_NaN() : z;
+    fn_vals[1] = std::exp(z);
+    stored.append(fn_vals);
+    sketched.append(fn_vals);
+  }
+  return values;
+}
+
+}
+
+//------------------------------------
+
+TEST(columnar_samples_tests, test_sums_and_extremes)
+{
+  const size_t num_samples = 200000; // more than one reduction chunk
+  ColumnarSampleStore stored, sketched;
+  stored.initialize(2);  sketched.initialize(2, 200);
+  const RealArray values = fill_stores(num_samples, stored, sketched);
+
+  EXPECT_EQ(num_samples, stored.num_samples());
+  EXPECT_EQ(num_samples - num_samples/100, stored.num_valid(0));
+  EXPECT_EQ(num_samples, stored.num_valid(1));
+  EXPECT_FALSE(stored.valid(0)[0]);
+  EXPECT_TRUE(sketched.sketched());
+  EXPECT_TRUE(sketched.column(0).empty());
+
+  // two-pass reference over the valid samples of function 0
+  Real n = 0., mean = 0., min = DBL_MAX, max = -DBL_MAX;
+  for (size_t s=0; s<num_samples; ++s)
+    if (s % 100) {
+      n += 1.;  mean += values[s];
+      min = std::min(min, values[s]);  max = std::max(max, values[s]);
+    }
+  mean /= n;
+  Real m2 = 0., m3 = 0., m4 = 0.;
+  for (size_t s=0; s<num_samples; ++s)
+    if (s % 100) {
+      Real dev = values[s] - mean;
+      m2 += dev*dev;  m3 += dev*dev*dev;  m4 += dev*dev*dev*dev;
+    }
+
+  RealMatrix stored_sums, sketched_sums;
+  stored.central_sums(stored_sums);  sketched.central_sums(sketched_sums);
+  const Real ref[5] = { n, mean, m2, m3, m4 };
+  for (int k=0; k<5; ++k) {
+    EXPECT_NEAR(ref[k], stored_sums(k,0),   1.e-9 * std::abs(ref[k]) + 1.e-9);
+    EXPECT_NEAR(ref[k], sketched_sums(k,0), 1.e-9 * std::abs(ref[k]) + 1.e-9);
+  }
+
+  Real s_min, s_max;
+  stored.extremes(0, s_min, s_max);
+  EXPECT_EQ(min, s_min);  EXPECT_EQ(max, s_max);
+  sketched.extremes(0, s_min, s_max);
+  EXPECT_EQ(min, s_min);  EXPECT_EQ(max, s_max);
+
+  // results do not depend on the number of threads
+  setenv("DAKOTA_SAMPLING_THREADS", "1", 1);
+  RealMatrix serial_sums;
+  stored.central_sums(serial_sums);
+  unsetenv("DAKOTA_SAMPLING_THREADS");
+  for (int k=0; k<5; ++k)
+    EXPECT_EQ(stored_sums(k,1), serial_sums(k,1));
+}
+
+
+TEST(columnar_samples_tests, test_level_counts)
+{
+  ColumnarSampleStore store;
+  store.initialize(1);
+  const Real samples[] = { 3., -1., 0.5, std::numeric_limits<Real>::quiet_NaN(),
+			   2., 0.5, 7., -4. };
+  RealVector fn_val(1);
+  for (Real s : samples)
+    { fn_val[0] = s;  store.append(fn_val); }
+
+  // a sample falls in the first bin whose level it does not exceed, so
+  // the unordered level -2 collects nothing
+  RealVector levels(4);
+  levels[0] = 0.5;  levels[1] = -2.;  levels[2] = 2.;  levels[3] = 5.;
+  SizetArray bins;
+  store.count_levels(0, levels, bins);
+  ASSERT_EQ(5, bins.size());
+  EXPECT_EQ(4, bins[0]); // -4, -1, 0.5, 0.5
+  EXPECT_EQ(0, bins[1]);
+  EXPECT_EQ(1, bins[2]); // 2
+  EXPECT_EQ(1, bins[3]); // 3
+  EXPECT_EQ(1, bins[4]); // 7
+
+  SizetArray ranks = { 6, 0, 4, 2, 10 };
+  RealArray values;
+  store.order_statistics(0, ranks, values);
+  ASSERT_EQ(5, values.size());
+  EXPECT_EQ(7.,  values[0]);
+  EXPECT_EQ(-4., values[1]);
+  EXPECT_EQ(2.,  values[2]);
+  EXPECT_EQ(0.5, values[3]);
+  EXPECT_EQ(7.,  values[4]); // ranks beyond the valid samples are clamped
+}
+
+
+TEST(columnar_samples_tests, test_sketch_ranks)
+{
+  const size_t num_samples = 200000, sketch_size = 400;
+  ColumnarSampleStore stored, sketched;
+  stored.initialize(2);  sketched.initialize(2, sketch_size);
+  RealArray values = fill_stores(num_samples, stored, sketched);
+  RealArray sorted;
+  for (size_t s=0; s<num_samples; ++s)
+    if (s % 100) sorted.push_back(values[s]);
+  std::sort(sorted.begin(), sorted.end());
+  const size_t num_valid = sorted.size();
+
+  SizetArray ranks;
+  for (size_t q=0; q<=100; ++q)
+    ranks.push_back(std::min(num_valid - 1, q * num_valid / 100));
+  RealArray exact, approx;
+  stored.order_statistics(0, ranks, exact);
+  sketched.order_statistics(0, ranks, approx);
+  for (size_t i=0; i<ranks.size(); ++i) {
+    EXPECT_EQ(sorted[ranks[i]], exact[i]);
+    // rank of the approximate value within the sorted samples
+    Real rank_err = std::abs((Real)(std::lower_bound(sorted.begin(),
+      sorted.end(), approx[i]) - sorted.begin()) - (Real)ranks[i]);
+    EXPECT_LT(rank_err, 0.02 * num_valid) << "rank " << ranks[i];
+  }
+  EXPECT_EQ(sorted.front(), approx.front());
+  EXPECT_EQ(sorted.back(),  approx.back());
+  EXPECT_LT(5 * sketch_size, num_valid);
+
+  // sketch level counts sum to the number of valid samples
+  RealVector levels(3);
+  levels[0] = -1.;  levels[1] = 0.;  levels[2] = 1.;
+  SizetArray exact_bins, approx_bins;
+  stored.count_levels(0, levels, exact_bins);
+  sketched.count_levels(0, levels, approx_bins);
+  size_t total = 0;
+  for (size_t k=0; k<=3; ++k) {
+    total += approx_bins[k];
+    EXPECT_NEAR((Real)exact_bins[k], (Real)approx_bins[k], 0.02 * num_valid);
+  }
+  EXPECT_EQ(num_valid, total);
+}
+
+
+/// Level mapping benchmark: a multiset sort of each function (the former
+/// NonDSampling approach) against columnar level counts and selection of
+/// order statistics.  The number of samples may be set through the
+/// DAKOTA_COLUMNAR_BENCH_SAMPLES environment variable.
+TEST(columnar_samples_tests, benchmark_level_mappings)
+{
+  size_t num_samples = 1000000;
+  if (const char* env_samples = std::getenv("DAKOTA_COLUMNAR_BENCH_SAMPLES"))
+    num_samples = std::strtoul(env_samples, nullptr, 10);
+
+  ColumnarSampleStore stored, sketched;
+  stored.initialize(2);  sketched.initialize(2, 200);
+  const RealArray values = fill_stores(num_samples, stored, sketched);
+  RealVector levels(3);
+  levels[0] = -1.;  levels[1] = 0.;  levels[2] = 1.;
+  SizetArray ranks = { num_samples / 20, num_samples / 2, 19*num_samples / 20 };
+
+  auto t0 = std::chrono::steady_clock::now();
+  std::multiset<Real> sorted;
+  for (size_t s=0; s<num_samples; ++s)
+    if (s % 100)
+      sorted.insert(values[s]);
+  SizetArray ms_bins(4, 0);
+  auto it = sorted.begin();
+  for (size_t k=0; k<3; ++k)
+    while (it != sorted.end() && *it <= levels[k])
+      { ++ms_bins[k]; ++it; }
+  ms_bins[3] = std::distance(it, sorted.end());
+  RealArray ms_order_stats;
+  for (size_t r : ranks)
+    { it = sorted.begin(); std::advance(it, r); ms_order_stats.push_back(*it); }
+  auto t1 = std::chrono::steady_clock::now();
+  SizetArray bins;  RealArray order_stats;
+  stored.count_levels(0, levels, bins);
+  stored.order_statistics(0, ranks, order_stats);
+  auto t2 = std::chrono::steady_clock::now();
+  EXPECT_EQ(ms_bins, bins);
+  EXPECT_EQ(ms_order_stats, order_stats);
+  sketched.count_levels(0, levels, bins);
+  sketched.order_statistics(0, ranks, order_stats);
+  auto t3 = std::chrono::steady_clock::now();
+
+  typedef std::chrono::duration<double, std::milli> msec;
+  std::cout << "Level mapping benchmark (" << num_samples << " samples, "
+	    << "3 levels, 3 ranks):"
+	    << "\n  multiset sort:            " << msec(t1 - t0).count() << " ms"
+	    << "\n  columnar selection:       " << msec(t2 - t1).count() << " ms"
+	    << "\n  quantile sketch:          " << msec(t3 - t2).count() << " ms"
+	    << std::endl;
+}
@@ -0,0 +1,92 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "CompletionNotifier.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <thread>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+using namespace Dakota;
+
+namespace {
+
+/// milliseconds elapsed since start
+double elapsed_ms(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>
+    (std::chrono::steady_clock::now() - start).count();
+}
+
+}
+
+//------------------------------------
+
+TEST(completion_notifier_tests, test_process_exit_wakes_wait)
+{
+  CompletionNotifier notifier;
+  pid_t pid = fork();
+  if (pid == 0)
+    { usleep(100000); _exit(0); }
+  ASSERT_GT(pid, 0);
+
+  std::map<pid_t, int> process_id_map{ { pid, 1 } };
+  if (!notifier.watch_processes(process_id_map)) {
+    waitpid(pid, NULL, 0);
+    GTEST_SKIP() << "process exits cannot be watched on this system";
+  }
+
+  // the wait returns at the exit, well before the timeout
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(notifier.wait(10000));
+  EXPECT_LT(elapsed_ms(start), 5000.);
+
+  int status = 0;
+  EXPECT_EQ(waitpid(pid, &status, WNOHANG), pid);
+
+  // once released, the reaped process no longer signals
+  process_id_map.clear();
+  notifier.watch_processes(process_id_map);
+  EXPECT_FALSE(notifier.wait(0));
+}
+
+//------------------------------------
+
+TEST(completion_notifier_tests, test_results_file_wakes_wait)
+{
+  std::filesystem::path dir
+    = std::filesystem::absolute("completion_notifier_dir");
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+
+  CompletionNotifier notifier;
+  if (!notifier.watch_directories({ dir })) {
+    std::filesystem::remove_all(dir);
+    GTEST_SKIP() << "directories cannot be watched on this system";
+  }
+  EXPECT_FALSE(notifier.wait(0));
+
+  std::thread writer([&dir]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      std::ofstream(dir / "results.out") << "1.0 f\n";
+    });
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(notifier.wait(10000));
+  EXPECT_LT(elapsed_ms(start), 5000.);
+  writer.join();
+
+  // a directory that does not exist cannot be watched: poll instead
+  EXPECT_FALSE(notifier.watch_directories({ dir / "missing" }));
+
+  std::filesystem::remove_all(dir);
+}
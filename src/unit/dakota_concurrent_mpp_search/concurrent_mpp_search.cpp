@@ -0,0 +1,191 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+#include "DirectApplicInterface.hpp"
+#include "DakotaResponse.hpp"
+#include "DakotaVariables.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace Dakota;
+
+namespace Dakota {
+  extern PRPCache data_pairs;
+}
+
+namespace {
+
+  /// Library-mode direct interface evaluating f1 = x1/x2 and f2 = x1*x2
+  /// with analytic gradients; it reports thread-safe evaluations so that
+  /// the validation evaluations of concurrent searches overlap
+  class RatioProductInterface: public DirectApplicInterface
+  {
+  public:
+
+    RatioProductInterface(const ProblemDescDB& problem_db,
+			  ParallelLibrary& parallel_lib):
+      DirectApplicInterface(problem_db, parallel_lib), numActive(0),
+      peakActive(0)
+    { }
+
+    ~RatioProductInterface() override { }
+
+    void derived_map(const Variables& vars, const ActiveSet& set,
+		     Response& response, int fn_eval_id) override
+    {
+      int active = ++numActive, peak = peakActive;
+      while (active > peak && !peakActive.compare_exchange_weak(peak, active))
+	{ }
+      // long enough for concurrently submitted evaluations to overlap
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+      const RealVector& x = vars.continuous_variables();
+      const ShortArray& asv = set.request_vector();
+      if (asv[0] & 1) response.function_value(x[0] / x[1], 0);
+      if (asv[1] & 1) response.function_value(x[0] * x[1], 1);
+      RealVector grad(2);
+      if (asv[0] & 2) {
+	grad[0] = 1. / x[1]; grad[1] = -x[0] / (x[1] * x[1]);
+	response.function_gradient(grad, 0);
+      }
+      if (asv[1] & 2) {
+	grad[0] = x[1]; grad[1] = x[0];
+	response.function_gradient(grad, 1);
+      }
+      --numActive;
+    }
+
+    /// largest number of evaluations observed in flight at once
+    int peak_active() const { return peakActive; }
+
+  protected:
+
+    bool thread_safe_evaluations() const override { return true; }
+
+  private:
+
+    std::atomic<int> numActive, peakActive;
+  };
+
+  /// input for a reliability study with several levels for each of two
+  /// response functions
+  std::string reliability_input(const std::string& mpp_search,
+				const std::string& levels, size_t concurrency)
+  {
+    std::string input =
+      "method \n"
+      "  local_reliability \n"
+      "    mpp_search " + mpp_search + " \n";
+    if (concurrency > 1)
+      input += "      concurrent_mpp_searches " +
+	std::to_string(concurrency) + " \n";
+    input +=
+      "    convergence_tolerance 1.e-8 \n"
+      "    " + levels + " \n"
+      "  output silent \n"
+      "variables \n"
+      "  lognormal_uncertain 2 \n"
+      "    means           1.  1. \n"
+      "    std_deviations  0.5 0.5 \n"
+      "  uncertain_correlation_matrix 1.  0.3 \n"
+      "                               0.3 1. \n"
+      "interface \n"
+      "  direct \n"
+      "    analysis_driver 'ratio_product' \n";
+    if (concurrency > 1)
+      input += "  asynchronous \n"
+	"    evaluation_concurrency " + std::to_string(concurrency) + " \n";
+    input +=
+      "responses \n"
+      "  response_functions 2 \n"
+      "  analytic_gradients \n"
+      "  no_hessians \n";
+    return input;
+  }
+
+  /// final statistics of a reliability study, along with the largest
+  /// number of evaluations in flight at once
+  void reliability_statistics(const std::string& mpp_search,
+			      const std::string& levels, size_t concurrency,
+			      RealVector& stats, int& peak_active)
+  {
+    std::shared_ptr<LibraryEnvironment> p_env(Opt_TPL_Test::create_env(
+      reliability_input(mpp_search, levels, concurrency)));
+    ProblemDescDB& problem_db = p_env->problem_description_db();
+    ParallelLibrary& parallel_lib = p_env->parallel_library();
+    std::shared_ptr<RatioProductInterface> rp_iface
+      = std::make_shared<RatioProductInterface>(problem_db, parallel_lib);
+    ASSERT_TRUE(p_env->plugin_interface("", "direct", "ratio_product",
+					rp_iface));
+    if (parallel_lib.mpirun_flag())
+      FAIL(); // This test only works for serial builds
+    p_env->execute();
+    copy_data(p_env->response_results().function_values(), stats);
+    peak_active = rp_iface->peak_active();
+    data_pairs.clear();
+  }
+
+  /// compare concurrent searches with sequential searches over the same
+  /// levels
+  void check_concurrent_searches(const std::string& mpp_search,
+				 const std::string& levels)
+  {
+    RealVector seq_stats, conc_stats;
+    int seq_peak = 0, peak = 0;
+    reliability_statistics(mpp_search, levels, 1, seq_stats, seq_peak);
+    reliability_statistics(mpp_search, levels, 4, conc_stats, peak);
+
+    EXPECT_EQ(1, seq_peak);
+    EXPECT_GT(peak, 1);
+    EXPECT_LE(peak, 4);
+    ASSERT_EQ(seq_stats.length(), conc_stats.length());
+    ASSERT_GT(seq_stats.length(), 0);
+    for (int i=0; i<seq_stats.length(); ++i)
+      EXPECT_NEAR(seq_stats[i], conc_stats[i],
+		  1.e-5 * (1. + std::fabs(seq_stats[i])));
+  }
+
+  const std::string ria_levels =
+    "response_levels 0.5 0.8 1.25 2. 0.4 0.8 1.5 2.5 \n"
+    "      num_response_levels 4 4";
+  const std::string pma_levels =
+    "probability_levels 0.05 0.2 0.4 0.7 0.95 0.05 0.2 0.4 0.7 0.95 \n"
+    "      num_probability_levels 5 5";
+
+}
+
+
+/** Concurrent AMV searches over the response levels (RIA) map the same
+    probabilities as sequential searches. */
+TEST(concurrent_mpp_search_tests, test_amv_ria_matches_sequential)
+{
+  check_concurrent_searches("x_taylor_mean", ria_levels);
+}
+
+/** Concurrent AMV+ searches over the response levels (RIA), some of them
+    cold started from the means, converge to the same MPPs as sequential
+    warm-started searches. */
+TEST(concurrent_mpp_search_tests, test_amv_plus_ria_matches_sequential)
+{
+  check_concurrent_searches("x_taylor_mpp", ria_levels);
+}
+
+/** Concurrent transformed AMV+ searches over the probability levels (PMA)
+    map the same response levels as sequential searches. */
+TEST(concurrent_mpp_search_tests, test_u_amv_plus_pma_matches_sequential)
+{
+  check_concurrent_searches("u_taylor_mpp", pma_levels);
+}
@@ -10,10 +10,13 @@
 #include <exception>
 
 #include "DigitalNet.hpp"
+#include "low_discrepancy_data.hpp"
 
 #include <fstream>
 #include <cmath>
 #include <ciso646>
+#include <chrono>
+#include <cstdlib>
 #include "opt_tpl_test.hpp"
 
 #include <gtest/gtest.h>
@@ -646,6 +649,119 @@ TEST(digital_net_tests, digital_net_check_annulus)
   EXPECT_LT(std::fabs(1. - 4*integrand / (0.65*std::atan(1))), 1e-1/100. );
 }
 
+// +-------------------------------------------------------------------------+
+// |                   Test digital net skip-ahead and blocks                |
+// +-------------------------------------------------------------------------+
+TEST(digital_net_tests, digital_net_check_skip_ahead)
+{
+  // Get digital net with a fixed seed
+  Dakota::DigitalNet digital_net(17);
+
+  // Get all points, a subrange, and the same points in parallel blocks
+  size_t dimension = 8;
+  Dakota::RealMatrix points(dimension, 4096);
+  digital_net.get_points(0, 4096, points);
+  Dakota::RealMatrix points_skip(dimension, 500);
+  digital_net.get_points(1000, 1500, points_skip);
+  Dakota::RealMatrix points_blocks(dimension, 4096);
+  digital_net.get_points_parallel(0, 4096, points_blocks, 7);
+
+  for ( size_t col = 0; col < dimension; col++ )
+  {
+    for ( size_t row = 0; row < 500; row++ )
+    {
+      EXPECT_EQ(points_skip[row][col], points[1000 + row][col]);
+    }
+    for ( size_t row = 0; row < 4096; row++ )
+    {
+      EXPECT_EQ(points_blocks[row][col], points[row][col]);
+    }
+  }
+
+  // Far into the sequence, the directly computed first point of a range
+  // must agree with the same point reached by the iterative update
+  size_t nFar = size_t(1) << 31;
+  Dakota::RealMatrix points_far(dimension, 8);
+  digital_net.get_points(nFar - 4, nFar + 4, points_far);
+  Dakota::RealMatrix points_far_skip(dimension, 4);
+  digital_net.get_points(nFar, nFar + 4, points_far_skip);
+  for ( size_t row = 0; row < 4; row++ )
+  {
+    for ( size_t col = 0; col < dimension; col++ )
+    {
+      EXPECT_EQ(points_far_skip[row][col], points_far[4 + row][col]);
+    }
+  }
+}
+
+// +-------------------------------------------------------------------------+
+// |               Test digital net natural ordering in blocks               |
+// +-------------------------------------------------------------------------+
+TEST(digital_net_tests, digital_net_check_natural_ordering_blocks)
+{
+  // Get digital net with natural ordering
+  Dakota::DigitalNet digital_net(
+    Dakota::UInt64Matrix(Teuchos::View, &Dakota::joe_kuo_d1024_t32_m32[0][0],
+      1024, 1024, 32),
+    32,
+    32,
+    32,
+    true,
+    true,
+    17,
+    Dakota::DIGITAL_NET_NATURAL_ORDERING,
+    false,
+    Dakota::NORMAL_OUTPUT
+  );
+
+  // Blocks need not be a power of 2 when the total number of points is
+  size_t dimension = 4;
+  Dakota::RealMatrix points(dimension, 1024);
+  digital_net.get_points(points);
+  Dakota::RealMatrix points_blocks(dimension, 1024);
+  digital_net.get_points_parallel(0, 1024, points_blocks, 3);
+  for ( size_t row = 0; row < 1024; row++ )
+  {
+    for ( size_t col = 0; col < dimension; col++ )
+    {
+      EXPECT_EQ(points_blocks[row][col], points[row][col]);
+    }
+  }
+}
+
+// +-------------------------------------------------------------------------+
+// |                   Points-per-second digital net benchmark               |
+// +-------------------------------------------------------------------------+
+/// The number of points defaults to 2^20 and may be changed through the
+/// DAKOTA_LD_BENCH_POINTS environment variable
+TEST(digital_net_tests, benchmark_digital_net_points)
+{
+  size_t numPoints = size_t(1) << 20, dimension = 16;
+  if ( const char* env_points = std::getenv("DAKOTA_LD_BENCH_POINTS") )
+  {
+    numPoints = std::strtoul(env_points, nullptr, 10);
+  }
+  size_t nMin = size_t(1) << 30; /// Far into the sequence
+
+  Dakota::DigitalNet digital_net(17);
+  Dakota::RealMatrix points(dimension, numPoints);
+  Dakota::RealMatrix points_blocks(dimension, numPoints);
+  auto t0 = std::chrono::steady_clock::now();
+  digital_net.get_points(nMin, nMin + numPoints, points);
+  auto t1 = std::chrono::steady_clock::now();
+  digital_net.get_points_parallel(nMin, nMin + numPoints, points_blocks);
+  auto t2 = std::chrono::steady_clock::now();
+  EXPECT_EQ(points_blocks[numPoints - 1][dimension - 1],
+    points[numPoints - 1][dimension - 1]);
+
+  typedef std::chrono::duration<double> sec;
+  std::cout << "Digital net benchmark (" << numPoints << " points from index "
+    << nMin << ", " << dimension << " dimensions):"
+    << "\n  serial:    " << numPoints / sec(t1 - t0).count() << " points/s"
+    << "\n  parallel:  " << numPoints / sec(t2 - t1).count() << " points/s"
+    << std::endl;
+}
+
 } // end namespace TestDigitalNet
 
 } // end namespace TestLowDiscrepancy
@@ -0,0 +1,136 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+#include "DirectApplicInterface.hpp"
+#include "DakotaResponse.hpp"
+#include "DakotaVariables.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace Dakota;
+
+namespace Dakota {
+  extern PRPCache data_pairs;
+}
+
+namespace {
+
+  /// response of the thread-safe test simulator: f = sum_i (x_i - i)^2
+  Real shifted_sphere(const RealVector& x)
+  {
+    Real f = 0.;
+    for (int i=0; i<x.length(); ++i)
+      f += std::pow(x[i] - Real(i), 2);
+    return f;
+  }
+
+  /// Library-mode direct interface whose derived_map() uses only its
+  /// arguments, so that it opts in to threaded asynchronous evaluations
+  class ThreadSafeDirectInterface: public DirectApplicInterface
+  {
+  public:
+
+    ThreadSafeDirectInterface(const ProblemDescDB& problem_db,
+			      ParallelLibrary& parallel_lib):
+      DirectApplicInterface(problem_db, parallel_lib), numActive(0),
+      peakActive(0), numMapped(0)
+    { }
+
+    ~ThreadSafeDirectInterface() override { }
+
+    void derived_map(const Variables& vars, const ActiveSet& set,
+		     Response& response, int fn_eval_id) override
+    {
+      int active = ++numActive, peak = peakActive;
+      while (active > peak && !peakActive.compare_exchange_weak(peak, active))
+	{ }
+      // long enough for concurrently submitted evaluations to overlap
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      if (set.request_vector()[0] & 1)
+	response.function_value(shifted_sphere(vars.continuous_variables()), 0);
+      ++numMapped;
+      --numActive;
+    }
+
+    /// largest number of evaluations observed in flight at once
+    int peak_active() const { return peakActive; }
+    /// number of completed evaluations
+    int num_mapped() const { return numMapped; }
+
+  protected:
+
+    bool thread_safe_evaluations() const override { return true; }
+
+  private:
+
+    std::atomic<int> numActive, peakActive, numMapped;
+  };
+
+}
+
+
+/** Asynchronous local evaluations of a direct interface reporting
+    thread-safe evaluations run on the evaluation thread pool rather than
+    aborting, and every evaluation returns the response of its own
+    variables. */
+TEST(direct_thread_safe_async_tests, test_asynch_evaluations_on_threads)
+{
+  const int num_samples = 24;
+  std::string input =
+    "method \n"
+    "  sampling \n"
+    "    sample_type lhs \n"
+    "    samples " + std::to_string(num_samples) + " \n"
+    "    seed 1234 \n"
+    "  output silent \n"
+    "variables \n"
+    "  uniform_uncertain 3 \n"
+    "    lower_bounds -1. -1. -1. \n"
+    "    upper_bounds  3.  3.  3. \n"
+    "interface \n"
+    "  direct \n"
+    "    analysis_driver 'shifted_sphere' \n"
+    "  asynchronous \n"
+    "    evaluation_concurrency 4 \n"
+    "responses \n"
+    "  response_functions 1 \n"
+    "  no_gradients \n"
+    "  no_hessians \n";
+
+  std::shared_ptr<LibraryEnvironment>
+    p_env(Opt_TPL_Test::create_env(input));
+  ProblemDescDB& problem_db = p_env->problem_description_db();
+  ParallelLibrary& parallel_lib = p_env->parallel_library();
+  std::shared_ptr<ThreadSafeDirectInterface> ts_iface
+    = std::make_shared<ThreadSafeDirectInterface>(problem_db, parallel_lib);
+  ASSERT_TRUE(p_env->plugin_interface("", "direct", "shifted_sphere",
+				      ts_iface));
+  if (parallel_lib.mpirun_flag())
+    FAIL(); // This test only works for serial builds
+  p_env->execute();
+
+  EXPECT_EQ(num_samples, ts_iface->num_mapped());
+  EXPECT_GT(ts_iface->peak_active(), 1);
+  EXPECT_LE(ts_iface->peak_active(), 4);
+
+  ASSERT_EQ(size_t(num_samples), data_pairs.size());
+  for (PRPCacheCIter it=data_pairs.begin(); it!=data_pairs.end(); ++it)
+    EXPECT_NEAR(shifted_sphere(it->variables().continuous_variables()),
+		it->response().function_value(0), 1.e-14);
+
+  // Clear the cache
+  data_pairs.clear();
+}
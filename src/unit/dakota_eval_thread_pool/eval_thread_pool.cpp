@@ -0,0 +1,90 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "EvaluationThreadPool.hpp"
+#include "dakota_global_defs.hpp"
+
+#include <atomic>
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using namespace Dakota;
+
+//------------------------------------
+
+TEST(eval_thread_pool_tests, test_all_evaluations_complete)
+{
+  EvaluationThreadPool pool(4);
+  EXPECT_EQ(pool.num_threads(), 4u);
+
+  const int num_evals = 200;
+  std::vector<double> results(num_evals + 1, 0.);
+  for (int id=1; id<=num_evals; ++id)
+    pool.submit(id, [id, &results]() {
+	std::this_thread::sleep_for(std::chrono::microseconds(50 * (id % 7)));
+	results[id] = 2. * id;
+      });
+
+  // mirror asynchronous_local_evaluations(): wait_some() until all captured
+  IntSet completed;
+  std::map<int, std::exception_ptr> failures;
+  while (pool.num_outstanding())
+    pool.wait_some(completed, failures);
+
+  EXPECT_EQ(completed.size(), num_evals);
+  EXPECT_TRUE(failures.empty());
+  for (int id=1; id<=num_evals; ++id)
+    EXPECT_DOUBLE_EQ(results[id], 2. * id);
+}
+
+//------------------------------------
+
+TEST(eval_thread_pool_tests, test_failures_captured)
+{
+  EvaluationThreadPool pool(3);
+  for (int id=1; id<=30; ++id)
+    pool.submit(id, [id]() {
+	if (id % 10 == 0)
+	  throw FunctionEvalFailure("simulated failure");
+      });
+
+  IntSet completed;
+  std::map<int, std::exception_ptr> failures;
+  while (pool.num_outstanding())
+    pool.wait_some(completed, failures);
+
+  EXPECT_EQ(completed.size(), 30);
+  ASSERT_EQ(failures.size(), 3);
+  for (const auto& fail : failures) {
+    EXPECT_EQ(fail.first % 10, 0);
+    EXPECT_THROW(std::rethrow_exception(fail.second), FunctionEvalFailure);
+  }
+}
+
+//------------------------------------
+
+TEST(eval_thread_pool_tests, test_nonblocking_test_some)
+{
+  EvaluationThreadPool pool(2);
+  std::atomic<bool> release(false);
+  pool.submit(1, [&release]() { while (!release) std::this_thread::yield(); });
+  pool.submit(2, []() { });
+
+  IntSet completed;
+  std::map<int, std::exception_ptr> failures;
+  // eval 1 cannot complete until released
+  pool.test_some(completed, failures);
+  EXPECT_EQ(completed.count(1), 0);
+
+  release = true;
+  while (pool.num_outstanding())
+    pool.test_some(completed, failures);
+  EXPECT_EQ(completed.size(), 2);
+}
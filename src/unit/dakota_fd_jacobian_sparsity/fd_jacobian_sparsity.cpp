@@ -0,0 +1,255 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+#include "DirectApplicInterface.hpp"
+#include "DakotaResponse.hpp"
+#include "DakotaVariables.hpp"
+#include "dakota_data_util.hpp"
+
+#include <cmath>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace Dakota;
+
+namespace Dakota {
+  extern PRPCache data_pairs;
+}
+
+namespace {
+
+  const size_t NUM_VARS = 6;
+
+  /// Paired Rosenbrock residuals with a block-sparse Jacobian: residual
+  /// 2i-1 depends on variables 2i-1 and 2i, residual 2i on variable 2i-1
+  /// only.  The odd columns share no row, nor do the even columns, so the
+  /// columns need two colors.
+  void block_rosenbrock(const RealVector& x, const ShortArray& asv,
+			RealVector& fn_vals)
+  {
+    for (size_t i=0; i<NUM_VARS/2; ++i) {
+      Real x_odd = x[2*i], x_even = x[2*i+1];
+      if (asv[2*i] & 1)
+	fn_vals[2*i]   = 10. * (x_even - x_odd * x_odd);
+      if (asv[2*i+1] & 1)
+	fn_vals[2*i+1] = 1. - x_odd;
+    }
+  }
+
+  /// Serial plug-in for block_rosenbrock that also evaluates queued
+  /// asynchronous jobs as a batch, so that Model takes its asynchronous
+  /// finite difference path
+  class BlockSparseInterface: public DirectApplicInterface
+  {
+  public:
+
+    BlockSparseInterface(const ProblemDescDB& problem_db,
+			 ParallelLibrary& parallel_lib):
+      DirectApplicInterface(problem_db, parallel_lib)
+    { numAnalysisServers = 1; }
+
+    ~BlockSparseInterface() override { }
+
+  protected:
+
+    int derived_map_ac(const String& ac_name) override
+    {
+      if (ac_name != "block_rosenbrock") {
+	Cerr << ac_name << " is not available as an analysis within "
+	     << "BlockSparseInterface." << std::endl;
+	abort_handler(INTERFACE_ERROR);
+      }
+      block_rosenbrock(xC, directFnASV, fnVals);
+      return 0;
+    }
+
+    /// no-op: jobs are evaluated in wait_local_evaluations()
+    void derived_map_asynch(const ParamResponsePair& pair) override { }
+
+    void wait_local_evaluations(PRPQueue& prp_queue) override
+    {
+      for (PRPQueueIter prp_iter = prp_queue.begin();
+	   prp_iter != prp_queue.end(); ++prp_iter) {
+	Response resp = prp_iter->response(); // shared rep
+	RealVector fn_vals = resp.function_values_view();
+	block_rosenbrock(prp_iter->variables().continuous_variables(),
+			 prp_iter->active_set().request_vector(), fn_vals);
+	completionSet.insert(prp_iter->eval_id());
+      }
+    }
+
+    void test_local_evaluations(PRPQueue& prp_queue) override
+    { wait_local_evaluations(prp_queue); }
+
+    /// no-op hides the run-time asynchronous checks of DirectApplicInterface
+    void set_communicators_checks(int max_eval_concurrency) override { }
+  };
+
+
+  /// Dakota input: a single evaluation of block_rosenbrock with numerical
+  /// gradients, optionally grouped by sparsity_spec
+  std::string fd_input(const std::string& interval_type,
+		       const std::string& sparsity_spec, bool asynch)
+  {
+    std::string input =
+      "method \n"
+      "  list_parameter_study \n"
+      "    list_of_points -1.2 1.0 -0.7 0.4 0.3 -0.5 \n"
+      "  output silent \n"
+      "variables \n"
+      "  continuous_design 6 \n"
+      "interface \n"
+      "  direct \n"
+      "    analysis_driver 'block_rosenbrock' \n"
+      "  deactivate evaluation_cache \n";
+    if (asynch)
+      input +=
+	"  asynchronous \n"
+	"    evaluation_concurrency 4 \n";
+    input +=
+      "responses \n"
+      "  calibration_terms 6 \n"
+      "  numerical_gradients \n"
+      "    method_source dakota \n"
+      "    interval_type " + interval_type + " \n"
+      "    fd_step_size 1.e-5 \n"
+      "    " + sparsity_spec + " \n"
+      "  no_hessians \n";
+    return input;
+  }
+
+  /// residuals, gradients, and cost of one numerical gradient evaluation
+  struct FDResult {
+    RealVector fnVals;    ///< residual values
+    RealMatrix fnGrads;   ///< residual gradients
+    int numEvals;         ///< interface evaluations used
+    size_t numColors;     ///< colors of the Jacobian sparsity pattern
+  };
+
+  /// Run the parameter study and evaluate values and gradients at its
+  /// point, which detects the sparsity pattern if requested, then measure
+  /// an evaluation of values and gradients at a new point.
+  void fd_gradients(const std::string& interval_type,
+		    const std::string& sparsity_spec, bool asynch,
+		    FDResult& result)
+  {
+    std::shared_ptr<LibraryEnvironment> p_env(Opt_TPL_Test::create_env(
+      fd_input(interval_type, sparsity_spec, asynch)));
+    ProblemDescDB& problem_db = p_env->problem_description_db();
+    ParallelLibrary& parallel_lib = p_env->parallel_library();
+    std::shared_ptr<Interface> block_iface
+      = std::make_shared<BlockSparseInterface>(problem_db, parallel_lib);
+    ASSERT_TRUE(p_env->plugin_interface("", "direct", "block_rosenbrock",
+					block_iface));
+    if (parallel_lib.mpirun_flag())
+      FAIL(); // This test only works for serial builds
+    p_env->execute();
+
+    ModelList models = p_env->filtered_model_list("simulation", "", "");
+    ASSERT_EQ(size_t(1), models.size());
+    Model& model = *models.front();
+    ASSERT_EQ(asynch, model.asynch_flag());
+
+    ShortArray asv(NUM_VARS, 3);
+    SizetArray dvv(NUM_VARS);
+    for (size_t j=0; j<NUM_VARS; ++j)
+      dvv[j] = j + 1;
+    ActiveSet set(asv, dvv);
+    model.evaluate(set);
+
+    RealVector c_vars(NUM_VARS);
+    for (size_t j=0; j<NUM_VARS; ++j)
+      c_vars[j] = 0.25 * j - 0.6;
+    model.current_variables().continuous_variables(c_vars);
+    int eval_id = block_iface->evaluation_id();
+    model.evaluate(set);
+
+    result.numEvals  = block_iface->evaluation_id() - eval_id;
+    result.numColors = model.num_fd_gradient_colors();
+    copy_data(model.current_response().function_values(), result.fnVals);
+    copy_data(model.current_response().function_gradients(), result.fnGrads);
+
+    // Clear the cache
+    data_pairs.clear();
+  }
+
+  /// Compare grouped finite difference gradients to dense ones
+  void check_grouped_gradients(const std::string& interval_type,
+			       const std::string& sparsity_spec, bool asynch)
+  {
+    // one evaluation at the point, plus one (forward) or two (central)
+    // per variable or color
+    int evals_per_step = (interval_type == "central") ? 2 : 1;
+
+    FDResult dense;
+    fd_gradients(interval_type, "", asynch, dense);
+    EXPECT_EQ(size_t(0), dense.numColors);
+    EXPECT_EQ(1 + evals_per_step * int(NUM_VARS), dense.numEvals);
+
+    FDResult grouped;
+    fd_gradients(interval_type, sparsity_spec, asynch, grouped);
+    EXPECT_EQ(size_t(2), grouped.numColors);
+    EXPECT_EQ(1 + evals_per_step * 2, grouped.numEvals);
+
+    ASSERT_EQ(dense.fnGrads.numRows(), grouped.fnGrads.numRows());
+    ASSERT_EQ(dense.fnGrads.numCols(), grouped.fnGrads.numCols());
+    for (size_t i=0; i<NUM_VARS; ++i) {
+      EXPECT_EQ(dense.fnVals[i], grouped.fnVals[i]);
+      for (size_t j=0; j<NUM_VARS; ++j)
+	EXPECT_NEAR(dense.fnGrads(j,i), grouped.fnGrads(j,i),
+		    1.e-12 * (1. + std::fabs(dense.fnGrads(j,i))));
+    }
+  }
+
+  const std::string explicit_pattern =
+    "jacobian_sparsity \n"
+    "      nonzero_functions 1 1 2 3 3 4 5 5 6 \n"
+    "      nonzero_variables 1 2 1 3 4 3 5 6 5";
+
+  const std::string detected_pattern = "jacobian_sparsity detect";
+
+}
+
+
+TEST(fd_jacobian_sparsity_tests, test_forward_explicit_sync)
+{
+  check_grouped_gradients("forward", explicit_pattern, false);
+}
+
+
+TEST(fd_jacobian_sparsity_tests, test_central_explicit_sync)
+{
+  check_grouped_gradients("central", explicit_pattern, false);
+}
+
+
+TEST(fd_jacobian_sparsity_tests, test_forward_explicit_async)
+{
+  check_grouped_gradients("forward", explicit_pattern, true);
+}
+
+
+TEST(fd_jacobian_sparsity_tests, test_central_explicit_async)
+{
+  check_grouped_gradients("central", explicit_pattern, true);
+}
+
+
+TEST(fd_jacobian_sparsity_tests, test_forward_detect_sync)
+{
+  check_grouped_gradients("forward", detected_pattern, false);
+}
+
+
+TEST(fd_jacobian_sparsity_tests, test_central_detect_async)
+{
+  check_grouped_gradients("central", detected_pattern, true);
+}
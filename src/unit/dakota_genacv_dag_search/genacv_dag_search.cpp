@@ -0,0 +1,153 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+#include "DakotaResponse.hpp"
+#include "dakota_data_util.hpp"
+
+#include <cmath>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace Dakota;
+
+namespace {
+
+  /// Dakota input: generalized ACV with model selection over the three
+  /// tunable_model fidelities, using an offline pilot so that the
+  /// allocation follows from a single search over model subsets and DAGs
+  std::string genacv_input(const std::string& output_level)
+  {
+    return
+      "method \n"
+      "  model_pointer = 'NONHIER' \n"
+      "  approximate_control_variate acv_mf \n"
+      "    solution_mode offline_pilot \n"
+      "    pilot_samples = 100 \n"
+      "    search_model_graphs \n"
+      "      model_selection full_recursion \n"
+      "    max_function_evaluations = 250 \n"
+      "    seed = 8674132 \n"
+      "  output " + output_level + " \n"
+      "model \n"
+      "  id_model = 'NONHIER' \n"
+      "  variables_pointer = 'HF_VARS' \n"
+      "  surrogate ensemble \n"
+      "    truth_model = 'HF' \n"
+      "    unordered_model_fidelities = 'LF' 'MF' \n"
+      "model \n"
+      "  id_model = 'LF' \n"
+      "  variables_pointer = 'LF_VARS' \n"
+      "  interface_pointer = 'LF_INT' \n"
+      "  simulation \n"
+      "    solution_level_cost = 0.01 \n"
+      "model \n"
+      "  id_model = 'MF' \n"
+      "  variables_pointer = 'MF_VARS' \n"
+      "  interface_pointer = 'MF_INT' \n"
+      "  simulation \n"
+      "    solution_level_cost = 0.1 \n"
+      "model \n"
+      "  id_model = 'HF' \n"
+      "  variables_pointer = 'HF_VARS' \n"
+      "  interface_pointer = 'HF_INT' \n"
+      "  simulation \n"
+      "    solution_level_cost = 1. \n"
+      "variables \n"
+      "  id_variables = 'LF_VARS' \n"
+      "  uniform_uncertain = 2 \n"
+      "    lower_bounds = 2*-1. \n"
+      "    upper_bounds = 2* 1. \n"
+      "    descriptors = 'x' 'y' \n"
+      "  continuous_state = 1 \n"
+      "    initial_state = 0.5235987755983 \n"
+      "    descriptors = 'theta' \n"
+      "  discrete_state_set integer = 1 \n"
+      "    initial_state = 2 \n"
+      "    set_values = 2 \n"
+      "    descriptors = 'ModelForm' \n"
+      "variables \n"
+      "  id_variables = 'MF_VARS' \n"
+      "  uniform_uncertain = 2 \n"
+      "    lower_bounds = 2*-1. \n"
+      "    upper_bounds = 2* 1. \n"
+      "    descriptors = 'x' 'y' \n"
+      "  continuous_state = 1 \n"
+      "    initial_state = 1.0471975511966 \n"
+      "    descriptors = 'theta' \n"
+      "  discrete_state_set integer = 1 \n"
+      "    initial_state = 1 \n"
+      "    set_values = 1 \n"
+      "    descriptors = 'ModelForm' \n"
+      "variables \n"
+      "  id_variables = 'HF_VARS' \n"
+      "  uniform_uncertain = 2 \n"
+      "    lower_bounds = 2*-1. \n"
+      "    upper_bounds = 2* 1. \n"
+      "    descriptors = 'x' 'y' \n"
+      "  continuous_state = 1 \n"
+      "    initial_state = 1.5707963267949 \n"
+      "    descriptors = 'theta' \n"
+      "  discrete_state_set integer = 1 \n"
+      "    initial_state = 0 \n"
+      "    set_values = 0 \n"
+      "    descriptors = 'ModelForm' \n"
+      "interface \n"
+      "  id_interface = 'LF_INT' \n"
+      "  direct \n"
+      "    analysis_driver = 'tunable_model' \n"
+      "  deactivate evaluation_cache restart_file \n"
+      "interface \n"
+      "  id_interface = 'MF_INT' \n"
+      "  direct \n"
+      "    analysis_driver = 'tunable_model' \n"
+      "  deactivate evaluation_cache restart_file \n"
+      "interface \n"
+      "  id_interface = 'HF_INT' \n"
+      "  direct \n"
+      "    analysis_driver = 'tunable_model' \n"
+      "  deactivate evaluation_cache restart_file \n"
+      "responses \n"
+      "  response_functions = 1 \n"
+      "  no_gradients \n"
+      "  no_hessians \n";
+  }
+
+  /// final statistics of a generalized ACV study
+  void genacv_statistics(const std::string& output_level, RealVector& stats)
+  {
+    std::shared_ptr<LibraryEnvironment>
+      p_env(Opt_TPL_Test::create_env(genacv_input(output_level)));
+    if (p_env->parallel_library().mpirun_flag())
+      FAIL(); // This test only works for serial builds
+    p_env->execute();
+    copy_data(p_env->response_results().function_values(), stats);
+  }
+
+}
+
+
+/** The search skips the DAGs of model subsets whose merit lower bound
+    cannot improve on the incumbent, except at debug output, where every
+    DAG is solved.  Since the samples are drawn from the same seed, the
+    final statistics agree only if both searches select the same model
+    subset, DAG, and allocation. */
+TEST(genacv_dag_search_tests, test_pruned_search_matches_full_search)
+{
+  RealVector pruned_stats, full_stats;
+  genacv_statistics("normal", pruned_stats);
+  genacv_statistics("debug",  full_stats);
+
+  ASSERT_EQ(full_stats.length(), pruned_stats.length());
+  ASSERT_GT(full_stats.length(), 0);
+  for (int i=0; i<full_stats.length(); ++i)
+    EXPECT_NEAR(full_stats[i], pruned_stats[i],
+		1.e-12 * (1. + std::fabs(full_stats[i])));
+}
@@ -16,6 +16,10 @@
 #include "SensAnalysisGlobal.hpp"
 #include "util_common.hpp"
 #include "util_metrics.hpp"
+#include "DakotaResponse.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
 #include <string>
 #include <random>
 #include "Eigen/Dense"
@@ -488,6 +492,239 @@ TEST(global_sa_matrices_tests, test_discrete_binned_sobol_computation)
   EXPECT_TRUE((frob_err < 1e-2));
 }
 
+//----------------------------------------------------------------
+
+namespace {
+
+  /// samples (factors x observations) of 3 uniform inputs, one input
+  /// taking 5 discrete values (so that ranks are tied), and 2 outputs
+  MatrixXd generate_correlation_samples(int num_samples, std::uint64_t seed)
+  {
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> dist(-1., 1.);
+    std::uniform_int_distribution<int> level(0, 4);
+    MatrixXd samples(6, num_samples);
+    for (int j = 0; j < num_samples; ++j) {
+      for (int i = 0; i < 3; ++i)
+        samples(i, j) = dist(rng);
+      samples(3, j) = level(rng);
+      samples(4, j) = 3.*samples(0, j) + samples(1, j)*samples(1, j)
+        - 0.5*samples(3, j) + 0.1*dist(rng);
+      samples(5, j) = std::exp(samples(2, j)) + samples(0, j)*samples(3, j);
+    }
+    return samples;
+  }
+
+  /// responses holding the trailing num_fns rows of samples
+  IntResponseMap make_responses(const MatrixXd& samples, int num_fns)
+  {
+    ActiveSet as(num_fns, 0);
+    SharedResponseData srd(as);
+    IntResponseMap resp_samples;
+    int num_vars = samples.rows() - num_fns;
+    for (int j = 0; j < samples.cols(); ++j) {
+      Response resp(srd);
+      for (int k = 0; k < num_fns; ++k)
+        resp.function_value_view(k) = samples(num_vars + k, j);
+      resp_samples.insert(resp_samples.end(), std::make_pair(j + 1, resp));
+    }
+    return resp_samples;
+  }
+
+  /// average ranks of the values in each row
+  MatrixXd rank_rows(const MatrixXd& samples)
+  {
+    MatrixXd ranks(samples.rows(), samples.cols());
+    for (int i = 0; i < samples.rows(); ++i) {
+      std::vector<double> sorted;
+      sorted.reserve(samples.cols());
+      for (int j = 0; j < samples.cols(); ++j)
+        sorted.push_back(samples(i, j));
+      std::sort(sorted.begin(), sorted.end());
+      for (int j = 0; j < samples.cols(); ++j) {
+        auto range = std::equal_range(sorted.begin(), sorted.end(),
+                                      samples(i, j));
+        ranks(i, j) = (range.first - sorted.begin()) +
+          (range.second - range.first - 1) / 2.;
+      }
+    }
+    return ranks;
+  }
+
+  /// sample correlation of two vectors
+  double correlation(const Eigen::VectorXd& x, const Eigen::VectorXd& y)
+  {
+    Eigen::VectorXd xc = x.array() - x.mean(), yc = y.array() - y.mean();
+    return xc.dot(yc) / (xc.norm() * yc.norm());
+  }
+
+  /// simple correlations among all rows of samples
+  MatrixXd direct_simple_corr(const MatrixXd& samples)
+  {
+    int num_corr = samples.rows();
+    MatrixXd corr(num_corr, num_corr);
+    for (int i = 0; i < num_corr; ++i)
+      for (int j = 0; j < num_corr; ++j)
+        corr(i, j) = correlation(samples.row(i).transpose(),
+                                 samples.row(j).transpose());
+    return corr;
+  }
+
+  /// partial correlations as correlations of the residuals of least
+  /// squares fits of input i and each output on the other inputs
+  MatrixXd direct_partial_corr(const MatrixXd& samples, int num_vars)
+  {
+    int num_obs = samples.cols(), num_fns = samples.rows() - num_vars;
+    MatrixXd corr(num_vars, num_fns);
+    for (int i = 0; i < num_vars; ++i) {
+      MatrixXd controls(num_obs, num_vars);
+      controls.col(0).setOnes();
+      for (int k = 0, c = 1; k < num_vars; ++k)
+        if (k != i)
+          controls.col(c++) = samples.row(k).transpose();
+      auto qr = controls.colPivHouseholderQr();
+      Eigen::VectorXd vi = samples.row(i).transpose();
+      Eigen::VectorXd vi_resid = vi - controls * qr.solve(vi);
+      for (int k = 0; k < num_fns; ++k) {
+        Eigen::VectorXd fk = samples.row(num_vars + k).transpose();
+        Eigen::VectorXd fk_resid = fk - controls * qr.solve(fk);
+        corr(i, k) = correlation(vi_resid, fk_resid);
+      }
+    }
+    return corr;
+  }
+
+  bool matches(const MatrixXd& gold, const RealMatrix& test, double tol)
+  {
+    if (gold.rows() != test.numRows() || gold.cols() != test.numCols())
+      return false;
+    for (int i = 0; i < gold.rows(); ++i)
+      for (int j = 0; j < gold.cols(); ++j)
+        if (std::abs(gold(i, j) - test(i, j)) > tol)
+          return false;
+    return true;
+  }
+
+}
+
+TEST(global_sa_matrices_tests, test_correlations_match_direct)
+{
+  const int num_vars = 4, num_fns = 2, num_samples = 20000;
+  MatrixXd samplesXd = generate_correlation_samples(num_samples,
+                                                    TEST_RNG_SEED);
+  RealMatrix vars_samples;
+  copy_data(MatrixXd(samplesXd.topRows(num_vars)), vars_samples);
+  IntResponseMap resp_samples = make_responses(samplesXd, num_fns);
+
+  // rows are ranked by several threads
+  setenv("DAKOTA_CORRELATION_THREADS", "3", 1);
+  SensAnalysisGlobal gsa;
+  gsa.compute_correlations(vars_samples, resp_samples);
+  unsetenv("DAKOTA_CORRELATION_THREADS");
+  ASSERT_TRUE(gsa.correlations_computed());
+
+  MatrixXd ranksXd = rank_rows(samplesXd);
+  EXPECT_TRUE(matches(direct_simple_corr(samplesXd),
+                      gsa.simple_correlations(), 1.e-10));
+  EXPECT_TRUE(matches(direct_partial_corr(samplesXd, num_vars),
+                      gsa.partial_correlations(), 1.e-10));
+  EXPECT_TRUE(matches(direct_simple_corr(ranksXd),
+                      gsa.simple_correlations(true), 1.e-10));
+  EXPECT_TRUE(matches(direct_partial_corr(ranksXd, num_vars),
+                      gsa.partial_correlations(true), 1.e-10));
+}
+
+//----------------------------------------------------------------
+
+TEST(global_sa_matrices_tests, test_accumulated_correlations)
+{
+  const int num_vars = 4, num_fns = 2, num_samples = 1000, chunk = 137;
+  MatrixXd samplesXd = generate_correlation_samples(num_samples,
+                                                    TEST_RNG_SEED);
+  // a failed evaluation is screened out in both modes
+  samplesXd(num_vars, 10) = std::numeric_limits<double>::quiet_NaN();
+
+  RealMatrix vars_samples;
+  copy_data(MatrixXd(samplesXd.topRows(num_vars)), vars_samples);
+  SensAnalysisGlobal gsa;
+  gsa.compute_correlations(vars_samples, make_responses(samplesXd, num_fns));
+
+  SensAnalysisGlobal streamed;
+  for (int first = 0; first < num_samples; first += chunk) {
+    int num_chunk = std::min(chunk, num_samples - first);
+    MatrixXd chunkXd = samplesXd.middleCols(first, num_chunk);
+    RealMatrix chunk_vars;
+    copy_data(MatrixXd(chunkXd.topRows(num_vars)), chunk_vars);
+    streamed.accumulate_correlations(chunk_vars,
+                                     make_responses(chunkXd, num_fns));
+  }
+  streamed.compute_accumulated_correlations();
+  ASSERT_TRUE(streamed.correlations_computed());
+
+  MatrixXd simple, partial;
+  copy_data(gsa.simple_correlations(), simple);
+  copy_data(gsa.partial_correlations(), partial);
+  EXPECT_TRUE(matches(simple, streamed.simple_correlations(), 1.e-12));
+  EXPECT_TRUE(matches(partial, streamed.partial_correlations(), 1.e-12));
+  // rank correlations require all samples at once
+  EXPECT_EQ(0, streamed.simple_correlations(true).numRows());
+  EXPECT_EQ(0, streamed.partial_correlations(true).numRows());
+}
+
+//----------------------------------------------------------------
+
+/// Correlation benchmark: all four correlation matrices computed from
+/// all samples, and simple and partial correlations accumulated in
+/// chunks of 10000 samples.  The number of samples may be set through
+/// the DAKOTA_CORRELATION_BENCH_SAMPLES environment variable.
+TEST(global_sa_matrices_tests, benchmark_correlations)
+{
+  int num_samples = 100000;
+  if (const char* env_samples = std::getenv("DAKOTA_CORRELATION_BENCH_SAMPLES"))
+    num_samples = std::atoi(env_samples);
+  const int num_vars = 100, num_fns = 2, chunk = 10000;
+
+  MatrixXd samplesXd(num_vars + num_fns, num_samples);
+  samplesXd.topRows(num_vars) =
+    generate_uniform_samples(num_vars, num_samples, TEST_RNG_SEED).matrix();
+  for (int j = 0; j < num_samples; ++j) {
+    samplesXd(num_vars, j) = samplesXd.col(j).head(num_vars).sum();
+    samplesXd(num_vars + 1, j) = samplesXd(0, j) * samplesXd(1, j);
+  }
+  RealMatrix vars_samples;
+  copy_data(MatrixXd(samplesXd.topRows(num_vars)), vars_samples);
+  IntResponseMap resp_samples = make_responses(samplesXd, num_fns);
+
+  auto t0 = std::chrono::steady_clock::now();
+  SensAnalysisGlobal gsa;
+  gsa.compute_correlations(vars_samples, resp_samples);
+  auto t1 = std::chrono::steady_clock::now();
+  SensAnalysisGlobal streamed;
+  for (int first = 0; first < num_samples; first += chunk) {
+    int num_chunk = std::min(chunk, num_samples - first);
+    RealMatrix chunk_vars(Teuchos::View, vars_samples, num_vars, num_chunk,
+                          0, first);
+    IntResponseMap chunk_resp(resp_samples.find(first + 1),
+                              resp_samples.find(first + num_chunk + 1));
+    streamed.accumulate_correlations(chunk_vars, chunk_resp);
+  }
+  streamed.compute_accumulated_correlations();
+  auto t2 = std::chrono::steady_clock::now();
+
+  MatrixXd partial;
+  copy_data(gsa.partial_correlations(), partial);
+  EXPECT_TRUE(matches(partial, streamed.partial_correlations(), 1.e-8));
+
+  typedef std::chrono::duration<double, std::milli> msec;
+  std::cout << "Correlation benchmark (" << num_samples << " samples, "
+            << num_vars << " inputs, " << num_fns << " outputs):"
+            << "\n  simple, partial, and rank: " << msec(t1 - t0).count()
+            << " ms"
+            << "\n  accumulated in chunks:     " << msec(t2 - t1).count()
+            << " ms" << std::endl;
+}
+
+
 
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,187 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#ifdef DAKOTA_HAVE_HDF5
+
+#include "dakota_data_types.hpp"
+#include "dakota_global_defs.hpp"
+#include "DakotaGlobalEnums.hpp"
+#include "DakotaVariables.hpp"
+#include "DakotaResponse.hpp"
+#include "EvaluationStore.hpp"
+#include "HDF5_IO.hpp"
+#include "H5Cpp.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+using namespace Dakota;
+
+namespace {
+
+const String MODEL_ID("EVAL_STORE_MODEL");
+const String IFACE_ID("EVAL_STORE_IFACE");
+const String IFACE_ROOT = "/interfaces/" + IFACE_ID + '/' + MODEL_ID + '/';
+
+/// Store num_evals evaluations of an interface with one each of continuous,
+/// discrete int, and discrete string variables and values, gradients, and
+/// Hessians for num_fns responses. Every third evaluation has a partial ASV
+/// and every fifth a partial DVV. Responses are stored in batches of
+/// num_concurrent to mimic asynchronous evaluations. Returns elapsed seconds.
+double store_evaluations(const String &file_name, const size_t buffer_size,
+                         const int num_evals, const int num_concurrent)
+{
+  const size_t num_cv = 4, num_fns = 3;
+  SizetArray vc_totals(NUM_VC_TOTALS, 0);
+  vc_totals[TOTAL_CDV] = num_cv;
+  vc_totals[TOTAL_DDIV] = 1;
+  vc_totals[TOTAL_DDSV] = 1;
+  std::pair<short, short> view(MIXED_ALL, EMPTY_VIEW);
+  SharedVariablesData svd(view, vc_totals);
+  Variables vars(svd);
+
+  ActiveSet full_set(num_fns, num_cv);
+  full_set.request_values(7);
+  Response resp(SIMULATION_RESPONSE, full_set);
+
+  ActiveSet partial_set(full_set);
+  partial_set.request_value(0, 1);
+  SizetArray partial_dvv(full_set.derivative_vector());
+  partial_dvv.erase(partial_dvv.begin() + 1);
+
+  std::shared_ptr<HDF5IOHelper> hdf5_stream(new HDF5IOHelper(file_name, true));
+  EvaluationStore eval_store;
+  eval_store.buffer_size(buffer_size);
+  eval_store.set_database(hdf5_stream);
+  eval_store.interface_selection(INTERF_EVAL_STORE_ALL);
+  eval_store.interface_allocate(MODEL_ID, IFACE_ID, "simulation", vars, resp,
+                                full_set, String2DArray());
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (int batch_start = 1; batch_start <= num_evals; batch_start += num_concurrent) {
+    int batch_end = std::min(batch_start + num_concurrent - 1, num_evals);
+    for (int eval_id = batch_start; eval_id <= batch_end; ++eval_id) {
+      for (size_t i=0; i<num_cv; ++i)
+        vars.all_continuous_variable(eval_id + 0.25*i, i);
+      vars.all_discrete_int_variable(eval_id, 0);
+      vars.all_discrete_string_variable("s" + std::to_string(eval_id % 7), 0);
+      ActiveSet set(full_set);
+      if (eval_id % 3 == 0) set.request_vector(partial_set.request_vector());
+      if (eval_id % 5 == 0) set.derivative_vector(partial_dvv);
+      eval_store.store_interface_variables(MODEL_ID, IFACE_ID, eval_id, set, vars);
+    }
+    for (int eval_id = batch_start; eval_id <= batch_end; ++eval_id) {
+      ActiveSet set(full_set);
+      if (eval_id % 3 == 0) set.request_vector(partial_set.request_vector());
+      if (eval_id % 5 == 0) set.derivative_vector(partial_dvv);
+      Response eval_resp(SIMULATION_RESPONSE, set);
+      size_t num_deriv = set.derivative_vector().size();
+      for (size_t f=0; f<num_fns; ++f) {
+        eval_resp.function_value(eval_id + 10.*f, f);
+        RealVector grad(num_deriv);
+        RealSymMatrix hess(num_deriv);
+        for (size_t i=0; i<num_deriv; ++i) {
+          grad[i] = eval_id + f + 0.1*i;
+          for (size_t j=0; j<=i; ++j)
+            hess(i,j) = eval_id - f + 0.01*(i+j);
+        }
+        eval_resp.function_gradient(grad, f);
+        eval_resp.function_hessian(hess, f);
+      }
+      eval_store.store_interface_response(MODEL_ID, IFACE_ID, eval_id, eval_resp);
+    }
+  }
+  eval_store.flush();
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(t1 - t0).count();
+}
+
+/// Read an entire dataset as doubles (integer datasets are converted)
+std::vector<double> read_dataset(const String &file_name, const String &dset_name)
+{
+  H5::H5File h5_file(file_name, H5F_ACC_RDONLY);
+  H5::DataSet ds = h5_file.openDataSet(dset_name);
+  std::vector<double> data(ds.getSpace().getSimpleExtentNpoints());
+  ds.read(data.data(), H5::PredType::NATIVE_DOUBLE);
+  return data;
+}
+
+/// Element-wise equality that treats NaNs as equal
+bool same_values(const std::vector<double> &a, const std::vector<double> &b)
+{
+  if (a.size() != b.size())
+    return false;
+  for (size_t i=0; i<a.size(); ++i)
+    if (!(a[i] == b[i] || (std::isnan(a[i]) && std::isnan(b[i]))))
+      return false;
+  return true;
+}
+
+} // anonymous namespace
+
+
+TEST(hdf5_evaluation_store_tests, test_buffered_matches_unbuffered)
+{
+  const int num_evals = 203;
+  store_evaluations("eval_store_direct.h5", 0, num_evals, 4);
+  // buffer smaller than, and larger than, the number of concurrent evaluations
+  store_evaluations("eval_store_buffered.h5", 16, num_evals, 4);
+  store_evaluations("eval_store_async.h5", 8, num_evals, 50);
+
+  const StringArray numeric_dsets = { "/_scales" + IFACE_ROOT + "evaluation_ids",
+    IFACE_ROOT + "variables/continuous", IFACE_ROOT + "variables/discrete_integer",
+    IFACE_ROOT + "properties/active_set_vector",
+    IFACE_ROOT + "properties/derivative_variables_vector",
+    IFACE_ROOT + "responses/functions", IFACE_ROOT + "responses/gradients",
+    IFACE_ROOT + "responses/hessians" };
+  for (const String &dset : numeric_dsets) {
+    std::vector<double> direct = read_dataset("eval_store_direct.h5", dset);
+    EXPECT_EQ(direct.size() % num_evals, 0u) << dset;
+    EXPECT_TRUE(same_values(direct, read_dataset("eval_store_buffered.h5", dset))) << dset;
+    EXPECT_TRUE(same_values(direct, read_dataset("eval_store_async.h5", dset))) << dset;
+  }
+
+  // partial ASV leaves NaN in the unrequested function value
+  std::vector<double> fns = read_dataset("eval_store_buffered.h5",
+                                         IFACE_ROOT + "responses/functions");
+  EXPECT_TRUE(std::isnan(fns[3*2 + 1])); // eval 3, function 2
+  EXPECT_EQ(fns[3*1 + 1], 2. + 10.);     // eval 2, function 2
+
+  HDF5IOHelper direct("eval_store_direct.h5"), buffered("eval_store_buffered.h5");
+  StringArray direct_strings, buffered_strings;
+  direct.read_vector(IFACE_ROOT + "variables/discrete_string", direct_strings);
+  buffered.read_vector(IFACE_ROOT + "variables/discrete_string", buffered_strings);
+  EXPECT_EQ(direct_strings, buffered_strings);
+}
+
+
+/// Throughput benchmark for evaluation storage. The number of evaluations
+/// defaults to 2000 and may be set through the DAKOTA_HDF5_BENCH_EVALS
+/// environment variable.
+TEST(hdf5_evaluation_store_tests, benchmark_buffered_storage)
+{
+  int num_evals = 2000;
+  if (const char* env_size = std::getenv("DAKOTA_HDF5_BENCH_EVALS"))
+    num_evals = std::atoi(env_size);
+
+  double direct = store_evaluations("eval_store_bench_direct.h5", 0, num_evals, 1);
+  double buffered = store_evaluations("eval_store_bench_buffered.h5", 64, num_evals, 1);
+  EXPECT_EQ(read_dataset("eval_store_bench_buffered.h5",
+                         "/_scales" + IFACE_ROOT + "evaluation_ids").size(), size_t(num_evals));
+
+  std::cout << "EvaluationStore benchmark (" << num_evals << " evaluations):"
+            << "\n  unbuffered:  " << num_evals / direct << " evals/s"
+            << "\n  buffered:    " << num_evals / buffered << " evals/s"
+            << std::endl;
+}
+
+#endif
@@ -274,6 +274,41 @@ TEST(instruction_materializer_tests, histogram_point_uncertain_reports_not_imple
     std::runtime_error);
 }
 
+TEST(instruction_materializer_tests, histogram_point_uncertain_splits_pairs_per_variable)
+{
+  const auto op = make_op(irgen::OpKind::HistogramPointUncertain, "histograms");
+  const auto store = invoke_handler(
+    op,
+    make_contract(irgen::IrValueType::RealRealMapArray),
+    json{{"hist", {{"count", 2},
+                    {"pairs_per_variable", json::array({1, 3})},
+                    {"abscissas", json::array({5.0, 1.0, 2.0, 3.0})},
+                    {"counts", json::array({4.0, 1.0, 1.0, 2.0})}}}},
+    "hist");
+  const auto& histograms = store.get<RealRealMapArray>("histograms");
+
+  ASSERT_EQ(histograms.size(), 2U);
+  EXPECT_DOUBLE_EQ(histograms[0].at(5.0), 1.0);
+  ASSERT_EQ(histograms[1].size(), 3U);
+  EXPECT_DOUBLE_EQ(histograms[1].at(1.0), 0.25);
+  EXPECT_DOUBLE_EQ(histograms[1].at(3.0), 0.5);
+}
+
+TEST(instruction_materializer_tests, discrete_set_values_accepts_unordered_elements)
+{
+  const auto op = make_op(irgen::OpKind::DiscreteSetValues, "values");
+  const auto store = invoke_handler(
+    op,
+    make_contract(irgen::IrValueType::IntSetArray),
+    json{{"set", {{"count", 1},
+                   {"elements", json::array({7, 3, 5, 3})}}}},
+    "set");
+  const auto& sets = store.get<IntSetArray>("values");
+
+  ASSERT_EQ(sets.size(), 1U);
+  EXPECT_EQ(sets[0], IntSet({3, 5, 7}));
+}
+
 TEST(instruction_materializer_tests, discrete_uncertain_set_values_probs_builds_probability_maps)
 {
   const auto op = make_op(irgen::OpKind::DiscreteUncertainSetValuesProbs, "pmf_values");
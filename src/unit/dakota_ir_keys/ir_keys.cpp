@@ -0,0 +1,184 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "IRQuery.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace Dakota;
+
+namespace {
+
+/// IR state with two method stores, the second active, and a model store
+IRState make_state()
+{
+  IRState state;
+  state.method.resize(2, IRStore(irgen::BlockType::Method));
+  state.method[0].set_value("max_iterations", size_t(10));
+  state.method[1].set_value("max_iterations", size_t(20));
+  state.method[1].set_value("convergence_tolerance", Real(1.e-6));
+  state.method[1].set_value("id", String("opt"));
+  state.model.resize(1, IRStore(irgen::BlockType::Model));
+  state.model[0].set_value("surrogate.type", String("gaussian_process"));
+  state.active.method = 1;
+  return state;
+}
+
+}
+
+//------------------------------------
+
+TEST(ir_keys_tests, test_names_round_trip)
+{
+  ASSERT_EQ(irgen::kIRKeyBlockOffsets[ir_keys::num_blocks], irgen::kNumIRKeys);
+  for (std::uint32_t id = 0; id < irgen::kNumIRKeys; ++id) {
+    const auto key = static_cast<irgen::IRKey>(id);
+    irgen::IRKey found;
+    ASSERT_TRUE(ir_keys::find(ir_keys::full_name(key), found));
+    EXPECT_EQ(key, found);
+    ASSERT_TRUE(ir_keys::find(ir_keys::block(key), ir_keys::local_name(key),
+                              found));
+    EXPECT_EQ(key, found);
+    EXPECT_LT(ir_keys::slot(key), ir_keys::num_keys(ir_keys::block(key)));
+  }
+
+  EXPECT_EQ(irgen::BlockType::Method,
+            ir_keys::block(irgen::IRKey::method_max_iterations));
+  EXPECT_EQ("max_iterations",
+            ir_keys::local_name(irgen::IRKey::method_max_iterations));
+  EXPECT_EQ("model.surrogate.type",
+            ir_keys::full_name(irgen::IRKey::model_surrogate_type));
+
+  irgen::IRKey found;
+  EXPECT_FALSE(ir_keys::find("method.no_such_key", found));
+  EXPECT_FALSE(ir_keys::find("no_such_block.id", found));
+  EXPECT_FALSE(ir_keys::find("method", found));
+  // a key of one block is not found in another
+  EXPECT_FALSE(ir_keys::find("environment.max_iterations", found));
+}
+
+
+TEST(ir_keys_tests, test_store_slots_and_map)
+{
+  IRStore store(irgen::BlockType::Method);
+  EXPECT_TRUE(store.empty());
+  EXPECT_FALSE(store.contains(irgen::IRKey::method_max_iterations));
+
+  store.set_value("max_iterations", size_t(7));
+  store.set_value(irgen::IRKey::method_id, String("m1"));
+  store.set_value("not_interned", 3);
+  EXPECT_EQ(3, store.size());
+
+  // string and key access reach the same slot
+  EXPECT_TRUE(store.contains(irgen::IRKey::method_max_iterations));
+  EXPECT_EQ(7, store.get<size_t>(irgen::IRKey::method_max_iterations));
+  EXPECT_EQ("m1", store.get<String>("id"));
+  EXPECT_EQ(3, store.get<int>("not_interned"));
+  ASSERT_NE(nullptr, store.find<size_t>(irgen::IRKey::method_max_iterations));
+  EXPECT_EQ(nullptr, store.find<int>(irgen::IRKey::method_max_iterations));
+  EXPECT_EQ(nullptr, store.find<Real>(irgen::IRKey::method_convergence_tolerance));
+  EXPECT_THROW(store.get<int>(irgen::IRKey::method_max_iterations),
+               std::runtime_error);
+  EXPECT_THROW(store.get<Real>("convergence_tolerance"), std::runtime_error);
+
+  const IRStore::Map values = store.values();
+  ASSERT_EQ(3, values.size());
+  EXPECT_EQ(7, std::get<size_t>(values.at("max_iterations")));
+  EXPECT_EQ(3, std::get<int>(values.at("not_interned")));
+
+  // a store without slots keeps interned keys by name
+  IRStore plain;
+  plain.set_value(irgen::IRKey::method_max_iterations, size_t(5));
+  EXPECT_EQ(5, plain.get<size_t>("max_iterations"));
+  EXPECT_EQ(5, plain.get<size_t>(irgen::IRKey::method_max_iterations));
+}
+
+
+TEST(ir_keys_tests, test_queries_follow_active_store)
+{
+  IRState state = make_state();
+  EXPECT_EQ(20, ir_query::get<size_t>(state, "method.max_iterations"));
+  EXPECT_EQ(20, ir_query::get<size_t>(state,
+                                      irgen::IRKey::method_max_iterations));
+  EXPECT_EQ("gaussian_process",
+            ir_query::get<String>(state, "model.surrogate.type"));
+  ASSERT_NE(nullptr, ir_query::find<String>(state, irgen::IRKey::method_id));
+
+  state.active.method = 0;
+  EXPECT_EQ(10, ir_query::get<size_t>(state,
+                                      irgen::IRKey::method_max_iterations));
+  EXPECT_EQ(nullptr, ir_query::find<String>(state, irgen::IRKey::method_id));
+  EXPECT_THROW(ir_query::get<String>(state, "method.id"), std::runtime_error);
+  EXPECT_THROW(ir_query::get<size_t>(state, "nonsense"), std::runtime_error);
+}
+
+
+/// Lookup benchmark: block-qualified names parsed and searched in a map
+/// (the former IRStore layout), names resolved through the interned key
+/// tables, and interned keys.  The number of queries may be
+/// set through the DAKOTA_IR_KEYS_BENCH_QUERIES environment variable.
+TEST(ir_keys_tests, benchmark_lookup_paths)
+{
+  size_t num_queries = 1000000;
+  if (const char* env_queries = std::getenv("DAKOTA_IR_KEYS_BENCH_QUERIES"))
+    num_queries = std::strtoul(env_queries, nullptr, 10);
+
+  // like a materialized store, the map holds every method key
+  IRState state = make_state();
+  IRStore::Map method_map = state.method[1].values();
+  for (size_t s = 0; s < ir_keys::num_keys(irgen::BlockType::Method); ++s)
+    method_map.emplace(String(ir_keys::local_name(static_cast<irgen::IRKey>(
+      irgen::kIRKeyBlockOffsets[size_t(irgen::BlockType::Method)] + s))),
+      IRValue());
+  const String iter_name("method.max_iterations"),
+    tol_name("method.convergence_tolerance"), id_name("method.id");
+
+  // each pass queries a size_t, a Real, and a String
+  size_t sum_parsed = 0, sum_named = 0, sum_keyed = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (size_t q = 0; q < num_queries; ++q) {
+    ir_query::ParsedIRKey parsed = ir_query::parse_full_pdb_key(iter_name);
+    sum_parsed += std::get<size_t>(method_map.find(parsed.local_key)->second);
+    parsed = ir_query::parse_full_pdb_key(tol_name);
+    sum_parsed += std::get<Real>(method_map.find(parsed.local_key)->second) > 0.;
+    parsed = ir_query::parse_full_pdb_key(id_name);
+    sum_parsed += std::get<String>(method_map.find(parsed.local_key)->second).size();
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (size_t q = 0; q < num_queries; ++q) {
+    sum_named += ir_query::get<size_t>(state, iter_name);
+    sum_named += ir_query::get<Real>(state, tol_name) > 0.;
+    sum_named += ir_query::get<String>(state, id_name).size();
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  for (size_t q = 0; q < num_queries; ++q) {
+    sum_keyed += ir_query::get<size_t>(state,
+      irgen::IRKey::method_max_iterations);
+    sum_keyed += ir_query::get<Real>(state,
+      irgen::IRKey::method_convergence_tolerance) > 0.;
+    sum_keyed += ir_query::get<String>(state, irgen::IRKey::method_id).size();
+  }
+  auto t3 = std::chrono::steady_clock::now();
+  EXPECT_EQ(sum_parsed, sum_named);
+  EXPECT_EQ(sum_parsed, sum_keyed);
+
+  typedef std::chrono::duration<double, std::nano> nsec;
+  std::cout << "IR lookup benchmark (" << num_queries << " x 3 queries):"
+            << "\n  parsed name, map store:   "
+            << nsec(t1 - t0).count() / (3*num_queries) << " ns/query"
+            << "\n  interned name lookup:     "
+            << nsec(t2 - t1).count() / (3*num_queries) << " ns/query"
+            << "\n  interned key:             "
+            << nsec(t3 - t2).count() / (3*num_queries) << " ns/query"
+            << std::endl;
+}
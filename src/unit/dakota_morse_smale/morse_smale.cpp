@@ -0,0 +1,139 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "MorseSmaleComplex.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+/// count points in dim dimensions, each followed by the value of a
+/// multimodal function
+std::vector<double> make_points(int count, int dim, unsigned seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> unif(-1., 1.);
+  std::vector<double> points(count*(dim+1));
+  for (int i = 0; i < count; ++i) {
+    double *x = &points[i*(dim+1)];
+    x[dim] = 0.;
+    for (int j = 0; j < dim; ++j) {
+      x[j] = unif(rng);
+      x[dim] += std::sin(3.*x[j]);
+    }
+    x[dim] += 0.1*unif(rng);
+  }
+  return points;
+}
+
+}
+
+//------------------------------------
+
+TEST(morse_smale_tests, test_insertion_matches_rebuild)
+{
+  const int dim = 3, n = 200, k = 6, num_cand = 10;
+  std::vector<double> points = make_points(n + num_cand, dim, 1234);
+  MS_Complex base(points.data(), dim+1, n, k);
+
+  for (int c = 0; c < num_cand; ++c) {
+    double *new_point = &points[(n+c)*(dim+1)];
+    MS_Complex inserted(base, new_point);
+
+    std::vector<double> all(points.begin(), points.begin() + n*(dim+1));
+    all.insert(all.end(), new_point, new_point + dim+1);
+    MS_Complex rebuilt(all.data(), dim+1, n+1, k);
+
+    ASSERT_EQ(rebuilt.numV, inserted.numV);
+    EXPECT_EQ(rebuilt.numE, inserted.numE);
+    EXPECT_EQ(rebuilt.numC, inserted.numC);
+    for (int i = 0; i < rebuilt.numV; ++i) {
+      EXPECT_EQ(rebuilt.GetVertex(i)->classification,
+                inserted.GetVertex(i)->classification);
+      EXPECT_EQ(rebuilt.GetVertex(i)->persistence,
+                inserted.GetVertex(i)->persistence);
+    }
+    EXPECT_EQ(base.ComparePersistenceNoSaddles(rebuilt),
+              ScoreTOPOP(base, new_point));
+  }
+}
+
+
+TEST(morse_smale_tests, test_parallel_scores_match_serial)
+{
+  const int dim = 2, n = 150, k = 8, num_cand = 24;
+  std::vector<double> points = make_points(n + num_cand, dim, 99);
+  MS_Complex base(points.data(), dim+1, n, k);
+  double *candidates = &points[n*(dim+1)];
+
+  std::vector<double> serial(num_cand), parallel(num_cand);
+  for (int c = 0; c < num_cand; ++c)
+    serial[c] = ScoreTOPOB(base, candidates + c*(dim+1));
+  ScoreCandidates(base, ScoreTOPOB, candidates, dim, num_cand,
+                  parallel.data(), 4);
+  EXPECT_EQ(serial, parallel);
+  ScoreCandidates(base, ScoreTOPOP, candidates, dim, num_cand,
+                  parallel.data(), 1);
+  for (int c = 0; c < num_cand; ++c)
+    EXPECT_EQ(ScoreTOPOP(base, candidates + c*(dim+1)), parallel[c]);
+}
+
+
+/// Candidate scoring benchmark: full rebuild of the complex per candidate
+/// (the former scoring), incremental insertion, and incremental insertion
+/// with one thread per core.  The number of points in the base complex
+/// may be set through the DAKOTA_MORSE_SMALE_BENCH_POINTS environment
+/// variable.
+TEST(morse_smale_tests, benchmark_candidate_scoring)
+{
+  int n = 2000;
+  if (const char* env_points = std::getenv("DAKOTA_MORSE_SMALE_BENCH_POINTS"))
+    n = std::atoi(env_points);
+  const int dim = 4, k = 15, num_cand = 32;
+  std::vector<double> points = make_points(n + num_cand, dim, 7);
+  MS_Complex base(points.data(), dim+1, n, k);
+  double *candidates = &points[n*(dim+1)];
+
+  std::vector<double> rebuilt(num_cand), serial(num_cand),
+    parallel(num_cand);
+  auto t0 = std::chrono::steady_clock::now();
+  for (int c = 0; c < num_cand; ++c) {
+    std::vector<double> all(points.begin(), points.begin() + n*(dim+1));
+    all.insert(all.end(), candidates + c*(dim+1), candidates + (c+1)*(dim+1));
+    MS_Complex full(all.data(), dim+1, n+1, k);
+    rebuilt[c] = base.CompareBottleneck(full);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (int c = 0; c < num_cand; ++c)
+    serial[c] = ScoreTOPOB(base, candidates + c*(dim+1));
+  auto t2 = std::chrono::steady_clock::now();
+  ScoreCandidates(base, ScoreTOPOB, candidates, dim, num_cand,
+                  parallel.data());
+  auto t3 = std::chrono::steady_clock::now();
+  EXPECT_EQ(rebuilt, serial);
+  EXPECT_EQ(serial, parallel);
+
+  typedef std::chrono::duration<double, std::milli> msec;
+  std::cout << "Morse-Smale scoring benchmark (" << n << " points, "
+            << num_cand << " candidates):"
+            << "\n  rebuild per candidate:     "
+            << msec(t1 - t0).count() / num_cand << " ms/candidate"
+            << "\n  incremental insertion:     "
+            << msec(t2 - t1).count() / num_cand << " ms/candidate"
+            << "\n  incremental, threaded:     "
+            << msec(t3 - t2).count() / num_cand << " ms/candidate"
+            << std::endl;
+}
@@ -0,0 +1,126 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "PersistentDriverPool.hpp"
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+using namespace Dakota;
+
+namespace {
+
+/// driver that echoes each request with its process id and exits on
+/// the request "crash"
+StringArray echo_driver()
+{
+  return StringArray{ "/bin/bash", "-c",
+    "while IFS= read -r line <&\"$DAKOTA_WORKER_FD\"; do "
+    "  if [ \"$line\" = crash ]; then exit 1; fi; "
+    "  printf '%s %s\\n' \"$$\" \"$line\" >&\"$DAKOTA_WORKER_FD\"; "
+    "done" };
+}
+
+/// collect num_evals completions from the pool
+void collect(PersistentDriverPool& pool, size_t num_evals,
+	     std::map<int, String>& replies, IntSet& failures)
+{
+  while (replies.size() + failures.size() < num_evals)
+    pool.wait_some(replies, failures);
+}
+
+/// request echoed in a reply, without the process id
+String echoed(const String& reply)
+{ return reply.substr(reply.find(' ') + 1); }
+
+}
+
+//------------------------------------
+
+TEST(persistent_driver_pool_tests, test_concurrent_requests_reuse_workers)
+{
+  if (access("/bin/bash", X_OK) != 0)
+    GTEST_SKIP() << "requires /bin/bash";
+
+  PersistentDriverPool pool(echo_driver());
+  for (int id=1; id<=3; ++id)
+    pool.submit(id, "eval " + std::to_string(id));
+  EXPECT_EQ(3, pool.num_workers());
+  EXPECT_EQ(3, pool.num_outstanding());
+
+  std::map<int, String> replies; IntSet failures;
+  collect(pool, 3, replies, failures);
+  EXPECT_TRUE(failures.empty());
+  ASSERT_EQ(3, replies.size());
+  StringSet worker_pids;
+  for (const auto& id_reply : replies) {
+    EXPECT_EQ("eval " + std::to_string(id_reply.first),
+	      echoed(id_reply.second));
+    worker_pids.insert(id_reply.second.substr(0, id_reply.second.find(' ')));
+  }
+  EXPECT_EQ(3, worker_pids.size());
+  EXPECT_EQ(0, pool.num_outstanding());
+
+  // subsequent evaluations are served by the same processes
+  replies.clear();
+  for (int id=4; id<=6; ++id)
+    pool.submit(id, "eval " + std::to_string(id));
+  collect(pool, 3, replies, failures);
+  EXPECT_EQ(3, pool.num_workers());
+  for (const auto& id_reply : replies)
+    EXPECT_TRUE(worker_pids.count(
+      id_reply.second.substr(0, id_reply.second.find(' '))));
+  EXPECT_EQ(0, pool.num_restarts());
+}
+
+
+TEST(persistent_driver_pool_tests, test_crashed_worker_is_replaced)
+{
+  if (access("/bin/bash", X_OK) != 0)
+    GTEST_SKIP() << "requires /bin/bash";
+
+  PersistentDriverPool pool(echo_driver());
+  std::map<int, String> replies; IntSet failures;
+  pool.submit(1, "crash");
+  pool.submit(2, "survivor");
+  collect(pool, 2, replies, failures);
+  EXPECT_EQ(IntSet{1}, failures);
+  ASSERT_EQ(1, replies.count(2));
+  EXPECT_EQ("survivor", echoed(replies[2]));
+
+  // the failed slot is refilled rather than the pool growing
+  replies.clear(); failures.clear();
+  pool.submit(3, "first");
+  pool.submit(4, "second");
+  collect(pool, 2, replies, failures);
+  EXPECT_TRUE(failures.empty());
+  EXPECT_EQ("first", echoed(replies[3]));
+  EXPECT_EQ("second", echoed(replies[4]));
+  EXPECT_EQ(2, pool.num_workers());
+  EXPECT_EQ(1, pool.num_restarts());
+}
+
+
+TEST(persistent_driver_pool_tests, test_timeout_without_reply)
+{
+  if (access("/bin/bash", X_OK) != 0)
+    GTEST_SKIP() << "requires /bin/bash";
+
+  // a driver that never replies
+  PersistentDriverPool pool(StringArray{ "/bin/bash", "-c",
+      "while IFS= read -r line <&\"$DAKOTA_WORKER_FD\"; do :; done" });
+  std::map<int, String> replies; IntSet failures;
+  pool.submit(1, "request");
+  pool.test_some(replies, failures);
+  pool.wait_some(replies, failures, 50);
+  EXPECT_TRUE(replies.empty());
+  EXPECT_TRUE(failures.empty());
+  EXPECT_EQ(1, pool.num_outstanding());
+}
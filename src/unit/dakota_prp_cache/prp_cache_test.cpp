@@ -0,0 +1,177 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "PRPMultiIndex.hpp"
+#include "SimulationResponse.hpp"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+using namespace Dakota;
+
+namespace {
+
+/// reference implementation: linear scan of the ordered index, as used
+/// prior to the nearby index
+PRPCacheOIter linear_nearby_lookup(PRPCache& prp_cache, const String& iface_id,
+				   const Variables& vars, const ActiveSet& set,
+				   Real tol)
+{
+  for (PRPCacheOIter it=prp_cache.begin(); it!=prp_cache.end(); ++it)
+    if (it->interface_id() == iface_id && nearby(it->variables(), vars, tol)
+	&& set_compare(*it, set))
+      return it;
+  return prp_cache.end();
+}
+
+/// populate prp_cache with num_evals PRPs having num_vars continuous
+/// variables drawn uniformly from [-10, 10], split over two interfaces
+void fill_cache(PRPCache& prp_cache, size_t num_evals, size_t num_vars,
+		std::mt19937& rng)
+{
+  SizetArray vc_totals(NUM_VC_TOTALS, 0);
+  vc_totals[TOTAL_CDV] = num_vars;
+  std::pair<short, short> view(MIXED_ALL, EMPTY_VIEW);
+  SharedVariablesData svd(view, vc_totals);
+  ActiveSet as(1, num_vars);
+  as.request_values(1);
+  std::uniform_real_distribution<Real> unif(-10., 10.);
+
+  for (size_t i=0; i<num_evals; ++i) {
+    Variables vars(svd);
+    for (size_t j=0; j<num_vars; ++j)
+      vars.continuous_variable(unif(rng), j);
+    Response resp(SIMULATION_RESPONSE, as);
+    resp.function_value((Real)i, 0);
+    String iface_id = (i % 2) ? "IFACE_A" : "IFACE_B";
+    prp_cache.insert(ParamResponsePair(vars, iface_id, resp, (int)i + 1,
+				       false)); // shallow copy
+  }
+}
+
+/// perturb each continuous variable by a relative factor in [-pert, pert]
+Variables perturbed_copy(const Variables& vars, Real pert, std::mt19937& rng)
+{
+  Variables pvars = vars.copy();
+  std::uniform_real_distribution<Real> unif(-pert, pert);
+  for (size_t j=0; j<pvars.cv(); ++j)
+    pvars.continuous_variable(pvars.continuous_variable(j) * (1.+unif(rng)),
+			      j);
+  return pvars;
+}
+
+}
+
+//------------------------------------
+
+TEST(prp_cache_tests, test_nearby_lookup_matches_linear_scan)
+{
+  std::mt19937 rng(20250101);
+  PRPCache prp_cache;
+  fill_cache(prp_cache, 2000, 4, rng);
+
+  Real tol = 1.e-6;
+  ActiveSet search_set(1, 4); search_set.request_values(1);
+  std::uniform_int_distribution<size_t> pick(0, prp_cache.size() - 1);
+  size_t num_hits = 0;
+  for (size_t k=0; k<200; ++k) {
+    PRPCacheOIter src_it = prp_cache.begin();
+    std::advance(src_it, pick(rng));
+    // half of the searches are within tolerance, half are not
+    Real pert = (k % 2) ? 0.1 * tol : 100. * tol;
+    Variables search_vars = perturbed_copy(src_it->variables(), pert, rng);
+    const String& iface_id = src_it->interface_id();
+
+    PRPCacheOIter fast_it = lookup_by_nearby_val(prp_cache, iface_id,
+      search_vars, search_set, tol);
+    PRPCacheOIter slow_it = linear_nearby_lookup(prp_cache, iface_id,
+      search_vars, search_set, tol);
+    EXPECT_TRUE(fast_it == slow_it);
+    if (fast_it != prp_cache.end()) ++num_hits;
+  }
+  EXPECT_EQ(num_hits, 100u);
+}
+
+//------------------------------------
+
+TEST(prp_cache_tests, test_nearby_lookup_zero_and_interface)
+{
+  std::mt19937 rng(12345);
+  PRPCache prp_cache;
+  fill_cache(prp_cache, 10, 2, rng);
+
+  // a record at the origin is found only for its own interface
+  SizetArray vc_totals(NUM_VC_TOTALS, 0);
+  vc_totals[TOTAL_CDV] = 2;
+  std::pair<short, short> view(MIXED_ALL, EMPTY_VIEW);
+  SharedVariablesData svd(view, vc_totals);
+  Variables origin(svd);
+  ActiveSet as(1, 2); as.request_values(1);
+  Response resp(SIMULATION_RESPONSE, as);
+  prp_cache.insert(ParamResponsePair(origin, "IFACE_Z", resp, 100, false));
+
+  Variables search_vars = origin.copy();
+  EXPECT_TRUE(lookup_by_nearby_val(prp_cache, "IFACE_Z", search_vars, as,
+				   1.e-8) != prp_cache.end());
+  EXPECT_TRUE(lookup_by_nearby_val(prp_cache, "IFACE_A", search_vars, as,
+				   1.e-8) == prp_cache.end());
+}
+
+//------------------------------------
+
+/// Throughput benchmark for tolerance-based duplicate detection.  The cache
+/// size defaults to 10^5 and may be raised (e.g., to 10^6) through the
+/// DAKOTA_PRP_CACHE_BENCH_SIZE environment variable.
+TEST(prp_cache_tests, benchmark_nearby_lookup)
+{
+  size_t num_evals = 100000, num_vars = 10, num_lookups = 1000,
+    num_linear = 20;
+  if (const char* env_size = std::getenv("DAKOTA_PRP_CACHE_BENCH_SIZE"))
+    num_evals = std::strtoul(env_size, nullptr, 10);
+
+  std::mt19937 rng(54321);
+  PRPCache prp_cache;
+  auto t0 = std::chrono::steady_clock::now();
+  fill_cache(prp_cache, num_evals, num_vars, rng);
+  auto t1 = std::chrono::steady_clock::now();
+
+  Real tol = 1.e-8;
+  ActiveSet search_set(1, num_vars); search_set.request_values(1);
+  std::uniform_int_distribution<size_t> pick(0, prp_cache.size() - 1);
+  std::vector<Variables> searches; StringArray iface_ids;
+  for (size_t k=0; k<num_lookups; ++k) {
+    PRPCacheOIter src_it = prp_cache.begin();
+    std::advance(src_it, pick(rng));
+    searches.push_back(perturbed_copy(src_it->variables(), 0.1 * tol, rng));
+    iface_ids.push_back(src_it->interface_id());
+  }
+
+  size_t num_hits = 0;
+  auto t2 = std::chrono::steady_clock::now();
+  for (size_t k=0; k<num_lookups; ++k)
+    if (lookup_by_nearby_val(prp_cache, iface_ids[k], searches[k], search_set,
+			     tol) != prp_cache.end())
+      ++num_hits;
+  auto t3 = std::chrono::steady_clock::now();
+  for (size_t k=0; k<num_linear; ++k)
+    linear_nearby_lookup(prp_cache, iface_ids[k], searches[k], search_set, tol);
+  auto t4 = std::chrono::steady_clock::now();
+  EXPECT_EQ(num_hits, num_lookups);
+
+  typedef std::chrono::duration<double, std::micro> usec;
+  std::cout << "PRPCache nearby lookup benchmark (" << num_evals << " PRPs, "
+	    << num_vars << " variables):"
+	    << "\n  fill:            " << usec(t1 - t0).count() / 1.e6 << " s"
+	    << "\n  indexed lookup:  " << usec(t3 - t2).count() / num_lookups
+	    << " us/lookup"
+	    << "\n  linear lookup:   " << usec(t4 - t3).count() / num_linear
+	    << " us/lookup" << std::endl;
+}
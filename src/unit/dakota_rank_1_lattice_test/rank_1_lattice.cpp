@@ -16,6 +16,8 @@
 
 #include <fstream>
 #include <cmath>
+#include <chrono>
+#include <cstdlib>
 
 #include "opt_tpl_test.hpp"
 
@@ -577,6 +579,80 @@ TEST(rank_1_lattice_tests, lattice_check_lattice_negative_seed)
   );
 }
 
+// +-------------------------------------------------------------------------+
+// |                 Test lattice skip-ahead and parallel blocks             |
+// +-------------------------------------------------------------------------+
+TEST(rank_1_lattice_tests, lattice_check_skip_ahead)
+{
+  // Get rank-1 lattice rule with a fixed seed
+  Dakota::Rank1Lattice lattice(17);
+
+  // Get all points, a subrange, and the same points in parallel blocks
+  size_t dimension = 8;
+  Dakota::RealMatrix points(dimension, 4096);
+  lattice.get_points(0, 4096, points);
+  Dakota::RealMatrix points_skip(dimension, 500);
+  lattice.get_points(1000, 1500, points_skip);
+  Dakota::RealMatrix points_blocks(dimension, 4096);
+  lattice.get_points_parallel(0, 4096, points_blocks, 7);
+
+  for ( size_t col = 0; col < dimension; col++ )
+  {
+    for ( size_t row = 0; row < 500; row++ )
+    {
+      EXPECT_EQ(points_skip[row][col], points[1000 + row][col]);
+    }
+    for ( size_t row = 0; row < 4096; row++ )
+    {
+      EXPECT_EQ(points_blocks[row][col], points[row][col]);
+    }
+  }
+
+  // Blocks from block_range cover the points exactly once
+  size_t covered = 0, previous_end = 100;
+  for ( size_t block = 0; block < 5; block++ )
+  {
+    auto range = Dakota::LowDiscrepancySequence::block_range(100, 1123, block, 5);
+    EXPECT_EQ(range.first, previous_end);
+    covered += range.second - range.first;
+    previous_end = range.second;
+  }
+  EXPECT_EQ(covered, 1023);
+}
+
+// +-------------------------------------------------------------------------+
+// |                     Points-per-second lattice benchmark                 |
+// +-------------------------------------------------------------------------+
+/// The number of points defaults to 2^19 and may be changed through the
+/// DAKOTA_LD_BENCH_POINTS environment variable
+TEST(rank_1_lattice_tests, benchmark_lattice_points)
+{
+  size_t numPoints = size_t(1) << 19, dimension = 16;
+  if ( const char* env_points = std::getenv("DAKOTA_LD_BENCH_POINTS") )
+  {
+    numPoints = std::strtoul(env_points, nullptr, 10);
+  }
+  size_t nMin = size_t(1) << 19;
+
+  Dakota::Rank1Lattice lattice(17);
+  Dakota::RealMatrix points(dimension, numPoints);
+  Dakota::RealMatrix points_blocks(dimension, numPoints);
+  auto t0 = std::chrono::steady_clock::now();
+  lattice.get_points(nMin, nMin + numPoints, points);
+  auto t1 = std::chrono::steady_clock::now();
+  lattice.get_points_parallel(nMin, nMin + numPoints, points_blocks);
+  auto t2 = std::chrono::steady_clock::now();
+  EXPECT_EQ(points_blocks[numPoints - 1][dimension - 1],
+    points[numPoints - 1][dimension - 1]);
+
+  typedef std::chrono::duration<double> sec;
+  std::cout << "Rank-1 lattice benchmark (" << numPoints << " points from "
+    << "index " << nMin << ", " << dimension << " dimensions):"
+    << "\n  serial:    " << numPoints / sec(t1 - t0).count() << " points/s"
+    << "\n  parallel:  " << numPoints / sec(t2 - t1).count() << " points/s"
+    << std::endl;
+}
+
 } // end namespace TestRank1Lattice
 
 } // end namespace TestLowDiscrepancy
@@ -8,6 +8,8 @@
     _______________________________________________________________________ */
 
 #include "OutputManager.hpp"
+#include "BoundedPRPCache.hpp"
+#include "IndexedRestart.hpp"
 #include "ParamResponsePair.hpp"
 #include "RestartVersion.hpp"
 #include "SimulationResponse.hpp"
@@ -18,6 +20,7 @@
 
 #include <gtest/gtest.h>
 #include <filesystem>
+#include <sstream>
 #include <cmath>
 
 #ifndef M_PI
@@ -336,6 +339,204 @@ TEST(restart_test_tests, test_io_restart_read_newfile)
   std::filesystem::remove(rst_filename);
 }
 
+/// read all PRPs from an indexed restart file
+PRPArray read_indexed_prps(const IndexedRestartReader& reader)
+{
+  PRPArray prps_in;
+  for (size_t i=0; i<reader.num_records(); ++i) {
+    ParamResponsePair prp_in;
+    reader.read_record(i, prp_in);
+    prps_in.push_back(prp_in);
+  }
+  return prps_in;
+}
+
+// Write an indexed file across several chunks, reopen it for append
+// without rewriting, and read back all records
+TEST(restart_test_tests, test_io_restart_indexed_append)
+{
+  std::string rst_filename("indexed.rst");
+  std::filesystem::remove(rst_filename);
+
+  const int num_evals = 10;
+  RestartVersion rst_ver("6.16.0+", "a1b2c3d4e5f6");
+  PRPArray prps_out;
+  {
+    const size_t chunk_records = 4;
+    RestartWriter rst_writer(std::unique_ptr<IndexedRestartWriter>(
+      new IndexedRestartWriter(rst_filename, rst_ver, chunk_records)));
+    prps_out = generate_and_write_prps(num_evals, rst_writer);
+  }
+  EXPECT_TRUE(IndexedRestart::is_indexed_restart(rst_filename));
+
+  {
+    IndexedRestartReader reader(rst_filename);
+    EXPECT_TRUE(reader.clean_close());
+    EXPECT_EQ(reader.restart_version().dakotaSHA1, "a1b2c3d4e5f6");
+    EXPECT_EQ(reader.num_records(), (size_t)num_evals);
+    EXPECT_TRUE((read_indexed_prps(reader) == prps_out));
+
+    // append a second batch in place
+    RestartWriter rst_writer(std::unique_ptr<IndexedRestartWriter>(
+      new IndexedRestartWriter(rst_filename, reader)));
+    PRPArray more_prps = generate_minimal_prps(3, rst_writer);
+    prps_out.insert(prps_out.end(), more_prps.begin(), more_prps.end());
+  }
+
+  {
+    IndexedRestartReader reader(rst_filename);
+    EXPECT_TRUE(reader.clean_close());
+    EXPECT_EQ(reader.num_records(), (size_t)num_evals + 3);
+    EXPECT_EQ(reader.record_eval_id(num_evals), 1);
+    EXPECT_TRUE((read_indexed_prps(reader) == prps_out));
+  }
+
+  std::filesystem::remove(rst_filename);
+}
+
+// Recover the complete records of an indexed file whose trailing index
+// and last record were torn by an abnormal exit, then resume appending
+TEST(restart_test_tests, test_io_restart_indexed_torn_tail)
+{
+  std::string rst_filename("indexed_torn.rst");
+  std::filesystem::remove(rst_filename);
+
+  const int num_evals = 6;
+  RestartVersion rst_ver("6.16.0+", "a1b2c3d4e5f6");
+  PRPArray prps_out;
+  {
+    RestartWriter rst_writer(std::unique_ptr<IndexedRestartWriter>(
+      new IndexedRestartWriter(rst_filename, rst_ver)));
+    prps_out = generate_minimal_prps(num_evals, rst_writer);
+  }
+
+  // chop the final index and part of the last record
+  size_t last_frame;
+  {
+    IndexedRestartReader reader(rst_filename);
+    last_frame = reader.record_frame_offset(num_evals - 1);
+  }
+  std::filesystem::resize_file(rst_filename, last_frame + 10);
+  prps_out.pop_back();
+
+  {
+    IndexedRestartReader reader(rst_filename);
+    EXPECT_FALSE(reader.clean_close());
+    EXPECT_EQ(reader.valid_length(), last_frame);
+    EXPECT_EQ(reader.num_records(), (size_t)num_evals - 1);
+    EXPECT_TRUE((read_indexed_prps(reader) == prps_out));
+
+    RestartWriter rst_writer(std::unique_ptr<IndexedRestartWriter>(
+      new IndexedRestartWriter(rst_filename, reader)));
+    PRPArray more_prps = generate_minimal_prps(2, rst_writer);
+    prps_out.insert(prps_out.end(), more_prps.begin(), more_prps.end());
+  }
+
+  {
+    IndexedRestartReader reader(rst_filename);
+    EXPECT_TRUE(reader.clean_close());
+    EXPECT_EQ(reader.num_records(), (size_t)num_evals + 1);
+    EXPECT_TRUE((read_indexed_prps(reader) == prps_out));
+  }
+
+  std::filesystem::remove(rst_filename);
+}
+
+// Spill least recently used records of a memory-bounded cache to disk and
+// restore them on lookup
+TEST(restart_test_tests, test_io_restart_bounded_cache_spill)
+{
+  std::string spill_filename("bounded_cache.spill");
+  std::filesystem::remove(spill_filename);
+
+  const int num_evals = 20;
+  std::ostringstream rst_stream;
+  RestartWriter rst_writer(rst_stream);
+  PRPArray prps_out = generate_and_write_prps(num_evals, rst_writer);
+
+  const size_t num_resident = 5;
+  PRPCache prp_cache;
+  {
+    BoundedPRPCache bounded_cache;
+    bounded_cache.initialize(
+      num_resident * BoundedPRPCache::record_bytes(prps_out[0]),
+      spill_filename);
+    for (const ParamResponsePair& prp : prps_out)
+      bounded_cache.insert(prp_cache, prp);
+    EXPECT_EQ(prp_cache.size(), num_resident);
+    EXPECT_EQ(bounded_cache.evictions(), num_evals - num_resident);
+
+    // the first record was spilled; a lookup restores it intact
+    const ParamResponsePair& first = prps_out[0];
+    PRPCacheHIter it = bounded_cache.lookup_by_val(prp_cache,
+      first.interface_id(), first.variables(), first.active_set());
+    ASSERT_TRUE(it != prp_cache.get<hashed>().end());
+    EXPECT_TRUE(*it == first);
+    EXPECT_EQ(bounded_cache.restorations(), (size_t)1);
+    EXPECT_EQ(prp_cache.size(), num_resident);
+
+    // a subset of the active set matches a spilled record
+    const ParamResponsePair& second = prps_out[1];
+    ActiveSet fn_set(second.active_set());
+    fn_set.request_values(1);
+    it = bounded_cache.lookup_by_val(prp_cache, second.interface_id(),
+				     second.variables(), fn_set);
+    ASSERT_TRUE(it != prp_cache.get<hashed>().end());
+    EXPECT_EQ(it->eval_id(), second.eval_id());
+    EXPECT_TRUE(std::filesystem::exists(spill_filename));
+  }
+  EXPECT_FALSE(std::filesystem::exists(spill_filename));
+}
+
+// A restored record updated in the cache is spilled again with its
+// current contents rather than its previous spill
+TEST(restart_test_tests, test_io_restart_bounded_cache_respill_updated)
+{
+  std::string spill_filename("bounded_cache_respill.spill");
+  std::filesystem::remove(spill_filename);
+
+  const int num_evals = 20;
+  std::ostringstream rst_stream;
+  RestartWriter rst_writer(rst_stream);
+  PRPArray prps_out = generate_and_write_prps(num_evals, rst_writer);
+
+  const size_t num_resident = 5;
+  PRPCache prp_cache;
+  {
+    BoundedPRPCache bounded_cache;
+    bounded_cache.initialize(
+      num_resident * BoundedPRPCache::record_bytes(prps_out[0]),
+      spill_filename);
+    for (const ParamResponsePair& prp : prps_out)
+      bounded_cache.insert(prp_cache, prp);
+
+    // restore the first record and update its response in place
+    const ParamResponsePair& first = prps_out[0];
+    PRPCacheHIter it = bounded_cache.lookup_by_val(prp_cache,
+      first.interface_id(), first.variables(), first.active_set());
+    ASSERT_TRUE(it != prp_cache.get<hashed>().end());
+    Response updated_resp = it->response(); // shared rep
+    Real updated_fn = first.response().function_value(0) + 1.;
+    updated_resp.function_value(updated_fn, 0);
+
+    // restoring num_resident other records evicts the first one again
+    for (size_t i=1; i<=num_resident; ++i) {
+      const ParamResponsePair& prp = prps_out[i];
+      ASSERT_TRUE(bounded_cache.lookup_by_val(prp_cache, prp.interface_id(),
+	prp.variables(), prp.active_set()) != prp_cache.get<hashed>().end());
+    }
+    ASSERT_TRUE(prp_cache.get<ordered>().find(first.eval_interface_ids())
+		== prp_cache.get<ordered>().end());
+
+    // the second restoration returns the updated record
+    it = bounded_cache.lookup_by_val(prp_cache, first.interface_id(),
+				     first.variables(), first.active_set());
+    ASSERT_TRUE(it != prp_cache.get<hashed>().end());
+    EXPECT_EQ(it->response().function_value(0), updated_fn);
+  }
+  EXPECT_FALSE(std::filesystem::exists(spill_filename));
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
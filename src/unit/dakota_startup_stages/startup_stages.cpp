@@ -0,0 +1,131 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "dakota_parser.hpp"
+#include "ast_to_json.hpp"
+#include "dakota_validation_metadata.hpp"
+#include "InstructionMaterializer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Dakota;
+
+namespace {
+
+/// Freeform study with num_vars variables of each of three kinds:
+/// continuous design with bounds and descriptors, integer design sets of
+/// three elements, and three-pair bin histograms
+std::string make_large_input(size_t num_vars)
+{
+  std::ostringstream in;
+  in << "environment\n"
+     << "method\n  sampling\n    samples = 10\n"
+     << "variables\n"
+     << "  continuous_design = " << num_vars << "\n    lower_bounds =";
+  for (size_t i = 0; i < num_vars; ++i)
+    in << " " << -1.0 - 0.001*i;
+  in << "\n    upper_bounds =";
+  for (size_t i = 0; i < num_vars; ++i)
+    in << " " << 1.0 + 0.001*i;
+  in << "\n    descriptors =";
+  for (size_t i = 0; i < num_vars; ++i)
+    in << " 'x" << i << "'";
+
+  in << "\n  discrete_design_set\n    integer = " << num_vars
+     << "\n      elements_per_variable =";
+  for (size_t i = 0; i < num_vars; ++i)
+    in << " 3";
+  in << "\n      elements =";
+  for (size_t i = 0; i < num_vars; ++i)
+    in << " " << i << " " << i+1 << " " << i+2;
+
+  in << "\n  histogram_bin_uncertain = " << num_vars
+     << "\n    pairs_per_variable =";
+  for (size_t i = 0; i < num_vars; ++i)
+    in << " 3";
+  in << "\n    abscissas =";
+  for (size_t i = 0; i < num_vars; ++i)
+    in << " " << i << " " << i+1 << " " << i+2;
+  in << "\n    counts =";
+  for (size_t i = 0; i < num_vars; ++i)
+    in << " 1 3 0";
+
+  in << "\ninterface\n  direct\n    analysis_driver = 'text_book'\n"
+     << "responses\n  response_functions = 1\n  no_gradients\n  no_hessians\n";
+  return in.str();
+}
+
+}
+
+//------------------------------------
+
+/// Startup benchmark on a generated large input, timed per stage of the
+/// freeform pipeline: DSL parse to AST, AST validation/semantics/default
+/// expansion, AST to JSON, JSON validation, and IR materialization.  The
+/// number of variables of each kind may be set through the
+/// DAKOTA_STARTUP_BENCH_VARIABLES environment variable.
+TEST(startup_stages_tests, benchmark_large_input_stages)
+{
+  size_t num_vars = 10000;
+  if (const char* env_vars = std::getenv("DAKOTA_STARTUP_BENCH_VARIABLES"))
+    num_vars = std::strtoul(env_vars, nullptr, 10);
+
+  const std::string input = make_large_input(num_vars);
+
+  auto t0 = std::chrono::steady_clock::now();
+  dakota::Document doc;
+  ASSERT_TRUE(dakota::parse_dakota_string(input, "<startup-bench>", doc));
+  auto t1 = std::chrono::steady_clock::now();
+  ASSERT_TRUE(dakota::validate_document(doc));
+  ASSERT_TRUE(dakota::analyze_semantics(doc));
+  ASSERT_TRUE(dakota::expand_defaults(doc));
+  auto t2 = std::chrono::steady_clock::now();
+  nlohmann::json study = dakota::ast_to_json(doc);
+  auto t3 = std::chrono::steady_clock::now();
+  std::vector<std::string> errors;
+  ASSERT_EQ(0, dakota::validation_metadata::validate_json_document(study,
+                                                                  errors));
+  auto t4 = std::chrono::steady_clock::now();
+  const IRState state = InstructionMaterializer().materialize(study);
+  auto t5 = std::chrono::steady_clock::now();
+
+  ASSERT_EQ(1, state.variables.size());
+  const IRStore& vars = state.variables[0];
+  EXPECT_EQ(num_vars, vars.get<RealVector>(
+    irgen::IRKey::variables_continuous_design_lower_bounds).length());
+  EXPECT_EQ(num_vars, vars.get<StringArray>(
+    irgen::IRKey::variables_continuous_design_labels).size());
+  const auto& sets = vars.get<IntSetArray>(
+    irgen::IRKey::variables_discrete_design_set_int_values);
+  ASSERT_EQ(num_vars, sets.size());
+  EXPECT_EQ(IntSet({0, 1, 2}), sets[0]);
+  const auto& bins = vars.get<RealRealMapArray>(
+    irgen::IRKey::variables_histogram_uncertain_bin_pairs);
+  ASSERT_EQ(num_vars, bins.size());
+  ASSERT_EQ(3, bins.back().size());
+  EXPECT_DOUBLE_EQ(0.25, bins.back().begin()->second);
+
+  typedef std::chrono::duration<double, std::milli> msec;
+  std::cout << "Startup benchmark (" << num_vars << " variables of each of "
+            << "3 kinds, " << input.size() << " input bytes):"
+            << "\n  parse DSL to AST:          " << msec(t1 - t0).count() << " ms"
+            << "\n  AST checks and defaults:   " << msec(t2 - t1).count() << " ms"
+            << "\n  AST to JSON:               " << msec(t3 - t2).count() << " ms"
+            << "\n  JSON validation:           " << msec(t4 - t3).count() << " ms"
+            << "\n  IR materialization:        " << msec(t5 - t4).count() << " ms"
+            << "\n  total:                     " << msec(t5 - t0).count() << " ms"
+            << std::endl;
+}
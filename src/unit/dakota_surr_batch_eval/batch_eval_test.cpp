@@ -0,0 +1,185 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+#include "DakotaResponse.hpp"
+#include "DakotaVariables.hpp"
+
+#include <cmath>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace Dakota;
+
+namespace Dakota {
+  extern PRPCache data_pairs;
+}
+
+namespace {
+
+  /// Dakota input: a global surrogate of text_book built from LHS
+  /// samples, evaluated once by a list parameter study
+  std::string surrogate_input(const std::string& approx_spec)
+  {
+    return
+      "environment \n"
+      "  method_pointer 'EvalSurrogate' \n"
+      "method \n"
+      "  id_method 'EvalSurrogate' \n"
+      "  model_pointer 'SURROGATE' \n"
+      "  list_parameter_study \n"
+      "    list_of_points 0.5 0.5 \n"
+      "  output silent \n"
+      "model \n"
+      "  id_model 'SURROGATE' \n"
+      "  surrogate global \n"
+      "    dace_method_pointer 'SAMPLING' \n"
+      "    " + approx_spec + " \n"
+      "variables \n"
+      "  continuous_design 2 \n"
+      "    lower_bounds -2.0 -2.0 \n"
+      "    upper_bounds  2.0  2.0 \n"
+      "    descriptors  'x1' 'x2' \n"
+      "responses \n"
+      "  objective_functions 1 \n"
+      "  nonlinear_inequality_constraints 2 \n"
+      "  analytic_gradients \n"
+      "  no_hessians \n"
+      "method \n"
+      "  id_method 'SAMPLING' \n"
+      "  model_pointer 'TRUTH' \n"
+      "  sampling \n"
+      "    sample_type lhs \n"
+      "    samples 20 \n"
+      "    seed 531 \n"
+      "  output silent \n"
+      "model \n"
+      "  id_model 'TRUTH' \n"
+      "  single \n"
+      "interface \n"
+      "  direct \n"
+      "    analysis_driver 'text_book' \n";
+  }
+
+  /// Evaluate the built surrogate at a set of points, first one point at
+  /// a time through evaluate() and then as a queue of evaluate_nowait()
+  /// requests completed by a single synchronize(), which takes the batch
+  /// path of ApproximationInterface, and compare the responses.  Batch
+  /// prediction variances are compared as well if check_variances.
+  void check_batch_matches_per_point(const std::string& approx_spec,
+				     bool check_variances)
+  {
+    std::shared_ptr<LibraryEnvironment>
+      p_env(Opt_TPL_Test::create_env(surrogate_input(approx_spec)));
+    if (p_env->parallel_library().mpirun_flag())
+      FAIL(); // This test only works for serial builds
+    p_env->execute(); // builds the surrogate
+
+    ModelList surr_models = p_env->filtered_model_list("surrogate", "", "");
+    ASSERT_EQ(size_t(1), surr_models.size());
+    Model& surr_model = *surr_models.front();
+
+    const size_t num_pts = 5, num_fns = 3;
+    const Real pts[num_pts][2] =
+      { { 0.2, -0.3 }, { -1.1, 0.7 }, { 1.6, 1.4 }, { -0.4, -1.8 },
+	{ 0.9, 0.05 } };
+
+    // values and gradients with respect to all variables, and with respect
+    // to the second variable only, whose DVV does not match the
+    // continuous variable ids of the surrogate
+    ShortArray asv(num_fns, 3);
+    SizetArray full_dvv(2), sub_dvv(1);
+    full_dvv[0] = 1; full_dvv[1] = 2; sub_dvv[0] = 2;
+    std::vector<ActiveSet> sets;
+    sets.push_back(ActiveSet(asv, full_dvv));
+    sets.push_back(ActiveSet(asv, sub_dvv));
+
+    for (size_t s=0; s<sets.size(); ++s) {
+      const ActiveSet& set = sets[s];
+      size_t num_deriv_vars = set.derivative_vector().size();
+
+      std::vector<Response> per_point(num_pts);
+      for (size_t p=0; p<num_pts; ++p) {
+	RealVector c_vars(2);
+	c_vars[0] = pts[p][0]; c_vars[1] = pts[p][1];
+	surr_model.current_variables().continuous_variables(c_vars);
+	surr_model.evaluate(set);
+	per_point[p] = surr_model.current_response().copy();
+      }
+
+      for (size_t p=0; p<num_pts; ++p) {
+	RealVector c_vars(2);
+	c_vars[0] = pts[p][0]; c_vars[1] = pts[p][1];
+	surr_model.current_variables().continuous_variables(c_vars);
+	surr_model.evaluate_nowait(set);
+      }
+      const IntResponseMap& batch = surr_model.synchronize();
+      ASSERT_EQ(num_pts, batch.size());
+
+      size_t p = 0;
+      for (IntRespMCIter r_it=batch.begin(); r_it!=batch.end(); ++r_it, ++p) {
+	const Response& resp = r_it->second;
+	const RealMatrix& grads = resp.function_gradients();
+	const RealMatrix& pp_grads = per_point[p].function_gradients();
+	ASSERT_EQ(num_deriv_vars, size_t(grads.numRows()));
+	ASSERT_EQ(num_deriv_vars, size_t(pp_grads.numRows()));
+	for (size_t i=0; i<num_fns; ++i) {
+	  EXPECT_NEAR(per_point[p].function_value(i), resp.function_value(i),
+		      1.e-10 * (1. + std::fabs(per_point[p].function_value(i))));
+	  for (size_t j=0; j<num_deriv_vars; ++j)
+	    EXPECT_NEAR(pp_grads(j,i), grads(j,i),
+			1.e-10 * (1. + std::fabs(pp_grads(j,i))));
+	}
+      }
+    }
+
+    // prediction variances through the multi-point Model overload
+    if (check_variances) {
+      RealMatrix c_vars(2, num_pts);
+      for (size_t p=0; p<num_pts; ++p)
+	{ c_vars(0,p) = pts[p][0]; c_vars(1,p) = pts[p][1]; }
+      RealMatrix batch_variances;
+      surr_model.approximation_variances(surr_model.current_variables(),
+					 c_vars, batch_variances);
+      for (size_t p=0; p<num_pts; ++p) {
+	RealVector pt_c_vars(Teuchos::Copy, c_vars[p], 2);
+	surr_model.current_variables().continuous_variables(pt_c_vars);
+	const RealVector& pt_variances
+	  = surr_model.approximation_variances(surr_model.current_variables());
+	for (size_t i=0; i<num_fns; ++i)
+	  EXPECT_NEAR(pt_variances[i], batch_variances(i,p),
+		      1.e-10 * (1. + std::fabs(pt_variances[i])));
+      }
+    }
+
+    // Clear the cache
+    data_pairs.clear();
+  }
+
+}
+
+
+TEST(surr_batch_eval_tests, test_batch_matches_per_point_dakota_gp)
+{
+  check_batch_matches_per_point("gaussian_process dakota", true);
+}
+
+
+TEST(surr_batch_eval_tests, test_batch_matches_per_point_surfpack_poly)
+{
+  check_batch_matches_per_point("polynomial quadratic", false);
+}
+
+
+TEST(surr_batch_eval_tests, test_batch_matches_per_point_exp_poly)
+{
+  check_batch_matches_per_point("experimental_polynomial basis_order 2",
+				false);
+}
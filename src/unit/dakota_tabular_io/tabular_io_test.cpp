@@ -0,0 +1,237 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "dakota_tabular_io.hpp"
+#include "DakotaVariables.hpp"
+#include "SimulationResponse.hpp"
+#include "ParamResponsePair.hpp"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+using namespace Dakota;
+
+namespace {
+
+/// select the stream-based readers ("0") or the mapped readers with the
+/// given number of threads
+void set_read_threads(const char* num_threads)
+{
+#if defined(_WIN32) || defined(_WIN64)
+  _putenv_s("DAKOTA_TABULAR_READ_THREADS", num_threads);
+#else
+  setenv("DAKOTA_TABULAR_READ_THREADS", num_threads, 1);
+#endif
+}
+
+/// variables with two continuous, one discrete int, num_dsv discrete
+/// string, and one discrete real design variables
+Variables make_variables(size_t num_dsv)
+{
+  SizetArray vc_totals(NUM_VC_TOTALS, 0);
+  vc_totals[TOTAL_CDV]  = 2;
+  vc_totals[TOTAL_DDIV] = 1;
+  vc_totals[TOTAL_DDSV] = num_dsv;
+  vc_totals[TOTAL_DDRV] = 1;
+  std::pair<short, short> view(MIXED_ALL, EMPTY_VIEW);
+  SharedVariablesData svd(view, vc_totals);
+  return Variables(svd);
+}
+
+void expect_equal_matrices(const RealMatrix& a, const RealMatrix& b)
+{
+  ASSERT_EQ(a.numRows(), b.numRows());
+  ASSERT_EQ(a.numCols(), b.numCols());
+  for (int j=0; j<a.numCols(); ++j)
+    for (int i=0; i<a.numRows(); ++i)
+      EXPECT_EQ(a(i,j), b(i,j));
+}
+
+}
+
+//------------------------------------
+
+TEST(tabular_io_tests, test_mapped_matrix_matches_stream)
+{
+  // annotated, with blank lines, CRLF, and a record split across lines
+  {
+    std::ofstream tab_file("tabular_io_records.dat");
+    tab_file << "%eval_id interface x1 x2 x3\n"
+	     << "1 NO_ID 1.5 -2e-3 +7\n\n"
+	     << "  2 EMPTY .25 3 -0.125\r\n"
+	     << "3 IFACE 1e300\n 4. 5\n";
+  }
+  // freeform rows for the sized reader, with extra trailing data
+  {
+    std::ofstream tab_file("tabular_io_sized.dat");
+    tab_file << "1 0.5 0.25\n2 1.5 1.25\n3 2.5 2.25\n4 3.5 3.25\n";
+  }
+
+  RealMatrix stream_records, stream_sized;
+  set_read_threads("0");
+  TabularIO::read_data_tabular("tabular_io_records.dat", "test",
+			       stream_records, 3, TABULAR_ANNOTATED);
+  TabularIO::read_data_tabular("tabular_io_sized.dat", "test", stream_sized,
+			       3, 2, TABULAR_EVAL_ID);
+  EXPECT_EQ(stream_records.numRows(), 3);
+  EXPECT_EQ(stream_records.numCols(), 3);
+  EXPECT_EQ(stream_records(2,0), 7.);
+  EXPECT_EQ(stream_sized(2,1), 2.25);
+
+  for (const char* num_threads : { "1", "2", "5" }) {
+    set_read_threads(num_threads);
+    RealMatrix mapped_records, mapped_sized;
+    TabularIO::read_data_tabular("tabular_io_records.dat", "test",
+				 mapped_records, 3, TABULAR_ANNOTATED);
+    TabularIO::read_data_tabular("tabular_io_sized.dat", "test", mapped_sized,
+				 3, 2, TABULAR_EVAL_ID);
+    expect_equal_matrices(mapped_records, stream_records);
+    expect_equal_matrices(mapped_sized, stream_sized);
+  }
+
+  std::remove("tabular_io_records.dat");
+  std::remove("tabular_io_sized.dat");
+}
+
+//------------------------------------
+
+TEST(tabular_io_tests, test_mapped_prp_matches_stream)
+{
+  {
+    std::ofstream tab_file("tabular_io_prp.dat");
+    for (int i=0; i<40; ++i)
+      tab_file << 10+i << (i % 3 ? " IFACE_A " : " EMPTY ") << 0.5*i << ' '
+	       << -1.e-3*i << ' ' << i-20 << " s" << i % 4 << ' ' << 2.5*i
+	       << ' ' << i*i << ' ' << (i % 5 ? "1.25" : "N/A") << '\n';
+  }
+
+  unsigned short tabular_format = TABULAR_EVAL_ID | TABULAR_IFACE_ID;
+  ActiveSet as(2, 5); as.request_values(1);
+  PRPList stream_prps;
+  set_read_threads("0");
+  TabularIO::read_data_tabular("tabular_io_prp.dat", "test",
+			       make_variables(1),
+			       Response(SIMULATION_RESPONSE, as), stream_prps,
+			       tabular_format);
+  ASSERT_EQ(stream_prps.size(), 40u);
+
+  for (const char* num_threads : { "1", "3" }) {
+    set_read_threads(num_threads);
+    PRPList mapped_prps;
+    TabularIO::read_data_tabular("tabular_io_prp.dat", "test",
+				 make_variables(1),
+				 Response(SIMULATION_RESPONSE, as),
+				 mapped_prps, tabular_format);
+    ASSERT_EQ(mapped_prps.size(), stream_prps.size());
+    auto s_it = stream_prps.begin();
+    for (auto m_it=mapped_prps.begin(); m_it!=mapped_prps.end();
+	 ++m_it, ++s_it) {
+      EXPECT_EQ(m_it->eval_id(), s_it->eval_id());
+      EXPECT_EQ(m_it->interface_id(), s_it->interface_id());
+      EXPECT_TRUE(m_it->variables() == s_it->variables());
+      EXPECT_EQ(m_it->variables().all_discrete_string_variables()[0],
+		s_it->variables().all_discrete_string_variables()[0]);
+      EXPECT_TRUE(m_it->response().function_values() ==
+		  s_it->response().function_values());
+    }
+  }
+
+  std::remove("tabular_io_prp.dat");
+}
+
+//------------------------------------
+
+TEST(tabular_io_tests, test_mapped_vars_resp_matches_stream)
+{
+  {
+    std::ofstream tab_file("tabular_io_vars_resp.dat");
+    for (int i=0; i<25; ++i)
+      tab_file << i+1 << ' ' << 0.5*i << ' ' << -1.e-3*i << ' ' << i-20
+	       << ' ' << 2.5*i << ' ' << i*i << '\n';
+  }
+
+  RealMatrix stream_vars, stream_resp;
+  set_read_threads("0");
+  TabularIO::read_data_tabular("tabular_io_vars_resp.dat", "test",
+			       make_variables(0), 1, stream_vars, stream_resp,
+			       TABULAR_EVAL_ID);
+  EXPECT_EQ(stream_vars.numRows(), 25);
+  EXPECT_EQ(stream_vars.numCols(), 4);
+
+  for (const char* num_threads : { "1", "4" }) {
+    set_read_threads(num_threads);
+    RealMatrix mapped_vars, mapped_resp;
+    TabularIO::read_data_tabular("tabular_io_vars_resp.dat", "test",
+				 make_variables(0), 1, mapped_vars, mapped_resp,
+				 TABULAR_EVAL_ID);
+    expect_equal_matrices(mapped_vars, stream_vars);
+    expect_equal_matrices(mapped_resp, stream_resp);
+  }
+
+  std::remove("tabular_io_vars_resp.dat");
+}
+
+//------------------------------------
+
+/// Throughput benchmark for reading build points into a RealMatrix.  The
+/// number of rows defaults to 2 x 10^5 and may be raised (e.g., to 2 x
+/// 10^6) through the DAKOTA_TABULAR_BENCH_ROWS environment variable.
+TEST(tabular_io_tests, benchmark_tabular_read)
+{
+  size_t num_rows = 200000, num_cols = 10;
+  if (const char* env_rows = std::getenv("DAKOTA_TABULAR_BENCH_ROWS"))
+    num_rows = std::strtoul(env_rows, nullptr, 10);
+
+  {
+    std::ofstream tab_file("tabular_io_bench.dat");
+    tab_file << std::setprecision(write_precision);
+    tab_file << "%eval_id interface";
+    for (size_t j=0; j<num_cols; ++j)
+      tab_file << " x" << j+1;
+    tab_file << '\n';
+    for (size_t i=0; i<num_rows; ++i) {
+      tab_file << i+1 << " NO_ID";
+      for (size_t j=0; j<num_cols; ++j)
+	tab_file << ' ' << std::sin(1.e-3*i + j);
+      tab_file << '\n';
+    }
+  }
+
+  typedef std::chrono::duration<double> sec;
+  RealMatrix stream_matrix, serial_matrix, parallel_matrix;
+  set_read_threads("0");
+  auto t0 = std::chrono::steady_clock::now();
+  TabularIO::read_data_tabular("tabular_io_bench.dat", "bench", stream_matrix,
+			       num_cols, TABULAR_ANNOTATED);
+  auto t1 = std::chrono::steady_clock::now();
+  set_read_threads("1");
+  TabularIO::read_data_tabular("tabular_io_bench.dat", "bench", serial_matrix,
+			       num_cols, TABULAR_ANNOTATED);
+  auto t2 = std::chrono::steady_clock::now();
+  set_read_threads("4");
+  TabularIO::read_data_tabular("tabular_io_bench.dat", "bench",
+			       parallel_matrix, num_cols, TABULAR_ANNOTATED);
+  auto t3 = std::chrono::steady_clock::now();
+
+  expect_equal_matrices(serial_matrix, stream_matrix);
+  expect_equal_matrices(parallel_matrix, stream_matrix);
+  std::cout << "Tabular read benchmark (" << num_rows << " rows, " << num_cols
+	    << " columns):"
+	    << "\n  stream:             " << sec(t1 - t0).count() << " s"
+	    << "\n  mapped, 1 thread:   " << sec(t2 - t1).count() << " s"
+	    << "\n  mapped, 4 threads:  " << sec(t3 - t2).count() << " s"
+	    << std::endl;
+
+  std::remove("tabular_io_bench.dat");
+}
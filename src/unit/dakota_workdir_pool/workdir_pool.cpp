@@ -0,0 +1,162 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2025
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "WorkdirPool.hpp"
+#include "WorkdirHelper.hpp"
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+using namespace Dakota;
+namespace fs = std::filesystem;
+
+namespace {
+
+/// write contents to path
+void write_file(const fs::path& path, const String& contents)
+{ std::ofstream out(path); out << contents; }
+
+/// contents of path
+String read_file(const fs::path& path)
+{
+  std::ifstream in(path);
+  return String(std::istreambuf_iterator<char>(in),
+		std::istreambuf_iterator<char>());
+}
+
+/// template directory with a file, a read-only file, and a subdirectory
+class WorkdirPoolTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    root = fs::temp_directory_path() /
+      ("dakota_workdir_pool_" + std::to_string(::testing::UnitTest::
+       GetInstance()->random_seed()) + "_" + ::testing::UnitTest::
+       GetInstance()->current_test_info()->name());
+    fs::remove_all(root);
+    fs::create_directories(root / "template" / "mesh");
+    write_file(root / "template" / "input.txt", "input");
+    write_file(root / "template" / "mesh" / "grid.dat", "grid");
+    write_file(root / "template" / "table.dat", "table");
+    fs::permissions(root / "template" / "table.dat",
+		    fs::perms::owner_read | fs::perms::group_read);
+  }
+  void TearDown() override
+  {
+    fs::permissions(root / "template" / "table.dat", fs::perms::owner_all);
+    fs::remove_all(root);
+  }
+
+  StringArray copy_files() const
+  {
+    return StringArray{ (root / "template" / "input.txt").string(),
+			(root / "template" / "mesh").string(),
+			(root / "template" / "table.dat").string() };
+  }
+
+  fs::path root;
+};
+
+}
+
+//------------------------------------
+
+TEST_F(WorkdirPoolTest, test_slots_are_reset_and_reused)
+{
+  fs::path slot1, slot2;
+  {
+    WorkdirPool pool(root / "workdir", copy_files(), StringArray());
+    slot1 = pool.acquire();
+    slot2 = pool.acquire();
+    EXPECT_NE(slot1, slot2);
+    EXPECT_TRUE(slot1.is_absolute());
+    EXPECT_EQ("input", read_file(slot1 / "input.txt"));
+    EXPECT_EQ("grid", read_file(slot1 / "mesh" / "grid.dat"));
+    // a file no one may write is shared rather than copied
+    EXPECT_TRUE(fs::equivalent(root / "template" / "table.dat",
+			       slot1 / "table.dat"));
+    EXPECT_FALSE(fs::equivalent(root / "template" / "input.txt",
+				slot1 / "input.txt"));
+
+    // an evaluation writes outputs, modifies and removes template files
+    write_file(slot1 / "results.out", "1.0");
+    fs::create_directory(slot1 / "scratch");
+    write_file(slot1 / "scratch" / "log", "log");
+    write_file(slot1 / "input.txt", "modified input");
+    fs::remove(slot1 / "mesh" / "grid.dat");
+    pool.release(slot1);
+
+    // the next evaluation gets the same directory, restored
+    fs::path reused = pool.acquire();
+    EXPECT_EQ(slot1, reused);
+    EXPECT_EQ(2, pool.num_slots());
+    EXPECT_FALSE(fs::exists(slot1 / "results.out"));
+    EXPECT_FALSE(fs::exists(slot1 / "scratch"));
+    EXPECT_EQ("input", read_file(slot1 / "input.txt"));
+    EXPECT_EQ("grid", read_file(slot1 / "mesh" / "grid.dat"));
+    EXPECT_EQ("input", read_file(root / "template" / "input.txt"));
+    EXPECT_TRUE(pool.contains(slot1));
+    EXPECT_FALSE(pool.contains(root / "template"));
+  }
+  // the pool removes its directories
+  EXPECT_FALSE(fs::exists(slot1));
+  EXPECT_FALSE(fs::exists(slot2));
+}
+
+
+TEST_F(WorkdirPoolTest, test_unmodified_template_items_are_kept)
+{
+  WorkdirPool pool(root / "workdir", copy_files(), StringArray());
+  fs::path slot = pool.acquire();
+  fs::file_time_type input_time = fs::last_write_time(slot / "input.txt");
+  write_file(slot / "mesh" / "grid.dat", "other");
+  pool.release(slot);
+
+  EXPECT_EQ(slot, pool.acquire());
+  // the untouched file is not copied again; the modified item is
+  EXPECT_EQ(input_time, fs::last_write_time(slot / "input.txt"));
+  EXPECT_EQ("grid", read_file(slot / "mesh" / "grid.dat"));
+}
+
+
+TEST_F(WorkdirPoolTest, test_links_and_stale_directories)
+{
+  // a directory left over from an earlier run is replaced
+  fs::create_directories(root / "workdir.slot1");
+  write_file(root / "workdir.slot1" / "stale", "stale");
+
+  WorkdirPool pool(root / "workdir", StringArray(),
+		   StringArray{ (root / "template" / "mesh").string() });
+  fs::path slot = pool.acquire();
+  EXPECT_EQ(root / "workdir.slot1", slot);
+  EXPECT_FALSE(fs::exists(slot / "stale"));
+  EXPECT_TRUE(fs::is_symlink(slot / "mesh"));
+
+  // replacing the link is detected and undone
+  fs::remove(slot / "mesh");
+  fs::create_directory(slot / "mesh");
+  pool.release(slot);
+  EXPECT_EQ(slot, pool.acquire());
+  EXPECT_TRUE(fs::is_symlink(slot / "mesh"));
+  EXPECT_EQ("grid", read_file(slot / "mesh" / "grid.dat"));
+}
+
+
+TEST_F(WorkdirPoolTest, test_copy_items_does_not_share_read_only_files)
+{
+  // outside a recycled directory, even a file no one may write is copied
+  fs::create_directory(root / "workdir");
+  WorkdirHelper::copy_items(copy_files(), root / "workdir", false);
+  EXPECT_EQ("table", read_file(root / "workdir" / "table.dat"));
+  EXPECT_FALSE(fs::equivalent(root / "template" / "table.dat",
+			      root / "workdir" / "table.dat"));
+  fs::permissions(root / "workdir" / "table.dat", fs::perms::owner_all);
+}
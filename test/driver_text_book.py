@@ -207,3 +207,34 @@ def text_book_batch(list_of_params):
         else:
             retvals.append(text_book_numpy(param_dict))
     return retvals
+
+
+def text_book_columnar(batch):
+    # one row per evaluation; all responses are computed for every row
+    # and Dakota keeps those requested by each row of batch["asv"]
+    x = batch["cv"]
+    num_evals, num_vars = x.shape
+    num_fns = batch["functions"]
+
+    fns = np.zeros((num_evals, num_fns))
+    grads = np.zeros((num_evals, num_fns, num_vars))
+    hessians = np.zeros((num_evals, num_fns, num_vars, num_vars))
+    diag = np.arange(num_vars)
+
+    fns[:, 0] = np.sum((x - 1.)**4, axis=1)
+    grads[:, 0, :] = 4. * (x - 1.)**3
+    hessians[:, 0, diag, diag] = 12. * (x - 1.)**2
+
+    if num_fns == 3:
+        fns[:, 1] = x[:, 0] * x[:, 0] - x[:, 1] / 2.0
+        grads[:, 1, 0] = 2.0 * x[:, 0]
+        grads[:, 1, 1] = -0.5
+        hessians[:, 1, 0, 0] = 2.0
+
+        fns[:, 2] = x[:, 1] * x[:, 1] - x[:, 0] / 2.0
+        grads[:, 2, 0] = -0.5
+        grads[:, 2, 1] = 2.0 * x[:, 1]
+        hessians[:, 2, 1, 1] = 2.0
+
+    return {"fns": fns, "fnGrads": grads, "fnHessians": hessians,
+            "metadata": np.tile([5., 10.], (num_evals, 1))}